@@ -509,1132 +509,1214 @@ unsigned char wxMathML_lisp_gz[] = {
   0xfe, 0x33, 0x0c, 0xe6, 0x8f, 0x21, 0x88, 0x60, 0x26, 0x0e, 0xc4, 0xe1,
   0xe1, 0x61, 0x28, 0x28, 0x4a, 0x69, 0xec, 0xe6, 0x6b, 0x7c, 0xd1, 0x9b,
   0x43, 0x1c, 0x53, 0x92, 0xfc, 0x96, 0x5e, 0x86, 0xaf, 0x50, 0x04, 0xf2,
-  0x70, 0xf9, 0x7f, 0xed, 0x7d, 0x7b, 0x9f, 0x1b, 0xb7, 0x91, 0xe0, 0xdf,
-  0xa3, 0x4f, 0x81, 0xa3, 0xc8, 0x0c, 0x29, 0x0f, 0x47, 0x9a, 0x51, 0xb2,
-  0xbb, 0x19, 0xc9, 0x5a, 0x3b, 0x89, 0x93, 0xf5, 0xad, 0x9d, 0xe8, 0x62,
-  0xe7, 0xb2, 0xb7, 0x49, 0x4c, 0x37, 0xc9, 0xe6, 0xb0, 0xa3, 0x26, 0x9b,
-  0xee, 0x6e, 0xce, 0xc3, 0xab, 0xe8, 0xb3, 0x5f, 0x3d, 0x50, 0x78, 0x35,
-  0xfa, 0x31, 0xb2, 0xe2, 0xdf, 0xdd, 0xfe, 0xe2, 0xcd, 0x6a, 0x9a, 0xdd,
-  0x85, 0x42, 0x01, 0x28, 0x14, 0x0a, 0x85, 0x42, 0xd5, 0xb9, 0x1a, 0xfd,
-  0x65, 0x84, 0xc1, 0x46, 0x40, 0x20, 0xc2, 0xba, 0x05, 0x34, 0xcd, 0x46,
-  0x61, 0x0b, 0x59, 0xe5, 0x61, 0xd1, 0x4d, 0xf6, 0x31, 0xd1, 0x2d, 0x8c,
-  0x1b, 0x54, 0x29, 0xab, 0xb0, 0xac, 0x72, 0x22, 0xb2, 0xcc, 0x22, 0x65,
-  0x15, 0x9a, 0xce, 0x85, 0x06, 0x70, 0x51, 0x35, 0x8d, 0x8e, 0xe0, 0xd2,
-  0xb4, 0x5e, 0x0d, 0x44, 0xe2, 0x2c, 0x57, 0x11, 0xfd, 0xff, 0xc4, 0xf1,
-  0x07, 0x38, 0x31, 0x4b, 0x16, 0x1f, 0x94, 0xfe, 0x16, 0xc3, 0xbd, 0xe8,
-  0x63, 0xd2, 0x8e, 0x23, 0xd2, 0x9b, 0x0c, 0xb7, 0x3c, 0xe4, 0xa7, 0x70,
-  0x4f, 0x03, 0x53, 0x35, 0x79, 0x83, 0x77, 0x44, 0x11, 0xe6, 0x30, 0x5e,
-  0xb5, 0x8e, 0xef, 0x81, 0x51, 0xba, 0xac, 0x30, 0x45, 0x55, 0x56, 0x58,
-  0x99, 0x05, 0x78, 0x58, 0x05, 0x4b, 0x04, 0xb7, 0x06, 0x8a, 0x85, 0x81,
-  0xa2, 0x15, 0xa5, 0xdb, 0x25, 0x50, 0x7c, 0x5d, 0xd9, 0x11, 0x33, 0xce,
-  0x6b, 0x6c, 0xe7, 0x25, 0x89, 0x0f, 0x4f, 0xf2, 0x78, 0xbb, 0x4f, 0xf0,
-  0xb4, 0xa8, 0xe1, 0xc8, 0x2b, 0x9a, 0x7a, 0x40, 0x3c, 0x7b, 0xcb, 0xe4,
-  0xae, 0xda, 0xda, 0x68, 0xe5, 0x87, 0x69, 0xa6, 0xcc, 0xf7, 0xae, 0xae,
-  0xb4, 0x3b, 0x89, 0x48, 0x1d, 0x38, 0xbd, 0x02, 0x42, 0x1b, 0x6a, 0x79,
-  0xe1, 0xd4, 0xd0, 0xd8, 0x62, 0xe6, 0xfd, 0x44, 0x9a, 0x60, 0x25, 0x9d,
-  0xbb, 0x1c, 0xbd, 0x83, 0x89, 0x74, 0x83, 0xac, 0x4f, 0xf8, 0x9d, 0xc2,
-  0x2e, 0x89, 0x12, 0xbe, 0xe1, 0x9b, 0x2b, 0x8c, 0x5c, 0x74, 0x17, 0xa3,
-  0x13, 0xe1, 0x76, 0xbc, 0x38, 0x04, 0x1b, 0x1f, 0xda, 0xda, 0x44, 0xbb,
-  0xda, 0xd4, 0xb2, 0x36, 0x28, 0xea, 0x32, 0xc9, 0x72, 0xf2, 0x2b, 0x38,
-  0xfc, 0xf0, 0xcd, 0x4e, 0x63, 0xcf, 0xdb, 0xd0, 0xfd, 0x73, 0xc0, 0xda,
-  0xb0, 0xc2, 0x5b, 0x23, 0x2b, 0x1f, 0x46, 0x76, 0xdb, 0xd6, 0xe9, 0xe4,
-  0x6e, 0xa4, 0x72, 0xbe, 0x48, 0x29, 0x7a, 0x54, 0x9b, 0x5f, 0x24, 0x9b,
-  0x5c, 0x5b, 0xdd, 0xf8, 0xa9, 0x87, 0xee, 0x9c, 0xd3, 0x00, 0xd7, 0x16,
-  0xaa, 0x4f, 0x04, 0xf4, 0x2b, 0xc0, 0xab, 0x5f, 0x90, 0x05, 0x52, 0xbf,
-  0xd5, 0x9b, 0x18, 0xd9, 0x29, 0x74, 0x6f, 0x3a, 0xfd, 0x32, 0x34, 0xea,
-  0xba, 0x44, 0xd3, 0x62, 0x13, 0x10, 0x8a, 0x76, 0xd9, 0x76, 0x4a, 0xf5,
-  0x41, 0x63, 0x03, 0x8d, 0x60, 0xa1, 0x18, 0x13, 0xcb, 0xec, 0x7a, 0x93,
-  0x17, 0x14, 0xf1, 0x0a, 0xc9, 0xf3, 0x7f, 0xea, 0xf5, 0x46, 0x57, 0xc9,
-  0x61, 0xbd, 0x2c, 0x88, 0x99, 0x19, 0xda, 0x5b, 0x42, 0xce, 0x97, 0xf5,
-  0x46, 0x68, 0xba, 0x39, 0x78, 0xaa, 0xad, 0xc7, 0x04, 0x21, 0x92, 0x80,
-  0x71, 0x68, 0x7d, 0x24, 0xeb, 0x8a, 0x8b, 0x85, 0xad, 0x2e, 0xbb, 0xbd,
-  0x78, 0x20, 0xb9, 0xed, 0x20, 0x6b, 0x0d, 0x6e, 0x67, 0xd1, 0x30, 0xb4,
-  0xcc, 0x8b, 0xd5, 0x1b, 0x6d, 0x23, 0x52, 0x4e, 0x5f, 0x38, 0xf0, 0x63,
-  0x58, 0xe5, 0x53, 0x84, 0xaf, 0x5f, 0xe1, 0xd3, 0xcb, 0xa7, 0x68, 0xb7,
-  0x6b, 0x83, 0xdd, 0x24, 0x79, 0x95, 0x12, 0x2c, 0x3d, 0x31, 0xb0, 0x03,
-  0xdb, 0x20, 0xa4, 0x21, 0x01, 0x74, 0x77, 0x36, 0xe1, 0xa6, 0x9e, 0x26,
-  0xe0, 0xab, 0x00, 0x33, 0x65, 0x39, 0xce, 0x2b, 0x4a, 0xec, 0xd1, 0x5f,
-  0x03, 0x73, 0x91, 0xae, 0x80, 0x96, 0xa4, 0x8f, 0xff, 0x3c, 0xc2, 0xd6,
-  0xe2, 0x11, 0x77, 0x4d, 0x2f, 0xd6, 0x69, 0x9e, 0xed, 0xec, 0xdb, 0x3f,
-  0x51, 0xd3, 0x66, 0xa3, 0xf8, 0xd7, 0xbf, 0xe0, 0xd7, 0x3e, 0xe2, 0xc6,
-  0xa8, 0x9c, 0xf4, 0xd2, 0x46, 0x50, 0xb6, 0xed, 0xf5, 0xab, 0xff, 0x32,
-  0x35, 0xbf, 0xfa, 0xdb, 0x90, 0x6a, 0x76, 0xc9, 0xb2, 0x1a, 0xd0, 0x05,
-  0x08, 0x65, 0xab, 0x49, 0xa8, 0x86, 0xa7, 0x49, 0x7f, 0x23, 0x40, 0x78,
-  0xfc, 0xf5, 0x78, 0x4d, 0x71, 0x23, 0x7a, 0x9b, 0x62, 0x61, 0x6d, 0x4d,
-  0xab, 0xbf, 0x72, 0x55, 0xf0, 0xb7, 0xaf, 0xae, 0xc9, 0x03, 0xea, 0x9a,
-  0xfc, 0xc0, 0xba, 0x40, 0x33, 0xbc, 0x93, 0x5a, 0xcc, 0x63, 0xc0, 0x34,
-  0x49, 0x1c, 0xa6, 0x81, 0xe6, 0xe2, 0xd9, 0xb9, 0x13, 0xfb, 0xa9, 0xe3,
-  0x73, 0x8e, 0x9f, 0xc3, 0x3a, 0x7a, 0x30, 0x34, 0x20, 0x5c, 0x24, 0x76,
-  0x81, 0x45, 0x98, 0xe8, 0xe2, 0xda, 0xaa, 0x55, 0x59, 0xcd, 0x7b, 0x9b,
-  0x93, 0xea, 0x1d, 0xf7, 0xef, 0x75, 0xd7, 0x4e, 0x92, 0x3a, 0x00, 0x6d,
-  0x3b, 0xb7, 0x6c, 0xac, 0x74, 0x0d, 0x71, 0xa4, 0x3d, 0x51, 0x35, 0x9d,
-  0xee, 0xaf, 0x48, 0x33, 0xc4, 0x6d, 0xf5, 0xc1, 0x2d, 0x71, 0x2d, 0xdb,
-  0xe2, 0xbb, 0x09, 0x72, 0x44, 0x35, 0x9c, 0x43, 0x5d, 0x0b, 0xb7, 0x59,
-  0xc6, 0xed, 0x3a, 0xee, 0xed, 0x3f, 0x36, 0xec, 0x9c, 0xd0, 0xbd, 0xb4,
-  0x97, 0xce, 0xd2, 0xce, 0xd3, 0xe0, 0xfb, 0xb4, 0x4e, 0xa0, 0xcc, 0xf5,
-  0x2b, 0x7c, 0x78, 0xf9, 0xf4, 0xba, 0x55, 0xf4, 0x4e, 0xba, 0x21, 0x69,
-  0xc9, 0xe1, 0xdd, 0xc9, 0x6f, 0xca, 0x34, 0x7d, 0x13, 0xc6, 0x45, 0xf3,
-  0x2a, 0x9d, 0x24, 0xf9, 0x61, 0xcb, 0xc8, 0xf8, 0xb1, 0xab, 0xe2, 0xb1,
-  0x05, 0xee, 0x87, 0x9d, 0x2c, 0x85, 0x4a, 0x7a, 0xea, 0x84, 0x35, 0xa0,
-  0xbd, 0x90, 0x93, 0xeb, 0x64, 0xb7, 0xd3, 0x68, 0xe9, 0xb1, 0xb3, 0xa3,
-  0x2c, 0x70, 0x2f, 0xec, 0x78, 0x02, 0xc2, 0x5a, 0x08, 0xa6, 0xc7, 0x4e,
-  0x68, 0x0b, 0xdc, 0x0f, 0x3b, 0x49, 0x0f, 0x55, 0x96, 0x63, 0x38, 0x2d,
-  0xc4, 0xad, 0x7f, 0x74, 0x96, 0x70, 0x0b, 0x0c, 0x81, 0xb7, 0x1c, 0x31,
-  0xe9, 0x63, 0x1e, 0xa0, 0x46, 0x40, 0xfb, 0x20, 0x05, 0xb0, 0x17, 0x23,
-  0xa8, 0xbc, 0x82, 0x93, 0x1e, 0x3b, 0xa1, 0x2d, 0x70, 0x3f, 0xec, 0x24,
-  0x2b, 0x04, 0x31, 0x3e, 0x75, 0xc2, 0x1a, 0xd0, 0x5e, 0xc8, 0xc9, 0x1b,
-  0x98, 0x85, 0x1a, 0x2d, 0x3d, 0x76, 0x42, 0x5b, 0xe0, 0x7e, 0xd8, 0x89,
-  0x3e, 0xf8, 0x21, 0xd4, 0xfc, 0xdc, 0x09, 0xef, 0x80, 0x0f, 0x80, 0x9e,
-  0xec, 0x8e, 0x8c, 0x79, 0x77, 0xec, 0x84, 0xd3, 0x60, 0x3d, 0x50, 0x93,
-  0xbd, 0xc6, 0xb6, 0xef, 0x86, 0xd3, 0x60, 0x3d, 0x50, 0x93, 0xbb, 0x8c,
-  0xb1, 0xdd, 0x65, 0x9d, 0x70, 0x1a, 0xac, 0x07, 0x6a, 0x52, 0xec, 0xb2,
-  0x55, 0x29, 0x33, 0x46, 0xff, 0xe8, 0x2c, 0xe1, 0x16, 0x18, 0x02, 0x3f,
-  0x39, 0x20, 0x21, 0xd5, 0x2b, 0xf8, 0xfb, 0xf2, 0x69, 0xd5, 0x0e, 0x77,
-  0x60, 0x7a, 0x0f, 0x3d, 0xf4, 0x96, 0xdb, 0x82, 0x69, 0x85, 0x87, 0x4e,
-  0x48, 0x01, 0xec, 0x83, 0x9b, 0x54, 0xd9, 0xb5, 0xc8, 0x39, 0x7a, 0xec,
-  0x84, 0xb6, 0xc0, 0xfd, 0xb0, 0x93, 0x3a, 0xd1, 0x03, 0x0f, 0x0f, 0xdd,
-  0x33, 0x55, 0x03, 0xf6, 0xc1, 0x4d, 0x8e, 0xae, 0x7c, 0x3b, 0x0e, 0x90,
-  0x57, 0x6e, 0x81, 0x21, 0xf0, 0x93, 0xc3, 0x56, 0xb3, 0x17, 0x3c, 0x74,
-  0x42, 0x0a, 0x60, 0x1f, 0xdc, 0x64, 0x25, 0x18, 0x57, 0x3d, 0x90, 0x02,
-  0xd8, 0x07, 0x37, 0x81, 0x76, 0x68, 0x1a, 0xab, 0x1e, 0x1a, 0x35, 0x60,
-  0x1f, 0x1c, 0x30, 0x7e, 0x7a, 0x9d, 0xc8, 0x1c, 0x80, 0xc7, 0x9e, 0x19,
-  0x20, 0xc0, 0xbd, 0xb0, 0x6f, 0xc7, 0x93, 0x4f, 0x71, 0xfd, 0x7e, 0xcb,
-  0xb8, 0x3f, 0xed, 0x5b, 0xcb, 0xdf, 0x8e, 0x1d, 0xf0, 0x01, 0xd0, 0x93,
-  0x5f, 0x80, 0x60, 0xd7, 0xc8, 0x7f, 0xd1, 0x23, 0xe3, 0xdf, 0x8e, 0x2d,
-  0x70, 0x3f, 0xec, 0xe4, 0x37, 0xb8, 0x8e, 0x6b, 0xd4, 0xbf, 0xe9, 0x5b,
-  0xd3, 0xdf, 0x8e, 0x1d, 0xf0, 0x01, 0xd0, 0x93, 0x5f, 0xe1, 0x5a, 0xae,
-  0xb1, 0xff, 0xaa, 0x6f, 0x5d, 0x7f, 0x3b, 0x76, 0xc0, 0x07, 0x40, 0x4f,
-  0x3e, 0x63, 0x4e, 0xd7, 0xf8, 0x3f, 0xeb, 0xe7, 0xfb, 0xb7, 0x63, 0xaf,
-  0xc8, 0xa0, 0x12, 0x93, 0xff, 0xb4, 0x7d, 0xff, 0x9f, 0xbd, 0xfd, 0x69,
-  0x81, 0xfb, 0x61, 0x27, 0x9f, 0x19, 0xc4, 0x9f, 0xf5, 0xc1, 0x1a, 0xd0,
-  0x5e, 0x48, 0x8c, 0xed, 0x62, 0xf0, 0x7e, 0xdd, 0xa7, 0x11, 0xbc, 0x1d,
-  0x3b, 0xe0, 0x03, 0xa0, 0x27, 0x9f, 0x17, 0x06, 0xf9, 0xe7, 0x3d, 0x7a,
-  0xc1, 0xdb, 0xb1, 0x05, 0xee, 0x87, 0x9d, 0xfc, 0x3b, 0x6a, 0x03, 0x1a,
-  0xf5, 0xbf, 0xf7, 0x69, 0x06, 0x6f, 0xc7, 0x0e, 0xf8, 0x00, 0xe8, 0xc9,
-  0x17, 0xa4, 0x0e, 0x68, 0xf4, 0x5f, 0xf4, 0xea, 0x06, 0x6f, 0xc7, 0x6e,
-  0x81, 0x21, 0xf0, 0x93, 0x2f, 0x8f, 0x1a, 0xfb, 0x97, 0x9d, 0xd2, 0xfd,
-  0xed, 0x58, 0x00, 0xfb, 0xe0, 0x26, 0xbf, 0x15, 0x8c, 0xbf, 0xed, 0x81,
-  0x14, 0xc0, 0x3e, 0xb8, 0xc9, 0x7f, 0x64, 0x1a, 0xe3, 0x7f, 0x74, 0x4a,
-  0xca, 0xb7, 0x63, 0x01, 0xec, 0x83, 0x9b, 0xfc, 0x8e, 0x75, 0x03, 0x8d,
-  0xf6, 0x77, 0xfd, 0x9a, 0xc2, 0xdb, 0xb1, 0x57, 0x64, 0x50, 0x89, 0xc9,
-  0xef, 0xb7, 0x85, 0xae, 0xe1, 0xf7, 0xdd, 0xeb, 0xfc, 0xdb, 0xb1, 0x01,
-  0xed, 0x85, 0x9c, 0x7c, 0x85, 0x6b, 0xbb, 0xc6, 0xfb, 0x55, 0xdf, 0x3a,
-  0xff, 0x76, 0xec, 0x80, 0x0f, 0x80, 0x9e, 0x7c, 0x9d, 0xc8, 0xf0, 0x7d,
-  0xdd, 0xbd, 0xde, 0xc3, 0x1c, 0x14, 0xd0, 0x5e, 0xc8, 0xc9, 0x1f, 0x3c,
-  0x99, 0xf7, 0x87, 0x21, 0x12, 0xcc, 0x2b, 0x32, 0xa8, 0xc4, 0xe4, 0xf5,
-  0x56, 0x18, 0xe5, 0x75, 0xf7, 0x2a, 0xfd, 0x76, 0x6c, 0x40, 0x7b, 0x21,
-  0x27, 0xbf, 0x34, 0x58, 0x7f, 0xd9, 0x07, 0x6b, 0x40, 0x7b, 0x21, 0x27,
-  0xaf, 0x2b, 0x43, 0x6b, 0xf7, 0xfa, 0x0f, 0xb4, 0x0a, 0x68, 0x2f, 0x24,
-  0x70, 0x32, 0xac, 0xf9, 0x86, 0xab, 0x7b, 0xd7, 0x7f, 0x07, 0x7c, 0x00,
-  0xf4, 0xe4, 0xb5, 0x21, 0xb9, 0x8f, 0x62, 0x21, 0xb8, 0x09, 0x17, 0x6c,
-  0xec, 0x58, 0xfb, 0xee, 0x56, 0xbe, 0x27, 0x29, 0x43, 0xa5, 0x9d, 0x50,
-  0xd9, 0x7e, 0x43, 0x60, 0xf0, 0xb7, 0x13, 0x6e, 0xc7, 0x80, 0xbb, 0xe2,
-  0xd5, 0x9c, 0x6c, 0x32, 0x2d, 0x45, 0x3c, 0x2b, 0x14, 0xdf, 0x5b, 0x50,
-  0x23, 0xfe, 0xdb, 0x0e, 0xf7, 0xdd, 0xb1, 0x30, 0xe6, 0x47, 0x7d, 0x48,
-  0x19, 0x31, 0x0d, 0x32, 0xd4, 0x94, 0x68, 0x38, 0xd5, 0x76, 0x21, 0xc7,
-  0xd0, 0xd8, 0x04, 0x75, 0x21, 0x5b, 0x9a, 0xa5, 0x21, 0x2f, 0x9f, 0x5d,
-  0x78, 0xb6, 0x40, 0x0f, 0x84, 0x4c, 0x61, 0xfc, 0x91, 0x8f, 0x37, 0x23,
-  0xb4, 0x11, 0x0c, 0x93, 0x76, 0xd5, 0x4d, 0x1a, 0x41, 0xba, 0x80, 0x6d,
-  0x94, 0x11, 0xe0, 0xc5, 0xbf, 0xb4, 0x1b, 0x29, 0x09, 0xe0, 0xf2, 0x59,
-  0x27, 0xe1, 0x03, 0xe8, 0x16, 0xb2, 0xfb, 0xe9, 0x56, 0x1e, 0x60, 0x07,
-  0xdd, 0x2e, 0xd9, 0x79, 0x84, 0xec, 0x4e, 0xaa, 0xd7, 0x18, 0xda, 0x35,
-  0xed, 0x23, 0x5c, 0x43, 0x69, 0xda, 0x3f, 0xee, 0xa6, 0x5d, 0x03, 0x7b,
-  0xb0, 0x6d, 0xe4, 0x6b, 0xd8, 0xae, 0x16, 0x68, 0x90, 0x9e, 0x46, 0xf0,
-  0x45, 0xf4, 0xfe, 0x66, 0x30, 0x9c, 0x0c, 0x42, 0x7f, 0x4b, 0x18, 0xde,
-  0x07, 0xef, 0x68, 0x0c, 0x83, 0xf7, 0x34, 0x87, 0x81, 0xba, 0x1a, 0x94,
-  0x94, 0x78, 0x88, 0xd3, 0xd3, 0x1a, 0x06, 0xe2, 0xa6, 0xcc, 0x5f, 0x75,
-  0xb7, 0x84, 0x61, 0x3d, 0xd0, 0xb6, 0x56, 0x30, 0xe8, 0xe5, 0xcf, 0xda,
-  0x1a, 0x10, 0x7c, 0x6f, 0x12, 0xbf, 0x49, 0x30, 0x14, 0x25, 0x7a, 0x79,
-  0x69, 0x19, 0xa3, 0x8f, 0xef, 0x23, 0x4d, 0xb0, 0xa0, 0xdc, 0x8c, 0xff,
-  0xd1, 0xdd, 0x0a, 0x0b, 0xee, 0x42, 0xb7, 0x35, 0xc4, 0x42, 0x5f, 0xfc,
-  0x53, 0xc7, 0xf9, 0x44, 0x7a, 0x77, 0x30, 0x67, 0x58, 0xf6, 0x79, 0xd6,
-  0x84, 0xb9, 0xf8, 0x69, 0xfb, 0xa8, 0x32, 0xc0, 0xf3, 0x9f, 0xb7, 0x0e,
-  0xe9, 0xa4, 0x3a, 0xee, 0xd4, 0xcf, 0x5b, 0xc5, 0xcb, 0xe4, 0x40, 0xb9,
-  0x55, 0x6a, 0xf5, 0xf3, 0x9f, 0x85, 0x28, 0x28, 0x47, 0x0a, 0x3a, 0x13,
-  0x92, 0x9f, 0xe2, 0x3c, 0xd9, 0x5f, 0xe7, 0xe9, 0x7c, 0x59, 0x26, 0x18,
-  0xc1, 0x51, 0xa7, 0x5f, 0xd8, 0xaf, 0xb0, 0xfe, 0x73, 0x95, 0x7c, 0xf3,
-  0xb2, 0x7e, 0x85, 0xe7, 0xfa, 0x5b, 0x18, 0xa1, 0xe4, 0x9b, 0x6f, 0xf6,
-  0x9c, 0xa3, 0xe1, 0xbc, 0x79, 0x08, 0x41, 0xf4, 0x7a, 0x47, 0x10, 0xae,
-  0x27, 0xa2, 0x1c, 0x40, 0xf8, 0x8e, 0x62, 0x58, 0x66, 0x5e, 0x51, 0xbc,
-  0x52, 0xdf, 0xf5, 0x2a, 0x74, 0xc8, 0x4b, 0x5a, 0x4b, 0x37, 0x1c, 0xf2,
-  0xf4, 0x95, 0xcd, 0x8e, 0x2a, 0x62, 0xae, 0x16, 0x0e, 0xae, 0x98, 0x27,
-  0x35, 0x46, 0xc2, 0xf0, 0xe3, 0xdc, 0x71, 0x07, 0x69, 0x8a, 0x36, 0x50,
-  0x28, 0x61, 0x3f, 0x17, 0x97, 0xce, 0x3b, 0x00, 0xb1, 0x1e, 0x9a, 0xc6,
-  0x7b, 0xc5, 0xba, 0xd7, 0xeb, 0x50, 0xf1, 0x14, 0x1a, 0x8a, 0x52, 0x2e,
-  0x3d, 0xb2, 0x9e, 0xd6, 0xb1, 0x88, 0x24, 0x50, 0xc7, 0xcc, 0x71, 0x59,
-  0x32, 0x61, 0x49, 0xf0, 0x3d, 0x3a, 0x21, 0x31, 0x0d, 0xce, 0x9b, 0xce,
-  0xa8, 0x24, 0x59, 0xda, 0x16, 0x91, 0xe4, 0x24, 0xe6, 0xe3, 0x14, 0xc4,
-  0x21, 0xe1, 0x1a, 0x98, 0xde, 0x78, 0x35, 0xd0, 0x88, 0xfd, 0xca, 0x89,
-  0x29, 0xe1, 0x54, 0x8c, 0xce, 0x00, 0xce, 0x61, 0xb2, 0x13, 0x49, 0xe4,
-  0x24, 0x80, 0xb4, 0x81, 0x4c, 0x5c, 0x37, 0xf0, 0x61, 0xb1, 0x4c, 0xa4,
-  0x9f, 0x7c, 0x77, 0x19, 0x3d, 0xdf, 0xac, 0x2f, 0x0a, 0xb6, 0x24, 0x16,
-  0xd4, 0xa4, 0x25, 0x6e, 0x8a, 0x17, 0xca, 0xc4, 0x1d, 0xca, 0xaf, 0xd9,
-  0xe5, 0x98, 0x2f, 0xb4, 0xba, 0xa3, 0x29, 0x77, 0x87, 0x71, 0x54, 0x77,
-  0x3b, 0x8c, 0x62, 0x5c, 0x1d, 0x14, 0x32, 0x07, 0x37, 0x49, 0x12, 0x06,
-  0x50, 0xc6, 0x21, 0xf4, 0x0f, 0xa6, 0x18, 0x42, 0x94, 0xb6, 0x80, 0x53,
-  0x6f, 0x69, 0x7f, 0xe0, 0xe3, 0xde, 0xa4, 0x08, 0xa2, 0x72, 0xfe, 0xd9,
-  0x1e, 0xa2, 0x73, 0x8e, 0x27, 0x81, 0xba, 0xb9, 0xa6, 0xd1, 0x5c, 0x42,
-  0xab, 0x94, 0x0d, 0xcd, 0x02, 0x3d, 0x1b, 0xf5, 0x11, 0xc4, 0x20, 0xf1,
-  0xe6, 0x46, 0x9c, 0xb9, 0x48, 0xcd, 0xd8, 0xa7, 0x2f, 0xe9, 0x41, 0x5d,
-  0x3c, 0xb3, 0x3e, 0xe2, 0x4c, 0x03, 0xbd, 0xb6, 0x97, 0x74, 0x4d, 0x65,
-  0x1d, 0xb5, 0xf8, 0x65, 0x63, 0x31, 0x65, 0x1e, 0x40, 0xb2, 0x52, 0xce,
-  0x98, 0xbb, 0x87, 0x8c, 0x6d, 0x53, 0x5d, 0x4b, 0x84, 0x70, 0xae, 0x77,
-  0xcd, 0x74, 0x9f, 0xa7, 0xba, 0x8e, 0x56, 0x1d, 0xce, 0xa7, 0x4e, 0xa2,
-  0x51, 0xa9, 0x30, 0x81, 0x5a, 0x2b, 0xd7, 0x9f, 0x58, 0xa8, 0x08, 0xc7,
-  0x37, 0xdc, 0xe2, 0xf4, 0xdd, 0xab, 0x80, 0xa5, 0x1a, 0x4e, 0xe1, 0x9e,
-  0xc8, 0xf9, 0x70, 0xac, 0x26, 0x9e, 0x34, 0x36, 0xb8, 0x41, 0x2f, 0xbb,
-  0x51, 0xc3, 0xf4, 0xe8, 0x11, 0xb5, 0xf2, 0xb7, 0x8d, 0xe1, 0x98, 0xdb,
-  0x62, 0xac, 0xd6, 0x98, 0x91, 0x21, 0xd3, 0xb9, 0x75, 0x75, 0xb0, 0x5d,
-  0x18, 0xad, 0xa8, 0x8b, 0xf5, 0x7a, 0x50, 0xf6, 0x31, 0x1f, 0xaf, 0xe8,
-  0xcc, 0x48, 0x31, 0xc5, 0x20, 0x06, 0x76, 0xf1, 0xfc, 0x67, 0xad, 0xba,
-  0x81, 0x01, 0xf9, 0x69, 0xbb, 0xc2, 0x87, 0xa2, 0x90, 0xef, 0xf4, 0xdc,
-  0x89, 0xdf, 0x74, 0x44, 0x0d, 0x11, 0x28, 0xd2, 0x7e, 0xce, 0x5d, 0xed,
-  0xa7, 0xa1, 0x2a, 0xb5, 0x83, 0x36, 0x15, 0x25, 0x81, 0xbd, 0xb8, 0x68,
-  0x57, 0x70, 0x0c, 0xcc, 0xb3, 0x76, 0x1d, 0x67, 0x37, 0xa4, 0x0d, 0x42,
-  0x96, 0x5c, 0x3c, 0x6a, 0xa1, 0xdf, 0xa1, 0xfe, 0x49, 0x37, 0xf5, 0x9a,
-  0xae, 0xcb, 0x76, 0xda, 0x1b, 0x10, 0x0d, 0xca, 0xf5, 0x55, 0xaa, 0x6e,
-  0xd2, 0x05, 0xa8, 0x8f, 0x76, 0x0b, 0xd7, 0x4b, 0xbc, 0x80, 0x76, 0x50,
-  0x1f, 0x01, 0x89, 0x28, 0x97, 0xdf, 0x95, 0xc2, 0xaa, 0xf6, 0x31, 0x12,
-  0x0e, 0x01, 0xbf, 0x0d, 0x73, 0x48, 0x26, 0xa1, 0xf1, 0x1d, 0x3b, 0x9c,
-  0x38, 0x33, 0x85, 0x44, 0xc9, 0x77, 0xec, 0x16, 0x13, 0xf7, 0x58, 0xf7,
-  0x37, 0xfb, 0x19, 0xe7, 0x30, 0xa3, 0x39, 0xe4, 0xff, 0x6e, 0x1a, 0x06,
-  0xe8, 0x1b, 0xef, 0x03, 0x9e, 0xf6, 0x1b, 0x1c, 0x08, 0xda, 0x05, 0xee,
-  0xb2, 0x39, 0x10, 0xf0, 0xc5, 0xe5, 0xa5, 0xdb, 0xc9, 0x20, 0x5e, 0xd7,
-  0x20, 0x39, 0x0b, 0x95, 0x2c, 0x25, 0x25, 0x4e, 0x5b, 0xb9, 0xe7, 0xb1,
-  0x9e, 0x77, 0x3c, 0x7a, 0x0c, 0xf1, 0x6e, 0xd7, 0x7e, 0x78, 0x8f, 0xeb,
-  0xc0, 0xb1, 0x69, 0x03, 0x7b, 0x00, 0xbb, 0xfc, 0x74, 0xf9, 0x36, 0x59,
-  0x3c, 0x7e, 0x4c, 0xb8, 0x86, 0x2c, 0x0d, 0x47, 0x5a, 0x04, 0x2a, 0x55,
-  0x35, 0x9a, 0x45, 0xc7, 0xbc, 0xdb, 0x37, 0x6a, 0x4c, 0x39, 0x00, 0x8d,
-  0x8f, 0x19, 0xfd, 0x98, 0xd3, 0x4d, 0x9d, 0x16, 0x1e, 0x75, 0x41, 0x1a,
-  0xfd, 0x89, 0x71, 0x04, 0xee, 0xd5, 0xe3, 0xd3, 0xb1, 0x5c, 0x85, 0x12,
-  0x05, 0x7e, 0xea, 0x16, 0x56, 0x4e, 0x31, 0xb3, 0xb7, 0x68, 0xdc, 0xe6,
-  0x68, 0xa9, 0x59, 0x1c, 0x5d, 0x5f, 0xbc, 0xd0, 0xc8, 0x38, 0xcd, 0x1d,
-  0x25, 0x8d, 0x84, 0xad, 0x0e, 0xbf, 0x9c, 0xe9, 0xec, 0x70, 0x33, 0x95,
-  0xa8, 0xe5, 0x8c, 0x2e, 0x5e, 0x78, 0xbb, 0xa8, 0xc8, 0xdd, 0x07, 0xd3,
-  0x43, 0xdf, 0xb2, 0x2b, 0x17, 0xf9, 0xae, 0x32, 0x36, 0x76, 0x5e, 0x7d,
-  0x79, 0x78, 0xfa, 0xca, 0x5e, 0x33, 0xd6, 0x5b, 0x2b, 0x5a, 0x67, 0x7d,
-  0x0e, 0xc2, 0x25, 0x58, 0xde, 0x24, 0x72, 0x01, 0x78, 0x68, 0x15, 0xe8,
-  0x7d, 0x49, 0x7e, 0x9f, 0xf0, 0x57, 0x7b, 0x78, 0x1e, 0x1a, 0xb5, 0xd6,
-  0x01, 0x3a, 0x6a, 0x95, 0x73, 0x11, 0x74, 0x93, 0x21, 0x7f, 0x64, 0xfb,
-  0x4d, 0x0a, 0x1c, 0xb0, 0x4a, 0xcd, 0x8d, 0xb4, 0xa6, 0xca, 0x5f, 0x2f,
-  0x95, 0x01, 0xb3, 0xba, 0x94, 0x13, 0xe7, 0xd0, 0x60, 0x93, 0x8b, 0x61,
-  0x6d, 0xb8, 0xfc, 0xbb, 0xf2, 0x80, 0x57, 0x17, 0x30, 0x58, 0x15, 0xb0,
-  0x2a, 0xe5, 0xdb, 0xfc, 0xf8, 0x1d, 0xa6, 0xb6, 0xca, 0xe5, 0x59, 0xc2,
-  0x22, 0x18, 0x1e, 0xe2, 0xfa, 0x04, 0xda, 0x54, 0xa8, 0x08, 0xcf, 0x48,
-  0x8d, 0xc8, 0xeb, 0xd7, 0xdb, 0x53, 0xd8, 0x52, 0x82, 0xb7, 0xb5, 0x94,
-  0x17, 0x87, 0xc4, 0x04, 0xf2, 0xf5, 0x73, 0x5d, 0xc6, 0x7a, 0x49, 0x67,
-  0xd0, 0x7c, 0x4d, 0x0a, 0x5d, 0x4b, 0x4f, 0xd5, 0xb1, 0x92, 0x8e, 0xe6,
-  0xc9, 0x77, 0xba, 0xf7, 0xee, 0x9d, 0xee, 0x7b, 0x1b, 0x05, 0x23, 0xc6,
-  0x9c, 0xf7, 0x33, 0xa7, 0x99, 0x56, 0xab, 0xaf, 0x31, 0x20, 0x65, 0xbd,
-  0xc6, 0xf0, 0x3c, 0x87, 0x64, 0x95, 0x22, 0x5b, 0xd2, 0xcf, 0xa7, 0xf8,
-  0x65, 0xe4, 0x96, 0x21, 0x9a, 0x4c, 0xf9, 0x70, 0xaf, 0x76, 0x3f, 0x93,
-  0x48, 0x45, 0x4d, 0xdc, 0xa3, 0xe6, 0x37, 0xaf, 0x12, 0xf3, 0x55, 0xde,
-  0x73, 0x21, 0x27, 0x20, 0x83, 0x99, 0x5d, 0xf8, 0x0b, 0x39, 0xfe, 0x29,
-  0xf5, 0x86, 0xb5, 0x19, 0x80, 0xfa, 0x2c, 0x37, 0x0a, 0xd1, 0xf8, 0x82,
-  0xf7, 0x9c, 0xca, 0x62, 0x8d, 0xe6, 0x91, 0xe2, 0x46, 0xe7, 0x98, 0xc0,
-  0x28, 0x68, 0x25, 0x6a, 0xd7, 0x67, 0x74, 0x79, 0x57, 0x61, 0x4e, 0xb9,
-  0x97, 0x1f, 0xeb, 0x2d, 0x3e, 0x3c, 0x6c, 0xb3, 0xeb, 0x2d, 0x63, 0x62,
-  0x11, 0x0a, 0x65, 0x31, 0xe7, 0xa0, 0xda, 0xa1, 0xe7, 0xfb, 0x26, 0x4f,
-  0xef, 0x32, 0x0c, 0x53, 0x77, 0x7e, 0x8e, 0xd1, 0x11, 0x9a, 0xe6, 0x1e,
-  0xbd, 0xe8, 0xca, 0x93, 0x6f, 0xf0, 0xc9, 0x2d, 0x44, 0xde, 0x02, 0x22,
-  0x36, 0xa1, 0x2e, 0x3c, 0xe3, 0xbe, 0x8a, 0xc6, 0xfd, 0x15, 0x8d, 0x5b,
-  0x2b, 0xe2, 0xb6, 0xa7, 0x49, 0x95, 0xe5, 0xf7, 0x78, 0x15, 0x39, 0xa5,
-  0x34, 0xaf, 0x75, 0x81, 0x69, 0xe2, 0x8a, 0xfd, 0x19, 0xdf, 0xd2, 0xad,
-  0xd2, 0x55, 0x7d, 0xa6, 0x0a, 0x0c, 0x19, 0x51, 0x1c, 0x9a, 0xf7, 0xa0,
-  0xb0, 0xd2, 0x48, 0xc0, 0x03, 0xa8, 0x77, 0xf4, 0xb2, 0xe2, 0x5c, 0x3e,
-  0xc0, 0xf0, 0x08, 0xe5, 0x6d, 0xb3, 0xa8, 0xe6, 0xeb, 0xa2, 0xae, 0x13,
-  0xbc, 0x4e, 0x8b, 0x09, 0x8e, 0x29, 0xd7, 0x0d, 0xa6, 0x7e, 0x85, 0x05,
-  0xfb, 0x86, 0x2f, 0x8a, 0x54, 0x17, 0x8d, 0x45, 0x32, 0x0c, 0xe3, 0x5b,
-  0xe2, 0x6d, 0x1d, 0x0a, 0xa2, 0x46, 0xd9, 0xee, 0xa8, 0x18, 0x8f, 0x2f,
-  0xbc, 0x1c, 0xf1, 0xd3, 0xc7, 0x38, 0xf0, 0x69, 0x99, 0x67, 0xbb, 0xac,
-  0x1e, 0xb9, 0xd7, 0x6a, 0x31, 0xf4, 0x01, 0x26, 0xed, 0xe5, 0xd8, 0xa5,
-  0x76, 0x05, 0xd5, 0x8f, 0x0e, 0x07, 0xb6, 0x45, 0x0f, 0x8e, 0xec, 0x35,
-  0xbe, 0x9d, 0x9e, 0x41, 0xe3, 0xcf, 0x3e, 0xa1, 0xba, 0xcd, 0x9c, 0x0e,
-  0xb7, 0x68, 0xfb, 0xa7, 0xaf, 0xfc, 0xf5, 0xd9, 0x40, 0x9e, 0x7d, 0x02,
-  0xcd, 0xb6, 0x8b, 0x73, 0xb5, 0x13, 0xae, 0x6f, 0xea, 0x7b, 0x6d, 0x3d,
-  0x6f, 0x94, 0x13, 0x6f, 0xf3, 0x8c, 0x4c, 0xeb, 0xc8, 0x1b, 0xef, 0x1b,
-  0xf2, 0x99, 0x6e, 0x2a, 0x0e, 0x9b, 0x43, 0x94, 0x3b, 0x8a, 0xc8, 0x48,
-  0xce, 0x28, 0xce, 0x7e, 0xb4, 0x41, 0xe2, 0x7b, 0xa5, 0x7a, 0x9c, 0xac,
-  0xa2, 0x73, 0x36, 0x78, 0x98, 0x78, 0xe1, 0x2b, 0x0e, 0x39, 0xc6, 0xa9,
-  0x30, 0xd4, 0x96, 0xac, 0xae, 0x39, 0x31, 0x41, 0x06, 0x8f, 0xb1, 0x72,
-  0x06, 0x39, 0x54, 0xb5, 0xe0, 0x3d, 0x57, 0x65, 0x25, 0xfa, 0xa8, 0x65,
-  0xb0, 0xfb, 0x47, 0x9b, 0x65, 0x05, 0x49, 0xb3, 0xd2, 0xde, 0x2b, 0xc8,
-  0xa2, 0x7a, 0xf6, 0xb8, 0x03, 0x2c, 0x64, 0x9e, 0x2c, 0x54, 0x68, 0x99,
-  0x7b, 0x06, 0x8c, 0xa6, 0xe9, 0x97, 0x17, 0x2f, 0x74, 0x7d, 0x98, 0x15,
-  0x1b, 0xaf, 0x97, 0x54, 0xea, 0xa9, 0xfa, 0x89, 0xe2, 0xf1, 0xbd, 0x49,
-  0x22, 0x9a, 0x69, 0x94, 0x31, 0x50, 0x19, 0x33, 0xf9, 0x9f, 0xa5, 0xab,
-  0xf5, 0x62, 0x66, 0x43, 0x49, 0x42, 0xe9, 0xe7, 0xe6, 0x16, 0x96, 0xa7,
-  0x0a, 0xc1, 0x0c, 0x86, 0x86, 0x01, 0x7b, 0xd2, 0x22, 0x6d, 0xf9, 0x93,
-  0x56, 0x12, 0xec, 0x5f, 0x1d, 0x0b, 0xc3, 0x9b, 0x80, 0xd5, 0xab, 0x35,
-  0x1d, 0xb7, 0x6a, 0xa0, 0x1b, 0x0e, 0x9a, 0xe4, 0x1a, 0xb8, 0x5c, 0x9d,
-  0x09, 0x99, 0x07, 0xa9, 0xa4, 0xa4, 0x14, 0x3b, 0xca, 0x56, 0xa4, 0xc9,
-  0xfa, 0x99, 0xb9, 0x18, 0x46, 0xdd, 0x87, 0x2b, 0x8c, 0xb4, 0x1a, 0xd3,
-  0xa5, 0x3d, 0xef, 0xec, 0x40, 0x66, 0x03, 0xc0, 0x7b, 0x01, 0x2b, 0x24,
-  0xdd, 0xdb, 0x85, 0x15, 0xe8, 0x99, 0x5e, 0xee, 0xb7, 0x99, 0x87, 0xe9,
-  0xa7, 0x9d, 0x98, 0x9c, 0xbb, 0xfc, 0x41, 0xdf, 0x78, 0xbd, 0x81, 0xfc,
-  0x06, 0x24, 0x9a, 0x78, 0x21, 0x21, 0x53, 0x32, 0xc4, 0x36, 0xeb, 0x01,
-  0xd0, 0x5d, 0xda, 0x90, 0x6a, 0x5e, 0xa7, 0x2a, 0xee, 0xd6, 0x58, 0x97,
-  0xce, 0x1a, 0xfc, 0x4d, 0xd3, 0x5e, 0x56, 0x14, 0xfb, 0x1c, 0x1e, 0x81,
-  0xa3, 0x4d, 0xbd, 0xe7, 0xd8, 0x8c, 0x60, 0x86, 0x9d, 0x9a, 0x11, 0x68,
-  0xc7, 0x59, 0x5e, 0xf0, 0x3d, 0xba, 0x3b, 0x64, 0x62, 0xed, 0xae, 0x42,
-  0xd1, 0xbd, 0x39, 0xbc, 0x0c, 0xc8, 0x61, 0x96, 0x69, 0x1d, 0xcd, 0x13,
-  0x0c, 0x6d, 0x21, 0xf1, 0x86, 0x93, 0xf2, 0x1a, 0xd7, 0x58, 0x2a, 0xd9,
-  0x32, 0xf5, 0x74, 0x62, 0xc3, 0x0e, 0x51, 0x4a, 0xa5, 0x4d, 0x28, 0x20,
-  0x92, 0xc3, 0xc7, 0x25, 0x92, 0xa5, 0xad, 0x8a, 0xb0, 0xdf, 0xa5, 0x74,
-  0xaf, 0xeb, 0xb4, 0xdc, 0xa7, 0x09, 0xf0, 0xcf, 0x28, 0x2e, 0x59, 0xa9,
-  0x8d, 0x22, 0x58, 0x39, 0xff, 0xa2, 0x89, 0x7c, 0x7a, 0x26, 0xf9, 0x1b,
-  0x87, 0x49, 0x47, 0x1d, 0x58, 0x8c, 0xf2, 0x43, 0x4a, 0x24, 0xa2, 0xe9,
-  0xf8, 0x90, 0x1f, 0xab, 0xe8, 0xb4, 0xcd, 0x77, 0xbc, 0x83, 0x01, 0xba,
-  0xf4, 0xf6, 0xc5, 0x9f, 0xb6, 0xdc, 0x1c, 0x32, 0xf0, 0x7f, 0x44, 0xd6,
-  0xcc, 0x08, 0x33, 0x06, 0xd2, 0x33, 0xdf, 0xf9, 0x73, 0x76, 0x4c, 0x56,
-  0xcd, 0x1f, 0x56, 0xbb, 0x71, 0xd1, 0x78, 0x70, 0xed, 0xa4, 0x32, 0xdd,
-  0x66, 0x55, 0xfa, 0x83, 0x08, 0x18, 0x5e, 0x6d, 0x63, 0x52, 0x99, 0x9b,
-  0xa0, 0x89, 0xb3, 0x58, 0xa0, 0xc2, 0x87, 0xb1, 0x01, 0x54, 0x52, 0x4f,
-  0xd7, 0xd9, 0x66, 0x33, 0xdd, 0x4c, 0x61, 0x78, 0xcf, 0xee, 0x3e, 0x4e,
-  0x66, 0x21, 0x6f, 0x87, 0x57, 0x3a, 0x7b, 0x57, 0x08, 0x3f, 0x16, 0x09,
-  0x85, 0x61, 0xee, 0x5b, 0x01, 0x3a, 0x16, 0x59, 0x34, 0x51, 0x24, 0xb5,
-  0xd1, 0x36, 0x14, 0x4a, 0x1d, 0x86, 0x09, 0x2d, 0xde, 0xf8, 0x11, 0x2a,
-  0x73, 0x6d, 0x1a, 0x49, 0xed, 0x2e, 0xa4, 0x2f, 0x5e, 0x2c, 0xb3, 0x7d,
-  0xb1, 0xa3, 0xd0, 0x24, 0x45, 0xba, 0xd9, 0x64, 0x2b, 0x34, 0xe8, 0x54,
-  0x7e, 0x77, 0x19, 0x10, 0x6e, 0xfd, 0x6a, 0x5b, 0xa0, 0x36, 0x2a, 0x72,
-  0x28, 0xec, 0x1c, 0xfd, 0xd9, 0xed, 0x20, 0xd0, 0xfc, 0x3e, 0xc9, 0x1f,
-  0xc9, 0x82, 0x7f, 0x80, 0xd5, 0x02, 0xd6, 0x47, 0x58, 0x97, 0xf6, 0x05,
-  0x2d, 0x4a, 0x68, 0x65, 0xc1, 0x34, 0x70, 0xa9, 0x7d, 0xc5, 0x83, 0x2a,
-  0x9a, 0xc0, 0xd0, 0x85, 0xd7, 0x54, 0xe1, 0xf3, 0x46, 0x04, 0xcd, 0xc3,
-  0xf0, 0x68, 0x43, 0x10, 0x9d, 0x3c, 0x1a, 0x6c, 0x8d, 0xcb, 0x61, 0xa5,
-  0x61, 0xab, 0x32, 0x89, 0x29, 0x21, 0xf8, 0xb6, 0xc3, 0xe0, 0xc9, 0x9f,
-  0x2f, 0x22, 0x27, 0xe5, 0xa6, 0x6b, 0x01, 0xc4, 0xbf, 0xa9, 0xef, 0xd8,
-  0xe0, 0xee, 0x22, 0x46, 0xa8, 0x1d, 0xca, 0x18, 0xb1, 0xf2, 0xd8, 0xe7,
-  0x59, 0x13, 0xe6, 0xe2, 0x59, 0xbb, 0xb4, 0x0f, 0x01, 0xe2, 0xc6, 0x40,
-  0x82, 0x8a, 0x9d, 0xac, 0xcb, 0x29, 0x39, 0x6c, 0xed, 0xf1, 0xd8, 0x6a,
-  0xd5, 0x88, 0x5a, 0xe3, 0xc4, 0xc8, 0x28, 0xcd, 0x99, 0x86, 0x15, 0x6e,
-  0x68, 0xc7, 0x3f, 0x17, 0x4b, 0x7e, 0x69, 0x23, 0xcb, 0x06, 0xbb, 0x7a,
-  0xd7, 0xe6, 0xe4, 0x87, 0x93, 0xf2, 0xb2, 0xb1, 0x47, 0x8d, 0x62, 0x5e,
-  0xb4, 0x2b, 0x37, 0xb6, 0x02, 0x05, 0xe5, 0xc0, 0x86, 0x95, 0x3a, 0x0e,
-  0x15, 0xe9, 0x3b, 0xfd, 0x91, 0x21, 0xb8, 0x94, 0x5e, 0x2e, 0xee, 0x02,
-  0xf2, 0xb0, 0xe7, 0x38, 0x64, 0x88, 0xca, 0x67, 0xf8, 0x43, 0x5f, 0x8a,
-  0x47, 0xe8, 0x86, 0x09, 0xed, 0x44, 0x85, 0xc7, 0x67, 0x62, 0x81, 0x31,
-  0x54, 0x40, 0xf5, 0xdc, 0xa7, 0x8c, 0xc8, 0x9e, 0xe8, 0x29, 0xc7, 0xfe,
-  0x60, 0x4f, 0xbe, 0xfc, 0xc0, 0x59, 0x36, 0x7c, 0x08, 0x97, 0x76, 0x4b,
-  0x7c, 0x64, 0x8f, 0x8f, 0x4f, 0x4e, 0x9c, 0x21, 0xe2, 0x66, 0xe7, 0x52,
-  0xc2, 0xef, 0x24, 0x06, 0xd5, 0xb2, 0x6a, 0x9f, 0x4b, 0x00, 0xe8, 0x1f,
-  0xd0, 0x88, 0xf6, 0x36, 0x3c, 0xb4, 0x09, 0x36, 0x86, 0x8a, 0xa5, 0x2f,
-  0x6c, 0x8d, 0x96, 0x07, 0x39, 0x1d, 0xfe, 0xd1, 0x28, 0x3a, 0x96, 0x2b,
-  0x9b, 0x0e, 0xb0, 0xb1, 0xa8, 0xe8, 0x03, 0x43, 0xe6, 0xaf, 0x76, 0xf7,
-  0x42, 0x86, 0x9a, 0x7a, 0xad, 0x69, 0xd1, 0xc2, 0x18, 0xd4, 0x85, 0x6c,
-  0x33, 0xf5, 0x33, 0xe4, 0xc5, 0xb3, 0x98, 0xf0, 0x68, 0x81, 0x68, 0xf8,
-  0x03, 0x8d, 0xdf, 0xf5, 0x28, 0x90, 0x00, 0xc0, 0xda, 0xe3, 0xbb, 0x4e,
-  0xe5, 0x11, 0xc0, 0x5c, 0xa8, 0x16, 0x92, 0x01, 0xca, 0x39, 0x17, 0x0c,
-  0x45, 0x0e, 0x7d, 0x8d, 0x1e, 0x3e, 0x70, 0x6b, 0xb2, 0x7d, 0x0f, 0xad,
-  0x08, 0xa1, 0x03, 0x69, 0x66, 0x7b, 0x89, 0xa3, 0xd9, 0xd2, 0xcd, 0x19,
-  0x2a, 0x13, 0x1e, 0x64, 0x5b, 0x37, 0x03, 0x64, 0x87, 0x52, 0xec, 0x7d,
-  0x6d, 0xd2, 0xcc, 0x3b, 0xf5, 0x1e, 0xb2, 0x75, 0x98, 0x28, 0x1a, 0xf3,
-  0x8f, 0xbb, 0xb9, 0x83, 0x41, 0x5d, 0xc8, 0x36, 0xb2, 0x19, 0xb2, 0x83,
-  0xf2, 0x10, 0x20, 0x72, 0x4c, 0x5b, 0xd4, 0x83, 0xe8, 0x37, 0x70, 0xcc,
-  0x29, 0x8f, 0xbb, 0xb7, 0x19, 0x06, 0xba, 0x83, 0xb6, 0x08, 0x4c, 0x93,
-  0xbc, 0x6b, 0xca, 0xee, 0x5b, 0x1e, 0xfa, 0xc8, 0x33, 0x70, 0x4c, 0xde,
-  0x4f, 0xae, 0xeb, 0x17, 0xdd, 0x14, 0x9a, 0x02, 0x01, 0x7c, 0x5b, 0x57,
-  0x1b, 0xf8, 0x8e, 0x16, 0x45, 0x60, 0x22, 0x2d, 0x4a, 0xbf, 0xeb, 0x6f,
-  0x0d, 0xc2, 0xd8, 0x96, 0xf4, 0xf8, 0x74, 0x12, 0x74, 0x08, 0xdc, 0xda,
-  0x0e, 0x04, 0xee, 0x6a, 0x83, 0xff, 0xbd, 0x49, 0x3f, 0xe6, 0x62, 0xe9,
-  0x6d, 0x00, 0x03, 0xe9, 0x16, 0xe4, 0x7d, 0x63, 0xc1, 0xd0, 0x01, 0x70,
-  0x5b, 0x03, 0x18, 0xb8, 0xa3, 0x05, 0x21, 0x40, 0xac, 0x09, 0xfd, 0x43,
-  0x90, 0x3b, 0x43, 0x90, 0xf7, 0x0e, 0x41, 0x6e, 0x87, 0x20, 0xef, 0x1d,
-  0x82, 0xbc, 0x67, 0x08, 0xf2, 0xbe, 0x21, 0x40, 0xc3, 0x7e, 0xdf, 0x6a,
-  0x44, 0xe1, 0x15, 0x49, 0xfa, 0x39, 0x19, 0x42, 0xf0, 0x25, 0x28, 0xe1,
-  0xf0, 0xa7, 0x47, 0x72, 0x22, 0x20, 0x8b, 0x4e, 0x0b, 0xdb, 0xd6, 0x1c,
-  0x84, 0xfd, 0xe7, 0x2e, 0xcf, 0xdf, 0xbd, 0x44, 0x21, 0x6c, 0x73, 0xa0,
-  0x40, 0x88, 0x91, 0x3d, 0x9a, 0xc1, 0xda, 0xe0, 0x95, 0x6c, 0x11, 0xf5,
-  0xeb, 0x36, 0xb7, 0x0a, 0x2e, 0xec, 0x95, 0x69, 0x77, 0x04, 0x06, 0xd8,
-  0x7f, 0x6a, 0xef, 0x78, 0xff, 0x73, 0xb3, 0x25, 0x45, 0xd9, 0xd3, 0x90,
-  0xa2, 0x0c, 0xdb, 0x51, 0x94, 0x03, 0x9b, 0x41, 0x45, 0xdd, 0x12, 0xad,
-  0x8d, 0x00, 0xc8, 0x9f, 0xb5, 0xb7, 0xc1, 0xfb, 0xca, 0x4d, 0xf0, 0xbe,
-  0x93, 0x6e, 0xad, 0x15, 0x7b, 0xfb, 0x3c, 0x6b, 0xc2, 0x5c, 0xb6, 0xbb,
-  0xff, 0x04, 0xdf, 0x9b, 0xce, 0x1b, 0xeb, 0xb4, 0xcc, 0x6e, 0x92, 0x3a,
-  0xbb, 0x11, 0xa3, 0x6c, 0xf8, 0x62, 0xd6, 0x06, 0xde, 0xb1, 0x8b, 0xf2,
-  0xc0, 0x2e, 0xda, 0x7d, 0x76, 0xc6, 0xb8, 0xc5, 0x1f, 0x52, 0x2f, 0x03,
-  0x76, 0xd4, 0xa8, 0x01, 0xe2, 0x75, 0x39, 0x41, 0xb0, 0x4d, 0x1d, 0x8d,
-  0xd3, 0x7d, 0x0a, 0x72, 0xce, 0x00, 0xcb, 0x65, 0x99, 0xde, 0xc8, 0x2e,
-  0x41, 0x4e, 0xfd, 0x8d, 0xbf, 0xd9, 0xb4, 0x58, 0xaf, 0x2b, 0x1b, 0xd4,
-  0xe4, 0x99, 0xdd, 0x50, 0x08, 0x28, 0xbb, 0x31, 0xfb, 0x60, 0x9c, 0x24,
-  0xa2, 0xe1, 0x5b, 0xba, 0x9e, 0x73, 0x6d, 0x14, 0xda, 0xcd, 0x77, 0x1a,
-  0x30, 0x20, 0x4d, 0xef, 0x8b, 0xb5, 0x71, 0x8d, 0x51, 0xbe, 0xcb, 0xc4,
-  0xba, 0xcd, 0x39, 0xc6, 0xcb, 0x3a, 0xe6, 0xb4, 0x12, 0x8a, 0xdb, 0x3e,
-  0x48, 0x80, 0xc0, 0x03, 0xa5, 0x61, 0x3e, 0x69, 0x1b, 0xcc, 0xe7, 0xfe,
-  0x08, 0xb4, 0xc2, 0x5d, 0xfa, 0x03, 0x61, 0x36, 0x2e, 0x5e, 0xdd, 0x36,
-  0xf7, 0xb0, 0x54, 0x3b, 0x88, 0xd1, 0x5a, 0xa0, 0x82, 0xb1, 0x3f, 0x89,
-  0x54, 0x68, 0x82, 0x2d, 0x86, 0x7c, 0xa1, 0x47, 0xc1, 0xa6, 0xb4, 0x84,
-  0xed, 0xcb, 0xe2, 0x26, 0x29, 0x2b, 0x95, 0x2f, 0x60, 0x56, 0xeb, 0x04,
-  0xbf, 0xf0, 0x62, 0xa1, 0x39, 0xd3, 0xda, 0x9b, 0xd0, 0x8c, 0xe4, 0xd8,
-  0x87, 0xf2, 0x02, 0xdd, 0xa6, 0xb6, 0x59, 0x9e, 0x2a, 0x8d, 0x61, 0x2d,
-  0xb1, 0x98, 0x89, 0x1e, 0x8d, 0xc3, 0x0d, 0xc5, 0xc7, 0xcf, 0x0c, 0xdd,
-  0x6f, 0x44, 0xe7, 0x1a, 0xd0, 0xf3, 0x3e, 0xe3, 0xd4, 0x4b, 0x17, 0x68,
-  0xae, 0xd5, 0x28, 0x90, 0xd6, 0x19, 0xd5, 0x68, 0x7a, 0x9c, 0x08, 0xa4,
-  0xfd, 0xbc, 0x54, 0xed, 0x26, 0xed, 0xd2, 0x9b, 0x37, 0xa6, 0x94, 0xb6,
-  0x55, 0x9a, 0x0e, 0xc2, 0xa0, 0x1b, 0xaf, 0xdf, 0x13, 0x72, 0xdb, 0x52,
-  0x49, 0x09, 0xa4, 0xd1, 0xb5, 0xf5, 0xa9, 0x8d, 0x1a, 0x47, 0x79, 0x91,
-  0x4f, 0xa6, 0x64, 0xd7, 0xf3, 0x02, 0x03, 0x21, 0x2d, 0x53, 0xae, 0x89,
-  0x26, 0x8d, 0x32, 0x10, 0xcf, 0xdc, 0x6f, 0xae, 0xad, 0x81, 0x1b, 0x7a,
-  0x3a, 0x75, 0x72, 0xc4, 0x4c, 0x6b, 0x25, 0x14, 0x9e, 0xd0, 0x01, 0x8f,
-  0xa0, 0x33, 0xd8, 0x38, 0x49, 0x1c, 0x06, 0xce, 0x1d, 0x7e, 0x8a, 0x14,
-  0x1a, 0xfe, 0x6c, 0xde, 0x4c, 0xb5, 0x86, 0x65, 0xfa, 0xc2, 0x39, 0x70,
-  0xc4, 0x90, 0x9d, 0x8e, 0x95, 0x6f, 0x34, 0x73, 0x0d, 0x82, 0x02, 0x33,
-  0x6d, 0xe5, 0x38, 0xa2, 0x58, 0xda, 0x15, 0x49, 0x8c, 0x19, 0xed, 0x64,
-  0xd3, 0xbb, 0x2f, 0x5e, 0x28, 0xed, 0xa4, 0x82, 0xf6, 0x75, 0x71, 0x3d,
-  0x70, 0xe6, 0x07, 0x7e, 0xc5, 0x24, 0x0b, 0x59, 0xcd, 0x4e, 0x45, 0x52,
-  0xaa, 0x2a, 0x4a, 0x0a, 0x37, 0x4d, 0x3e, 0x46, 0x89, 0x32, 0xa6, 0x2c,
-  0x76, 0xfc, 0x43, 0x64, 0x8c, 0x64, 0xbe, 0x06, 0x09, 0x79, 0xee, 0x8f,
-  0xe4, 0x18, 0x4d, 0xf3, 0xaa, 0xa6, 0x5e, 0xc5, 0x73, 0x03, 0x73, 0xa9,
-  0x41, 0xec, 0xfc, 0xc6, 0xc4, 0xb3, 0x4c, 0xf9, 0xd0, 0x61, 0x43, 0xfe,
+  0x70, 0xf9, 0x7f, 0xed, 0x7d, 0x6d, 0x7b, 0x1b, 0xc7, 0x91, 0xe0, 0x67,
+  0xea, 0x57, 0xf4, 0x41, 0x40, 0x08, 0xc8, 0x04, 0x25, 0x4a, 0xf1, 0xee,
+  0x86, 0x92, 0xb5, 0x76, 0x12, 0x27, 0xeb, 0x5b, 0x3b, 0xd1, 0xd9, 0xce,
+  0x65, 0x6f, 0xe3, 0x18, 0x1e, 0x00, 0x03, 0x72, 0xa2, 0x01, 0x06, 0x9e,
+  0x19, 0x50, 0xa4, 0x57, 0xd1, 0x6f, 0xbf, 0x7a, 0xed, 0xb7, 0x79, 0x03,
+  0x65, 0x27, 0xcf, 0xdd, 0x3e, 0xf1, 0x66, 0xc5, 0xc1, 0x4c, 0x75, 0x75,
+  0x75, 0x77, 0x75, 0x75, 0x75, 0x75, 0x75, 0xd5, 0xb9, 0x19, 0xfd, 0x79,
+  0x84, 0xc1, 0x46, 0x40, 0x20, 0xc2, 0xba, 0x05, 0x34, 0xcd, 0x46, 0x71,
+  0x0b, 0x59, 0xe5, 0x61, 0xd1, 0x4d, 0xf6, 0x31, 0xd5, 0x2d, 0xac, 0x1b,
+  0x54, 0xa9, 0xab, 0xb0, 0xae, 0x72, 0x2a, 0xb2, 0xec, 0x22, 0xe5, 0x14,
+  0x9a, 0xde, 0x85, 0x06, 0x70, 0x51, 0x35, 0x8d, 0x8e, 0xe0, 0xd2, 0xb4,
+  0x5e, 0x1d, 0x89, 0xc4, 0x5b, 0xae, 0x5a, 0xf4, 0xff, 0x13, 0xcf, 0x1f,
+  0xe0, 0xc4, 0x2e, 0x59, 0x7c, 0x50, 0xfa, 0x3b, 0x0c, 0xf7, 0x22, 0xc7,
+  0xa4, 0x3d, 0x47, 0xa4, 0x37, 0x19, 0x6e, 0x79, 0xc8, 0x4f, 0xe1, 0x8e,
+  0x06, 0xa6, 0x6a, 0xf2, 0x06, 0xef, 0x88, 0x5a, 0x98, 0xc3, 0x7a, 0xd5,
+  0x7a, 0xbe, 0x07, 0x56, 0xe9, 0x72, 0xc2, 0x14, 0x55, 0x59, 0x65, 0x65,
+  0x16, 0xe0, 0x71, 0x15, 0x2c, 0x11, 0xfc, 0x1a, 0x28, 0x16, 0x06, 0x8a,
+  0x56, 0x94, 0x6e, 0x4f, 0x81, 0xe2, 0xab, 0xca, 0x8d, 0x98, 0x75, 0x5e,
+  0x63, 0x3b, 0x2f, 0x49, 0x7c, 0x78, 0xd2, 0xc7, 0x37, 0xbb, 0x04, 0x4f,
+  0x8b, 0x1a, 0x8e, 0xbc, 0xaa, 0xa9, 0x47, 0xc4, 0xb3, 0xb7, 0x4c, 0xee,
+  0xab, 0xad, 0x8d, 0x56, 0xfe, 0x34, 0xcd, 0xd4, 0xf9, 0xde, 0xd7, 0x95,
+  0x6e, 0x27, 0xd1, 0x52, 0x07, 0x4e, 0xaf, 0x88, 0xd0, 0x86, 0x5a, 0x5e,
+  0x78, 0x35, 0x34, 0xb6, 0x98, 0xf9, 0x30, 0x91, 0x36, 0x58, 0x49, 0xef,
+  0x2e, 0x47, 0x76, 0x30, 0x2d, 0xdd, 0xa0, 0xeb, 0x13, 0x7e, 0xa7, 0xb0,
+  0x4b, 0xaa, 0x84, 0x6f, 0xf8, 0xe6, 0x0a, 0x23, 0x57, 0xdd, 0xc5, 0xea,
+  0x44, 0xb8, 0x1d, 0x2f, 0xf6, 0xd1, 0xc6, 0x87, 0xb6, 0x36, 0xad, 0x5d,
+  0x6d, 0x6b, 0x59, 0x5b, 0x14, 0x75, 0x99, 0x64, 0x39, 0xf9, 0x15, 0xec,
+  0x7f, 0xfc, 0x66, 0xa7, 0xb1, 0xe7, 0x6d, 0xe8, 0xfe, 0x39, 0x60, 0x6d,
+  0x58, 0xe1, 0x9d, 0x91, 0x95, 0x0f, 0x23, 0xfb, 0x6d, 0xeb, 0x74, 0x72,
+  0x37, 0x32, 0x39, 0x5f, 0xa4, 0x54, 0x3d, 0xaa, 0xcb, 0x2f, 0x92, 0x4d,
+  0xae, 0x9d, 0x6e, 0xfc, 0xd4, 0x43, 0xb7, 0xde, 0x69, 0x80, 0x6f, 0x0b,
+  0x95, 0x13, 0x01, 0x79, 0x05, 0x78, 0xe5, 0x05, 0x59, 0x20, 0xe5, 0xad,
+  0x6c, 0x62, 0x74, 0xa7, 0xd0, 0xbf, 0xe9, 0x0c, 0xcb, 0xd0, 0xa8, 0x4b,
+  0x89, 0xa6, 0xc5, 0x26, 0x22, 0x14, 0xed, 0xb2, 0xdd, 0x94, 0xca, 0x41,
+  0x63, 0x03, 0x8d, 0x62, 0xa1, 0x18, 0x13, 0xcb, 0xec, 0x6a, 0x93, 0x17,
+  0x14, 0xf1, 0x0a, 0xc9, 0x0b, 0x7f, 0xca, 0x7a, 0x23, 0x55, 0x72, 0x58,
+  0x2f, 0x07, 0x62, 0x67, 0x86, 0x78, 0x4b, 0xe8, 0xf9, 0xb2, 0x6c, 0x84,
+  0xa6, 0x9b, 0x7d, 0xa0, 0xda, 0x06, 0x4c, 0x10, 0x23, 0x89, 0x18, 0x87,
+  0xd6, 0x47, 0xb2, 0xae, 0xf8, 0x58, 0xd8, 0xea, 0xb2, 0xdd, 0xa9, 0x07,
+  0x92, 0xdf, 0x0e, 0xb2, 0xd6, 0xe0, 0x76, 0x16, 0x0d, 0x43, 0xcb, 0xbc,
+  0x58, 0xbd, 0x16, 0x1b, 0x91, 0xf1, 0xfa, 0xc2, 0x83, 0x1f, 0xc3, 0x2a,
+  0x9f, 0x22, 0x7c, 0xfd, 0x12, 0x9f, 0x5e, 0x3c, 0x46, 0xbb, 0x5d, 0x17,
+  0xec, 0x26, 0xc9, 0xab, 0x94, 0x60, 0xe9, 0x89, 0x81, 0x3d, 0xd8, 0x06,
+  0x21, 0x0d, 0x09, 0x20, 0xdd, 0xd9, 0x84, 0x9b, 0x06, 0x9a, 0x40, 0xa8,
+  0x02, 0xcc, 0x8c, 0xe3, 0xb8, 0xa0, 0x28, 0xb1, 0xc7, 0x70, 0x0d, 0xcc,
+  0x45, 0x52, 0x01, 0x2d, 0x49, 0x1f, 0x7d, 0x33, 0xc2, 0xd6, 0xe2, 0x11,
+  0x77, 0x4d, 0x2f, 0xd6, 0x69, 0x9e, 0x6d, 0xdd, 0xdb, 0x3f, 0x51, 0xd3,
+  0x66, 0xa3, 0xf6, 0xaf, 0x7f, 0xc6, 0xaf, 0x43, 0xc4, 0x8d, 0x51, 0x39,
+  0x19, 0xa4, 0x8d, 0xa0, 0x5c, 0xdb, 0xeb, 0x97, 0xff, 0x65, 0x6b, 0x7e,
+  0xf9, 0xd7, 0x63, 0xaa, 0xd9, 0x26, 0xcb, 0xea, 0x88, 0x2e, 0x40, 0x28,
+  0x57, 0x4d, 0x42, 0x35, 0x3c, 0x4e, 0x86, 0x1b, 0x01, 0xc2, 0xe3, 0x2f,
+  0x87, 0x2b, 0x8a, 0x1b, 0x31, 0xd8, 0x14, 0x07, 0xeb, 0x6a, 0x5a, 0xfd,
+  0x85, 0xab, 0x82, 0xbf, 0x43, 0x75, 0x4d, 0xee, 0x51, 0xd7, 0xe4, 0x47,
+  0xd6, 0x05, 0x9a, 0xe1, 0xad, 0xd6, 0x62, 0x1f, 0x23, 0xa6, 0x49, 0xda,
+  0x61, 0x1a, 0x68, 0x2e, 0x9e, 0x9c, 0x7b, 0xb1, 0x9f, 0x7a, 0x3e, 0xe7,
+  0xf8, 0x39, 0xae, 0x63, 0x00, 0x43, 0x03, 0xc2, 0x47, 0xe2, 0x16, 0x58,
+  0x84, 0x69, 0x5d, 0x5c, 0x3b, 0xb5, 0x2a, 0xa7, 0x79, 0x5f, 0xe7, 0xa4,
+  0x7a, 0xb7, 0xfb, 0xf7, 0xfa, 0x6b, 0x27, 0x49, 0x1d, 0x80, 0x76, 0x9d,
+  0x5b, 0x36, 0x56, 0xba, 0x86, 0x38, 0x12, 0x4f, 0x54, 0xa1, 0xd3, 0xff,
+  0xd5, 0xd2, 0x0c, 0x75, 0x5b, 0xbd, 0x77, 0x4b, 0x7c, 0xcb, 0xb6, 0xfa,
+  0x6e, 0x82, 0x1c, 0x31, 0x0d, 0xe7, 0x50, 0xdf, 0xc2, 0x6d, 0x97, 0x71,
+  0xb7, 0x8e, 0x07, 0xfb, 0x8f, 0x0d, 0x3b, 0x27, 0xf4, 0x2f, 0xed, 0xa5,
+  0xb7, 0xb4, 0xf3, 0x34, 0xf8, 0x21, 0xad, 0x13, 0x28, 0x73, 0xf5, 0x12,
+  0x1f, 0x5e, 0x3c, 0xbe, 0xea, 0x14, 0xbd, 0x93, 0x7e, 0x48, 0x5a, 0x72,
+  0x78, 0x77, 0xf2, 0xdb, 0x32, 0x4d, 0x5f, 0xc7, 0x71, 0xd1, 0x82, 0x4a,
+  0x27, 0x49, 0xbe, 0xbf, 0x66, 0x64, 0xfc, 0xd8, 0x57, 0xf1, 0xd8, 0x01,
+  0x0f, 0xc3, 0x4e, 0x96, 0x4a, 0x25, 0x3d, 0xf5, 0xc2, 0x5a, 0xd0, 0x41,
+  0xc8, 0xc9, 0x55, 0xb2, 0xdd, 0x0a, 0x5a, 0x7a, 0xec, 0xed, 0x28, 0x07,
+  0x3c, 0x08, 0x3b, 0x9e, 0x80, 0xb0, 0x56, 0x82, 0xe9, 0xb1, 0x17, 0xda,
+  0x01, 0x0f, 0xc3, 0x4e, 0xd2, 0x7d, 0x95, 0xe5, 0x18, 0x4e, 0x0b, 0x71,
+  0xcb, 0x8f, 0xde, 0x12, 0x7e, 0x81, 0x63, 0xe0, 0x1d, 0x47, 0x4c, 0x86,
+  0x98, 0x07, 0xa8, 0x51, 0xd0, 0x21, 0x48, 0x05, 0x1c, 0xc4, 0x08, 0x2a,
+  0xaf, 0xe2, 0xa4, 0xc7, 0x5e, 0x68, 0x07, 0x3c, 0x0c, 0x3b, 0xc9, 0x0a,
+  0x45, 0x8c, 0x4f, 0xbd, 0xb0, 0x16, 0x74, 0x10, 0x72, 0xf2, 0x1a, 0x66,
+  0xa1, 0xa0, 0xa5, 0xc7, 0x5e, 0x68, 0x07, 0x3c, 0x0c, 0x3b, 0x91, 0x83,
+  0x1f, 0x42, 0xcd, 0xcf, 0xbd, 0xf0, 0x1e, 0xf8, 0x11, 0xd0, 0x93, 0xed,
+  0x81, 0x31, 0x6f, 0x0f, 0xbd, 0x70, 0x02, 0x36, 0x00, 0x35, 0xd9, 0x09,
+  0xb6, 0x5d, 0x3f, 0x9c, 0x80, 0x0d, 0x40, 0x4d, 0x6e, 0x33, 0xc6, 0x76,
+  0x9b, 0xf5, 0xc2, 0x09, 0xd8, 0x00, 0xd4, 0xa4, 0xd8, 0x66, 0xab, 0x52,
+  0x67, 0x8c, 0xfc, 0xe8, 0x2d, 0xe1, 0x17, 0x38, 0x06, 0x7e, 0xb2, 0x47,
+  0x42, 0xaa, 0x97, 0xf0, 0xf7, 0xc5, 0xe3, 0xaa, 0x1b, 0x6e, 0xcf, 0xf4,
+  0xee, 0x07, 0xe8, 0x2d, 0xaf, 0x0b, 0xa6, 0x15, 0x1e, 0x7a, 0x21, 0x15,
+  0x70, 0x08, 0x6e, 0x52, 0x65, 0x57, 0x2a, 0xe7, 0xe8, 0xb1, 0x17, 0xda,
+  0x01, 0x0f, 0xc3, 0x4e, 0xea, 0x44, 0x06, 0x1e, 0x1e, 0xfa, 0x67, 0xaa,
+  0x00, 0x0e, 0xc1, 0x4d, 0x0e, 0xbe, 0x7c, 0x3b, 0x1c, 0x21, 0xaf, 0xfc,
+  0x02, 0xc7, 0xc0, 0x4f, 0xf6, 0xd7, 0xc2, 0x5e, 0xf0, 0xd0, 0x0b, 0xa9,
+  0x80, 0x43, 0x70, 0x93, 0x95, 0x62, 0x5c, 0x0d, 0x40, 0x2a, 0xe0, 0x10,
+  0xdc, 0x04, 0xda, 0x21, 0x34, 0x56, 0x03, 0x34, 0x0a, 0xe0, 0x10, 0x1c,
+  0x30, 0x7e, 0x7a, 0x95, 0xe8, 0x1c, 0x80, 0xc7, 0x81, 0x19, 0xa0, 0xc0,
+  0x83, 0xb0, 0x6f, 0xc7, 0x93, 0x4f, 0x70, 0xfd, 0x7e, 0xcb, 0xb8, 0x3f,
+  0x19, 0x5a, 0xcb, 0xdf, 0x8e, 0x3d, 0xf0, 0x23, 0xa0, 0x27, 0xbf, 0x04,
+  0xc1, 0x2e, 0xc8, 0x7f, 0x39, 0x20, 0xe3, 0xdf, 0x8e, 0x1d, 0xf0, 0x30,
+  0xec, 0xe4, 0xb7, 0xb8, 0x8e, 0x0b, 0xea, 0xdf, 0x0e, 0xad, 0xe9, 0x6f,
+  0xc7, 0x1e, 0xf8, 0x11, 0xd0, 0x93, 0x5f, 0xe3, 0x5a, 0x2e, 0xd8, 0x7f,
+  0x3d, 0xb4, 0xae, 0xbf, 0x1d, 0x7b, 0xe0, 0x47, 0x40, 0x4f, 0x3e, 0x65,
+  0x4e, 0x17, 0xfc, 0x9f, 0x0e, 0xf3, 0xfd, 0xdb, 0x71, 0x50, 0xe4, 0xa8,
+  0x12, 0x93, 0xff, 0x74, 0x7d, 0xff, 0x9f, 0x83, 0xfd, 0xe9, 0x80, 0x87,
+  0x61, 0x27, 0x9f, 0x5a, 0xc4, 0x9f, 0x0e, 0xc1, 0x5a, 0xd0, 0x41, 0x48,
+  0x8c, 0xed, 0x62, 0xf1, 0x7e, 0x3d, 0xa4, 0x11, 0xbc, 0x1d, 0x7b, 0xe0,
+  0x47, 0x40, 0x4f, 0x3e, 0x2b, 0x2c, 0xf2, 0xcf, 0x06, 0xf4, 0x82, 0xb7,
+  0x63, 0x07, 0x3c, 0x0c, 0x3b, 0xf9, 0x77, 0xd4, 0x06, 0x04, 0xf5, 0xbf,
+  0x0f, 0x69, 0x06, 0x6f, 0xc7, 0x1e, 0xf8, 0x11, 0xd0, 0x93, 0xcf, 0x49,
+  0x1d, 0x10, 0xf4, 0x9f, 0x0f, 0xea, 0x06, 0x6f, 0xc7, 0x7e, 0x81, 0x63,
+  0xe0, 0x27, 0x5f, 0x1c, 0x04, 0xfb, 0x17, 0xbd, 0xd2, 0xfd, 0xed, 0x58,
+  0x01, 0x87, 0xe0, 0x26, 0xbf, 0x53, 0x8c, 0xbf, 0x1b, 0x80, 0x54, 0xc0,
+  0x21, 0xb8, 0xc9, 0x7f, 0x64, 0x82, 0xf1, 0x3f, 0x7a, 0x25, 0xe5, 0xdb,
+  0xb1, 0x02, 0x0e, 0xc1, 0x4d, 0x7e, 0xcf, 0xba, 0x81, 0xa0, 0xfd, 0xfd,
+  0xb0, 0xa6, 0xf0, 0x76, 0x1c, 0x14, 0x39, 0xaa, 0xc4, 0xe4, 0xcb, 0xeb,
+  0x42, 0x6a, 0xf8, 0xb2, 0x7f, 0x9d, 0x7f, 0x3b, 0xb6, 0xa0, 0x83, 0x90,
+  0x93, 0xaf, 0x70, 0x6d, 0x17, 0xbc, 0x5f, 0x0d, 0xad, 0xf3, 0x6f, 0xc7,
+  0x1e, 0xf8, 0x11, 0xd0, 0x93, 0xaf, 0x13, 0x1d, 0xbe, 0xaf, 0xfb, 0xd7,
+  0x7b, 0x98, 0x83, 0x0a, 0x3a, 0x08, 0x39, 0xf9, 0x43, 0x20, 0xf3, 0xfe,
+  0x70, 0x8c, 0x04, 0x0b, 0x8a, 0x1c, 0x55, 0x62, 0xf2, 0xea, 0x5a, 0x19,
+  0xe5, 0x55, 0xff, 0x2a, 0xfd, 0x76, 0x6c, 0x41, 0x07, 0x21, 0x27, 0xbf,
+  0xb2, 0x58, 0x7f, 0x35, 0x04, 0x6b, 0x41, 0x07, 0x21, 0x27, 0xaf, 0x2a,
+  0x4b, 0x6b, 0xff, 0xfa, 0x0f, 0xb4, 0x2a, 0xe8, 0x20, 0x24, 0x70, 0x32,
+  0xac, 0xf9, 0x96, 0xab, 0x07, 0xd7, 0x7f, 0x0f, 0xfc, 0x08, 0xe8, 0xc9,
+  0x2b, 0x4b, 0xf2, 0x10, 0xc5, 0x4a, 0x70, 0x13, 0x2e, 0xda, 0xd8, 0xb1,
+  0xf6, 0xdd, 0xaf, 0x7c, 0x4f, 0x52, 0x86, 0x4a, 0x7b, 0xa1, 0xb2, 0xdd,
+  0x86, 0xc0, 0xe0, 0x6f, 0x2f, 0xdc, 0x96, 0x01, 0xb7, 0xc5, 0xcb, 0x39,
+  0xd9, 0x64, 0x3a, 0x8a, 0x04, 0x56, 0x28, 0xbe, 0xb7, 0x60, 0x46, 0xfc,
+  0xb7, 0x1b, 0xee, 0xfb, 0x43, 0x61, 0xcd, 0x8f, 0x72, 0x48, 0xd9, 0x62,
+  0x1a, 0x64, 0xa8, 0x29, 0xd1, 0x70, 0x2a, 0x76, 0x21, 0xcf, 0xd0, 0xd8,
+  0x04, 0xf5, 0x21, 0x3b, 0x9a, 0x25, 0x90, 0x4f, 0x9f, 0x5c, 0x04, 0xb6,
+  0xc0, 0x00, 0x84, 0x4c, 0x61, 0xfc, 0x91, 0x8f, 0x37, 0x5b, 0x68, 0x23,
+  0x18, 0x26, 0xed, 0xb2, 0x9f, 0x34, 0x82, 0xf4, 0x01, 0xbb, 0x28, 0x23,
+  0xc0, 0x8b, 0x7f, 0xe9, 0x36, 0x52, 0x12, 0xc0, 0xd3, 0x27, 0xbd, 0x84,
+  0x1f, 0x41, 0xb7, 0x92, 0x3d, 0x4c, 0xb7, 0x09, 0x00, 0x7b, 0xe8, 0xf6,
+  0xc9, 0xce, 0x5b, 0xc8, 0xee, 0xa5, 0x7a, 0x8d, 0xa1, 0x5d, 0xd3, 0x21,
+  0xc2, 0x05, 0x4a, 0x68, 0xff, 0xa8, 0x9f, 0x76, 0x01, 0x0e, 0x60, 0xbb,
+  0xc8, 0x17, 0xd8, 0xbe, 0x16, 0x08, 0xc8, 0x40, 0x23, 0xf8, 0x22, 0xfa,
+  0x70, 0x33, 0x18, 0x4e, 0x07, 0x61, 0xb8, 0x25, 0x0c, 0x1f, 0x82, 0xf7,
+  0x34, 0x86, 0xc1, 0x07, 0x9a, 0xc3, 0x40, 0x7d, 0x0d, 0x4a, 0x4a, 0x3c,
+  0xc4, 0x19, 0x68, 0x0d, 0x03, 0x71, 0x53, 0xe6, 0x2f, 0xfb, 0x5b, 0xc2,
+  0xb0, 0x01, 0x68, 0x57, 0x2b, 0x18, 0xf4, 0xe9, 0x87, 0x5d, 0x0d, 0x88,
+  0xbe, 0x37, 0x89, 0xdf, 0x24, 0x18, 0x8a, 0x12, 0xbd, 0xbc, 0x44, 0xc6,
+  0xc8, 0xf1, 0x7d, 0x4b, 0x13, 0x1c, 0x28, 0x37, 0xe3, 0x7f, 0xf4, 0xb7,
+  0xc2, 0x81, 0xfb, 0xd0, 0x5d, 0x0d, 0x71, 0xd0, 0x17, 0xff, 0xd4, 0x73,
+  0x3e, 0x91, 0xde, 0xee, 0xed, 0x19, 0x96, 0x7b, 0x9e, 0x35, 0x61, 0x2e,
+  0x7e, 0xde, 0x3d, 0xaa, 0x0c, 0xf0, 0xec, 0x17, 0x9d, 0x43, 0x3a, 0xa9,
+  0x0e, 0x5b, 0xf3, 0x8b, 0x4e, 0xf1, 0x32, 0xd9, 0x53, 0x6e, 0x95, 0xda,
+  0xfc, 0xe2, 0xc3, 0x18, 0x05, 0xe5, 0x48, 0x41, 0x67, 0x42, 0xf2, 0x53,
+  0x9c, 0x27, 0xbb, 0xab, 0x3c, 0x9d, 0x2f, 0xcb, 0x04, 0x23, 0x38, 0x4a,
+  0xfa, 0x85, 0xdd, 0x0a, 0xeb, 0x3f, 0x37, 0xc9, 0xb7, 0x2f, 0xea, 0x97,
+  0x78, 0xae, 0x7f, 0x0d, 0x23, 0x94, 0x7c, 0xfb, 0xed, 0x8e, 0x73, 0x34,
+  0x9c, 0x37, 0x0f, 0x21, 0x88, 0xde, 0xe0, 0x08, 0xc2, 0xf7, 0x44, 0xd4,
+  0x03, 0x88, 0xd0, 0x51, 0x0c, 0xcb, 0xcc, 0x2b, 0x8a, 0x57, 0x1a, 0xba,
+  0x5e, 0xc5, 0x0e, 0x79, 0x49, 0x67, 0xe9, 0x86, 0x43, 0x9e, 0x5c, 0xd9,
+  0xec, 0xa9, 0xa2, 0xcd, 0xd5, 0xc2, 0xc3, 0xd5, 0xe6, 0x49, 0x8d, 0x91,
+  0x30, 0xc2, 0x38, 0x77, 0xdc, 0x41, 0x42, 0xd1, 0x06, 0x0a, 0x25, 0xec,
+  0xe7, 0xe2, 0xd3, 0x79, 0x0b, 0x20, 0xce, 0x43, 0xd3, 0x7a, 0xaf, 0x38,
+  0xf7, 0x7a, 0x09, 0x15, 0x4f, 0xa1, 0xa1, 0x28, 0xe5, 0xd2, 0x03, 0xe7,
+  0x69, 0xdd, 0x16, 0x91, 0x04, 0xea, 0x98, 0x79, 0x2e, 0x4b, 0x36, 0x2c,
+  0x09, 0xbe, 0x47, 0x27, 0x24, 0xa6, 0xc1, 0x7b, 0xd3, 0x1b, 0x95, 0x24,
+  0x4b, 0xbb, 0x22, 0x92, 0x9c, 0xb4, 0xf9, 0x38, 0x45, 0x71, 0x48, 0xb8,
+  0x06, 0xa6, 0xb7, 0xbd, 0x1a, 0x68, 0xc4, 0x6e, 0xe5, 0xc5, 0x94, 0xf0,
+  0x2a, 0x46, 0x67, 0x00, 0xef, 0x30, 0xd9, 0x8b, 0x24, 0x72, 0x12, 0x41,
+  0xba, 0x40, 0x26, 0xbe, 0x1b, 0xf8, 0x71, 0xb1, 0x4c, 0xb4, 0x9f, 0x42,
+  0x77, 0x19, 0x99, 0x6f, 0xce, 0x17, 0x05, 0x5b, 0xd2, 0x16, 0xd4, 0xa4,
+  0x23, 0x6e, 0x4a, 0x10, 0xca, 0xc4, 0x1f, 0xca, 0xaf, 0xd9, 0xe5, 0x98,
+  0x2f, 0xb4, 0xfa, 0xa3, 0xa9, 0x77, 0x87, 0x71, 0x54, 0xb7, 0x5b, 0x8c,
+  0x62, 0x5c, 0xed, 0x0d, 0x32, 0x07, 0x37, 0x49, 0x13, 0x06, 0x50, 0xc6,
+  0x21, 0xf4, 0x0f, 0xa6, 0x18, 0x42, 0x94, 0xb6, 0x80, 0x53, 0x6f, 0x89,
+  0x3f, 0xf0, 0x61, 0x67, 0x53, 0x04, 0x51, 0xb9, 0xf0, 0x6c, 0x0f, 0xd1,
+  0x79, 0xc7, 0x93, 0x40, 0xdd, 0x5c, 0x68, 0xb4, 0x97, 0xd0, 0x2a, 0xe3,
+  0x42, 0xb3, 0x40, 0xcf, 0xb6, 0xfa, 0x08, 0x62, 0x90, 0x78, 0x7b, 0x23,
+  0xce, 0x5e, 0xa4, 0x66, 0xec, 0xd3, 0x17, 0xf4, 0x60, 0x2e, 0x9e, 0x38,
+  0x1f, 0x71, 0xa6, 0x81, 0x5e, 0xbb, 0x4b, 0xba, 0xb6, 0xb2, 0x9e, 0x5a,
+  0xc2, 0xb2, 0x6d, 0x31, 0x65, 0xee, 0x41, 0xb2, 0x31, 0xde, 0x98, 0xfb,
+  0x87, 0x8c, 0x5d, 0x53, 0x5d, 0x24, 0x42, 0x3c, 0xd7, 0xfb, 0x66, 0x7a,
+  0xc8, 0x53, 0x7d, 0x47, 0xab, 0x1e, 0xe7, 0x53, 0x27, 0xd1, 0xa8, 0x54,
+  0x98, 0x40, 0xad, 0x93, 0xeb, 0x4f, 0x1c, 0x54, 0x0b, 0xc7, 0x37, 0xdc,
+  0xe2, 0xe4, 0xee, 0x55, 0xc4, 0x52, 0x0d, 0xa7, 0xf0, 0x40, 0xe4, 0xfc,
+  0x74, 0xac, 0xa6, 0x9e, 0x34, 0x2e, 0xb8, 0xc1, 0x20, 0xbb, 0x51, 0xc3,
+  0x64, 0xf4, 0x88, 0x5a, 0xfd, 0xdb, 0xc5, 0x70, 0xcc, 0x6d, 0x6d, 0xac,
+  0xd6, 0x98, 0x91, 0x31, 0xd3, 0xf9, 0x75, 0xf5, 0xb0, 0x5d, 0x1c, 0xad,
+  0xa8, 0x8f, 0xf5, 0x06, 0x50, 0x0e, 0x31, 0x1f, 0xaf, 0xe8, 0xcc, 0x48,
+  0x6d, 0x8a, 0x41, 0x1b, 0xd8, 0xc5, 0xb3, 0x0f, 0x3b, 0x75, 0x03, 0x0b,
+  0xf2, 0xf3, 0x6e, 0x85, 0x0f, 0x45, 0x21, 0xdf, 0xe9, 0xb9, 0x55, 0xbf,
+  0xe9, 0x16, 0x35, 0x44, 0xa1, 0x48, 0xfb, 0x39, 0xf7, 0xb5, 0x9f, 0x86,
+  0xaa, 0xd4, 0x0d, 0xda, 0x54, 0x94, 0x14, 0xf6, 0xe2, 0xa2, 0x5b, 0xc1,
+  0xb1, 0x30, 0x4f, 0xba, 0x75, 0x9c, 0xed, 0x31, 0x6d, 0x50, 0xb2, 0xf4,
+  0xe2, 0x51, 0x07, 0xfd, 0x1e, 0xf5, 0x8f, 0xfa, 0xa9, 0x17, 0xba, 0x9e,
+  0x76, 0xd3, 0xde, 0x80, 0x68, 0x50, 0x2e, 0x57, 0xa9, 0xfa, 0x49, 0x57,
+  0xa0, 0x21, 0xda, 0x1d, 0xdc, 0x20, 0xf1, 0x0a, 0xda, 0x43, 0x7d, 0x0b,
+  0x48, 0x8b, 0x72, 0xf9, 0x7d, 0xa9, 0xac, 0xea, 0x1e, 0x5b, 0xc2, 0x21,
+  0xe0, 0xb7, 0xe3, 0x1c, 0x92, 0x49, 0x68, 0x7c, 0xcf, 0x0e, 0x27, 0xde,
+  0x4c, 0x21, 0x51, 0xf2, 0x3d, 0xbb, 0xc5, 0xb4, 0x7b, 0xac, 0x87, 0x9b,
+  0xfd, 0x8c, 0x73, 0x98, 0xd1, 0x1c, 0x0a, 0x7f, 0x37, 0x0d, 0x03, 0xf4,
+  0x8d, 0xf7, 0x01, 0x8f, 0x87, 0x0d, 0x0e, 0x04, 0xed, 0x03, 0xf7, 0xd9,
+  0x1c, 0x08, 0xf8, 0xe2, 0xe9, 0x53, 0xbf, 0x93, 0x41, 0xbc, 0xae, 0x41,
+  0x72, 0x16, 0x26, 0x59, 0x6a, 0x4a, 0x9c, 0xae, 0x72, 0xcf, 0xda, 0x7a,
+  0xde, 0xf3, 0xe8, 0xb1, 0xc4, 0xfb, 0x5d, 0xfb, 0xd3, 0x7b, 0x5c, 0x47,
+  0x8e, 0x4d, 0x1b, 0xd8, 0x03, 0xb8, 0xe5, 0xa7, 0xcf, 0xb7, 0xc9, 0xe1,
+  0x09, 0x63, 0xc2, 0x35, 0x64, 0x69, 0x3c, 0xd2, 0x2a, 0x50, 0xa9, 0xaa,
+  0xd1, 0xac, 0x75, 0xcc, 0xfb, 0x7d, 0xa3, 0xc6, 0x94, 0x03, 0xd0, 0xfa,
+  0x98, 0xd1, 0x8f, 0x39, 0xdd, 0xd4, 0xe9, 0xe0, 0x51, 0x1f, 0xa4, 0xd1,
+  0x9f, 0x18, 0x47, 0xe0, 0xce, 0x3c, 0x3c, 0x1d, 0xeb, 0x55, 0x28, 0x55,
+  0xe0, 0xa7, 0x7e, 0x61, 0xe3, 0x15, 0xb3, 0x7b, 0x8b, 0xc6, 0x6d, 0x8e,
+  0x8e, 0x9a, 0xd5, 0xd1, 0xf5, 0xf9, 0x73, 0x41, 0xc6, 0x69, 0xee, 0x28,
+  0x69, 0x24, 0x6c, 0x75, 0xf8, 0xe5, 0x4c, 0xb2, 0xc3, 0xcd, 0x4c, 0x62,
+  0x96, 0x33, 0xba, 0x78, 0x11, 0xec, 0xa2, 0x5a, 0xee, 0x3e, 0xd8, 0x1e,
+  0xfa, 0x8e, 0x5d, 0xb9, 0xc8, 0x77, 0x95, 0xb1, 0xb1, 0xf3, 0xea, 0x8b,
+  0xfd, 0xe3, 0x97, 0xee, 0x9a, 0xb1, 0x6c, 0xad, 0x68, 0x9d, 0x0d, 0x39,
+  0x08, 0x97, 0x60, 0x7d, 0x93, 0xe8, 0x05, 0xe0, 0x63, 0xab, 0x40, 0xef,
+  0x4b, 0xf2, 0xfb, 0x84, 0xbf, 0xe2, 0xe1, 0xb9, 0x6f, 0xd4, 0x5a, 0x47,
+  0xe8, 0xa8, 0x55, 0xde, 0x45, 0xd0, 0x4d, 0x86, 0xfc, 0x91, 0xed, 0x36,
+  0x29, 0x70, 0xc0, 0x2a, 0xb5, 0x37, 0xd2, 0x9a, 0x2a, 0x7f, 0xbd, 0x34,
+  0x16, 0xcc, 0xe9, 0x52, 0x5e, 0x9c, 0x43, 0x8b, 0x4d, 0x2f, 0x86, 0x75,
+  0xe1, 0x0a, 0xef, 0xca, 0x03, 0x5e, 0x29, 0x60, 0xb1, 0x1a, 0x60, 0x55,
+  0xca, 0xb7, 0xf9, 0xd1, 0x3b, 0x4c, 0x6d, 0x95, 0xeb, 0xb3, 0x86, 0x45,
+  0xb0, 0x3c, 0xc4, 0xf5, 0x29, 0xb4, 0xad, 0xd0, 0x10, 0x9e, 0x91, 0x19,
+  0x91, 0xd7, 0x6f, 0xb0, 0xa7, 0x70, 0xa5, 0x14, 0x6f, 0x67, 0xa9, 0x20,
+  0x0e, 0x89, 0x0d, 0xe4, 0x1b, 0xe6, 0xba, 0x6c, 0xeb, 0x25, 0xc9, 0xa0,
+  0xf9, 0x8a, 0x14, 0xba, 0x8e, 0x9e, 0xaa, 0xdb, 0x4a, 0x7a, 0x9a, 0x27,
+  0xdf, 0xe9, 0xde, 0xf9, 0x77, 0xba, 0xef, 0x5c, 0x14, 0x8c, 0x36, 0xe6,
+  0xbc, 0x9b, 0x79, 0xcd, 0x74, 0x5a, 0x7d, 0x8d, 0x01, 0x29, 0xeb, 0x35,
+  0x86, 0xe7, 0xd9, 0x27, 0xab, 0x14, 0xd9, 0x92, 0x7e, 0x3e, 0xc6, 0x2f,
+  0x23, 0xbf, 0x0c, 0xd1, 0x64, 0xcb, 0xc7, 0x7b, 0xb5, 0xbb, 0x99, 0x46,
+  0x2a, 0x6a, 0xe2, 0x1e, 0x35, 0xbf, 0x05, 0x95, 0xd8, 0xaf, 0xfa, 0x9e,
+  0x0b, 0x79, 0x01, 0x19, 0xec, 0xec, 0xc2, 0x5f, 0xc8, 0xf1, 0x8f, 0xa9,
+  0x37, 0x9c, 0xcd, 0x00, 0xd4, 0x67, 0xbd, 0x51, 0x88, 0xc6, 0x17, 0xbc,
+  0xe7, 0x54, 0x16, 0x6b, 0x34, 0x8f, 0x14, 0x37, 0x92, 0x63, 0x02, 0xa3,
+  0xa0, 0x95, 0xa8, 0x5d, 0x9f, 0xd1, 0xe5, 0x5d, 0x83, 0x39, 0xe5, 0x5e,
+  0x7c, 0x24, 0x5b, 0x7c, 0x78, 0xb8, 0xce, 0xae, 0xae, 0x19, 0x13, 0x8b,
+  0x50, 0x28, 0x8b, 0x39, 0x07, 0xcd, 0x16, 0x3d, 0xdf, 0x37, 0x79, 0x7a,
+  0x9b, 0x61, 0x98, 0xba, 0xf3, 0x73, 0x8c, 0x8e, 0xd0, 0x34, 0xf7, 0xc8,
+  0xa2, 0xab, 0x4f, 0xa1, 0xc1, 0x27, 0x77, 0x10, 0x79, 0x07, 0x88, 0xda,
+  0x84, 0xfa, 0xf0, 0x8c, 0x87, 0x2a, 0x1a, 0x0f, 0x57, 0x34, 0xee, 0xac,
+  0x88, 0xdb, 0x9e, 0x26, 0x55, 0x96, 0xdf, 0xe1, 0x55, 0xe4, 0x94, 0xd2,
+  0xbc, 0xd6, 0x05, 0xa6, 0x89, 0x2b, 0x76, 0x67, 0x7c, 0x4b, 0xb7, 0x4a,
+  0x57, 0xf5, 0x99, 0x29, 0x30, 0x64, 0x44, 0xb1, 0x6f, 0xde, 0x83, 0xc2,
+  0x4a, 0x5b, 0x02, 0x1e, 0x40, 0xbd, 0xa3, 0x17, 0x15, 0xe7, 0xf2, 0x01,
+  0x86, 0x47, 0xa8, 0x60, 0x9b, 0x45, 0x35, 0x5f, 0x15, 0x75, 0x9d, 0xe0,
+  0x75, 0x5a, 0x4c, 0x70, 0x4c, 0xb9, 0x6e, 0x30, 0xf5, 0x2b, 0x2c, 0xd8,
+  0x37, 0x7c, 0x51, 0xa4, 0xba, 0x68, 0x2c, 0x92, 0x71, 0x18, 0xdf, 0x12,
+  0x6f, 0xeb, 0x50, 0x10, 0x35, 0xca, 0x76, 0x47, 0xc5, 0x78, 0x7c, 0xe1,
+  0xe5, 0x88, 0x9f, 0x3e, 0xc2, 0x81, 0x4f, 0xcb, 0x3c, 0xdb, 0x66, 0xf5,
+  0xc8, 0xbf, 0x56, 0x8b, 0xa1, 0x0f, 0x30, 0x69, 0x2f, 0xc7, 0x2e, 0x75,
+  0x2b, 0xa8, 0x3c, 0x7a, 0x1c, 0xd8, 0x15, 0x3d, 0xb8, 0x65, 0xaf, 0xf1,
+  0xdd, 0xf4, 0x0c, 0x1a, 0x7f, 0xf6, 0x31, 0xd5, 0x6d, 0xe7, 0x74, 0xbc,
+  0x45, 0xdb, 0x3d, 0x7e, 0x19, 0xae, 0xcf, 0x16, 0xf2, 0xec, 0x63, 0x68,
+  0xb6, 0x5b, 0x9c, 0xab, 0xad, 0x72, 0x7d, 0x53, 0xdf, 0xeb, 0xea, 0x79,
+  0xab, 0x9c, 0x04, 0x9b, 0x67, 0x64, 0x5a, 0x4f, 0xde, 0x04, 0xdf, 0x90,
+  0xcf, 0xa4, 0xa9, 0x38, 0x6c, 0x1e, 0x51, 0xfe, 0x28, 0x22, 0x23, 0x79,
+  0xa3, 0x38, 0xfb, 0xbb, 0x0d, 0x12, 0xdf, 0x2b, 0x95, 0x71, 0x72, 0x8a,
+  0xce, 0xd9, 0xd1, 0xc3, 0xc4, 0x0b, 0x5f, 0xb1, 0xcf, 0x31, 0x4e, 0x85,
+  0xa5, 0xb6, 0x64, 0x75, 0xcd, 0x8b, 0x09, 0x72, 0xf4, 0x18, 0x1b, 0x6f,
+  0x90, 0x63, 0x55, 0x0b, 0xde, 0x73, 0x55, 0x4e, 0xa2, 0x8f, 0x3a, 0x06,
+  0x7b, 0x78, 0xb4, 0x59, 0x56, 0x90, 0x34, 0x2b, 0xdd, 0xbd, 0x82, 0xac,
+  0x55, 0xcf, 0x1e, 0xf7, 0x80, 0xc5, 0xcc, 0x93, 0xc5, 0x0a, 0x2d, 0x73,
+  0xcf, 0x11, 0xa3, 0x69, 0xfb, 0xe5, 0xf9, 0x73, 0xa9, 0x0f, 0xb3, 0x62,
+  0xe3, 0xf5, 0x92, 0xca, 0x3c, 0x36, 0x3f, 0x33, 0x3c, 0xbe, 0x37, 0x49,
+  0x8b, 0x66, 0xda, 0xca, 0x18, 0xa8, 0x8c, 0xd9, 0xfc, 0xcf, 0xda, 0xd5,
+  0xb2, 0x98, 0xb9, 0x50, 0x92, 0x50, 0xfa, 0x99, 0xbd, 0x85, 0x15, 0xa8,
+  0x42, 0x30, 0x83, 0xa1, 0x61, 0xc0, 0x9e, 0xb4, 0x48, 0x3b, 0xfe, 0xa4,
+  0x95, 0x04, 0xfb, 0x57, 0x62, 0x61, 0x04, 0x13, 0xb0, 0x7a, 0xb9, 0xa6,
+  0xe3, 0x56, 0x01, 0xba, 0xe1, 0xa0, 0x49, 0xbe, 0x81, 0xcb, 0xd7, 0x99,
+  0x90, 0x79, 0x90, 0x4a, 0x4a, 0x4a, 0xb1, 0xa5, 0x6c, 0x45, 0x42, 0xd6,
+  0x87, 0xf6, 0x62, 0x18, 0x75, 0x1f, 0xae, 0x30, 0xda, 0x6a, 0x4c, 0x97,
+  0xf6, 0xac, 0xb7, 0x03, 0x99, 0x0d, 0x00, 0xef, 0x05, 0xac, 0x90, 0x74,
+  0x6f, 0x17, 0x56, 0xa0, 0x27, 0xb2, 0xdc, 0x5f, 0x67, 0x01, 0xa6, 0x9f,
+  0xf7, 0x62, 0xf2, 0xee, 0xf2, 0x47, 0x7d, 0x13, 0xf4, 0x06, 0xf2, 0x1b,
+  0x90, 0x68, 0xe3, 0x85, 0xc4, 0x4c, 0xc9, 0x10, 0xd7, 0xd9, 0x00, 0x80,
+  0x74, 0x69, 0x43, 0xaa, 0x05, 0x9d, 0x6a, 0xb8, 0x5b, 0xdb, 0xba, 0x74,
+  0xd6, 0xe0, 0x6f, 0x9a, 0xf6, 0xba, 0xa2, 0xb8, 0xe7, 0xf8, 0x08, 0x1c,
+  0x6d, 0xea, 0x03, 0xc7, 0x66, 0x04, 0x73, 0xdc, 0xa9, 0x19, 0x81, 0xf6,
+  0x9c, 0xe5, 0x45, 0xdf, 0x5b, 0x77, 0x87, 0x4c, 0xac, 0xdb, 0x55, 0x18,
+  0xba, 0x37, 0x87, 0x97, 0x01, 0x39, 0xcc, 0x32, 0xad, 0xa3, 0x79, 0x82,
+  0xa1, 0x2d, 0x34, 0xde, 0x70, 0x52, 0x5e, 0xe1, 0x1a, 0x4b, 0x25, 0x3b,
+  0xa6, 0x9e, 0x24, 0x36, 0xec, 0x11, 0xa5, 0x54, 0xda, 0x86, 0x02, 0x22,
+  0x39, 0x7c, 0x58, 0x22, 0x59, 0x62, 0x55, 0x84, 0xfd, 0x2e, 0xa5, 0x7b,
+  0x5d, 0xa7, 0xe5, 0x2e, 0x4d, 0x80, 0x7f, 0x46, 0xed, 0x92, 0x95, 0xda,
+  0xa8, 0x82, 0x95, 0xf3, 0x2f, 0xda, 0xc8, 0xa7, 0x67, 0x9a, 0xbf, 0xf1,
+  0x38, 0xe9, 0x28, 0x81, 0xc5, 0x28, 0x3f, 0xa4, 0x46, 0x22, 0x9a, 0x8e,
+  0xf7, 0xf9, 0xa1, 0x6a, 0x9d, 0xb6, 0xf9, 0x96, 0x77, 0x30, 0x40, 0x97,
+  0x6c, 0x5f, 0xc2, 0x69, 0xcb, 0xcd, 0x21, 0x03, 0xff, 0x07, 0x64, 0xcd,
+  0x6c, 0x61, 0xc6, 0x48, 0x7a, 0xe6, 0xdb, 0x70, 0xce, 0x8e, 0xc9, 0xaa,
+  0xf9, 0xe3, 0x6a, 0xb7, 0x2e, 0x1a, 0xf7, 0xae, 0x9d, 0x54, 0xa6, 0x37,
+  0x59, 0x95, 0xfe, 0x28, 0x02, 0x8e, 0xaf, 0xb6, 0x31, 0xa9, 0xec, 0x4d,
+  0xd0, 0xc4, 0x5b, 0x2c, 0x50, 0xe1, 0xc3, 0xd8, 0x00, 0x26, 0xa9, 0xa7,
+  0xeb, 0x6c, 0xb3, 0x99, 0x6e, 0xa6, 0x30, 0xbc, 0x67, 0xb7, 0x1f, 0x25,
+  0xb3, 0x98, 0xb7, 0xe3, 0x2b, 0x9d, 0x83, 0x2b, 0x44, 0x18, 0x8b, 0x84,
+  0xc2, 0x30, 0x0f, 0xad, 0x00, 0x3d, 0x8b, 0x2c, 0x9a, 0x28, 0x92, 0xda,
+  0x6a, 0x1b, 0x06, 0xa5, 0x0e, 0xc3, 0xc4, 0x16, 0x6f, 0xfc, 0x08, 0x95,
+  0xf9, 0x36, 0x8d, 0xa4, 0xf6, 0x17, 0xd2, 0xe7, 0xcf, 0x97, 0xd9, 0xae,
+  0xd8, 0x52, 0x68, 0x92, 0x22, 0xdd, 0x6c, 0xb2, 0x15, 0x1a, 0x74, 0xaa,
+  0xb0, 0xbb, 0x2c, 0x08, 0xb7, 0x7e, 0x75, 0x5d, 0xa0, 0x36, 0xaa, 0x72,
+  0x28, 0xee, 0x1c, 0xf9, 0xec, 0x77, 0x10, 0x68, 0x7e, 0x1f, 0xe7, 0x0f,
+  0x74, 0xc1, 0xdf, 0xc3, 0x6a, 0x01, 0xeb, 0x23, 0xac, 0x4b, 0xbb, 0x82,
+  0x16, 0x25, 0xb4, 0xb2, 0x60, 0x1a, 0xb8, 0xd4, 0xbd, 0xe2, 0x41, 0x55,
+  0x4d, 0xe0, 0xd8, 0x85, 0xd7, 0x56, 0x11, 0xf2, 0x46, 0x0b, 0x9a, 0xfb,
+  0xe1, 0x11, 0x43, 0x10, 0x9d, 0x3c, 0x5a, 0x6c, 0x8d, 0xcb, 0x61, 0xa5,
+  0x65, 0xab, 0x32, 0x69, 0x53, 0x42, 0xf0, 0x6d, 0x8f, 0xc1, 0x93, 0x3f,
+  0x5f, 0xb4, 0x9c, 0x94, 0xdb, 0xae, 0x05, 0x90, 0xf0, 0xa6, 0xbe, 0x67,
+  0x83, 0xbb, 0x6d, 0x31, 0x42, 0x6d, 0x51, 0xc6, 0xa8, 0x95, 0xc7, 0x3d,
+  0xcf, 0x9a, 0x30, 0x17, 0x4f, 0xba, 0xa5, 0x7d, 0x0c, 0xd0, 0x6e, 0x0c,
+  0x24, 0xa8, 0xb6, 0x93, 0x75, 0x3d, 0x25, 0x87, 0xad, 0x3d, 0x1e, 0x5b,
+  0xad, 0x1a, 0x51, 0x6b, 0xbc, 0x18, 0x19, 0xa5, 0x3d, 0xd3, 0x70, 0xc2,
+  0x0d, 0xed, 0xf8, 0xe7, 0x6a, 0xc9, 0x2f, 0x5d, 0x64, 0xd9, 0x68, 0x57,
+  0xef, 0xdb, 0x9c, 0xc2, 0x70, 0x52, 0x41, 0x36, 0xf6, 0x56, 0xa3, 0x58,
+  0x10, 0xed, 0xca, 0x8f, 0xad, 0x40, 0x41, 0x39, 0xb0, 0x61, 0xa5, 0xc4,
+  0xa1, 0x22, 0x7d, 0x67, 0x38, 0x32, 0x04, 0x97, 0x92, 0xe5, 0xe2, 0x36,
+  0x22, 0x0f, 0x7b, 0x8e, 0x43, 0x86, 0x98, 0x7c, 0x86, 0x3f, 0xe4, 0x52,
+  0x3c, 0x42, 0x37, 0x4c, 0x68, 0x27, 0x26, 0x3e, 0x3e, 0x53, 0x0b, 0x8c,
+  0xa5, 0x02, 0xaa, 0xe7, 0x3e, 0x65, 0x44, 0xee, 0x44, 0xcf, 0x78, 0xf6,
+  0x07, 0x77, 0xf2, 0x15, 0x06, 0xce, 0x72, 0xe1, 0x43, 0xb8, 0xb4, 0x5f,
+  0xe2, 0x03, 0x77, 0x7c, 0x7c, 0x72, 0xe2, 0x0d, 0x11, 0x37, 0x3b, 0xd7,
+  0x12, 0x61, 0x27, 0x31, 0xa8, 0xc8, 0xaa, 0x5d, 0xae, 0x01, 0xa0, 0x7f,
+  0x44, 0x23, 0xba, 0xdb, 0x70, 0xdf, 0x26, 0xb8, 0x18, 0x2a, 0x8e, 0xbe,
+  0xb8, 0x35, 0x22, 0x0f, 0x72, 0x3a, 0xfc, 0xa3, 0x51, 0xf4, 0x2c, 0x57,
+  0x2e, 0x1d, 0x60, 0x63, 0x51, 0x91, 0x03, 0x43, 0xe6, 0xaf, 0x6e, 0xf7,
+  0x42, 0x86, 0x9a, 0x06, 0xad, 0xe9, 0xd0, 0xc2, 0x18, 0xd4, 0x87, 0xec,
+  0x32, 0xf5, 0x33, 0xe4, 0xc5, 0x93, 0x36, 0xe1, 0xd1, 0x01, 0xd1, 0xf0,
+  0x07, 0x1a, 0xbf, 0x1b, 0x50, 0x20, 0x01, 0x80, 0xb5, 0xc7, 0x77, 0xbd,
+  0xca, 0x23, 0x80, 0xf9, 0x50, 0x1d, 0x24, 0x03, 0x94, 0x77, 0x2e, 0x18,
+  0x8b, 0x1c, 0xfa, 0xda, 0x7a, 0xf8, 0xc0, 0xad, 0xc9, 0x76, 0x03, 0xb4,
+  0x22, 0x84, 0x04, 0xd2, 0xcc, 0x76, 0x1a, 0x47, 0xb3, 0xa3, 0x9b, 0x33,
+  0x54, 0x26, 0x02, 0xc8, 0xae, 0x6e, 0x06, 0xc8, 0x1e, 0xa5, 0x38, 0xf8,
+  0xda, 0xa4, 0x99, 0x77, 0xea, 0x03, 0x64, 0x4b, 0x98, 0x28, 0x1a, 0xf3,
+  0x8f, 0xfa, 0xb9, 0x83, 0x41, 0x7d, 0xc8, 0x2e, 0xb2, 0x19, 0xb2, 0x87,
+  0xf2, 0x18, 0xa0, 0xe5, 0x98, 0xb6, 0xa8, 0x8f, 0xa2, 0xdf, 0xc2, 0x31,
+  0xa7, 0x3c, 0xec, 0xdf, 0x66, 0x58, 0xe8, 0x1e, 0xda, 0x5a, 0x60, 0x9a,
+  0xe4, 0x5d, 0x51, 0x76, 0xdf, 0x72, 0x3f, 0x44, 0x9e, 0x85, 0x63, 0xf2,
+  0x7e, 0x76, 0x55, 0x3f, 0xef, 0xa7, 0xd0, 0x16, 0x88, 0xe0, 0xbb, 0xba,
+  0xda, 0xc2, 0xf7, 0xb4, 0xa8, 0x05, 0xa6, 0xa5, 0x45, 0xe9, 0xf7, 0xc3,
+  0xad, 0x41, 0x18, 0xd7, 0x92, 0x01, 0x9f, 0x4e, 0x82, 0x8e, 0x81, 0x3b,
+  0xdb, 0x81, 0xc0, 0x7d, 0x6d, 0x08, 0xbf, 0x37, 0xe9, 0xc7, 0x5c, 0x2c,
+  0x83, 0x0d, 0x60, 0x20, 0x69, 0x41, 0x3e, 0x34, 0x16, 0x0c, 0x1d, 0x01,
+  0x77, 0x35, 0x80, 0x81, 0x7b, 0x5a, 0x10, 0x03, 0xb4, 0x35, 0x61, 0x78,
+  0x08, 0x72, 0x6f, 0x08, 0xf2, 0xc1, 0x21, 0xc8, 0xdd, 0x10, 0xe4, 0x83,
+  0x43, 0x90, 0x0f, 0x0c, 0x41, 0x3e, 0x34, 0x04, 0x68, 0xd8, 0x1f, 0x5a,
+  0x8d, 0x28, 0xbc, 0x22, 0x49, 0x3f, 0x2f, 0x43, 0x08, 0xbe, 0x04, 0x25,
+  0x1c, 0xfe, 0x0c, 0x48, 0x4e, 0x04, 0x64, 0xd1, 0xe9, 0x60, 0xbb, 0x9a,
+  0x83, 0xb0, 0xff, 0xdc, 0xe7, 0xf9, 0xbb, 0xd3, 0x28, 0x84, 0x5d, 0x0e,
+  0x14, 0x08, 0x31, 0x72, 0x47, 0x33, 0x58, 0x1b, 0xbc, 0xd2, 0x2d, 0xa2,
+  0xbc, 0xee, 0x72, 0xab, 0xe0, 0xc2, 0x41, 0x99, 0x6e, 0x47, 0x60, 0x80,
+  0xfd, 0xa7, 0xee, 0x8e, 0x0f, 0x3f, 0x37, 0x5b, 0x52, 0x94, 0x03, 0x0d,
+  0x29, 0xca, 0xb8, 0x1d, 0x45, 0x79, 0x64, 0x33, 0xa8, 0xa8, 0x5f, 0xa2,
+  0xb3, 0x11, 0x00, 0xf9, 0x61, 0x77, 0x1b, 0x82, 0xaf, 0xdc, 0x84, 0xe0,
+  0x3b, 0xe9, 0xd6, 0xa2, 0xd8, 0xbb, 0xe7, 0x59, 0x13, 0xe6, 0x69, 0xb7,
+  0xfb, 0x4f, 0xf4, 0xbd, 0xe9, 0xbc, 0xb1, 0x4e, 0xcb, 0xec, 0x26, 0xa9,
+  0xb3, 0x1b, 0x35, 0xca, 0xc6, 0x2f, 0x66, 0x5d, 0xe0, 0x3d, 0xbb, 0xa8,
+  0x00, 0xec, 0xa2, 0xdb, 0x67, 0x67, 0x8c, 0x5b, 0xfc, 0x63, 0xea, 0x65,
+  0xc0, 0x9e, 0x1a, 0x05, 0xa0, 0xbd, 0x2e, 0x2f, 0x08, 0xb6, 0xad, 0xa3,
+  0x71, 0xba, 0x4f, 0x41, 0xce, 0x19, 0x60, 0xb9, 0x2c, 0xd3, 0x1b, 0xdd,
+  0x25, 0xe8, 0xa9, 0xbf, 0xf5, 0x37, 0x9b, 0x16, 0xeb, 0x75, 0xe5, 0x82,
+  0x9a, 0x3c, 0x71, 0x1b, 0x0a, 0x05, 0x65, 0x37, 0xe6, 0x10, 0x8c, 0x93,
+  0x44, 0x34, 0x7c, 0x4b, 0xd7, 0x73, 0xae, 0x8d, 0x42, 0xbb, 0x85, 0x4e,
+  0x03, 0x16, 0xa4, 0xe9, 0x7d, 0xb1, 0xb6, 0xae, 0x31, 0x26, 0x74, 0x99,
+  0x58, 0x77, 0x39, 0xc7, 0x04, 0x59, 0xc7, 0xbc, 0x56, 0x42, 0x71, 0xd7,
+  0x07, 0x09, 0x10, 0xb8, 0xa7, 0x34, 0xcc, 0x27, 0x5d, 0x83, 0xf9, 0x2c,
+  0x1c, 0x81, 0x4e, 0xb8, 0xa7, 0xe1, 0x40, 0xd8, 0x8d, 0x4b, 0x50, 0xb7,
+  0xcb, 0x3d, 0xac, 0xd5, 0x1e, 0xc5, 0x68, 0x1d, 0x50, 0xd1, 0xd8, 0x9f,
+  0xb4, 0x54, 0x68, 0x83, 0x2d, 0xc6, 0x7c, 0x21, 0xa3, 0xe0, 0x52, 0x5a,
+  0xc2, 0xf6, 0x65, 0x71, 0x93, 0x94, 0x95, 0xc9, 0x17, 0x30, 0xab, 0x25,
+  0xc1, 0x2f, 0xbc, 0x58, 0x08, 0x67, 0x3a, 0x7b, 0x13, 0x9a, 0x91, 0x3c,
+  0xfb, 0x50, 0x5e, 0xa0, 0xdb, 0xd4, 0x75, 0x96, 0xa7, 0x46, 0x30, 0xac,
+  0x35, 0x16, 0x33, 0xd1, 0x23, 0x38, 0xfc, 0x50, 0x7c, 0xfc, 0xcc, 0xd0,
+  0xc3, 0x46, 0x74, 0xae, 0x01, 0x3d, 0xef, 0x33, 0x4e, 0xbd, 0x74, 0x81,
+  0xe6, 0x5a, 0x41, 0x81, 0xb4, 0xce, 0xa8, 0x46, 0xdb, 0xe3, 0x44, 0x20,
+  0xed, 0xe7, 0xb5, 0x6a, 0x3f, 0x69, 0x97, 0x6c, 0xde, 0x98, 0x52, 0xda,
+  0x56, 0x09, 0x1d, 0x84, 0x41, 0x1a, 0x2f, 0xef, 0x09, 0xb9, 0x6b, 0xa9,
+  0xa6, 0x04, 0x12, 0x74, 0x5d, 0x7d, 0xea, 0xa2, 0xc6, 0x51, 0x5e, 0xe4,
+  0x93, 0x29, 0xd9, 0xf5, 0x82, 0xc0, 0x40, 0x48, 0xcb, 0x94, 0x6b, 0xa2,
+  0x49, 0x63, 0x2c, 0xc4, 0x13, 0xff, 0x9b, 0x6f, 0x6b, 0xe0, 0x86, 0x9e,
+  0x4e, 0xbd, 0x1c, 0x31, 0xd3, 0xda, 0x28, 0x85, 0x27, 0x74, 0xc0, 0xa3,
+  0xe8, 0x2c, 0x36, 0x4e, 0x12, 0x87, 0x81, 0x73, 0x8f, 0x3f, 0x45, 0x8a,
+  0x0d, 0x7f, 0x2e, 0x6f, 0xa6, 0x59, 0xc3, 0x32, 0x7d, 0xe1, 0x1d, 0x38,
+  0x62, 0xc8, 0x4e, 0xcf, 0xca, 0x37, 0x9a, 0xf9, 0x06, 0x41, 0x85, 0x99,
+  0x76, 0x72, 0x1c, 0x51, 0xac, 0xed, 0x6a, 0x49, 0x8c, 0xd9, 0xda, 0xc9,
+  0xb6, 0x77, 0x9f, 0x3f, 0x37, 0xe2, 0xa4, 0x82, 0xf6, 0x75, 0x75, 0x3d,
+  0xf0, 0xe6, 0x07, 0x7e, 0xc5, 0x24, 0x0b, 0x59, 0xcd, 0x4e, 0x45, 0x5a,
+  0xaa, 0x2a, 0x4a, 0x0a, 0x37, 0x4d, 0x3e, 0x46, 0x89, 0xb1, 0xa6, 0x2c,
+  0x76, 0xfc, 0x43, 0x64, 0x8c, 0x64, 0xbe, 0x06, 0x09, 0x79, 0x1e, 0x8e,
+  0xe4, 0x18, 0x4d, 0xf3, 0xa6, 0xa6, 0x5e, 0xc5, 0x73, 0x03, 0x7b, 0xa9,
+  0x41, 0xed, 0xfc, 0xd6, 0xc4, 0xb3, 0x4c, 0xf9, 0xd0, 0x61, 0x43, 0xfe,
   0x38, 0x75, 0x86, 0x21, 0x64, 0xb1, 0x54, 0x93, 0x17, 0x28, 0x9c, 0xb6,
-  0x0e, 0xb6, 0x4d, 0x35, 0x57, 0x6c, 0x11, 0x06, 0x81, 0x7d, 0xa1, 0xee,
-  0xd5, 0x65, 0xc8, 0x2c, 0x2e, 0xaf, 0x18, 0xf3, 0xf1, 0xf4, 0xc2, 0x03,
-  0xfc, 0x10, 0x9c, 0x63, 0x71, 0xdf, 0x71, 0x98, 0xf7, 0xe9, 0x1a, 0x2d,
-  0x15, 0xa7, 0x8d, 0x2c, 0xa3, 0xa3, 0xf5, 0x48, 0x8d, 0x2a, 0x16, 0xd0,
-  0x98, 0x10, 0x07, 0x38, 0x85, 0x0e, 0x89, 0xd1, 0x33, 0x5c, 0x9d, 0x51,
-  0x21, 0xf8, 0x49, 0x46, 0x0d, 0x75, 0xf6, 0x89, 0xae, 0x58, 0xbd, 0x50,
-  0xeb, 0x6f, 0xf6, 0x8a, 0xc0, 0x29, 0x85, 0x05, 0xe2, 0x4f, 0xf7, 0xc5,
-  0x4e, 0x99, 0xe0, 0xda, 0x1c, 0x6f, 0xdf, 0x9e, 0x90, 0x87, 0x0e, 0x37,
-  0xd3, 0xa5, 0x4a, 0xc5, 0x3b, 0xe6, 0xdb, 0x29, 0x57, 0x74, 0x36, 0x25,
-  0xef, 0xf5, 0x6c, 0x73, 0x9f, 0xb8, 0x44, 0x2c, 0xd5, 0x59, 0x3a, 0x93,
-  0x04, 0x87, 0xc6, 0xc4, 0x63, 0x19, 0xd0, 0xb2, 0x3d, 0x25, 0x51, 0x95,
-  0x9a, 0x01, 0x81, 0xb0, 0xc7, 0xcc, 0x43, 0xcd, 0xad, 0x44, 0x7c, 0xd0,
-  0x40, 0xa4, 0x1a, 0x80, 0xcf, 0x80, 0x21, 0xa2, 0x8e, 0x6e, 0x3c, 0x18,
-  0x4d, 0xcb, 0x7d, 0x89, 0x9e, 0x4d, 0xa1, 0xef, 0x3c, 0xbd, 0x0c, 0xe6,
-  0xaa, 0x64, 0xe7, 0xc8, 0x36, 0xa1, 0xc2, 0xe6, 0x18, 0x89, 0xd8, 0x45,
-  0xde, 0x51, 0xef, 0x30, 0x2a, 0x71, 0x03, 0xbe, 0x27, 0x93, 0x2e, 0xd5,
-  0xae, 0x27, 0x7e, 0x40, 0x89, 0x11, 0x1b, 0xe2, 0x83, 0xe4, 0x56, 0x18,
-  0x43, 0x6c, 0x57, 0x08, 0x6a, 0x2d, 0x06, 0xc7, 0x75, 0xdc, 0x31, 0x29,
-  0x14, 0xa7, 0x5d, 0x3a, 0xa6, 0xaf, 0xec, 0xd1, 0x32, 0x42, 0xce, 0x80,
-  0x9d, 0xcd, 0x42, 0xa2, 0xc4, 0x27, 0x4e, 0xcc, 0x8b, 0xec, 0xa8, 0x17,
-  0x29, 0x31, 0x4d, 0xbf, 0xd3, 0xab, 0x0b, 0xbf, 0xe2, 0xac, 0x6a, 0x26,
-  0x4b, 0x27, 0xfb, 0x60, 0x48, 0xcf, 0x32, 0xc8, 0x29, 0x87, 0xa0, 0x9c,
-  0x19, 0xdb, 0xad, 0xf9, 0xe4, 0x1b, 0x20, 0xc3, 0x71, 0x21, 0x10, 0xe9,
-  0x0b, 0xb7, 0xcf, 0x64, 0xb4, 0x52, 0x0a, 0x67, 0x19, 0xf4, 0xbf, 0x29,
-  0x11, 0x97, 0xbd, 0x8e, 0xc9, 0x18, 0x7d, 0xbd, 0x62, 0x55, 0x7b, 0x35,
-  0xb7, 0xd5, 0x1b, 0xe1, 0x14, 0x29, 0x11, 0x6f, 0xc3, 0xc9, 0x30, 0xf6,
-  0x69, 0xc2, 0x46, 0x46, 0x9e, 0x2b, 0xea, 0x68, 0x1c, 0x37, 0xcb, 0x30,
-  0x84, 0xd3, 0xdd, 0x8e, 0x67, 0x2b, 0xb4, 0xa8, 0x6c, 0x9a, 0x3b, 0xd7,
-  0x72, 0xeb, 0xd4, 0x3c, 0xcd, 0xc2, 0xef, 0xcf, 0xdb, 0x37, 0x20, 0xde,
-  0xd7, 0x86, 0xb5, 0x72, 0x5d, 0x18, 0x0b, 0x9f, 0xf3, 0x1c, 0x81, 0x79,
-  0xde, 0x73, 0x06, 0xbd, 0x74, 0x12, 0xc4, 0x6a, 0x49, 0xcc, 0x5f, 0xdc,
-  0x10, 0xb2, 0x44, 0x9d, 0xb6, 0xed, 0x4f, 0xb1, 0x48, 0x34, 0x0c, 0x2d,
-  0x47, 0xfc, 0xef, 0x47, 0x56, 0xb6, 0x21, 0xe3, 0x75, 0x09, 0xdd, 0xb8,
-  0x60, 0x10, 0x4e, 0x6b, 0x58, 0xee, 0xb2, 0x3a, 0xe5, 0x9c, 0x0b, 0x4d,
-  0x49, 0x85, 0x07, 0x04, 0x0d, 0x7f, 0xf5, 0xb9, 0x13, 0x63, 0x17, 0x21,
-  0xf4, 0x11, 0xc5, 0xc8, 0xe3, 0xad, 0x08, 0xaa, 0x2c, 0x16, 0xaa, 0x3d,
-  0x40, 0x86, 0xf9, 0x8f, 0x06, 0xa0, 0x63, 0xc2, 0x34, 0x1e, 0x9d, 0x7c,
-  0x5b, 0xf7, 0x85, 0x3d, 0x9a, 0xd7, 0x9e, 0xab, 0x26, 0x85, 0xf5, 0x08,
-  0x14, 0x00, 0x74, 0x15, 0xdd, 0xef, 0x46, 0x33, 0xe7, 0x08, 0xdf, 0xf8,
-  0xef, 0x6a, 0x04, 0x6c, 0xe7, 0xbb, 0x50, 0xe6, 0xb4, 0x9d, 0xd7, 0x09,
-  0x3e, 0x16, 0x91, 0x77, 0x2a, 0x82, 0x1d, 0x54, 0x51, 0x8b, 0xde, 0x14,
-  0x6e, 0xc3, 0xee, 0x1f, 0xdd, 0x6b, 0xf4, 0xe6, 0xe5, 0x23, 0xeb, 0x99,
-  0xe9, 0x54, 0x51, 0xd5, 0xe9, 0xc1, 0x54, 0xe1, 0xa2, 0x90, 0xe2, 0xe6,
-  0x6c, 0x3f, 0x56, 0x7a, 0x9f, 0xde, 0xd5, 0x96, 0x40, 0x81, 0x0d, 0x09,
-  0xac, 0xb2, 0xbb, 0x0e, 0x1c, 0xf5, 0xb6, 0x3c, 0x3a, 0x7d, 0xa8, 0x61,
-  0x43, 0x1c, 0x2c, 0x38, 0x2b, 0x50, 0x8f, 0xf7, 0x8d, 0x26, 0xd2, 0x4d,
-  0x4d, 0x32, 0xf8, 0x90, 0x73, 0x9b, 0x0b, 0xd5, 0x52, 0x27, 0x2d, 0x08,
-  0xb6, 0x52, 0x12, 0x54, 0x5e, 0x31, 0xc6, 0x5c, 0x37, 0x4b, 0xb2, 0x98,
-  0x77, 0xc7, 0xdc, 0x2b, 0xa4, 0x22, 0x95, 0xad, 0x0b, 0x0b, 0x9e, 0xe2,
-  0xa4, 0xd8, 0xc6, 0xe7, 0xa1, 0xf0, 0xb3, 0xcf, 0x83, 0xc3, 0x38, 0x8e,
-  0xc8, 0xb5, 0x40, 0xd9, 0x3e, 0xc2, 0x36, 0xff, 0x18, 0x93, 0x21, 0x63,
-  0xd2, 0x90, 0x32, 0x92, 0x4d, 0x63, 0x7f, 0xf8, 0x6f, 0x1d, 0x08, 0xbe,
-  0x33, 0xd7, 0x15, 0x2d, 0x4c, 0x35, 0x66, 0x2e, 0xd2, 0x61, 0xcf, 0x9b,
-  0x7d, 0xd3, 0x5c, 0xc8, 0x5c, 0x78, 0x0c, 0x77, 0xcc, 0x01, 0xa2, 0x29,
-  0x4e, 0xb4, 0x63, 0x04, 0xf4, 0x96, 0x3e, 0x2c, 0x32, 0x08, 0x37, 0x43,
-  0x02, 0x56, 0x40, 0x19, 0x43, 0x87, 0x5e, 0x68, 0x4f, 0x34, 0x22, 0xe8,
-  0xd5, 0xc3, 0x13, 0x66, 0xcd, 0xc6, 0xe0, 0xe6, 0x94, 0x95, 0xbc, 0xe5,
-  0x02, 0xd5, 0xda, 0xa4, 0x57, 0x0b, 0x72, 0x9a, 0x71, 0x1e, 0xde, 0x44,
-  0x12, 0x4e, 0x88, 0x3a, 0x85, 0xdd, 0x8a, 0x8a, 0x89, 0x7f, 0xb3, 0x21,
-  0x5f, 0xe6, 0xaf, 0xa6, 0xef, 0x3e, 0x9d, 0xbd, 0xfb, 0x54, 0xbd, 0x7c,
-  0x8a, 0x3f, 0xf8, 0xfa, 0x82, 0x17, 0xd7, 0x7d, 0x60, 0x02, 0x59, 0xb3,
-  0x15, 0xd4, 0x9a, 0x96, 0xd7, 0x42, 0xef, 0xba, 0xaa, 0xe6, 0xfb, 0x48,
-  0xea, 0x8d, 0x46, 0x28, 0xe7, 0x3c, 0xf5, 0x3b, 0x23, 0x76, 0x18, 0x90,
-  0x2c, 0xd3, 0x3c, 0x0a, 0x15, 0x76, 0x28, 0xad, 0xaf, 0x78, 0xf9, 0x2a,
-  0x1e, 0x18, 0x5e, 0x9f, 0x5f, 0xc3, 0xff, 0xf1, 0x5c, 0xb4, 0x49, 0xe0,
-  0x98, 0x17, 0xaf, 0xb2, 0x7d, 0x06, 0xfb, 0xd8, 0x5c, 0x92, 0x49, 0xaa,
-  0xc7, 0x7f, 0x3e, 0x9f, 0x21, 0x6f, 0x36, 0x1c, 0x40, 0x4c, 0x45, 0x41,
-  0xbd, 0x0d, 0xba, 0x76, 0xf7, 0x98, 0x1f, 0x28, 0x4f, 0x8c, 0x60, 0x7d,
-  0xfc, 0xd1, 0x0a, 0xb3, 0xc9, 0xd2, 0x05, 0x90, 0xac, 0xda, 0xce, 0xa1,
-  0xd4, 0xe1, 0x58, 0x7b, 0xbb, 0xa6, 0x27, 0xe4, 0xc6, 0x33, 0x5f, 0x65,
-  0xe5, 0x0a, 0x93, 0xd8, 0xb3, 0x54, 0x83, 0xaf, 0x3e, 0x47, 0x45, 0x53,
-  0x18, 0xf0, 0x04, 0xa5, 0x8c, 0x1d, 0x25, 0xc7, 0xce, 0x77, 0x76, 0x29,
-  0xb8, 0xbb, 0x84, 0xbd, 0x25, 0x62, 0x5f, 0x69, 0x53, 0x11, 0x73, 0xdb,
-  0x1d, 0xef, 0x74, 0x92, 0x7a, 0x4b, 0xca, 0x2e, 0x59, 0x2a, 0xe4, 0x47,
-  0x7c, 0xcf, 0xd3, 0xd5, 0x0a, 0x6e, 0x3e, 0xc8, 0xa7, 0x8d, 0x7a, 0x92,
-  0xe4, 0xf5, 0x9c, 0x3b, 0xe0, 0xfe, 0x72, 0xfd, 0x04, 0xb0, 0xe8, 0xee,
-  0xf0, 0x6c, 0x97, 0x00, 0xba, 0xd0, 0x40, 0x20, 0x60, 0x0f, 0x8e, 0x26,
-  0xf8, 0x48, 0x6f, 0x86, 0x40, 0x9c, 0xd7, 0x98, 0x9a, 0x75, 0x5f, 0xec,
-  0x53, 0x7f, 0x3b, 0x37, 0x36, 0xd8, 0x35, 0xdf, 0x05, 0x25, 0x92, 0x6a,
-  0x95, 0x65, 0xad, 0x45, 0x6a, 0xf7, 0x4b, 0x93, 0xdc, 0x28, 0x46, 0x63,
-  0x2d, 0x7c, 0x38, 0x3e, 0xdb, 0x7c, 0xc1, 0x6a, 0x82, 0x04, 0x88, 0xa1,
-  0x47, 0x8d, 0xfe, 0xb0, 0x7f, 0xb3, 0x2f, 0x6e, 0xf7, 0x4a, 0x7a, 0x04,
-  0x3d, 0xe1, 0x47, 0x7e, 0x8d, 0x44, 0xc7, 0x91, 0xe1, 0x64, 0x44, 0x6a,
-  0x09, 0xee, 0xf1, 0x48, 0x47, 0xf8, 0xd0, 0xb7, 0xa4, 0x16, 0xe8, 0x40,
-  0x9c, 0xd7, 0x6c, 0x57, 0x44, 0xa9, 0x5c, 0xd5, 0x49, 0x8d, 0x37, 0xbd,
-  0x57, 0x6f, 0x92, 0x6b, 0xce, 0xe3, 0x13, 0x4b, 0x03, 0x23, 0x37, 0xb1,
-  0x9a, 0x7b, 0x7a, 0x5f, 0x14, 0x68, 0xcf, 0xeb, 0xfc, 0xc8, 0x77, 0x98,
-  0x1c, 0x77, 0x1c, 0x74, 0xbf, 0xf1, 0x6f, 0x35, 0x20, 0x0b, 0xfa, 0x86,
-  0x55, 0x9c, 0xd8, 0xd5, 0x23, 0xb3, 0xe7, 0x5d, 0x1e, 0xb3, 0x7c, 0x3d,
-  0xc7, 0x6b, 0x02, 0x29, 0x4b, 0x93, 0xa8, 0x27, 0x7e, 0xa9, 0x52, 0xeb,
-  0x93, 0x9f, 0x3a, 0x0c, 0x8e, 0xee, 0x3f, 0xbc, 0xb6, 0x64, 0x3c, 0x11,
-  0x80, 0x02, 0x36, 0xd9, 0x50, 0xaf, 0xed, 0x8c, 0x24, 0xd8, 0x21, 0x62,
-  0x2f, 0xb5, 0xd9, 0x99, 0x53, 0x37, 0xae, 0xdd, 0x99, 0xe2, 0x36, 0xcd,
-  0x66, 0x33, 0xaf, 0x02, 0x41, 0x44, 0x06, 0x9c, 0x6f, 0x03, 0x1c, 0x9c,
-  0xbe, 0x7a, 0xd7, 0x06, 0x7e, 0x3a, 0x95, 0xbb, 0x8b, 0x64, 0x62, 0x33,
-  0x9d, 0xec, 0x17, 0xe1, 0x19, 0xb9, 0x6b, 0x49, 0x5c, 0x14, 0x9c, 0xb5,
-  0x34, 0x46, 0x39, 0x1c, 0xbf, 0x16, 0x39, 0x99, 0x68, 0x42, 0xa2, 0xc1,
-  0x4e, 0x40, 0x80, 0x8c, 0x3f, 0x71, 0x3d, 0xb9, 0x60, 0xde, 0x89, 0x8f,
-  0x29, 0x05, 0x48, 0x68, 0x7c, 0x5d, 0xc9, 0xd7, 0x2f, 0xed, 0x45, 0x90,
-  0x8f, 0x15, 0x20, 0x7a, 0x36, 0xa3, 0x87, 0x15, 0x1b, 0x7d, 0x61, 0x57,
-  0x2d, 0x5d, 0xc0, 0x46, 0x0b, 0x6b, 0x6d, 0x9a, 0x8e, 0xaf, 0xd3, 0x3d,
-  0x7f, 0x7a, 0xa4, 0xad, 0x5d, 0xda, 0x04, 0x36, 0x53, 0xe6, 0x6a, 0x64,
-  0xa6, 0xfe, 0x0a, 0xbf, 0x76, 0x92, 0x24, 0xed, 0x14, 0xca, 0xd4, 0x0b,
-  0x11, 0xd5, 0x67, 0x77, 0xf4, 0x5d, 0xdb, 0xbe, 0xa0, 0x6e, 0xa0, 0x8a,
-  0x9e, 0x6b, 0x57, 0x04, 0x9a, 0xc5, 0x1d, 0x5b, 0xff, 0x65, 0xec, 0x9e,
-  0xfe, 0x38, 0xf1, 0x2e, 0x98, 0x7a, 0xbf, 0xbc, 0x19, 0x56, 0xc0, 0x4e,
-  0xa5, 0x38, 0x14, 0xf9, 0xbd, 0x4d, 0xeb, 0x14, 0x9f, 0x4d, 0x87, 0x62,
-  0xb5, 0xdd, 0x26, 0x3b, 0x34, 0xa7, 0xc5, 0xa6, 0x53, 0x30, 0x97, 0xde,
-  0xb8, 0x61, 0x1b, 0x02, 0x43, 0x75, 0x6e, 0xcc, 0x0b, 0x91, 0x2b, 0x8c,
-  0xda, 0x82, 0x6d, 0x8f, 0x9b, 0x79, 0x4d, 0x40, 0x63, 0x36, 0x06, 0x2f,
-  0x98, 0xee, 0x6c, 0xe6, 0x6b, 0x6b, 0xa6, 0x60, 0x6e, 0xdb, 0xb7, 0x3b,
-  0x6c, 0x06, 0xae, 0x62, 0x4f, 0x6d, 0x7c, 0x8a, 0x00, 0xc7, 0x9b, 0xe1,
-  0x38, 0x42, 0x2b, 0xb8, 0x00, 0x34, 0xc7, 0xc2, 0xe9, 0xba, 0x46, 0x5f,
-  0xb6, 0xb0, 0xb6, 0x1d, 0x96, 0x18, 0x73, 0x03, 0x9c, 0xd1, 0x65, 0xdc,
-  0xcc, 0xa8, 0x28, 0x6c, 0xf5, 0x07, 0x34, 0x3a, 0x18, 0xb0, 0xd3, 0x00,
-  0x29, 0x49, 0x73, 0x29, 0x24, 0xe6, 0x9d, 0x87, 0x8f, 0xd5, 0x66, 0x1f,
-  0x1b, 0xa7, 0xb6, 0x41, 0x22, 0xaf, 0x4b, 0x10, 0x4a, 0x97, 0xca, 0x90,
-  0xe9, 0x6d, 0x62, 0x3c, 0xd4, 0x18, 0x33, 0x07, 0x4d, 0x5a, 0x98, 0x4e,
-  0xda, 0x71, 0xf2, 0xe6, 0xed, 0x81, 0x2d, 0xcf, 0x13, 0xb0, 0x95, 0x8d,
-  0x06, 0xe2, 0x08, 0x99, 0x80, 0xc8, 0xa4, 0x7f, 0x2e, 0x1c, 0x38, 0x6d,
-  0x86, 0xec, 0xe5, 0x8f, 0x5b, 0x4c, 0x32, 0x17, 0x6b, 0xa9, 0x9f, 0x80,
-  0x37, 0x16, 0xb2, 0xc3, 0x29, 0xfb, 0xdc, 0xad, 0xd9, 0x49, 0x6b, 0x31,
-  0xd3, 0x80, 0xce, 0x16, 0x84, 0x6e, 0xd3, 0xe3, 0x95, 0x1a, 0xbf, 0x3a,
-  0x04, 0xd3, 0xe9, 0x8c, 0xcd, 0xc5, 0xd7, 0x6c, 0x26, 0x0b, 0x03, 0x5b,
-  0xf2, 0x9a, 0x74, 0x5a, 0xc3, 0xa7, 0x69, 0xe9, 0xe8, 0x6c, 0x18, 0x75,
-  0x4f, 0x2d, 0x79, 0x41, 0x70, 0x93, 0xe1, 0x5c, 0xa0, 0xc3, 0xed, 0xd8,
-  0x61, 0x8d, 0x1d, 0x37, 0x85, 0x53, 0xf1, 0xd0, 0x98, 0xc7, 0x73, 0xd9,
-  0xaa, 0x0e, 0x69, 0xfe, 0x4f, 0xdd, 0xe6, 0x07, 0xad, 0x6e, 0xca, 0x0d,
-  0xbe, 0x14, 0xde, 0x9c, 0xec, 0x85, 0x0c, 0x06, 0xcc, 0xb1, 0xf9, 0x21,
-  0xc9, 0xca, 0x47, 0x6c, 0x7b, 0x9f, 0x8e, 0xf3, 0xe4, 0xfa, 0x98, 0x96,
-  0x65, 0xaa, 0x46, 0x5f, 0x8c, 0xd4, 0x33, 0x53, 0x01, 0x9f, 0xf3, 0x30,
-  0xfe, 0xc9, 0x00, 0x98, 0x71, 0x9e, 0xc2, 0xea, 0xb2, 0x2e, 0xd3, 0xc5,
-  0x41, 0x8d, 0x5e, 0xb7, 0x63, 0x1a, 0x02, 0x65, 0x71, 0x7d, 0xa7, 0x46,
-  0xff, 0xab, 0x1f, 0x57, 0x17, 0xd4, 0x18, 0xf4, 0xf4, 0xe5, 0x7d, 0xb5,
-  0x4d, 0x6f, 0x16, 0xd0, 0x47, 0x5f, 0xb7, 0x22, 0x1b, 0x06, 0xe6, 0x60,
-  0x3b, 0x82, 0x16, 0x39, 0x00, 0x5b, 0x17, 0xd8, 0x78, 0x8b, 0x09, 0x69,
-  0x31, 0x0a, 0xe7, 0xbf, 0xb5, 0x62, 0xea, 0x07, 0x19, 0x57, 0x07, 0x00,
-  0xca, 0x60, 0xb9, 0x5e, 0x2c, 0xd3, 0xaa, 0x4a, 0xf3, 0xc5, 0x5f, 0xd5,
-  0xe8, 0x7f, 0xb6, 0x22, 0x7c, 0x10, 0x74, 0x13, 0xf7, 0xbd, 0x1a, 0xfd,
-  0x9f, 0xe1, 0xb8, 0xbb, 0xa0, 0x61, 0xdb, 0x50, 0x15, 0xab, 0x45, 0x83,
-  0x23, 0x00, 0x86, 0x61, 0x2f, 0x1d, 0xcc, 0x0f, 0x80, 0x0d, 0xf1, 0x0a,
-  0x77, 0x0c, 0xc1, 0xdb, 0x05, 0x3b, 0xfe, 0x6b, 0xb2, 0x2a, 0x96, 0x99,
-  0x53, 0x37, 0x1e, 0x15, 0xc1, 0xa4, 0x7a, 0xee, 0xe0, 0x1b, 0x00, 0x83,
-  0x5a, 0xd8, 0x22, 0x98, 0x51, 0x58, 0x5f, 0xed, 0x53, 0x36, 0x08, 0xca,
-  0x19, 0x9f, 0x6d, 0x52, 0xee, 0x8a, 0x7d, 0xb6, 0xd2, 0x3d, 0x6e, 0x5b,
-  0xa0, 0x9e, 0x47, 0x47, 0x68, 0x10, 0xfc, 0x18, 0xf4, 0xdd, 0x32, 0x31,
-  0x85, 0xd4, 0xe8, 0x97, 0x2d, 0xd4, 0x0e, 0x84, 0xf3, 0xe8, 0xdd, 0xbf,
-  0x49, 0xf3, 0x0b, 0xcd, 0xd8, 0xb8, 0x2b, 0x43, 0xf0, 0x16, 0x76, 0xea,
-  0x07, 0x6e, 0x60, 0xbe, 0x0c, 0x81, 0x2f, 0x3b, 0x30, 0xc7, 0x80, 0xc5,
-  0x58, 0x46, 0xbb, 0x4c, 0x49, 0x16, 0x5c, 0x2a, 0x2b, 0x42, 0x6d, 0xd2,
-  0xe0, 0x50, 0x83, 0x19, 0x5a, 0x32, 0xd4, 0x79, 0x58, 0xd1, 0x71, 0xe0,
-  0x66, 0x9c, 0xe0, 0x94, 0x92, 0x9c, 0x7e, 0x8d, 0x49, 0xcb, 0xb5, 0xd5,
-  0x4f, 0xf6, 0xad, 0xd5, 0xf1, 0x70, 0x20, 0x3f, 0x84, 0x3d, 0xe8, 0x62,
-  0x73, 0xb5, 0x02, 0x65, 0xe7, 0xe9, 0x21, 0xa9, 0xf0, 0xa6, 0x30, 0xa6,
-  0xbc, 0x26, 0x2f, 0xca, 0xa2, 0x7c, 0x43, 0x38, 0xb4, 0x12, 0xb7, 0x43,
-  0xbb, 0xd9, 0xf8, 0x80, 0x47, 0xf4, 0x8b, 0x63, 0x95, 0x56, 0x8b, 0x43,
-  0x99, 0xed, 0xd2, 0x05, 0xe8, 0x27, 0x0b, 0xeb, 0xf5, 0x50, 0xb1, 0x41,
-  0xa4, 0x59, 0x82, 0x81, 0xf9, 0x7a, 0xe4, 0xf3, 0x18, 0x00, 0xa1, 0xc4,
-  0xc5, 0x6a, 0xbd, 0x30, 0x2e, 0x1a, 0xd5, 0x50, 0xec, 0xf4, 0x0f, 0xba,
-  0xdb, 0xe8, 0x78, 0x1d, 0xb4, 0x68, 0x9d, 0xca, 0xd6, 0xe4, 0xf4, 0xed,
-  0xf8, 0xee, 0x2d, 0xfe, 0x7b, 0x4f, 0xff, 0x7e, 0xff, 0x76, 0xe6, 0x58,
-  0x41, 0xa8, 0x9b, 0x4f, 0x27, 0x07, 0xaa, 0x05, 0x2f, 0xb1, 0xf8, 0x43,
-  0x23, 0xef, 0x67, 0x41, 0x81, 0x71, 0x7f, 0x81, 0xc6, 0x56, 0x43, 0x4a,
-  0x44, 0x23, 0x71, 0xa2, 0x37, 0x5c, 0x6f, 0xe7, 0xa2, 0x9d, 0xe3, 0xb9,
-  0x73, 0x07, 0xda, 0x98, 0xb0, 0xf5, 0xee, 0x50, 0xdb, 0x99, 0xe9, 0x82,
-  0xa9, 0xb5, 0xa6, 0x53, 0x02, 0x53, 0xcd, 0xc1, 0xba, 0xba, 0x97, 0xb0,
-  0xf1, 0x8b, 0x0c, 0x8d, 0x98, 0x09, 0x75, 0x8a, 0x4e, 0x6d, 0x89, 0xa3,
-  0xde, 0xdc, 0x37, 0x0d, 0x70, 0xa3, 0x53, 0x27, 0x1c, 0x49, 0x1d, 0x16,
-  0x65, 0xe5, 0x62, 0x3a, 0x82, 0x92, 0xa3, 0xd9, 0xc8, 0xd1, 0x47, 0x8d,
-  0xc2, 0xd8, 0xcc, 0xdc, 0xe6, 0x44, 0x40, 0x11, 0x73, 0x1b, 0x8c, 0x2a,
-  0x9a, 0xe5, 0x9f, 0x18, 0x6d, 0x85, 0x1d, 0x40, 0x47, 0xe2, 0xa5, 0x6b,
-  0x12, 0x99, 0x77, 0xde, 0x3f, 0x64, 0x9c, 0x07, 0x8b, 0x3c, 0x08, 0x1c,
-  0xa9, 0x35, 0x1e, 0xec, 0xad, 0xc6, 0x50, 0xf4, 0x31, 0x25, 0x2a, 0x75,
-  0x2f, 0xa9, 0x35, 0x39, 0x3a, 0x23, 0x7e, 0xe4, 0xb8, 0xd6, 0x44, 0x7a,
-  0xd8, 0x8e, 0x98, 0x1e, 0x30, 0x27, 0x60, 0xc1, 0xf4, 0xc6, 0x28, 0x77,
-  0x8f, 0x4f, 0x3d, 0x1b, 0x30, 0x4e, 0xef, 0x28, 0xaf, 0xcb, 0xd1, 0x87,
-  0xcd, 0xdf, 0x2e, 0x43, 0xfc, 0xca, 0xf0, 0xc9, 0x7e, 0x66, 0x1e, 0x6f,
-  0x4c, 0x67, 0x4c, 0x61, 0x9b, 0x56, 0xa2, 0x67, 0xed, 0x6f, 0x61, 0xae,
-  0xa7, 0xfb, 0xe2, 0x78, 0xbd, 0x55, 0x7a, 0x60, 0x2b, 0x8c, 0x3e, 0x18,
-  0x9d, 0x58, 0x75, 0x61, 0x2d, 0x5f, 0x1c, 0x51, 0xb3, 0x84, 0xf5, 0x1a,
-  0x76, 0xd7, 0x8e, 0x32, 0x0c, 0x3a, 0x23, 0xbb, 0x32, 0xa1, 0xa1, 0xc7,
-  0x50, 0xe0, 0x78, 0x16, 0x08, 0x83, 0xe8, 0xe1, 0xf7, 0xb8, 0x4c, 0xeb,
-  0xb1, 0xfa, 0x10, 0x9f, 0x8a, 0x34, 0xd8, 0x4e, 0x6c, 0x40, 0xb3, 0x7e,
-  0x9e, 0xd2, 0xdb, 0xa5, 0x06, 0x6f, 0xf5, 0x30, 0x4c, 0x9c, 0x4d, 0x8c,
-  0x4b, 0xd9, 0xa1, 0x7d, 0xb7, 0xcc, 0x7c, 0x74, 0xa2, 0xc2, 0xb0, 0x4a,
-  0x43, 0xe8, 0x1a, 0x46, 0x55, 0x8c, 0xa6, 0xe9, 0xc8, 0x43, 0x11, 0xc9,
-  0x02, 0xe8, 0x6c, 0x78, 0x2c, 0x8e, 0x59, 0x0b, 0xfd, 0x9e, 0x25, 0xe5,
-  0x75, 0x5e, 0xd4, 0x35, 0xee, 0x7a, 0xf5, 0x92, 0xe1, 0x99, 0x51, 0x74,
-  0xcc, 0x3a, 0xed, 0x8e, 0xc5, 0x95, 0x9b, 0xa7, 0xa6, 0x04, 0xc4, 0x4f,
-  0xc3, 0x8c, 0x96, 0x04, 0xe9, 0x5b, 0x2c, 0xa9, 0x2e, 0xc7, 0x64, 0x69,
-  0xf6, 0xf4, 0xb0, 0xf7, 0xc2, 0x6f, 0x04, 0x14, 0x9c, 0x26, 0xf8, 0xbb,
-  0xe7, 0x77, 0x89, 0x7a, 0x97, 0xd0, 0xbe, 0x19, 0xfe, 0x8c, 0x14, 0xd6,
-  0x41, 0x48, 0xa9, 0x7e, 0xf8, 0xa5, 0x4f, 0xca, 0xfa, 0x90, 0xf8, 0x18,
-  0xbc, 0xc2, 0xee, 0x29, 0x21, 0x1d, 0x33, 0x65, 0xbb, 0xe4, 0x3a, 0x9d,
-  0xaf, 0x8a, 0x23, 0x86, 0xce, 0x79, 0xa2, 0x9e, 0x89, 0x4f, 0xc4, 0xa7,
-  0xd0, 0x9d, 0x59, 0x4d, 0xa7, 0x25, 0x84, 0x00, 0xdd, 0x4b, 0x13, 0x75,
-  0x7e, 0xbd, 0x3f, 0x1e, 0xa0, 0xbf, 0xd5, 0x26, 0xa3, 0xd0, 0x17, 0xa6,
-  0xf3, 0xf0, 0xe5, 0x5c, 0x7f, 0xc4, 0x6f, 0xdc, 0x63, 0xe2, 0x48, 0xbc,
-  0x5f, 0x6d, 0xf0, 0x40, 0x6b, 0x4e, 0x50, 0xfb, 0xe3, 0xee, 0x89, 0xfe,
-  0xe0, 0xd2, 0xbd, 0x4b, 0xee, 0x8a, 0x63, 0xbd, 0x78, 0xb7, 0x86, 0xff,
-  0x49, 0x35, 0x23, 0x5a, 0xcb, 0x0e, 0xd9, 0x7a, 0x16, 0x14, 0xef, 0xa1,
-  0x72, 0x9d, 0xd4, 0x49, 0x9c, 0x44, 0xfc, 0xf2, 0x01, 0xe8, 0x43, 0x34,
-  0xdd, 0xc4, 0xf9, 0xd5, 0xda, 0x2a, 0x7f, 0x62, 0xc2, 0x2a, 0x4c, 0xab,
-  0xe3, 0x66, 0x63, 0x3c, 0x9e, 0x35, 0x11, 0xfe, 0x70, 0xe8, 0x4f, 0x84,
-  0xa2, 0x4e, 0x77, 0x07, 0xc2, 0x43, 0xfc, 0x84, 0x65, 0xc3, 0xd3, 0x3a,
-  0x78, 0xcf, 0x42, 0x69, 0xcc, 0xb5, 0xd2, 0xe2, 0x70, 0x73, 0x1d, 0x90,
-  0x0e, 0x6f, 0x46, 0xc1, 0xab, 0xc3, 0xfe, 0x5a, 0x7b, 0x2e, 0xd9, 0x16,
-  0x85, 0x84, 0x18, 0x27, 0xc3, 0xb6, 0x3e, 0x71, 0xbb, 0x23, 0x28, 0x6c,
-  0x3d, 0x6d, 0x30, 0xca, 0xf1, 0xa8, 0x82, 0x2d, 0x3b, 0x80, 0x6f, 0x13,
-  0x12, 0xd7, 0x4b, 0x89, 0x28, 0x4b, 0x81, 0x9c, 0x46, 0xeb, 0x04, 0x36,
-  0x97, 0xf0, 0x15, 0x3e, 0x56, 0x45, 0xb1, 0xc7, 0xbf, 0xd8, 0x96, 0xe9,
-  0x0c, 0x4f, 0x1e, 0xca, 0x9a, 0x8d, 0xa4, 0x32, 0xd5, 0xe9, 0x74, 0x18,
-  0xa3, 0x16, 0xd0, 0x35, 0x75, 0x80, 0xb8, 0xcf, 0xc9, 0x43, 0x35, 0xd9,
-  0x9b, 0x5a, 0x70, 0x01, 0x01, 0x79, 0x5f, 0x8d, 0xce, 0x9d, 0x23, 0x23,
-  0xdd, 0x3f, 0xb0, 0x36, 0x24, 0x3b, 0x3a, 0x42, 0xf5, 0x66, 0xfb, 0xa6,
-  0xdc, 0xd5, 0xd6, 0x55, 0x40, 0x42, 0x33, 0xe8, 0x32, 0x45, 0xbe, 0x5e,
-  0xc8, 0x24, 0x18, 0x61, 0x36, 0x83, 0x1a, 0xb7, 0xb1, 0x38, 0x9e, 0xd0,
-  0x8b, 0xea, 0x90, 0xad, 0xaa, 0xec, 0xfb, 0x54, 0xbd, 0x5b, 0xc3, 0xff,
-  0x80, 0x4c, 0xf8, 0xfe, 0x7d, 0x5a, 0x16, 0xc9, 0x5d, 0x56, 0xbd, 0x10,
-  0xe3, 0x85, 0x44, 0xd1, 0x03, 0x04, 0xfe, 0x40, 0xcd, 0x2c, 0x61, 0xfb,
-  0xeb, 0x15, 0x28, 0xc9, 0xc5, 0xac, 0x59, 0x05, 0xbd, 0x57, 0xd4, 0x38,
-  0xb5, 0x4c, 0x56, 0x6f, 0xae, 0x29, 0x54, 0x9b, 0xfa, 0x33, 0x7a, 0x20,
-  0xd4, 0x18, 0x77, 0x2e, 0xdd, 0x43, 0xf3, 0x57, 0xd0, 0x9b, 0x9b, 0x62,
-  0x8f, 0x17, 0x86, 0x30, 0x4e, 0x4d, 0x7e, 0x76, 0xf1, 0x0c, 0x3e, 0xe1,
-  0x9b, 0x0a, 0xb6, 0x06, 0xa9, 0xba, 0x38, 0x7f, 0xa6, 0x34, 0xa1, 0x67,
-  0xef, 0x43, 0xa8, 0xf7, 0xd2, 0x50, 0x1b, 0x21, 0x77, 0x40, 0x2d, 0x61,
-  0x3f, 0x22, 0xcb, 0x76, 0x94, 0x72, 0xe4, 0xaa, 0xc3, 0x8a, 0x66, 0xcc,
-  0x68, 0xac, 0x36, 0x59, 0x59, 0x59, 0xfa, 0x10, 0x99, 0x35, 0x29, 0x8d,
-  0xb5, 0xdb, 0x89, 0xf7, 0x35, 0xb8, 0x0e, 0x91, 0xed, 0xeb, 0x05, 0xc5,
-  0x61, 0x43, 0xdf, 0x7a, 0x65, 0xa7, 0x2c, 0x86, 0xb8, 0xd1, 0x5e, 0xe3,
-  0x84, 0x4b, 0xdc, 0x26, 0xcd, 0x4d, 0x90, 0xbc, 0x30, 0xc4, 0x8d, 0xb5,
-  0xf6, 0x62, 0x70, 0x5d, 0x29, 0x26, 0x2b, 0x29, 0xaf, 0x8f, 0xa4, 0x26,
-  0xc0, 0x8e, 0x07, 0xbb, 0x11, 0x98, 0x55, 0x97, 0x3f, 0x1f, 0x85, 0x88,
-  0x4d, 0xc0, 0xce, 0x2d, 0x9a, 0xd0, 0x4c, 0x35, 0xf0, 0xab, 0xab, 0x1e,
-  0xdd, 0xc2, 0x21, 0x15, 0x69, 0xd3, 0xa2, 0xae, 0xc2, 0x3b, 0x26, 0x84,
-  0xc6, 0x3a, 0xcd, 0x61, 0x87, 0x91, 0xc2, 0xb6, 0x5d, 0x9c, 0x90, 0x9d,
-  0x23, 0x2c, 0xf6, 0x57, 0xbd, 0xe2, 0x9b, 0x08, 0x57, 0x74, 0x64, 0x08,
-  0x25, 0xae, 0x60, 0x5a, 0x03, 0xae, 0xab, 0x25, 0x6c, 0xea, 0x6a, 0x75,
-  0xb5, 0x02, 0x85, 0x31, 0x5d, 0x01, 0x51, 0x4e, 0x9f, 0xd3, 0x4a, 0x04,
-  0x7f, 0x13, 0xd8, 0x6c, 0xcf, 0x37, 0x65, 0x42, 0x2e, 0xcf, 0xe9, 0x13,
-  0xf4, 0xd8, 0xb6, 0x00, 0x30, 0x60, 0xc9, 0x1e, 0x24, 0x4b, 0x0d, 0xbb,
-  0x0e, 0x01, 0x89, 0x95, 0x9a, 0xd9, 0x81, 0xac, 0x60, 0x96, 0xb0, 0xcf,
-  0xcc, 0x94, 0x44, 0x52, 0xe5, 0xdc, 0xee, 0x41, 0x37, 0xd7, 0x58, 0x9d,
-  0xb1, 0x6a, 0x70, 0xcd, 0x1d, 0xe7, 0xa8, 0x58, 0xe2, 0x71, 0xa0, 0xde,
-  0xbb, 0xf9, 0x4e, 0xde, 0x8d, 0x50, 0x06, 0xd9, 0x9d, 0x71, 0x10, 0x08,
-  0x8f, 0xda, 0x5f, 0xe0, 0x59, 0xbb, 0x26, 0xc8, 0x16, 0x1c, 0x11, 0xb5,
-  0x23, 0x8b, 0x48, 0xa8, 0x74, 0x28, 0x4a, 0x8e, 0x18, 0xa8, 0x0b, 0x94,
-  0xdb, 0x53, 0xd9, 0x09, 0x8d, 0xca, 0xe3, 0x7e, 0x8f, 0x51, 0x1d, 0x4d,
-  0xe0, 0xc9, 0x75, 0x8a, 0x51, 0x28, 0xef, 0xd3, 0xea, 0xcf, 0x23, 0x8a,
-  0xdb, 0xe5, 0x40, 0xe8, 0x80, 0x53, 0x1e, 0x08, 0x1f, 0x71, 0x7a, 0x24,
-  0x4e, 0x46, 0x0e, 0x7b, 0x71, 0xb3, 0x85, 0xa6, 0xae, 0xb6, 0x37, 0x5a,
-  0xfe, 0x28, 0xb6, 0x66, 0xb4, 0x75, 0x80, 0xdf, 0xfc, 0x21, 0x8d, 0xf7,
-  0xd0, 0x6e, 0x4a, 0x3c, 0x0b, 0x49, 0x30, 0xf0, 0x66, 0x57, 0x87, 0xb4,
-  0x0d, 0xaf, 0x8a, 0x50, 0x1a, 0x43, 0x19, 0xeb, 0xc1, 0x38, 0x4e, 0xe7,
-  0x50, 0xb6, 0xd1, 0xb9, 0x81, 0x8a, 0xa0, 0x0b, 0xc3, 0x24, 0x5b, 0xa5,
-  0xe2, 0xa1, 0x20, 0x3b, 0x66, 0x7a, 0xc5, 0xdb, 0x2b, 0xfe, 0x2a, 0xa7,
-  0x47, 0xbc, 0x93, 0xf6, 0xdf, 0xcd, 0xb5, 0xd0, 0xda, 0xa5, 0x37, 0x89,
-  0xe8, 0xe9, 0x1a, 0x42, 0x83, 0xe0, 0x86, 0x48, 0xf4, 0x56, 0xbf, 0xac,
-  0xe3, 0x7d, 0xee, 0x7d, 0xa0, 0x16, 0xed, 0x71, 0xe2, 0xf3, 0x6f, 0x1e,
-  0x36, 0xef, 0x20, 0x9e, 0x85, 0x88, 0x91, 0x4e, 0x9a, 0x8c, 0x99, 0x5c,
-  0xb8, 0x32, 0x64, 0xb5, 0x8a, 0x8c, 0xf0, 0xee, 0x92, 0x94, 0x70, 0x65,
-  0x85, 0xa9, 0x4d, 0x2c, 0xfe, 0x09, 0xb5, 0x51, 0xee, 0x1c, 0x51, 0x0f,
-  0x49, 0xcd, 0x33, 0x9a, 0xb0, 0xb7, 0x77, 0xe8, 0xac, 0x70, 0xac, 0x96,
-  0xb8, 0x3f, 0x75, 0xc7, 0xe0, 0x75, 0x99, 0x1e, 0x12, 0x9a, 0x9a, 0xbf,
-  0xc6, 0xc6, 0xa9, 0xc7, 0xa8, 0xbd, 0xe8, 0x76, 0xce, 0x34, 0xd9, 0x1b,
-  0x79, 0xa1, 0xa6, 0x1f, 0x01, 0x51, 0xee, 0x57, 0xd6, 0x12, 0xac, 0xf2,
-  0x10, 0xaa, 0x13, 0xce, 0x41, 0x49, 0x75, 0x5f, 0x81, 0xde, 0x36, 0xb7,
-  0xb0, 0xa0, 0x22, 0xb1, 0xa6, 0xc8, 0x6b, 0x8a, 0x88, 0x88, 0xd3, 0xb1,
-  0xd6, 0x29, 0xac, 0x4e, 0x72, 0xe9, 0xa0, 0xb1, 0xea, 0x63, 0xa0, 0x4f,
-  0x3a, 0x30, 0x3c, 0xb2, 0xa0, 0x91, 0xc1, 0x00, 0xd1, 0x1d, 0xa2, 0x3a,
-  0xab, 0x8f, 0xc0, 0x54, 0xd4, 0x4d, 0x09, 0xed, 0x84, 0x65, 0xe7, 0xc7,
-  0xe3, 0x25, 0xd1, 0x60, 0x43, 0x1a, 0x6d, 0xc4, 0x59, 0x2b, 0xf8, 0x1b,
-  0x30, 0x26, 0x98, 0x22, 0x6d, 0x95, 0x4d, 0xf3, 0x3c, 0x4e, 0x4f, 0x5e,
-  0xc0, 0x6e, 0x66, 0x64, 0xbf, 0x06, 0x48, 0xc4, 0xcf, 0x43, 0x86, 0xb3,
-  0xbc, 0x16, 0x77, 0x7b, 0x23, 0x00, 0x12, 0x39, 0xb5, 0x3b, 0xe0, 0xa7,
-  0x59, 0x70, 0x37, 0x61, 0x16, 0xe9, 0x36, 0xed, 0x19, 0xd0, 0x4b, 0x95,
-  0x39, 0x6c, 0x83, 0xff, 0x2c, 0xa0, 0x9e, 0x37, 0xad, 0x9d, 0xa8, 0x27,
-  0x0e, 0xdf, 0x63, 0x91, 0xcd, 0xbd, 0xb1, 0xab, 0x8c, 0x91, 0x92, 0xcb,
-  0x35, 0x5e, 0xb5, 0xd1, 0x98, 0xa8, 0xd3, 0x31, 0xc2, 0x91, 0xb1, 0x99,
-  0xf0, 0x7b, 0x73, 0xad, 0x80, 0x87, 0xce, 0x9b, 0x11, 0x84, 0x65, 0xa1,
-  0x49, 0x96, 0xf6, 0xb5, 0x02, 0x4b, 0xfb, 0x51, 0x7b, 0x52, 0x67, 0x66,
-  0x07, 0x20, 0x6d, 0x0b, 0x76, 0x02, 0xa7, 0x63, 0xf8, 0xd7, 0x85, 0xc0,
-  0x5e, 0x0e, 0xd5, 0x38, 0x34, 0x1d, 0x7a, 0x8f, 0xee, 0x95, 0xa0, 0x96,
-  0xea, 0x4d, 0x17, 0x9e, 0x99, 0x81, 0xe8, 0x2b, 0x82, 0x1b, 0x07, 0xda,
-  0xce, 0x9c, 0x59, 0x66, 0x76, 0x78, 0x4a, 0xc4, 0x0c, 0xc9, 0x0c, 0xc3,
-  0xff, 0xb2, 0x66, 0x04, 0xb2, 0x87, 0x5f, 0xe3, 0xc4, 0x35, 0x0b, 0xbe,
-  0x81, 0x24, 0x40, 0xe0, 0x57, 0x63, 0x25, 0xc6, 0x48, 0xcd, 0xd0, 0xe8,
-  0xac, 0xde, 0x2e, 0x08, 0xbc, 0xf4, 0xe5, 0xae, 0x15, 0xc7, 0x22, 0x06,
-  0x83, 0x82, 0x71, 0x71, 0xdd, 0x5a, 0x8c, 0x9d, 0x39, 0xb3, 0xfd, 0xba,
-  0xb8, 0xad, 0xe6, 0xbf, 0xfb, 0xea, 0x89, 0x9d, 0x78, 0x4f, 0x70, 0x41,
-  0x83, 0xf6, 0x6d, 0xe6, 0xf0, 0xf9, 0xf9, 0xe5, 0x13, 0x1d, 0xbc, 0xd9,
-  0x5b, 0x1c, 0x50, 0x5e, 0x60, 0xeb, 0xe9, 0x94, 0x14, 0x85, 0x46, 0x63,
-  0x91, 0x00, 0x25, 0xf1, 0x50, 0xdb, 0x2e, 0xf2, 0xaf, 0x9d, 0xa2, 0x60,
-  0xc5, 0x42, 0x18, 0x34, 0x96, 0x16, 0x12, 0x73, 0xf5, 0xd4, 0x4c, 0x2f,
-  0x72, 0x73, 0xa6, 0xfb, 0xc9, 0x05, 0xa7, 0x24, 0xd2, 0xa3, 0x66, 0xc2,
-  0xad, 0xe2, 0x6b, 0x75, 0xca, 0x8e, 0x54, 0xe1, 0xe7, 0xb5, 0x7c, 0x1e,
-  0x63, 0xfd, 0x0b, 0x11, 0x49, 0x92, 0xee, 0xc7, 0x88, 0x2d, 0x9e, 0x37,
-  0x85, 0xc9, 0x79, 0x64, 0x04, 0x0b, 0xd1, 0xce, 0x83, 0x8c, 0x74, 0xe2,
-  0x4f, 0x77, 0x74, 0xc5, 0x35, 0x4c, 0xa4, 0x3c, 0x7d, 0x57, 0x2e, 0xc3,
-  0xf8, 0x5d, 0x05, 0xfb, 0xaf, 0x39, 0x2a, 0xf4, 0xdc, 0x53, 0x71, 0x57,
-  0x40, 0x3c, 0xa6, 0x42, 0xfb, 0xf8, 0xba, 0x4c, 0x6e, 0xe1, 0x0f, 0x22,
-  0xc6, 0xb4, 0x3f, 0xb8, 0xc0, 0x71, 0xad, 0xe4, 0xdd, 0xe5, 0xfa, 0x8d,
-  0x8d, 0x01, 0xed, 0xe2, 0x36, 0x5b, 0xd7, 0x5b, 0x98, 0x62, 0xb1, 0xcd,
-  0xc5, 0x8c, 0x6e, 0xc2, 0x35, 0x8a, 0x6c, 0xc9, 0x39, 0x1b, 0xcb, 0xb4,
-  0xed, 0x39, 0x98, 0xaa, 0xba, 0xb5, 0xe2, 0x75, 0x06, 0xab, 0x0e, 0x92,
-  0x57, 0xa9, 0xb3, 0xb0, 0x70, 0x54, 0x87, 0x98, 0x53, 0xab, 0x98, 0x47,
-  0x2a, 0x1e, 0xf3, 0xf9, 0x36, 0x4d, 0xd6, 0xc1, 0xbe, 0xa2, 0xa5, 0x0b,
-  0x40, 0xdb, 0x2b, 0x92, 0x35, 0x6c, 0x98, 0xe1, 0xbd, 0xd9, 0x22, 0xec,
-  0x40, 0x41, 0xce, 0x0e, 0xc0, 0x82, 0x34, 0x18, 0xf3, 0x25, 0x46, 0x1e,
-  0xd7, 0x6a, 0x89, 0xe1, 0xcc, 0x19, 0xaf, 0x6c, 0x01, 0xa7, 0x1a, 0xa5,
-  0xa5, 0xd2, 0x12, 0x44, 0x94, 0x9a, 0xc4, 0x51, 0x51, 0x5c, 0x0d, 0x05,
-  0x2d, 0x10, 0x3d, 0x4a, 0x0c, 0x82, 0x78, 0xd3, 0xa9, 0x96, 0x72, 0xf6,
-  0xb6, 0x94, 0xd1, 0x5f, 0xc8, 0x40, 0xe2, 0xe8, 0x2f, 0xf8, 0xdb, 0xd5,
-  0x5f, 0xf4, 0xdd, 0xb4, 0x56, 0xfd, 0x45, 0x98, 0xfd, 0x83, 0xaa, 0x31,
-  0x27, 0xc6, 0x0b, 0xdb, 0x74, 0x97, 0xbd, 0x71, 0x89, 0xc6, 0x8d, 0xcf,
-  0xf9, 0xcb, 0x82, 0x25, 0x5e, 0x85, 0x1b, 0xe0, 0x33, 0x45, 0x43, 0x85,
-  0x26, 0x6d, 0x1e, 0x68, 0x74, 0x9e, 0x03, 0x82, 0x0b, 0x75, 0x0d, 0x78,
-  0x8e, 0x15, 0xea, 0x10, 0x5a, 0xb0, 0x3a, 0xb8, 0x58, 0x3c, 0x64, 0x3b,
-  0x7b, 0x1b, 0x6e, 0xa0, 0xee, 0x74, 0xe2, 0x84, 0xf1, 0xc2, 0xe2, 0xdc,
-  0x66, 0x3f, 0x82, 0x19, 0xf5, 0x82, 0x65, 0xb0, 0x47, 0xce, 0xb2, 0x63,
-  0x97, 0x3b, 0xe3, 0x01, 0xc2, 0xcb, 0x77, 0xdf, 0xfa, 0xaa, 0x2f, 0x88,
-  0xba, 0x4b, 0x18, 0x3b, 0x8c, 0x78, 0x55, 0x53, 0x83, 0x84, 0xcc, 0xe9,
-  0x98, 0x97, 0x5f, 0x66, 0x66, 0x0d, 0xa7, 0x0d, 0xa4, 0x52, 0xca, 0xf7,
-  0xb4, 0xb4, 0xb8, 0xc2, 0xd9, 0x66, 0x4c, 0x10, 0x63, 0x3d, 0x9b, 0xd6,
-  0x0b, 0xe8, 0xde, 0x8e, 0x02, 0x76, 0x98, 0xce, 0xec, 0x54, 0x30, 0xf0,
-  0xd3, 0x50, 0x22, 0x99, 0x2f, 0xdc, 0x02, 0xdd, 0x00, 0xeb, 0xbb, 0xcb,
-  0x3e, 0xd4, 0x2f, 0xe1, 0xab, 0xbb, 0xbf, 0x78, 0xf5, 0x2e, 0x39, 0xbf,
-  0xc6, 0xfb, 0x8a, 0xf0, 0xfe, 0x95, 0xb8, 0x56, 0xab, 0xa0, 0xbe, 0x36,
-  0xde, 0x41, 0xe9, 0x4e, 0xfc, 0x53, 0x61, 0x0e, 0xbe, 0x90, 0x7f, 0x40,
-  0x6e, 0x7c, 0x49, 0x63, 0x61, 0x59, 0x5d, 0x87, 0x5d, 0xb0, 0xe3, 0xfc,
-  0x00, 0x96, 0xf9, 0x01, 0x2a, 0xf7, 0x89, 0x0e, 0x03, 0xd7, 0xae, 0x76,
-  0xbb, 0xf2, 0xa3, 0x55, 0x1f, 0x96, 0xdb, 0x03, 0x6c, 0xcb, 0x0c, 0xcd,
-  0xd1, 0x71, 0x33, 0xb5, 0x81, 0xf7, 0x6d, 0xc3, 0x11, 0x83, 0xb1, 0x81,
-  0xd4, 0xb2, 0xa6, 0x75, 0x06, 0x7c, 0xc0, 0x09, 0xa0, 0x6f, 0x7e, 0x36,
-  0x26, 0xa5, 0xa3, 0x1d, 0x39, 0x1d, 0xed, 0x6b, 0x7f, 0xae, 0x76, 0x27,
-  0xb6, 0x60, 0x60, 0x26, 0xb6, 0x00, 0xc3, 0x83, 0xb5, 0xfb, 0x9a, 0x22,
-  0x56, 0x8d, 0x70, 0xdf, 0x9a, 0xad, 0xba, 0x8a, 0x50, 0x21, 0x73, 0xce,
-  0x15, 0x11, 0x81, 0xca, 0xfd, 0x14, 0xf7, 0x01, 0x63, 0x6e, 0xf5, 0x02,
-  0x0d, 0xd9, 0xeb, 0xac, 0x54, 0xe1, 0x30, 0xd8, 0xc9, 0xf1, 0x77, 0xa8,
-  0xcc, 0x1b, 0xc6, 0x46, 0x4d, 0x52, 0x51, 0x4c, 0x96, 0xa8, 0x50, 0x9a,
-  0xb4, 0xcb, 0x93, 0x0e, 0x89, 0x72, 0x16, 0x19, 0x0b, 0x4f, 0x1b, 0x97,
-  0x88, 0x92, 0x43, 0xb5, 0xf1, 0xb6, 0x1a, 0x45, 0xbd, 0x76, 0x44, 0x53,
-  0x5b, 0x47, 0xc7, 0x8a, 0x63, 0x3f, 0xb9, 0x65, 0xa3, 0xfd, 0x36, 0x40,
-  0x14, 0xfa, 0x92, 0xb0, 0x4b, 0x16, 0x8a, 0x51, 0x49, 0x18, 0x7d, 0xe6,
-  0x0a, 0x1f, 0x4f, 0xbb, 0x67, 0x19, 0xd1, 0xd4, 0xf0, 0xa5, 0xc4, 0x68,
-  0xe4, 0x28, 0x45, 0xa1, 0xb6, 0xbe, 0x70, 0x14, 0xa3, 0x50, 0x65, 0x67,
-  0xa5, 0x89, 0x55, 0x9a, 0x53, 0xd0, 0x8d, 0xca, 0xcb, 0x75, 0x04, 0x93,
-  0xdd, 0x30, 0x7c, 0x70, 0x5c, 0x97, 0xeb, 0x0f, 0x89, 0xed, 0xf9, 0x60,
-  0x6c, 0xcf, 0x63, 0xd8, 0xbc, 0x1e, 0x7b, 0x4f, 0x5c, 0xf6, 0x90, 0x05,
-  0x9b, 0xf6, 0x93, 0x32, 0x95, 0x01, 0x76, 0xcf, 0x59, 0xfa, 0x2c, 0x28,
-  0x1f, 0xc0, 0x7a, 0xd2, 0x65, 0x39, 0x09, 0xcc, 0x57, 0xfd, 0xe6, 0x90,
-  0x0e, 0x53, 0x88, 0x72, 0xf4, 0xc4, 0xf7, 0xb6, 0x86, 0x84, 0x0b, 0xae,
-  0x35, 0x88, 0xfc, 0x00, 0x63, 0xc8, 0x83, 0xe9, 0x0a, 0x6c, 0x1c, 0x8e,
-  0x5f, 0x7a, 0x68, 0xe4, 0xf8, 0x04, 0xa9, 0x63, 0xbd, 0x7e, 0xa8, 0x05,
-  0xa3, 0xcf, 0x7a, 0xd1, 0x29, 0x22, 0x1f, 0x64, 0xac, 0x78, 0xa0, 0xa1,
-  0xe2, 0x41, 0x46, 0x0a, 0xdd, 0x25, 0x6c, 0x1a, 0xe7, 0x80, 0x28, 0x5e,
-  0xbc, 0x97, 0xb3, 0xe6, 0x19, 0x80, 0x29, 0xae, 0x46, 0xa0, 0xc6, 0x99,
-  0xd4, 0xaf, 0x8e, 0x5d, 0xc2, 0x4e, 0x99, 0xe7, 0xff, 0x98, 0x32, 0xff,
-  0x3f, 0x4c, 0x19, 0xd1, 0x1a, 0x1e, 0x34, 0x73, 0x9e, 0xff, 0x63, 0xe6,
-  0x7c, 0xc0, 0x99, 0xe3, 0x4d, 0x1d, 0x59, 0x48, 0x1b, 0x53, 0xc7, 0x0c,
-  0x00, 0xc3, 0xb8, 0x77, 0xea, 0xe5, 0x66, 0x1d, 0x2d, 0xac, 0x56, 0xd7,
-  0x6e, 0xe0, 0x8d, 0x4e, 0xc9, 0x41, 0x78, 0x9f, 0x47, 0xf0, 0xd2, 0x69,
-  0xa6, 0x76, 0x53, 0x5b, 0x5c, 0x97, 0xc9, 0x61, 0x9b, 0xad, 0x2a, 0x34,
-  0x64, 0xd8, 0x7a, 0x65, 0xb6, 0x1e, 0x97, 0x8c, 0x30, 0xaf, 0x6a, 0x6b,
-  0xcd, 0x0a, 0xac, 0x0f, 0x34, 0x6b, 0x8d, 0x01, 0x22, 0xc7, 0x7d, 0x5d,
-  0x4e, 0x77, 0xb9, 0x79, 0x96, 0x3a, 0x93, 0x20, 0xa7, 0x0b, 0x75, 0x78,
-  0x0b, 0x81, 0x9c, 0xde, 0xf2, 0x19, 0x4f, 0xfa, 0x13, 0x31, 0x50, 0xe4,
-  0xd1, 0xc6, 0x47, 0x9a, 0xfe, 0x3e, 0x76, 0x24, 0x67, 0xef, 0x46, 0x8a,
-  0xe2, 0x82, 0xf4, 0x0d, 0xed, 0xd4, 0xee, 0x5a, 0x10, 0x8d, 0x3a, 0x1e,
-  0x76, 0x82, 0x0d, 0x23, 0xe0, 0x05, 0xf9, 0xd1, 0xd0, 0x2b, 0x1b, 0x27,
-  0x47, 0xce, 0xae, 0x1e, 0xb0, 0x03, 0x24, 0x31, 0x32, 0x64, 0x03, 0xa8,
-  0x3c, 0x11, 0x09, 0x1d, 0x1e, 0x36, 0x28, 0xba, 0x25, 0xd5, 0x05, 0x1b,
-  0x96, 0x2b, 0x78, 0x59, 0xca, 0xb1, 0xb4, 0x48, 0x1d, 0x0a, 0x67, 0xd4,
-  0xd8, 0x8a, 0x38, 0xbb, 0x10, 0xbc, 0xdd, 0xe2, 0x8c, 0x3f, 0xcf, 0x43,
-  0x23, 0x52, 0x9a, 0x56, 0xc4, 0xe1, 0xbb, 0x90, 0x07, 0x9e, 0x07, 0xbc,
-  0xe7, 0xe6, 0xe3, 0x7d, 0xf6, 0x1d, 0x0f, 0xd9, 0x72, 0x88, 0xe3, 0x0e,
-  0xed, 0xa9, 0x7a, 0x4c, 0xbe, 0x8c, 0xfa, 0xbd, 0x4c, 0xbe, 0xf6, 0x7c,
-  0xe3, 0x3d, 0x2c, 0xbf, 0x4c, 0x5c, 0xdd, 0x5a, 0x7f, 0xa7, 0xe5, 0xd7,
-  0x73, 0x2d, 0x6c, 0x48, 0x12, 0x71, 0x46, 0xe4, 0xa8, 0x9d, 0x0f, 0x14,
-  0xb7, 0x11, 0x63, 0xc2, 0xc9, 0xc3, 0x0c, 0x09, 0x27, 0x8e, 0x7d, 0x9e,
-  0x65, 0xb6, 0x71, 0x1e, 0x3b, 0x13, 0xab, 0xa7, 0x9d, 0x2f, 0x32, 0xb6,
-  0xee, 0x02, 0xcb, 0xc6, 0x2f, 0x4c, 0x39, 0x22, 0x46, 0x82, 0xaa, 0x38,
-  0x96, 0x94, 0xb2, 0x93, 0xb6, 0xf7, 0xf6, 0x3d, 0xb2, 0x89, 0x7d, 0xdb,
-  0x6b, 0x63, 0xe8, 0x37, 0x0b, 0xc4, 0x08, 0x21, 0x2b, 0xdc, 0x8f, 0x4f,
-  0x89, 0xf5, 0xb9, 0xf3, 0x95, 0x12, 0x14, 0x0f, 0x7c, 0xfe, 0xca, 0x06,
-  0x33, 0xfc, 0xfd, 0xbe, 0x43, 0xab, 0x1c, 0x36, 0x0a, 0xc6, 0x97, 0x07,
-  0x37, 0x62, 0x22, 0x6a, 0x0c, 0xaf, 0x65, 0xc7, 0x92, 0xac, 0x29, 0xe1,
-  0x7e, 0x12, 0x67, 0xdd, 0xc2, 0x28, 0x68, 0x3f, 0x70, 0x09, 0x81, 0xe9,
-  0xd6, 0x5c, 0x3a, 0x9d, 0x48, 0x0b, 0x86, 0xdb, 0xa3, 0x66, 0xfa, 0xe0,
-  0x1c, 0x36, 0x58, 0x33, 0xb0, 0x38, 0x50, 0x42, 0x51, 0x22, 0xbc, 0x55,
-  0x90, 0x2e, 0x9a, 0xaf, 0x32, 0x90, 0x89, 0xe8, 0xf6, 0xf7, 0x0f, 0xe5,
-  0xfc, 0xbf, 0x8f, 0x72, 0x6e, 0x96, 0x59, 0x7f, 0x88, 0xc3, 0xd8, 0x0c,
-  0x46, 0x61, 0x3f, 0x19, 0xaa, 0xb0, 0x87, 0x80, 0x0f, 0x53, 0xd8, 0x23,
-  0xf3, 0xb2, 0xd7, 0x20, 0xf8, 0x30, 0xbd, 0xbd, 0x0d, 0xfc, 0xc7, 0xd7,
-  0xdb, 0x61, 0x9e, 0xd6, 0x20, 0x54, 0x7f, 0xe0, 0xdc, 0xe2, 0x91, 0xe0,
-  0x79, 0x54, 0x29, 0xef, 0xd7, 0x3f, 0x26, 0xdf, 0xff, 0xb3, 0xc6, 0x24,
-  0x6f, 0xec, 0xbd, 0x8d, 0xb1, 0x12, 0xdd, 0xea, 0x47, 0x9d, 0x44, 0xf1,
-  0x6a, 0xbb, 0x3d, 0x72, 0x5a, 0xa9, 0xec, 0x72, 0x8a, 0x69, 0x2d, 0x14,
-  0x9f, 0x7f, 0x7f, 0x3f, 0x93, 0x13, 0x9e, 0x0b, 0x2e, 0xc8, 0x94, 0xce,
-  0xfc, 0xad, 0x67, 0xdd, 0x43, 0x2b, 0xd2, 0x95, 0xb8, 0xba, 0x9b, 0x58,
-  0xe3, 0xcd, 0x3d, 0x1d, 0x1d, 0x56, 0xfa, 0x17, 0x49, 0x59, 0x17, 0x7b,
-  0xf5, 0xc7, 0x2c, 0x87, 0xf6, 0x9f, 0x56, 0x18, 0x69, 0xed, 0x70, 0xac,
-  0x4d, 0x18, 0x94, 0xf3, 0x47, 0x41, 0x18, 0x94, 0x31, 0x55, 0x88, 0x20,
-  0x53, 0x60, 0x74, 0xc7, 0x1b, 0xbb, 0xbe, 0x53, 0x18, 0xc9, 0x53, 0x42,
-  0x8c, 0x06, 0x93, 0xef, 0xa0, 0xbc, 0x58, 0x4f, 0x1b, 0x95, 0x12, 0xc2,
-  0x6c, 0x9f, 0xce, 0x39, 0x2a, 0x99, 0xb2, 0x3d, 0x2b, 0x37, 0xd2, 0xc6,
-  0x3c, 0x23, 0xb4, 0x0f, 0x9a, 0x9e, 0xa2, 0xa8, 0x35, 0xe0, 0x79, 0x5f,
-  0x25, 0xfe, 0x49, 0xa6, 0x82, 0x10, 0x8e, 0xc7, 0xd3, 0x80, 0x91, 0x53,
-  0x4d, 0x14, 0x46, 0xf7, 0xa1, 0x77, 0x81, 0x6e, 0x5c, 0x61, 0xc8, 0xc4,
-  0x84, 0x11, 0x58, 0xca, 0xb8, 0x49, 0xc6, 0x0f, 0x1c, 0x63, 0xa2, 0x6a,
-  0x9f, 0x1d, 0xeb, 0x74, 0xbe, 0x3c, 0xcc, 0x02, 0xb1, 0x81, 0xfd, 0x72,
-  0xf1, 0x2f, 0xcf, 0x44, 0x6f, 0x0a, 0x90, 0x94, 0x11, 0x24, 0x65, 0x13,
-  0x49, 0xe9, 0x23, 0x71, 0xe3, 0x26, 0xd6, 0x12, 0x5a, 0x0e, 0x65, 0x89,
-  0x74, 0x07, 0x5d, 0x7b, 0x7b, 0xa6, 0x5c, 0x9f, 0xe6, 0x29, 0x0c, 0x1b,
-  0xdd, 0x60, 0x4a, 0xed, 0x57, 0x7d, 0x0f, 0x55, 0x72, 0x63, 0x38, 0xff,
-  0xc9, 0xfd, 0x0b, 0x13, 0x65, 0xe5, 0x1a, 0xb6, 0x40, 0xf7, 0x4e, 0x78,
-  0x23, 0x0f, 0x18, 0xc1, 0x96, 0xc5, 0xfa, 0x3e, 0xf6, 0x11, 0x18, 0xd7,
-  0x04, 0x52, 0x89, 0x7d, 0x76, 0xaa, 0xc4, 0xb0, 0x77, 0x9d, 0x20, 0x86,
-  0xac, 0xf9, 0x9d, 0x1b, 0x3e, 0xe8, 0xac, 0x72, 0xef, 0x78, 0x75, 0x94,
-  0x76, 0xbb, 0x08, 0x70, 0xf4, 0x97, 0xc0, 0xff, 0x00, 0x50, 0xab, 0x30,
-  0xe6, 0x1a, 0x24, 0xf5, 0xda, 0x95, 0x0d, 0xa0, 0xfe, 0x0e, 0xa3, 0x91,
-  0xaf, 0xe9, 0x84, 0xbf, 0x4c, 0xeb, 0x63, 0xb9, 0x57, 0x89, 0xe2, 0x7a,
-  0xce, 0xdf, 0x4d, 0x46, 0xe6, 0x70, 0xd4, 0xf0, 0xd5, 0xe9, 0x99, 0x1d,
-  0xa0, 0x59, 0x2f, 0xe5, 0x65, 0x04, 0x42, 0x5f, 0x2f, 0xd6, 0x41, 0xfd,
-  0x0c, 0x21, 0x32, 0x5e, 0x78, 0xc9, 0xbb, 0x48, 0x61, 0x77, 0x04, 0xbd,
-  0x2f, 0xc7, 0xde, 0x3a, 0x2d, 0xe2, 0x99, 0x0c, 0x16, 0x8c, 0xbe, 0x94,
-  0x6b, 0xc5, 0x8f, 0x1b, 0x82, 0xd4, 0xdc, 0x5a, 0x36, 0xd8, 0xcd, 0xbc,
-  0xc2, 0x50, 0x6a, 0x18, 0x38, 0x4a, 0x82, 0x2c, 0x6a, 0x56, 0xb4, 0xac,
-  0x76, 0xea, 0x07, 0x61, 0x14, 0x54, 0xf6, 0x4e, 0x0f, 0xde, 0x2f, 0x36,
-  0x57, 0x3f, 0x29, 0x30, 0xf6, 0x23, 0xa7, 0xab, 0xb5, 0x63, 0xfd, 0xe7,
-  0x3b, 0x44, 0x97, 0x96, 0xea, 0xd2, 0xbd, 0x4b, 0x51, 0x17, 0xea, 0x5b,
-  0x11, 0x48, 0xa7, 0x64, 0x70, 0x6b, 0xc4, 0xc0, 0x3c, 0xd7, 0x17, 0x26,
-  0xd9, 0xf4, 0xd0, 0xac, 0xc5, 0x99, 0x13, 0xda, 0xb8, 0x67, 0x2e, 0x96,
-  0xd2, 0xe0, 0x48, 0x08, 0x1c, 0x7c, 0x3c, 0x35, 0xc1, 0x21, 0x19, 0x65,
-  0xed, 0xa1, 0x60, 0x4a, 0xfb, 0xf1, 0x48, 0xe8, 0x97, 0x00, 0x63, 0xd8,
-  0xa1, 0x9c, 0x90, 0xa8, 0xad, 0x3b, 0x75, 0xba, 0x22, 0xaf, 0x33, 0x2d,
-  0x50, 0xe5, 0x20, 0x0e, 0xbf, 0xa1, 0x34, 0x72, 0x62, 0x3a, 0x87, 0x9f,
-  0x4b, 0xfb, 0xd9, 0x46, 0x69, 0x36, 0x44, 0x51, 0x92, 0xa7, 0x36, 0x9a,
-  0x38, 0x03, 0x54, 0x0b, 0x49, 0x7f, 0x3f, 0x9a, 0x0e, 0x45, 0x55, 0x77,
-  0xf5, 0x14, 0x7f, 0xfe, 0x10, 0x74, 0x71, 0xc5, 0xb5, 0x95, 0x02, 0x86,
-  0x2b, 0x85, 0x23, 0x2b, 0x9f, 0x25, 0xcf, 0xf5, 0xf5, 0x82, 0x17, 0xee,
-  0x7f, 0xbc, 0x00, 0x7f, 0x7a, 0xac, 0x8b, 0x39, 0xee, 0xaa, 0xf1, 0x72,
-  0x98, 0x09, 0x3a, 0xf6, 0x42, 0x22, 0x28, 0xb8, 0xb1, 0x03, 0xf2, 0xe5,
-  0x06, 0x56, 0xbc, 0x53, 0x74, 0x50, 0xc5, 0x02, 0xb0, 0xba, 0xd3, 0x9b,
-  0x51, 0x23, 0xc8, 0x40, 0xbe, 0xda, 0x79, 0x60, 0x84, 0x17, 0xe1, 0x62,
-  0x04, 0x7c, 0x55, 0x27, 0x35, 0xb0, 0x28, 0xee, 0xd8, 0x23, 0xf5, 0x1b,
-  0xc3, 0x38, 0x9a, 0x0b, 0x56, 0xc5, 0xee, 0x40, 0x17, 0xdb, 0xac, 0x55,
-  0x7c, 0x97, 0xac, 0x40, 0x5b, 0x5b, 0x51, 0x9a, 0xb6, 0x79, 0x65, 0x50,
-  0xcd, 0x6f, 0x4b, 0x14, 0xf5, 0x25, 0x67, 0xf1, 0xb8, 0xbd, 0x83, 0x7f,
-  0x59, 0xb0, 0x7c, 0xab, 0xf5, 0x87, 0x33, 0x7a, 0xd7, 0xdc, 0x59, 0x28,
-  0xc7, 0xa0, 0xe0, 0x55, 0x49, 0x59, 0x0b, 0xc8, 0x2a, 0x4b, 0x29, 0x17,
-  0x56, 0xb0, 0x3c, 0xa3, 0xb3, 0xef, 0x21, 0x5d, 0x61, 0xb2, 0x5d, 0x1f,
-  0x98, 0x06, 0x28, 0x62, 0xb6, 0x3d, 0xa3, 0x2a, 0x23, 0x26, 0x08, 0x13,
-  0xc9, 0xdd, 0xd9, 0x7b, 0x9a, 0xb3, 0x8b, 0x32, 0xb5, 0xe7, 0x04, 0xed,
-  0x0d, 0x1d, 0x6f, 0xe1, 0x45, 0x71, 0x5d, 0x26, 0x3b, 0xd4, 0x8d, 0xcc,
-  0x8f, 0x59, 0x4f, 0xa9, 0x0a, 0x16, 0x01, 0x4c, 0x70, 0x97, 0xf3, 0xd5,
-  0x3d, 0xe7, 0x67, 0x5f, 0xc9, 0x65, 0x52, 0x56, 0x52, 0x4c, 0x9e, 0xfb,
-  0xca, 0x1c, 0xb2, 0x74, 0xb5, 0x05, 0x4d, 0x8f, 0x54, 0x6f, 0xfd, 0xdc,
-  0x5b, 0x4f, 0x71, 0x67, 0xaa, 0xe1, 0x47, 0x3f, 0xc6, 0x13, 0x67, 0x53,
-  0xb1, 0xcd, 0x47, 0xf1, 0xe7, 0x36, 0x8b, 0x7e, 0x0b, 0x81, 0xf4, 0x43,
-  0x6a, 0xe6, 0x2f, 0x1a, 0x67, 0x23, 0x86, 0x09, 0xe1, 0x75, 0x98, 0x78,
-  0x9d, 0x72, 0x20, 0x85, 0xec, 0xc6, 0x7a, 0x63, 0xfb, 0x24, 0xec, 0xd2,
-  0x64, 0x4f, 0x38, 0x77, 0xe9, 0x3a, 0xd3, 0x8f, 0xc0, 0xbc, 0x4c, 0x50,
-  0xbd, 0xa6, 0xbf, 0x98, 0x49, 0x77, 0x61, 0x00, 0xcd, 0xaf, 0x6a, 0x21,
-  0x39, 0x4f, 0x56, 0xa9, 0xfd, 0xb2, 0xc7, 0xdd, 0x45, 0x9e, 0xd5, 0xf7,
-  0x8c, 0x02, 0xad, 0x11, 0x18, 0x8f, 0x61, 0x9f, 0x26, 0xe5, 0xa2, 0x4c,
-  0xaf, 0x75, 0x10, 0x03, 0xfe, 0x78, 0x5c, 0x56, 0x09, 0x7e, 0xef, 0x6f,
-  0x08, 0x05, 0xeb, 0x94, 0x26, 0x78, 0xd3, 0xb6, 0xfa, 0xee, 0x08, 0x5c,
-  0x5d, 0x2d, 0xa0, 0x6e, 0x72, 0xe7, 0x08, 0x26, 0xbb, 0xfe, 0x3c, 0x6a,
-  0x96, 0xac, 0x8b, 0x05, 0x46, 0x75, 0x59, 0x54, 0x45, 0x7e, 0x93, 0x7a,
-  0x85, 0xbc, 0x2f, 0x0d, 0x09, 0x30, 0xe0, 0x3f, 0x67, 0xaf, 0xf0, 0xfb,
-  0x94, 0x55, 0x75, 0x45, 0x46, 0xc0, 0xaa, 0xc0, 0x3b, 0xbd, 0x35, 0x26,
-  0xaa, 0xa1, 0xd8, 0xb6, 0x3a, 0xc4, 0xb4, 0x4e, 0x09, 0xe3, 0xc7, 0x4f,
-  0x54, 0xb0, 0x13, 0x5c, 0xf3, 0x3d, 0x70, 0xf2, 0xae, 0xc7, 0x8e, 0x72,
-  0xb6, 0x15, 0xef, 0x41, 0x93, 0xdc, 0x25, 0x64, 0xad, 0x07, 0x44, 0x28,
-  0xc5, 0x40, 0x10, 0xf3, 0x44, 0xcf, 0x6d, 0xbf, 0x64, 0x34, 0x38, 0x3c,
-  0xb2, 0xbb, 0x1b, 0x70, 0xf6, 0x00, 0xba, 0x7a, 0x6a, 0xf8, 0xe2, 0xb8,
-  0x87, 0x3e, 0x98, 0xe2, 0xbf, 0x91, 0x1b, 0xea, 0x2f, 0xf1, 0x3d, 0xdd,
-  0xfd, 0xa7, 0x87, 0x91, 0xc1, 0xaf, 0x69, 0xa6, 0x62, 0xfe, 0x01, 0x1f,
-  0x63, 0x35, 0x9a, 0xdc, 0xd4, 0x08, 0xcf, 0x86, 0x2a, 0x1e, 0x34, 0x9f,
-  0x6e, 0x06, 0x20, 0xb4, 0x5e, 0xa1, 0xda, 0x82, 0x0e, 0xb3, 0xa7, 0x64,
-  0x18, 0x0f, 0xee, 0x28, 0xe7, 0x1f, 0x12, 0x5b, 0x06, 0x77, 0x4a, 0xc7,
-  0x59, 0x83, 0x60, 0x63, 0xd9, 0x32, 0x97, 0x11, 0x8e, 0x78, 0x15, 0x81,
-  0x82, 0xe6, 0x88, 0xcb, 0xa9, 0xd6, 0x6e, 0x47, 0x7f, 0x0a, 0xdb, 0xfb,
-  0x28, 0x34, 0x02, 0x70, 0x35, 0x6c, 0xe4, 0x38, 0xce, 0x66, 0xe6, 0x89,
-  0x1e, 0xf4, 0x4b, 0xe0, 0xe3, 0xbf, 0x48, 0x2a, 0x10, 0x4a, 0x29, 0x1d,
-  0x36, 0x5b, 0x83, 0x31, 0x08, 0xd9, 0x8f, 0xb9, 0x17, 0x62, 0x97, 0x92,
-  0x47, 0x2f, 0xa5, 0x67, 0x39, 0x16, 0xa2, 0xfc, 0x78, 0x89, 0x46, 0xff,
-  0x1c, 0x66, 0x1d, 0xbc, 0x9e, 0xbe, 0xfb, 0x2f, 0xcc, 0x3a, 0xf9, 0x2e,
-  0xc1, 0xf4, 0x9f, 0xef, 0xbe, 0x39, 0x53, 0xef, 0xfe, 0x36, 0x7b, 0xf9,
-  0xd4, 0x00, 0x8c, 0x6c, 0x30, 0x49, 0xf3, 0x20, 0x4b, 0x88, 0x5e, 0xd5,
-  0xd7, 0x6b, 0x9a, 0x0e, 0x37, 0x78, 0xd1, 0x1b, 0xad, 0x0d, 0x68, 0xd8,
-  0xae, 0x0b, 0x7a, 0x77, 0x8b, 0xaa, 0xa9, 0xd2, 0x5b, 0x1c, 0x73, 0x55,
-  0x60, 0x9e, 0xac, 0xd7, 0x73, 0x01, 0xd7, 0xc3, 0x7b, 0x93, 0xe4, 0x3e,
-  0x47, 0xa1, 0x3b, 0xb2, 0xc0, 0x10, 0xf5, 0xf6, 0xc7, 0xa4, 0xc1, 0x59,
-  0x58, 0x9a, 0x7a, 0x40, 0xd3, 0x83, 0x1b, 0xa4, 0xd5, 0xb1, 0xc4, 0xbc,
-  0x4e, 0xb0, 0xc0, 0xf1, 0x54, 0x5e, 0x1b, 0x0a, 0xab, 0x01, 0xe4, 0x01,
-  0x86, 0xb9, 0x85, 0x9f, 0x36, 0x69, 0xa3, 0xb2, 0x0b, 0x03, 0xb2, 0x80,
-  0x42, 0x48, 0x99, 0xdc, 0x59, 0x10, 0x3b, 0x7f, 0xbc, 0xb5, 0x14, 0xac,
-  0x46, 0x42, 0xf4, 0x36, 0x50, 0x3f, 0x6d, 0xc3, 0xdd, 0x9c, 0x8f, 0x84,
-  0x23, 0xd2, 0x7b, 0x3c, 0xfa, 0xf4, 0x55, 0x77, 0x1e, 0x3e, 0xb5, 0xf5,
-  0x9b, 0x33, 0x21, 0xa1, 0x2a, 0x33, 0x1d, 0x17, 0xc2, 0x05, 0xa2, 0xbb,
-  0xb0, 0x72, 0xe5, 0x4d, 0xd0, 0xc8, 0xbc, 0x0b, 0x39, 0x91, 0x7a, 0x8b,
-  0xed, 0x0d, 0x54, 0x79, 0xf5, 0x8a, 0x42, 0x86, 0x7e, 0x33, 0x7e, 0xf7,
-  0x37, 0x68, 0xaa, 0xf7, 0x61, 0xe4, 0xf4, 0x5c, 0x28, 0x1b, 0x74, 0xe5,
-  0x06, 0x7b, 0x44, 0xb7, 0x11, 0x10, 0xb6, 0xf0, 0x52, 0x78, 0x0e, 0x53,
-  0x9c, 0x04, 0xf8, 0x3a, 0xe5, 0xa3, 0x68, 0x18, 0x52, 0x64, 0x11, 0x5d,
-  0x6d, 0x44, 0x5a, 0xbb, 0xfc, 0xf0, 0x9a, 0xe8, 0x70, 0xbe, 0xa7, 0x52,
-  0x4e, 0xb3, 0x45, 0x67, 0x4c, 0xf4, 0xd6, 0x4e, 0xd0, 0xac, 0x02, 0x54,
-  0xfe, 0x5a, 0x68, 0xe4, 0x10, 0x42, 0x68, 0x1a, 0x2d, 0x8f, 0x30, 0xee,
-  0x21, 0x02, 0xd3, 0x6d, 0xfa, 0x92, 0xb2, 0xf1, 0x47, 0x68, 0xed, 0x33,
-  0x8e, 0xa7, 0x3e, 0xd6, 0x70, 0x63, 0xb3, 0x52, 0xe1, 0xe9, 0x1f, 0x28,
-  0xb3, 0x26, 0x83, 0x92, 0xcb, 0xb1, 0x1e, 0x63, 0xf9, 0xe5, 0xf5, 0x6d,
-  0xa8, 0x31, 0x51, 0x67, 0xf7, 0xf0, 0xe8, 0xf6, 0xbf, 0x4e, 0x13, 0xbe,
-  0x78, 0xf2, 0xfb, 0x62, 0x09, 0xcb, 0x8c, 0xfa, 0x55, 0xb1, 0xce, 0xd2,
-  0xf2, 0x4a, 0xbe, 0xff, 0x6f, 0x33, 0x95, 0x64, 0x32, 0xa2, 0xd3, 0xa8,
-  0xda, 0xc1, 0x2f, 0xb5, 0x2e, 0x30, 0xed, 0x0d, 0xd6, 0x01, 0xf5, 0x67,
-  0x7b, 0x53, 0x0d, 0xa8, 0x24, 0xf0, 0x0d, 0x27, 0xea, 0x3d, 0xbd, 0xde,
-  0xdd, 0x6b, 0x7b, 0xba, 0x20, 0x5d, 0x1e, 0x6b, 0xfe, 0x6a, 0xcb, 0x3e,
-  0x31, 0x13, 0x4d, 0x62, 0x22, 0x31, 0xb2, 0x27, 0x66, 0x5a, 0x6e, 0x93,
-  0x6a, 0x6b, 0x17, 0x82, 0x37, 0x50, 0x9a, 0x26, 0x8f, 0xbd, 0x6e, 0x20,
-  0xfa, 0x76, 0x76, 0x0d, 0x04, 0xa4, 0x3c, 0x45, 0xc2, 0x3b, 0xf1, 0x18,
-  0xa3, 0x3e, 0xbc, 0x61, 0x80, 0x4b, 0x2d, 0xa0, 0xc3, 0xf4, 0x9b, 0xea,
-  0xf1, 0x9f, 0xc7, 0x72, 0x7c, 0xea, 0x8e, 0x1f, 0x2e, 0xc6, 0x6e, 0xf7,
-  0x22, 0xf8, 0xcc, 0x60, 0x6f, 0xa5, 0x5d, 0x9b, 0xe2, 0x30, 0xdb, 0xdb,
-  0xf7, 0xb8, 0x86, 0x56, 0xea, 0x40, 0x1e, 0x29, 0x5b, 0xcd, 0xc6, 0x1c,
-  0x70, 0x9d, 0xbf, 0x64, 0x68, 0x85, 0x71, 0x4d, 0x99, 0x9a, 0xe6, 0x25,
-  0x6e, 0x16, 0x30, 0xee, 0x3a, 0x01, 0xd3, 0x3a, 0xae, 0x27, 0xf2, 0xc9,
-  0x74, 0x5f, 0xcc, 0x6f, 0x93, 0x12, 0x2f, 0x98, 0xf3, 0x8b, 0x16, 0x9e,
-  0xa3, 0x6f, 0x27, 0x0d, 0x4e, 0x61, 0x95, 0x80, 0x19, 0xc5, 0x45, 0x6e,
-  0xf9, 0xc3, 0x97, 0x6d, 0xb1, 0x49, 0xd0, 0x13, 0x8f, 0xff, 0xa1, 0x4a,
-  0x53, 0x9f, 0x4e, 0xa5, 0xff, 0x5f, 0xfd, 0xb2, 0xd8, 0xed, 0x80, 0xd8,
-  0x55, 0xa2, 0x13, 0x02, 0xd6, 0xb7, 0x69, 0x6a, 0xef, 0xa4, 0x28, 0xce,
-  0x3d, 0x2c, 0x3f, 0x96, 0x98, 0x20, 0xc1, 0x2e, 0x09, 0xf8, 0x71, 0x9d,
-  0x95, 0xe9, 0xaa, 0x2e, 0xca, 0x2c, 0xad, 0x38, 0x0e, 0xa0, 0x8f, 0x34,
-  0xa5, 0x45, 0x06, 0x8f, 0x18, 0x68, 0x9b, 0x0c, 0xaa, 0xa2, 0xb7, 0x02,
-  0x99, 0xbb, 0x2f, 0xee, 0xda, 0xc3, 0xe2, 0xd4, 0xac, 0xa5, 0x98, 0xfa,
-  0xaf, 0x6b, 0x5d, 0x9c, 0xbc, 0x44, 0x99, 0x41, 0x22, 0x9e, 0x1e, 0x22,
-  0x12, 0xbe, 0x94, 0x51, 0x60, 0x86, 0x9e, 0xd3, 0x3e, 0x5e, 0xa2, 0xd6,
-  0x07, 0x27, 0xda, 0x26, 0x0d, 0x81, 0x96, 0x09, 0x75, 0x9a, 0x3b, 0xeb,
-  0xc8, 0x97, 0xce, 0x3a, 0x12, 0xaa, 0x9d, 0x53, 0x3a, 0xcf, 0xa6, 0xda,
-  0xa2, 0xc3, 0x6e, 0x48, 0x0e, 0x93, 0x47, 0xcd, 0xbf, 0x3b, 0xa6, 0xe5,
-  0xfd, 0xd0, 0x16, 0x57, 0xd8, 0xe4, 0xce, 0xe6, 0x37, 0xf5, 0xe1, 0x56,
-  0xf5, 0x97, 0xa9, 0x7d, 0x8f, 0xce, 0x79, 0x50, 0xc7, 0xe8, 0x93, 0x7e,
-  0x34, 0x74, 0x97, 0x7b, 0xd3, 0x43, 0xb1, 0x45, 0xd2, 0x55, 0x71, 0xec,
-  0x8f, 0xaa, 0xb1, 0xf4, 0x37, 0xd8, 0xe4, 0xc1, 0x2b, 0x91, 0xc5, 0x3d,
-  0x32, 0xdb, 0x88, 0x90, 0xf5, 0x4e, 0xc5, 0x43, 0x04, 0x36, 0x34, 0x25,
-  0x70, 0x7a, 0x3f, 0xa0, 0x76, 0x25, 0x69, 0x07, 0x7c, 0xa2, 0xef, 0x1d,
-  0x65, 0xfb, 0x0d, 0x2c, 0x0f, 0x26, 0xbc, 0x54, 0x07, 0xe4, 0xb6, 0xde,
-  0xe5, 0x0c, 0x49, 0xca, 0xf4, 0x8b, 0x6e, 0xe8, 0xba, 0x38, 0x74, 0xa3,
-  0x35, 0xa7, 0x5c, 0xb0, 0x92, 0x63, 0xc2, 0xee, 0x7e, 0x02, 0xd6, 0xe9,
-  0xae, 0x8f, 0x54, 0x73, 0x8b, 0x5a, 0xfb, 0x8e, 0x3c, 0xc1, 0xd4, 0x99,
-  0x5f, 0x1e, 0x41, 0x2b, 0x59, 0xa6, 0x0a, 0xb9, 0x3b, 0x83, 0xe5, 0x6e,
-  0x99, 0x6e, 0x70, 0x35, 0x91, 0x8b, 0x57, 0xb0, 0x7a, 0xa4, 0xe8, 0x75,
-  0x93, 0x55, 0xbd, 0x14, 0x08, 0xec, 0x20, 0x12, 0xb6, 0x45, 0x55, 0x3f,
-  0xe9, 0x10, 0x18, 0x3c, 0x5f, 0x9e, 0xe4, 0x12, 0xf7, 0xfa, 0x89, 0x9e,
-  0x38, 0x0d, 0x55, 0xd1, 0x9d, 0xb1, 0x2c, 0x0d, 0x1e, 0x7f, 0x54, 0x2d,
-  0x57, 0xc0, 0xc8, 0xe9, 0xbe, 0x3a, 0xc2, 0x4c, 0x29, 0x53, 0xd8, 0xb3,
-  0x2c, 0xf3, 0x7b, 0x26, 0x86, 0x96, 0x2d, 0x99, 0x70, 0x84, 0x9d, 0x2c,
-  0x08, 0x68, 0x1f, 0x24, 0xe1, 0x3a, 0xc7, 0x34, 0x20, 0x22, 0x57, 0x1e,
-  0xcf, 0x19, 0x53, 0x07, 0xdc, 0xa0, 0x06, 0x48, 0x7f, 0xff, 0x58, 0x6d,
-  0x10, 0xdf, 0xa0, 0x01, 0xcd, 0xb0, 0xa0, 0xad, 0x93, 0xbc, 0xb2, 0xdb,
-  0x85, 0x1f, 0x71, 0xf9, 0x8b, 0xeb, 0xc5, 0xa0, 0x45, 0x14, 0xb7, 0x95,
-  0x5d, 0xec, 0x60, 0x75, 0xc2, 0xa8, 0x57, 0xcc, 0x81, 0xa7, 0x95, 0xec,
-  0xa5, 0xcc, 0x82, 0x77, 0xcf, 0x3b, 0xa8, 0x84, 0x63, 0x1d, 0xe2, 0xca,
-  0x46, 0xdb, 0xa9, 0xa2, 0x7c, 0x03, 0x4a, 0x49, 0x5a, 0x9f, 0x7b, 0xb2,
-  0x6a, 0xb5, 0xc6, 0x04, 0x05, 0x22, 0x16, 0xb6, 0x30, 0xed, 0xf2, 0xb4,
-  0x24, 0x09, 0x2c, 0x32, 0x90, 0x7d, 0x05, 0x95, 0xe8, 0x58, 0x2c, 0x76,
-  0x71, 0x7a, 0xc8, 0xfe, 0xfc, 0x90, 0xd4, 0x5b, 0x1c, 0xe3, 0x03, 0x52,
-  0x30, 0xa3, 0x7f, 0x70, 0x0c, 0xec, 0x51, 0xb6, 0x9c, 0x6f, 0x99, 0x2f,
-  0x27, 0x1c, 0x32, 0x53, 0x0a, 0xaa, 0x2b, 0x4b, 0xba, 0xc1, 0x36, 0xb7,
-  0xef, 0xa4, 0x1c, 0x96, 0x14, 0xac, 0x57, 0x38, 0x99, 0x1c, 0x68, 0xfa,
-  0x69, 0x2b, 0x30, 0x60, 0xeb, 0xf4, 0x26, 0xc3, 0x5c, 0x33, 0x16, 0x2d,
-  0xbf, 0x58, 0x67, 0x12, 0xf0, 0xc4, 0xd0, 0x89, 0x47, 0xc8, 0x6c, 0x46,
-  0x5f, 0xad, 0xa9, 0x4f, 0xae, 0x10, 0x4a, 0xed, 0xb4, 0xb0, 0x90, 0xf3,
-  0x33, 0x0c, 0x1a, 0x27, 0xd8, 0xd8, 0x9e, 0x4e, 0x68, 0x1e, 0x7f, 0xa4,
-  0x70, 0xa4, 0xd2, 0xeb, 0xb2, 0xc0, 0x70, 0x2b, 0xab, 0xfc, 0x6a, 0xb5,
-  0x25, 0xd7, 0x3d, 0x4d, 0x93, 0x61, 0xa3, 0xf4, 0xae, 0xbe, 0x5a, 0xad,
-  0xdd, 0xf7, 0xbb, 0xa3, 0x58, 0xd1, 0xf0, 0x9b, 0x44, 0x9d, 0x32, 0xed,
-  0x9f, 0xb9, 0xb0, 0xc8, 0xab, 0x7b, 0x46, 0xb4, 0x82, 0x3a, 0xa0, 0xd8,
-  0x5c, 0x8f, 0x7f, 0xa4, 0xc3, 0x1e, 0x7f, 0x74, 0x8d, 0x73, 0xa0, 0xca,
-  0xae, 0x1a, 0xc4, 0x20, 0x0a, 0x62, 0x09, 0x18, 0x74, 0xa2, 0x15, 0xef,
-  0xea, 0x46, 0x51, 0xe4, 0xc7, 0x55, 0x86, 0xee, 0x20, 0x00, 0x85, 0x05,
-  0x70, 0x81, 0x8e, 0x81, 0xf1, 0x74, 0xab, 0x96, 0x78, 0xbe, 0x91, 0xdd,
-  0x35, 0xea, 0xd3, 0x9f, 0x29, 0x73, 0x91, 0xb4, 0xd0, 0x19, 0x13, 0x7a,
-  0x51, 0x3d, 0x21, 0x04, 0xd8, 0x09, 0x7b, 0x8a, 0x4d, 0x6b, 0x39, 0xc4,
-  0x57, 0xe6, 0x3f, 0x7d, 0xf7, 0xe9, 0xc8, 0xa9, 0xeb, 0x3a, 0xad, 0x57,
-  0xb7, 0x68, 0x64, 0x7c, 0x3a, 0x32, 0x83, 0xb1, 0xc2, 0xea, 0xb0, 0x87,
-  0xe0, 0x8b, 0x43, 0x46, 0x1a, 0xe9, 0x0f, 0x61, 0x6d, 0x85, 0x0a, 0xe2,
-  0xef, 0x36, 0x9b, 0x0c, 0x2d, 0xf9, 0xf9, 0xbd, 0xc2, 0xbe, 0xd3, 0xa1,
-  0x04, 0x2b, 0x2a, 0x64, 0xcb, 0x9c, 0xc1, 0x14, 0x2b, 0xce, 0xd5, 0x2f,
-  0x78, 0x8f, 0xa3, 0xb4, 0x40, 0xf1, 0x31, 0x55, 0xdb, 0x0c, 0x76, 0x3e,
-  0x7a, 0x2f, 0xb5, 0x4e, 0x97, 0x59, 0xb2, 0x27, 0xbd, 0xf4, 0xb8, 0x3c,
-  0xee, 0xeb, 0x23, 0xda, 0x9b, 0x30, 0x0f, 0x5e, 0x45, 0xe1, 0x37, 0x7e,
-  0x9d, 0x2e, 0xd5, 0xe5, 0xb3, 0x8b, 0x7f, 0xc6, 0xa4, 0xbd, 0x69, 0x05,
-  0x3b, 0xae, 0x73, 0x67, 0xf8, 0xee, 0xc2, 0xbe, 0xbc, 0x1e, 0xd4, 0x95,
-  0x04, 0x4f, 0x66, 0x36, 0x4f, 0x7d, 0x1a, 0x58, 0x92, 0xab, 0x9a, 0xa3,
-  0x5b, 0x80, 0x70, 0x35, 0xf3, 0x2f, 0x72, 0xab, 0xc3, 0x85, 0x48, 0x8b,
-  0xe5, 0x25, 0xe6, 0x15, 0x1a, 0x6b, 0x1c, 0x00, 0xe8, 0xed, 0x99, 0x95,
-  0xaf, 0xee, 0x81, 0xee, 0xe8, 0x73, 0xd0, 0x32, 0xae, 0x48, 0xa6, 0xd5,
-  0xdb, 0x5d, 0x7e, 0xbe, 0x3a, 0x1c, 0xae, 0xd4, 0x2f, 0x91, 0x09, 0x71,
-  0x86, 0x89, 0xbc, 0xe2, 0x1c, 0xe0, 0xd0, 0xf4, 0x23, 0x4d, 0xbc, 0x44,
-  0xcb, 0x3c, 0x10, 0x7f, 0x64, 0xf0, 0x86, 0x05, 0x1a, 0x37, 0xa7, 0x46,
-  0xba, 0x6b, 0xd3, 0x6e, 0x8d, 0x01, 0xc3, 0x91, 0xa6, 0x73, 0x92, 0xe0,
-  0xd8, 0x03, 0xb4, 0x77, 0xe7, 0xd9, 0x2b, 0xdd, 0xd8, 0x5c, 0xaa, 0xdd,
-  0x64, 0xf5, 0x2c, 0x08, 0xa6, 0xab, 0x99, 0x91, 0x7b, 0x76, 0x95, 0xf8,
-  0x23, 0x6f, 0xc7, 0x80, 0x5e, 0x18, 0x51, 0x4f, 0x12, 0x3b, 0x34, 0xeb,
-  0xf9, 0x81, 0xbb, 0xe0, 0x55, 0xb2, 0xc7, 0x63, 0x78, 0x9e, 0x62, 0x68,
-  0xa6, 0xd6, 0xcd, 0xe1, 0xc4, 0xeb, 0x5e, 0x83, 0xae, 0xde, 0x4d, 0xde,
-  0xfd, 0xc4, 0xac, 0x3c, 0xba, 0x66, 0xbd, 0xe3, 0x7e, 0xa6, 0x56, 0x91,
-  0xc3, 0x3b, 0x7f, 0xe9, 0xa0, 0x65, 0x92, 0x9c, 0x91, 0x94, 0xbf, 0xe6,
-  0xb9, 0x59, 0xe3, 0x50, 0xf4, 0x62, 0xc8, 0x44, 0x60, 0x05, 0xb1, 0xe7,
-  0x0e, 0x0e, 0x5a, 0xb1, 0x37, 0xe1, 0x2a, 0x46, 0xda, 0x67, 0x48, 0x63,
-  0xad, 0x11, 0x2b, 0x7b, 0xc2, 0x4f, 0x73, 0x25, 0x78, 0x71, 0x73, 0x8b,
-  0xa1, 0xba, 0x9f, 0xe9, 0x20, 0xfb, 0xfa, 0x46, 0x3a, 0x81, 0x21, 0x6b,
-  0xb8, 0xa5, 0xc8, 0x88, 0x85, 0x2f, 0xe7, 0x50, 0xe0, 0x22, 0xb4, 0x70,
-  0x8f, 0x9d, 0xa6, 0x4d, 0x71, 0x20, 0xd8, 0xe8, 0x45, 0x21, 0x5f, 0x5c,
-  0x37, 0x16, 0xd8, 0xff, 0x92, 0x21, 0x17, 0x40, 0xac, 0x63, 0xa2, 0x16,
-  0xeb, 0x16, 0xc5, 0x15, 0x07, 0x3b, 0x90, 0x63, 0xfb, 0x6a, 0x5b, 0x1c,
-  0x73, 0x76, 0x96, 0x40, 0x41, 0x0f, 0xf3, 0x14, 0x50, 0xd8, 0x30, 0x88,
-  0x9c, 0x69, 0x0b, 0xea, 0x9c, 0x8e, 0xc9, 0x62, 0x8d, 0xb8, 0x03, 0x3f,
-  0x65, 0x0c, 0x7c, 0x40, 0x3e, 0x6b, 0xec, 0x23, 0x44, 0x3b, 0x6e, 0x0b,
-  0xe6, 0xe1, 0x88, 0x5d, 0xd1, 0x91, 0x6b, 0xd3, 0xa1, 0x29, 0xdc, 0xe4,
-  0x71, 0xf1, 0xc7, 0xc6, 0xbd, 0x60, 0xe0, 0xd4, 0x35, 0xf3, 0x08, 0x76,
-  0x82, 0xe7, 0xf8, 0xa5, 0x39, 0x8c, 0x8e, 0x6b, 0x27, 0x2c, 0x8b, 0xdb,
-  0xb9, 0x0e, 0x3d, 0x6f, 0x2e, 0xdc, 0xc0, 0x3b, 0x1d, 0x35, 0x5b, 0xc3,
-  0xb3, 0x45, 0x3e, 0x6f, 0x00, 0xc2, 0xbb, 0xe3, 0x6e, 0xdf, 0x84, 0xdd,
-  0x59, 0x4f, 0x3e, 0xe0, 0x72, 0xd3, 0xb6, 0x53, 0xb9, 0x5f, 0xe4, 0xd2,
-  0x4d, 0x05, 0xf6, 0xc6, 0x1d, 0xc2, 0xf9, 0xc4, 0xa8, 0xea, 0x12, 0xd3,
-  0x08, 0xea, 0x43, 0xd6, 0x86, 0x3f, 0xa5, 0x21, 0xa5, 0x2e, 0x93, 0x7d,
-  0x05, 0x6b, 0x82, 0x0e, 0x05, 0x04, 0x7b, 0xc1, 0xb2, 0x00, 0xfe, 0x4f,
-  0x37, 0x6a, 0xa7, 0xf6, 0x61, 0xa9, 0xf4, 0x3b, 0x65, 0xdb, 0x7d, 0x3a,
-  0x46, 0x2d, 0xdd, 0x78, 0x5e, 0x3a, 0x1d, 0xf2, 0x1e, 0x53, 0x23, 0x9b,
-  0x35, 0x48, 0x84, 0xca, 0x6c, 0xdf, 0x05, 0x95, 0x39, 0x9d, 0x3a, 0xb8,
-  0xb2, 0x5d, 0x47, 0x65, 0x86, 0xf8, 0x48, 0x6b, 0xc4, 0x5a, 0xe8, 0xbc,
-  0x72, 0xe5, 0x01, 0x4e, 0x3d, 0x73, 0x01, 0xcc, 0xc0, 0x68, 0x1d, 0x67,
-  0x50, 0xd7, 0xb8, 0x33, 0x1a, 0x47, 0xd1, 0x22, 0x51, 0xfb, 0x06, 0xa5,
-  0xa6, 0xe5, 0x91, 0xae, 0x10, 0x4a, 0x9d, 0x57, 0x3e, 0xa5, 0x3b, 0x4b,
-  0xa9, 0x81, 0xf1, 0x28, 0xed, 0xe9, 0xd7, 0x90, 0x52, 0x8b, 0x44, 0xed,
-  0x9a, 0x03, 0x98, 0x78, 0x9d, 0x66, 0x61, 0x63, 0x94, 0x53, 0x6d, 0xa3,
-  0x91, 0x47, 0xd6, 0x10, 0x39, 0x20, 0x73, 0xe4, 0x91, 0x39, 0x9a, 0x32,
-  0x82, 0xa0, 0x9c, 0x39, 0x63, 0xd7, 0xd1, 0x13, 0xa5, 0x39, 0x7d, 0x3a,
-  0x69, 0x08, 0x87, 0x26, 0x09, 0xc6, 0xc7, 0x40, 0x27, 0xa2, 0xf3, 0x24,
-  0x56, 0xef, 0xdc, 0x72, 0xf0, 0xd8, 0x8f, 0x7a, 0xd6, 0x76, 0xf2, 0xa3,
-  0xdb, 0x7c, 0x37, 0x6d, 0x21, 0x9f, 0x9a, 0x59, 0x7b, 0xb9, 0x97, 0x18,
-  0xd8, 0xa9, 0xc3, 0x61, 0xcc, 0x40, 0x8a, 0x68, 0xfc, 0x28, 0x2e, 0x74,
-  0x05, 0x00, 0xcb, 0xc3, 0x82, 0x2f, 0x7b, 0xf9, 0xcf, 0x1b, 0x98, 0x90,
-  0x30, 0x7a, 0xef, 0x32, 0x55, 0x77, 0xcd, 0x00, 0x19, 0xad, 0xd9, 0xbb,
-  0x81, 0x22, 0xa7, 0x04, 0x41, 0x47, 0x70, 0x19, 0x4f, 0x0e, 0x72, 0x69,
-  0x7d, 0x01, 0x85, 0x57, 0x46, 0xf1, 0x0b, 0x3a, 0x75, 0x17, 0x47, 0x58,
-  0x2b, 0xd2, 0x1b, 0x3a, 0xa9, 0x65, 0x95, 0xe0, 0x0b, 0x3c, 0x23, 0xc7,
-  0xd5, 0x4e, 0xdb, 0xad, 0xed, 0x89, 0x38, 0x46, 0xef, 0xa4, 0x95, 0x72,
-  0x45, 0x36, 0xed, 0x73, 0x78, 0xa0, 0x05, 0xbd, 0xe7, 0xec, 0xe8, 0x3d,
-  0x4e, 0x8e, 0xc8, 0xe3, 0xd0, 0x5d, 0xe0, 0xde, 0xeb, 0x30, 0x44, 0xb7,
-  0xda, 0x37, 0x88, 0x8b, 0x52, 0x53, 0xa2, 0x4f, 0xc0, 0x9c, 0x92, 0xd3,
-  0x02, 0x85, 0x7b, 0x27, 0xd8, 0x5d, 0xe3, 0xd0, 0x40, 0x7f, 0xd5, 0x9f,
-  0x6b, 0x39, 0x2b, 0x6d, 0x6e, 0xbc, 0xd1, 0xbd, 0xa0, 0x52, 0xcb, 0xac,
-  0x06, 0xaa, 0x2b, 0x16, 0xbe, 0xe8, 0xcd, 0x5c, 0x61, 0xd8, 0xf1, 0x84,
-  0xc3, 0x07, 0xa3, 0x83, 0xf4, 0xb9, 0x2e, 0xfe, 0x75, 0xb1, 0x06, 0x95,
-  0xf6, 0xf7, 0xe9, 0x21, 0x4f, 0x56, 0x29, 0x6b, 0xa1, 0x06, 0xdf, 0xf2,
-  0x5e, 0x19, 0x7d, 0x7f, 0x9b, 0xe4, 0x1b, 0x68, 0xc2, 0x3d, 0x5d, 0x2d,
-  0xd8, 0x65, 0xdf, 0x83, 0xda, 0xfa, 0xc5, 0xe7, 0x5f, 0xbd, 0x06, 0xd6,
-  0x5a, 0xa7, 0x7e, 0x1c, 0x72, 0x1b, 0x37, 0xb6, 0xd8, 0x2d, 0xb2, 0xdd,
-  0x35, 0xd7, 0xae, 0xcf, 0xfb, 0xb4, 0xfc, 0xa1, 0x26, 0xba, 0x7b, 0x74,
-  0x2f, 0x64, 0x54, 0xbd, 0x45, 0x73, 0x25, 0x91, 0xaa, 0x6c, 0xa2, 0xd7,
-  0xde, 0xf0, 0xb9, 0x1e, 0x96, 0x66, 0x80, 0x5b, 0xe7, 0x1e, 0x82, 0x03,
-  0xc6, 0x11, 0x71, 0xd7, 0xed, 0x71, 0x74, 0x1b, 0x45, 0x5e, 0x59, 0x92,
-  0x42, 0xcd, 0x87, 0xb2, 0x4f, 0x73, 0xc4, 0x4a, 0x16, 0x84, 0xa4, 0x57,
-  0x99, 0x9c, 0xd4, 0x4d, 0xf8, 0x4b, 0x57, 0x25, 0x72, 0x8f, 0x75, 0x5e,
-  0x8c, 0xd4, 0xdd, 0x65, 0x43, 0x61, 0xd2, 0x29, 0x4b, 0x9a, 0xa0, 0xf6,
-  0xc8, 0xc7, 0xed, 0xe1, 0xc0, 0x4c, 0x44, 0x1d, 0x4a, 0x86, 0x60, 0xee,
-  0x61, 0xd3, 0x0e, 0xea, 0x98, 0x47, 0x56, 0x7a, 0xd2, 0x75, 0xc6, 0x2a,
-  0x4d, 0xca, 0xd5, 0x16, 0x7d, 0x74, 0x8d, 0x89, 0x35, 0xab, 0xc5, 0xb6,
-  0xab, 0x6f, 0xb2, 0x05, 0xdf, 0x0c, 0x4f, 0xfe, 0x1a, 0xb9, 0xee, 0xb3,
-  0x3c, 0x4b, 0x2a, 0xd8, 0x6f, 0x00, 0x83, 0x30, 0x67, 0xc2, 0x16, 0xb9,
-  0x4c, 0x56, 0xda, 0xd5, 0x85, 0x36, 0xc8, 0xc5, 0x46, 0x15, 0xc7, 0xd2,
-  0x30, 0xdc, 0x29, 0x66, 0xe1, 0xc5, 0x9e, 0xaf, 0x53, 0xb2, 0x98, 0x6b,
-  0x9e, 0x02, 0xf5, 0x15, 0x3b, 0x72, 0x8e, 0x0c, 0x65, 0x5d, 0x74, 0xa7,
-  0x76, 0xb6, 0x84, 0x7b, 0x45, 0x4e, 0x55, 0x2f, 0x90, 0x73, 0xee, 0xed,
-  0xb9, 0x4d, 0x9c, 0xa2, 0x9c, 0xa9, 0xe4, 0xe9, 0xeb, 0x5e, 0x4d, 0xba,
-  0x69, 0xd1, 0x0a, 0x39, 0x4f, 0x2f, 0x7a, 0x93, 0x50, 0xff, 0x52, 0xf2,
-  0x8f, 0x39, 0x28, 0xe5, 0x68, 0x0b, 0xba, 0xd1, 0xae, 0x16, 0x29, 0x1a,
-  0x1e, 0xf9, 0x54, 0xc0, 0xc6, 0x5d, 0xd2, 0x7e, 0xfa, 0x52, 0x0e, 0x7e,
-  0xf2, 0xf9, 0xfd, 0x8d, 0xba, 0x4a, 0xf6, 0xf7, 0xf8, 0x5b, 0xd5, 0x7a,
-  0x29, 0x3c, 0x11, 0x0e, 0x72, 0x22, 0x98, 0xe9, 0xb7, 0xb0, 0xbc, 0xe1,
-  0x89, 0xa8, 0xf5, 0x21, 0xb9, 0x41, 0x1f, 0x12, 0xa2, 0xf7, 0xea, 0x8a,
-  0x7d, 0x49, 0x66, 0x0e, 0xb8, 0x6b, 0x86, 0xf8, 0x13, 0xcb, 0x3b, 0x74,
-  0xca, 0xf8, 0x8b, 0x7b, 0x36, 0x1e, 0x69, 0x08, 0x72, 0x1c, 0x27, 0x7c,
-  0x31, 0xec, 0xa5, 0xc5, 0xec, 0x8e, 0x23, 0xf3, 0x16, 0x26, 0x3a, 0x2f,
-  0xd4, 0x8a, 0xbe, 0x54, 0xd4, 0x14, 0x4b, 0x08, 0xc5, 0x8a, 0xb5, 0x97,
-  0x8a, 0xbb, 0x40, 0x49, 0x5e, 0x3a, 0x27, 0x97, 0x62, 0xa7, 0x23, 0x1c,
-  0xb2, 0xd5, 0xc0, 0x53, 0xe1, 0xd3, 0x1d, 0xed, 0x78, 0x80, 0x44, 0xd8,
-  0xae, 0x82, 0x1a, 0xb0, 0x82, 0x8e, 0x48, 0xf0, 0x88, 0x92, 0x0e, 0xd3,
-  0x24, 0x22, 0x9c, 0x3e, 0x21, 0xd3, 0x66, 0x44, 0xa7, 0xbc, 0x19, 0x4d,
-  0x3a, 0x34, 0xce, 0xe8, 0x11, 0xb6, 0xba, 0x78, 0x88, 0x72, 0x7f, 0x86,
-  0x5e, 0x59, 0xd0, 0x40, 0x60, 0xc3, 0x64, 0x8d, 0x2e, 0x5a, 0xe8, 0x98,
-  0x42, 0x3d, 0x9d, 0x71, 0x68, 0x2e, 0x41, 0xc2, 0xdc, 0xbc, 0x47, 0xd1,
-  0xc7, 0xcc, 0x2c, 0xc6, 0x4c, 0xca, 0xe8, 0x52, 0xd5, 0xa0, 0x76, 0x91,
-  0xc9, 0x8d, 0x6d, 0x98, 0x55, 0x56, 0x1f, 0x13, 0x3e, 0x3b, 0x95, 0x9e,
-  0x68, 0x8c, 0x1f, 0x77, 0x95, 0x3a, 0xd5, 0x19, 0x7e, 0xcd, 0xe6, 0x4a,
-  0xf7, 0xb7, 0xe6, 0x4b, 0xd4, 0x82, 0xa8, 0x5b, 0x76, 0x26, 0xf4, 0xb1,
-  0xb1, 0x03, 0x36, 0x50, 0xea, 0x32, 0x51, 0xc6, 0x90, 0x42, 0x2e, 0x63,
-  0x4c, 0x2d, 0x63, 0xcc, 0x06, 0x30, 0x86, 0xa0, 0x9f, 0x39, 0x07, 0xfe,
-  0x92, 0x8e, 0x4a, 0x8d, 0xc4, 0x3a, 0x31, 0x0a, 0x77, 0xc4, 0x66, 0x52,
-  0x56, 0x30, 0x67, 0x93, 0xfa, 0x88, 0x2b, 0x9c, 0x33, 0xaf, 0x68, 0x29,
-  0x24, 0x8b, 0x3d, 0x33, 0x08, 0x4f, 0x17, 0x67, 0x5f, 0xbe, 0xd1, 0xa7,
-  0xce, 0xfa, 0x4e, 0xf1, 0x34, 0x2e, 0x1b, 0x9c, 0x85, 0x14, 0xc7, 0xeb,
-  0xb3, 0x2f, 0xbe, 0xfa, 0xec, 0x4a, 0xbd, 0x2e, 0x60, 0xf2, 0x2f, 0x81,
-  0x65, 0x12, 0xa5, 0x6d, 0xd2, 0x02, 0xff, 0xaf, 0x22, 0x2d, 0x3b, 0xe7,
-  0xbf, 0xbd, 0x15, 0x67, 0x4e, 0x7b, 0x7f, 0x4b, 0xec, 0x06, 0x3d, 0x78,
-  0x9b, 0xc2, 0x02, 0x79, 0xc3, 0xbe, 0x7d, 0xa9, 0xd5, 0x5c, 0x68, 0xe5,
-  0xc5, 0x8f, 0xc8, 0x62, 0x65, 0x7a, 0x5b, 0x62, 0x72, 0x48, 0xcd, 0x16,
-  0x06, 0x2f, 0x96, 0x21, 0x6c, 0x7a, 0x82, 0x3c, 0xad, 0xca, 0xd5, 0xd3,
-  0x1d, 0xbe, 0x3d, 0xcf, 0x29, 0xcf, 0x9c, 0x4d, 0x00, 0xe5, 0x38, 0x19,
-  0x93, 0x55, 0xce, 0x9c, 0xd7, 0x68, 0x37, 0x8f, 0x0d, 0x08, 0x4e, 0x42,
-  0x85, 0xa5, 0xd9, 0xf8, 0xa4, 0x9b, 0xaa, 0xb3, 0x9b, 0xb3, 0xdf, 0x61,
-  0xea, 0xba, 0xa6, 0x58, 0x4a, 0xc8, 0x59, 0x93, 0x8e, 0xfe, 0x2b, 0x75,
-  0xbb, 0xcd, 0x56, 0x5b, 0x42, 0x65, 0xe8, 0x8c, 0x54, 0x98, 0xde, 0x41,
-  0x6f, 0x55, 0xe7, 0xa6, 0x3f, 0xfe, 0x08, 0x98, 0x73, 0xa8, 0x02, 0x4f,
-  0xe3, 0x40, 0xab, 0x0b, 0x4e, 0xba, 0x5d, 0xb1, 0x8f, 0xcf, 0x42, 0x13,
-  0x22, 0xb6, 0x10, 0x1b, 0x58, 0x22, 0x08, 0x19, 0x0c, 0x37, 0xf4, 0xe0,
-  0x2d, 0xa8, 0x2d, 0xba, 0x57, 0x51, 0x1d, 0xd9, 0x73, 0x6e, 0x14, 0x5d,
-  0xf4, 0xdc, 0xcd, 0x95, 0xc7, 0x51, 0x89, 0x65, 0x45, 0xda, 0x83, 0xb6,
-  0x91, 0xae, 0xc9, 0x37, 0xbc, 0x7a, 0xa2, 0x9e, 0xa9, 0xd1, 0xbf, 0xc1,
-  0x58, 0xed, 0x40, 0xc6, 0xb2, 0xff, 0xa5, 0x3e, 0xad, 0x83, 0x3e, 0x03,
-  0x0e, 0x64, 0xd8, 0x33, 0xeb, 0xdf, 0xf5, 0xaf, 0xae, 0x57, 0x78, 0x78,
-  0x37, 0xe4, 0x14, 0x11, 0x2c, 0x8a, 0x32, 0xbb, 0xc6, 0x00, 0x14, 0x0b,
-  0xa9, 0x71, 0x16, 0x81, 0xa4, 0x65, 0xd2, 0xac, 0xae, 0x51, 0x1d, 0x90,
-  0x57, 0xd2, 0xa9, 0xbd, 0x27, 0xff, 0xc8, 0x88, 0xba, 0xa0, 0x13, 0x85,
-  0xd1, 0xa8, 0x00, 0xe7, 0x02, 0x3a, 0x7f, 0x64, 0x55, 0xa3, 0x97, 0xad,
-  0x8d, 0xa7, 0x30, 0xf7, 0x4e, 0xf4, 0x84, 0xd6, 0x63, 0xdb, 0xb6, 0x8f,
-  0x72, 0x44, 0x76, 0x7b, 0x47, 0x28, 0x6d, 0x4c, 0xdc, 0x81, 0xe7, 0x64,
-  0x84, 0xb7, 0xfd, 0x32, 0x5f, 0xb3, 0xe2, 0xf0, 0xa4, 0x5a, 0x94, 0x62,
-  0xc9, 0x6a, 0x14, 0x6b, 0xe6, 0xcc, 0x74, 0x9c, 0xd9, 0x3c, 0xe8, 0x74,
-  0x49, 0x8a, 0x4c, 0x5e, 0x18, 0xa6, 0x64, 0x0e, 0x9d, 0x50, 0xa7, 0xab,
-  0x9a, 0x52, 0x5e, 0x44, 0x47, 0xb1, 0x11, 0x74, 0xda, 0x76, 0x1c, 0xea,
-  0xda, 0x38, 0xc1, 0xcc, 0xe4, 0x92, 0x2a, 0xae, 0xd4, 0xd7, 0x78, 0x76,
-  0x6f, 0x06, 0x4a, 0x84, 0x01, 0x1f, 0xbd, 0x01, 0xe3, 0x86, 0x05, 0x18,
-  0x19, 0xf9, 0x82, 0xd0, 0x51, 0x99, 0x9d, 0x8c, 0x09, 0xdf, 0x7c, 0x65,
-  0x5f, 0x30, 0xc0, 0x83, 0x93, 0x91, 0xe7, 0xc6, 0x79, 0x30, 0x86, 0xb0,
-  0x3f, 0x68, 0xed, 0x0a, 0xe5, 0xdc, 0x64, 0xeb, 0x61, 0x0b, 0xdd, 0xc6,
-  0x0e, 0x97, 0x34, 0x59, 0xff, 0x43, 0x65, 0xf2, 0x78, 0x20, 0x75, 0xea,
-  0x77, 0x74, 0xb0, 0x28, 0xda, 0x24, 0xde, 0x89, 0x64, 0x47, 0x22, 0x72,
-  0x23, 0xda, 0xa7, 0xb7, 0xea, 0x3a, 0x2f, 0x96, 0xec, 0xc7, 0xa1, 0x1d,
-  0x0b, 0x74, 0x47, 0xef, 0x28, 0x9c, 0x08, 0x2e, 0xd4, 0xb8, 0x7c, 0x3b,
-  0xce, 0x2b, 0xa7, 0xda, 0xeb, 0xd9, 0x77, 0x9f, 0x53, 0x9b, 0x94, 0x96,
-  0x0b, 0xda, 0x6b, 0x74, 0x91, 0xfb, 0x28, 0x6e, 0x25, 0xf7, 0xe9, 0xd7,
-  0xe4, 0x86, 0xa7, 0xa3, 0xb3, 0x47, 0xff, 0x17, 0x18, 0xff, 0xee, 0x84,
-  0xae, 0x30, 0x01, 0x00
+  0x04, 0xdb, 0xa6, 0x9a, 0x2b, 0xb6, 0x08, 0x83, 0xc0, 0xbe, 0x30, 0x77,
+  0xe6, 0x69, 0xcc, 0x2c, 0x3e, 0xaf, 0x58, 0xf3, 0xf1, 0xf4, 0x22, 0x00,
+  0xfc, 0x29, 0x38, 0xc7, 0xe1, 0xbe, 0xe5, 0x30, 0xef, 0xd3, 0x35, 0x5a,
+  0x2a, 0x4e, 0x1b, 0x59, 0x46, 0x47, 0xeb, 0x91, 0x19, 0x55, 0x2c, 0xa0,
+  0x31, 0x21, 0x0e, 0x70, 0x0a, 0x1d, 0x12, 0xa3, 0x67, 0xb8, 0x39, 0xa3,
+  0x42, 0xf0, 0x93, 0x8c, 0x1a, 0xe6, 0xec, 0x63, 0xa9, 0xd8, 0x3c, 0x37,
+  0xeb, 0x6f, 0x77, 0x86, 0xc0, 0x29, 0x85, 0x05, 0xe2, 0x4f, 0x77, 0xc5,
+  0xd6, 0xd8, 0xe0, 0xda, 0x1c, 0x6f, 0xdf, 0x9d, 0x90, 0xc7, 0x0e, 0x37,
+  0xd3, 0xa5, 0x49, 0xd5, 0x3b, 0xe6, 0xbb, 0x29, 0x57, 0x74, 0x36, 0x25,
+  0xef, 0xf5, 0x6c, 0x73, 0x97, 0xf8, 0x44, 0x2c, 0xcd, 0x59, 0x3a, 0xd3,
+  0x04, 0x87, 0xd6, 0xc4, 0xe3, 0x18, 0xd0, 0xb1, 0x3d, 0x25, 0x51, 0xd5,
+  0x9a, 0x01, 0x81, 0xb2, 0xc7, 0x2c, 0x40, 0xcd, 0xad, 0x44, 0x7c, 0xd0,
+  0x40, 0xa4, 0x1a, 0x80, 0xcf, 0x80, 0x21, 0x5a, 0x1d, 0xdd, 0x78, 0x30,
+  0x9a, 0x96, 0xfb, 0x12, 0x3d, 0x9b, 0x62, 0xdf, 0x79, 0x7a, 0x19, 0xcd,
+  0x55, 0xcd, 0xce, 0x91, 0x6d, 0x62, 0x85, 0xcd, 0x33, 0x12, 0xb1, 0x8b,
+  0xbc, 0xa7, 0xde, 0x61, 0x54, 0xe2, 0x06, 0xfc, 0x40, 0x26, 0x5d, 0xaa,
+  0x5d, 0x26, 0x7e, 0x44, 0x89, 0x15, 0x1b, 0xea, 0x83, 0xe4, 0x57, 0xd8,
+  0x86, 0xd8, 0xad, 0x10, 0xd4, 0x5a, 0x0c, 0x8e, 0xeb, 0xb9, 0x63, 0x52,
+  0x28, 0x4e, 0xb7, 0x74, 0x4c, 0x5f, 0xba, 0xa3, 0x65, 0x84, 0x9c, 0x01,
+  0x3b, 0xdb, 0x85, 0xc4, 0xa8, 0x4f, 0x9c, 0x9a, 0x17, 0xd9, 0x51, 0xaf,
+  0xa5, 0xc4, 0x34, 0xfd, 0x5e, 0x56, 0x17, 0x7e, 0xc5, 0x59, 0xd5, 0x6c,
+  0x96, 0x4e, 0xf6, 0xc1, 0xd0, 0x9e, 0x65, 0x90, 0x53, 0x0e, 0x41, 0x39,
+  0xb3, 0xb6, 0x5b, 0xfb, 0x29, 0x34, 0x40, 0xc6, 0xe3, 0x42, 0x20, 0xda,
+  0x17, 0x7e, 0x9f, 0xe9, 0x68, 0xa5, 0x14, 0xce, 0x32, 0xea, 0x7f, 0x5b,
+  0xa2, 0x5d, 0xf6, 0x7a, 0x26, 0x63, 0xf4, 0xf5, 0x6a, 0xab, 0x3a, 0xa8,
+  0xb9, 0xab, 0xde, 0x16, 0x4e, 0xd1, 0x12, 0xed, 0x6d, 0x38, 0x39, 0x8e,
+  0x7d, 0x9a, 0xb0, 0x2d, 0x23, 0xcf, 0x15, 0xf5, 0x34, 0x8e, 0x9b, 0x65,
+  0x19, 0xc2, 0xeb, 0x6e, 0xcf, 0xb3, 0x15, 0x5a, 0x54, 0x36, 0xcd, 0x9d,
+  0x6b, 0xbd, 0x75, 0x6a, 0x9f, 0x66, 0xf1, 0xf7, 0x67, 0xdd, 0x1b, 0x90,
+  0xe0, 0x6b, 0xc3, 0x5a, 0xb9, 0x2e, 0xac, 0x85, 0xcf, 0x7b, 0x6e, 0x81,
+  0x79, 0x36, 0x70, 0x06, 0xbd, 0xf4, 0x12, 0xc4, 0x8a, 0x24, 0xe6, 0x2f,
+  0x7e, 0x08, 0x59, 0xa2, 0x4e, 0x6c, 0xfb, 0x53, 0x2c, 0xd2, 0x1a, 0x86,
+  0x96, 0x23, 0xfe, 0x0f, 0x23, 0x2b, 0xbb, 0x90, 0xf1, 0xba, 0x84, 0x6e,
+  0x5c, 0x30, 0x08, 0xa7, 0x35, 0x2c, 0x77, 0x59, 0x9d, 0x72, 0xce, 0x85,
+  0xa6, 0xa4, 0xc2, 0x03, 0x82, 0x86, 0xbf, 0xfa, 0xdc, 0x8b, 0xb1, 0x8b,
+  0x10, 0x72, 0x44, 0x31, 0x0a, 0x78, 0xab, 0x05, 0x55, 0xd6, 0x16, 0xaa,
+  0x3d, 0x42, 0x86, 0xf9, 0x8f, 0x8e, 0x40, 0xc7, 0x84, 0x09, 0x1e, 0x49,
+  0xbe, 0x2d, 0x7d, 0xe1, 0x8e, 0xe6, 0xc5, 0x73, 0xd5, 0xa6, 0xb0, 0x1e,
+  0x81, 0x02, 0x80, 0xae, 0xa2, 0xbb, 0xed, 0x68, 0xe6, 0x1d, 0xe1, 0x5b,
+  0xff, 0x5d, 0x41, 0xc0, 0x76, 0xbe, 0x0b, 0x63, 0x4f, 0xdb, 0x79, 0x9d,
+  0xe0, 0x63, 0x11, 0x7d, 0x67, 0x5a, 0xb0, 0x83, 0x2a, 0xea, 0xd0, 0xdb,
+  0xc2, 0x5d, 0xd8, 0xc3, 0xa3, 0x7b, 0x41, 0x6f, 0x5f, 0x3e, 0x70, 0x9e,
+  0x99, 0x5e, 0x15, 0x55, 0x9d, 0xee, 0x6d, 0x15, 0x3e, 0x0a, 0x2d, 0x6e,
+  0xcf, 0xf6, 0xdb, 0x4a, 0xef, 0xd2, 0xdb, 0xda, 0x11, 0xa8, 0xb0, 0x31,
+  0x81, 0x55, 0x76, 0xdb, 0x83, 0xa3, 0xbe, 0x2e, 0x0f, 0x5e, 0x1f, 0x0a,
+  0x6c, 0x8c, 0x83, 0x05, 0x67, 0x05, 0xea, 0xf1, 0xae, 0xd1, 0x44, 0xba,
+  0xa9, 0x49, 0x06, 0x1f, 0x72, 0x6e, 0xf3, 0xa1, 0x3a, 0xea, 0xa4, 0x05,
+  0xc1, 0x55, 0x4a, 0x82, 0x2a, 0x28, 0xc6, 0x98, 0xeb, 0x66, 0x49, 0x16,
+  0xf3, 0xfe, 0x98, 0x07, 0x85, 0x4c, 0x4b, 0x65, 0xeb, 0xc2, 0x81, 0xa7,
+  0x38, 0x29, 0xae, 0xdb, 0xe7, 0xa1, 0xf2, 0x73, 0xc8, 0x83, 0xc7, 0x71,
+  0x1c, 0x91, 0xeb, 0x80, 0xb2, 0x5d, 0x0b, 0xdb, 0xfc, 0x63, 0x4c, 0x8e,
+  0x19, 0x93, 0x86, 0x94, 0xd1, 0x6c, 0x1a, 0xbb, 0xfd, 0x7f, 0xeb, 0x40,
+  0xf0, 0xbd, 0xb9, 0xae, 0x68, 0x61, 0xaa, 0x31, 0x73, 0x91, 0x84, 0x3d,
+  0x6f, 0xf6, 0x4d, 0x73, 0x21, 0xf3, 0xe1, 0x31, 0xdc, 0x31, 0x07, 0x88,
+  0xa6, 0x38, 0xd1, 0x9e, 0x11, 0x30, 0x58, 0xfa, 0xb0, 0xc8, 0x51, 0xb8,
+  0x19, 0x12, 0xb0, 0x02, 0xca, 0x36, 0x74, 0xe8, 0x85, 0xf6, 0x48, 0x10,
+  0x41, 0xaf, 0xee, 0x1f, 0x31, 0x6b, 0x36, 0x06, 0x37, 0xa7, 0xac, 0xe4,
+  0x1d, 0x17, 0xa8, 0xd6, 0x36, 0xbd, 0x5a, 0x94, 0xd3, 0x8c, 0xf3, 0xf0,
+  0x26, 0x9a, 0x70, 0x42, 0xd5, 0x29, 0xec, 0x56, 0x54, 0x4c, 0xc2, 0x9b,
+  0x0d, 0xf9, 0x32, 0x7f, 0x39, 0x7d, 0xf7, 0xc9, 0xec, 0xdd, 0x27, 0xe6,
+  0xc5, 0x63, 0xfc, 0xc1, 0xd7, 0x17, 0x82, 0xb8, 0xee, 0x47, 0x26, 0x90,
+  0xb5, 0x5b, 0x41, 0xd1, 0xb4, 0x82, 0x16, 0x06, 0xd7, 0x55, 0x85, 0xef,
+  0x5b, 0x52, 0x6f, 0x34, 0x42, 0x39, 0xe7, 0x69, 0xd8, 0x19, 0x6d, 0x87,
+  0x01, 0xc9, 0x32, 0xcd, 0x5b, 0xa1, 0xe2, 0x0e, 0xa5, 0xf5, 0x15, 0x2f,
+  0x5f, 0xb5, 0x07, 0x86, 0x97, 0xf3, 0x6b, 0xf8, 0x3f, 0x9e, 0x8b, 0x2e,
+  0x09, 0x1c, 0xf3, 0xe2, 0x65, 0xb6, 0xcb, 0x60, 0x1f, 0x9b, 0x6b, 0x32,
+  0x49, 0xf3, 0xf0, 0x9b, 0xf3, 0x19, 0xf2, 0x66, 0xc3, 0x01, 0xc4, 0x56,
+  0x14, 0xd5, 0xdb, 0xa0, 0x6b, 0x7b, 0x87, 0xf9, 0x81, 0xf2, 0xc4, 0x0a,
+  0xd6, 0x87, 0x1f, 0xac, 0x30, 0x9b, 0x2c, 0x5d, 0x00, 0xc9, 0xaa, 0xeb,
+  0x39, 0x94, 0xda, 0x1f, 0xea, 0x60, 0xd7, 0xf4, 0x88, 0xdc, 0x78, 0xe6,
+  0xab, 0xac, 0x5c, 0x61, 0x12, 0x7b, 0x96, 0x6a, 0xf0, 0x35, 0xe4, 0xa8,
+  0xd6, 0x14, 0x06, 0x3c, 0x41, 0x29, 0x63, 0x47, 0xc9, 0xb1, 0xf3, 0xbd,
+  0x5d, 0x0a, 0xee, 0x2e, 0x61, 0x6f, 0x89, 0xd8, 0x57, 0x62, 0x2a, 0x62,
+  0x6e, 0xbb, 0xe5, 0x9d, 0x4e, 0x52, 0x5f, 0x93, 0xb2, 0x4b, 0x96, 0x0a,
+  0xfd, 0xd1, 0xbe, 0xe7, 0xe9, 0x6b, 0x05, 0x37, 0x1f, 0xe4, 0xd3, 0xc6,
+  0x3c, 0x4a, 0xf2, 0x7a, 0xce, 0x1d, 0x70, 0xf7, 0x74, 0xfd, 0x08, 0xb0,
+  0x48, 0x77, 0x04, 0xb6, 0x4b, 0x00, 0x5d, 0x08, 0x10, 0x08, 0xd8, 0xbd,
+  0xa7, 0x09, 0x3e, 0x90, 0xcd, 0x10, 0x88, 0xf3, 0x1a, 0x53, 0xb3, 0xee,
+  0x8a, 0x5d, 0x1a, 0x6e, 0xe7, 0xc6, 0x16, 0xbb, 0xf0, 0x5d, 0x54, 0x22,
+  0xa9, 0x56, 0x59, 0xd6, 0x59, 0xa4, 0xf6, 0xbf, 0x34, 0xc9, 0x6d, 0xc5,
+  0x68, 0xad, 0x85, 0xf7, 0xc7, 0xe7, 0x9a, 0xaf, 0x58, 0x6d, 0x90, 0x00,
+  0x35, 0xf4, 0x98, 0xd1, 0x1f, 0x76, 0xaf, 0x77, 0xc5, 0x9b, 0x9d, 0xd1,
+  0x1e, 0x41, 0x4f, 0xf8, 0x51, 0x58, 0x23, 0xd1, 0x71, 0x60, 0x38, 0x1d,
+  0x91, 0x5a, 0x83, 0x7b, 0x3c, 0x90, 0x08, 0x1f, 0x72, 0x4b, 0x6a, 0x81,
+  0x0e, 0xc4, 0x79, 0xcd, 0x76, 0x45, 0x94, 0xca, 0x55, 0x9d, 0xd4, 0x78,
+  0xd3, 0x7b, 0xf5, 0x3a, 0xb9, 0xe2, 0x3c, 0x3e, 0x6d, 0x69, 0x60, 0xf4,
+  0x26, 0x56, 0x73, 0x4f, 0x1f, 0x8a, 0x02, 0xf1, 0xbc, 0xce, 0x0f, 0x7c,
+  0x87, 0xc9, 0x73, 0xc7, 0x41, 0xf7, 0x9b, 0xf0, 0x56, 0x03, 0xb2, 0x60,
+  0x68, 0x58, 0xc5, 0x89, 0x5d, 0x3d, 0xb0, 0x7b, 0xde, 0xe5, 0x21, 0xcb,
+  0xd7, 0x73, 0xbc, 0x26, 0x90, 0xb2, 0x34, 0x69, 0xf5, 0xc4, 0x2f, 0x4d,
+  0xea, 0x7c, 0xf2, 0x53, 0x8f, 0xc1, 0xd1, 0xfd, 0x87, 0xd7, 0x96, 0x8c,
+  0x27, 0x02, 0x50, 0xc0, 0x26, 0x1b, 0xea, 0xb5, 0xad, 0x95, 0x04, 0x5b,
+  0x44, 0x1c, 0xa4, 0x36, 0x3b, 0xf3, 0xea, 0xc6, 0xb5, 0x3b, 0x33, 0xdc,
+  0xa6, 0xd9, 0x6c, 0x16, 0x54, 0xa0, 0x88, 0xc8, 0x80, 0xf3, 0x5d, 0x84,
+  0x83, 0xd3, 0x57, 0x6f, 0xbb, 0xc0, 0x4f, 0xa7, 0x7a, 0x77, 0x91, 0x4c,
+  0x6c, 0xb6, 0x93, 0xc3, 0x22, 0x3c, 0x23, 0xb7, 0x1d, 0x89, 0x8b, 0xa2,
+  0xb3, 0x96, 0xc6, 0x28, 0xc7, 0xe3, 0xd7, 0x21, 0x27, 0x13, 0x21, 0xa4,
+  0x35, 0xd8, 0x09, 0x08, 0x90, 0xf1, 0xc7, 0xbe, 0x27, 0x17, 0xcc, 0x3b,
+  0xf5, 0x31, 0xa5, 0x00, 0x09, 0x8d, 0xaf, 0x2b, 0xfd, 0xfa, 0x85, 0xbb,
+  0x08, 0xf2, 0x91, 0x01, 0x44, 0x4f, 0x66, 0xf4, 0xb0, 0x62, 0xa3, 0x2f,
+  0xec, 0xaa, 0xb5, 0x0b, 0xd8, 0x68, 0xe1, 0xac, 0x4d, 0xd3, 0xf1, 0x55,
+  0xba, 0xe3, 0x4f, 0x0f, 0xc4, 0xda, 0x25, 0x26, 0xb0, 0x99, 0xb1, 0x57,
+  0x23, 0x33, 0xf3, 0x17, 0xf8, 0xb5, 0xd5, 0x24, 0x69, 0xa7, 0x50, 0xa6,
+  0x5e, 0xa8, 0xa8, 0x3e, 0xbb, 0xa5, 0xef, 0x62, 0xfb, 0x82, 0xba, 0x81,
+  0x2a, 0x7a, 0xae, 0x7d, 0x11, 0x68, 0x17, 0x77, 0x6c, 0xfd, 0x17, 0x6d,
+  0xf7, 0xf4, 0xc7, 0x49, 0x70, 0xc1, 0x34, 0xf8, 0x15, 0xcc, 0xb0, 0x02,
+  0x76, 0x2a, 0xc5, 0xbe, 0xc8, 0xef, 0x5c, 0x5a, 0xa7, 0xf6, 0xd9, 0xb4,
+  0x2f, 0x56, 0xd7, 0xd7, 0xc9, 0x16, 0xcd, 0x69, 0x6d, 0xd3, 0x29, 0x9a,
+  0x4b, 0xaf, 0xfd, 0xb0, 0x0d, 0x91, 0xa1, 0x3a, 0xb7, 0xe6, 0x85, 0x96,
+  0x2b, 0x8c, 0x62, 0xc1, 0x76, 0xc7, 0xcd, 0xbc, 0x26, 0xa0, 0x31, 0x1b,
+  0x83, 0x17, 0x4c, 0xb7, 0x2e, 0xf3, 0xb5, 0x33, 0x53, 0x30, 0xb7, 0xed,
+  0xba, 0x1d, 0x36, 0x23, 0x57, 0xb1, 0xc7, 0x2e, 0x3e, 0x45, 0x84, 0xe3,
+  0xf5, 0xf1, 0x38, 0x62, 0x2b, 0xb8, 0x02, 0x34, 0xc7, 0xc2, 0xeb, 0xba,
+  0x46, 0x5f, 0x76, 0xb0, 0xb6, 0x1b, 0x96, 0x36, 0xe6, 0x06, 0x38, 0xab,
+  0xcb, 0xf8, 0x99, 0x51, 0x51, 0xd8, 0xca, 0x07, 0x34, 0x3a, 0x58, 0xb0,
+  0xd3, 0x08, 0x29, 0x49, 0x73, 0x2d, 0xa4, 0xe6, 0x9d, 0xfb, 0x8f, 0xd5,
+  0x66, 0xd7, 0x36, 0x4e, 0x5d, 0x83, 0x44, 0x5e, 0x97, 0x20, 0x94, 0x9e,
+  0x1a, 0x4b, 0x66, 0xb0, 0x89, 0x09, 0x50, 0x63, 0xcc, 0x1c, 0x34, 0x69,
+  0x61, 0x3a, 0x69, 0xcf, 0xc9, 0x9b, 0xb7, 0x07, 0xae, 0x3c, 0x4f, 0xc0,
+  0x4e, 0x36, 0x3a, 0x12, 0x47, 0xcc, 0x04, 0x44, 0x26, 0xfd, 0x73, 0xe1,
+  0xc1, 0x89, 0x19, 0x72, 0x90, 0x3f, 0xde, 0x60, 0x92, 0xb9, 0xb6, 0x96,
+  0x86, 0x09, 0x78, 0xdb, 0x42, 0x76, 0x78, 0x65, 0x9f, 0xf9, 0x35, 0x7b,
+  0x69, 0x2d, 0x66, 0x02, 0xe8, 0x6d, 0x41, 0xe8, 0x36, 0x3d, 0x5e, 0xa9,
+  0x09, 0xab, 0x43, 0x30, 0x49, 0x67, 0x6c, 0x2f, 0xbe, 0x66, 0x33, 0x5d,
+  0x18, 0xd8, 0x92, 0xd7, 0xa4, 0xd3, 0x19, 0x3e, 0x6d, 0x4b, 0x47, 0x67,
+  0xc7, 0x51, 0xf7, 0xd8, 0x91, 0x17, 0x05, 0x37, 0x39, 0x9e, 0x0b, 0x24,
+  0xdc, 0x8e, 0x1b, 0xd6, 0xb6, 0xe3, 0xa6, 0x78, 0x2a, 0xee, 0x1b, 0xf3,
+  0x78, 0xae, 0x5b, 0xd5, 0x63, 0x9a, 0xff, 0x73, 0xbf, 0xf9, 0x51, 0xab,
+  0x9b, 0x72, 0x83, 0x2f, 0x85, 0x37, 0x27, 0x7b, 0xa1, 0x83, 0x01, 0x73,
+  0x6c, 0xbe, 0x4f, 0xb2, 0xf2, 0x01, 0xdb, 0xde, 0xa7, 0xe3, 0x3c, 0xb9,
+  0x3a, 0xa4, 0x65, 0x99, 0x9a, 0xd1, 0xe7, 0x23, 0xf3, 0xc4, 0x56, 0xc0,
+  0xe7, 0x3c, 0x8c, 0x7f, 0x72, 0x04, 0xcc, 0x38, 0x4f, 0x61, 0x75, 0x59,
+  0x97, 0xe9, 0x62, 0x6f, 0x46, 0xaf, 0xba, 0x31, 0x1d, 0x03, 0xe5, 0x70,
+  0x7d, 0x6f, 0x46, 0xff, 0x6b, 0x18, 0x57, 0x1f, 0xd4, 0x18, 0xf4, 0xf4,
+  0xe5, 0x5d, 0x75, 0x9d, 0xde, 0x2c, 0xa0, 0x8f, 0xbe, 0xee, 0x44, 0x76,
+  0x1c, 0x98, 0x87, 0xed, 0x00, 0x5a, 0xe4, 0x11, 0xd8, 0xfa, 0xc0, 0xc6,
+  0xd7, 0x98, 0x90, 0x16, 0xa3, 0x70, 0xfe, 0x5b, 0x27, 0xa6, 0x61, 0x90,
+  0x71, 0xb5, 0x07, 0xa0, 0x0c, 0x96, 0xeb, 0xc5, 0x32, 0xad, 0xaa, 0x34,
+  0x5f, 0xfc, 0xc5, 0x8c, 0xfe, 0x67, 0x27, 0xc2, 0x7b, 0x41, 0x37, 0x71,
+  0xdf, 0x99, 0xd1, 0xff, 0x39, 0x1e, 0x77, 0x1f, 0x34, 0x6c, 0x1b, 0xaa,
+  0x62, 0xb5, 0x68, 0x70, 0x04, 0xc0, 0x30, 0xec, 0x53, 0x0f, 0xf3, 0x3d,
+  0x60, 0x63, 0xbc, 0xca, 0x1d, 0xc7, 0xe0, 0xed, 0x83, 0x1d, 0xff, 0x25,
+  0x59, 0x15, 0xcb, 0xcc, 0xab, 0x1b, 0x8f, 0x8a, 0x60, 0x52, 0x3d, 0xf3,
+  0xf0, 0x1d, 0x01, 0x83, 0x5a, 0xd8, 0x22, 0x9a, 0x51, 0x58, 0x5f, 0x1d,
+  0x52, 0x76, 0x14, 0x94, 0x37, 0x3e, 0xd7, 0x49, 0xb9, 0x2d, 0x76, 0xd9,
+  0x4a, 0x7a, 0xdc, 0xb5, 0xc0, 0x3c, 0x6b, 0x1d, 0xa1, 0xa3, 0xe0, 0xc7,
+  0xa0, 0xef, 0x96, 0x89, 0x2d, 0x64, 0x46, 0xbf, 0xea, 0xa0, 0xf6, 0x48,
+  0xb8, 0x80, 0xde, 0xdd, 0xeb, 0x34, 0xbf, 0x10, 0xc6, 0xc6, 0x5d, 0x19,
+  0x82, 0x77, 0xb0, 0xd3, 0x30, 0x70, 0x03, 0xf3, 0xd3, 0x18, 0xf8, 0x69,
+  0x0f, 0xe6, 0x36, 0x60, 0x35, 0x96, 0xd1, 0x2e, 0x53, 0x93, 0x05, 0x97,
+  0xc6, 0x89, 0x50, 0x97, 0x34, 0x38, 0xd6, 0x60, 0x8e, 0x2d, 0x19, 0xeb,
+  0x3c, 0xac, 0xe8, 0x78, 0x70, 0x33, 0x4e, 0x70, 0x4a, 0x49, 0x4e, 0xbf,
+  0xc6, 0xa4, 0xe5, 0x62, 0xf5, 0xd3, 0x7d, 0x6b, 0x75, 0xd8, 0xef, 0xc9,
+  0x0f, 0x61, 0x07, 0xba, 0xd8, 0xdc, 0xac, 0x40, 0xd9, 0x79, 0xbc, 0x4f,
+  0x2a, 0xbc, 0x29, 0x8c, 0x29, 0xaf, 0xc9, 0x8b, 0xb2, 0x28, 0x5f, 0x13,
+  0x0e, 0x51, 0xe2, 0xb6, 0x68, 0x37, 0x1b, 0xef, 0xf1, 0x88, 0x7e, 0x71,
+  0xa8, 0xd2, 0x6a, 0xb1, 0x2f, 0xb3, 0x6d, 0xba, 0x00, 0xfd, 0x64, 0xe1,
+  0xbc, 0x1e, 0x2a, 0x36, 0x88, 0x34, 0x4b, 0x30, 0x30, 0x5f, 0x8f, 0x7c,
+  0xd6, 0x06, 0x40, 0x28, 0x71, 0xb1, 0x5a, 0x2f, 0xac, 0x8b, 0x46, 0x75,
+  0x2c, 0x76, 0xfa, 0x07, 0xdd, 0x6d, 0x24, 0x5e, 0x07, 0x2d, 0x5a, 0xa7,
+  0xba, 0x35, 0x39, 0x7d, 0x3b, 0xbe, 0x7d, 0x8b, 0xff, 0xde, 0xd1, 0xbf,
+  0x3f, 0xbc, 0x9d, 0x79, 0x56, 0x10, 0xea, 0xe6, 0xd3, 0xc9, 0x9e, 0x6a,
+  0xc1, 0x4b, 0x2c, 0xe1, 0xd0, 0xe8, 0xfb, 0x59, 0x54, 0x60, 0x3c, 0x5c,
+  0xa0, 0xb1, 0xd5, 0xd0, 0x12, 0xad, 0x91, 0x38, 0xd1, 0x1b, 0x6e, 0xb0,
+  0x73, 0xd1, 0xce, 0xf1, 0xcc, 0xbb, 0x03, 0x6d, 0x4d, 0xd8, 0xb2, 0x3b,
+  0x14, 0x3b, 0x33, 0x5d, 0x30, 0x75, 0xd6, 0x74, 0x4a, 0x60, 0x2a, 0x1c,
+  0x2c, 0xd5, 0xbd, 0x80, 0x8d, 0x5f, 0xcb, 0xd0, 0xa8, 0x99, 0x50, 0x52,
+  0x74, 0x8a, 0x25, 0x8e, 0x7a, 0x73, 0xd7, 0x34, 0xc0, 0x8d, 0x4e, 0xbd,
+  0x70, 0x24, 0x75, 0x5c, 0x94, 0x95, 0x8b, 0xe9, 0x08, 0x4a, 0x8e, 0x66,
+  0x23, 0x4f, 0x1f, 0xb5, 0x0a, 0x63, 0x33, 0x73, 0x9b, 0x17, 0x01, 0x45,
+  0xcd, 0x6d, 0x30, 0xaa, 0x68, 0x96, 0x7f, 0x64, 0xb5, 0x15, 0x76, 0x00,
+  0x1d, 0xa9, 0x97, 0xae, 0x4d, 0x64, 0xde, 0x7b, 0xff, 0x90, 0x71, 0xee,
+  0x1d, 0xf2, 0x28, 0x70, 0xa4, 0x68, 0x3c, 0xd8, 0x5b, 0x8d, 0xa1, 0x18,
+  0x62, 0x4a, 0x54, 0xea, 0x5e, 0x50, 0x6b, 0x72, 0x74, 0x46, 0xfc, 0xc0,
+  0x73, 0xad, 0x69, 0xe9, 0x61, 0x37, 0x62, 0x32, 0x60, 0x5e, 0xc0, 0x82,
+  0xe9, 0x8d, 0x55, 0xee, 0x1e, 0x9e, 0x06, 0x36, 0x60, 0x9c, 0xde, 0xad,
+  0xbc, 0xae, 0x47, 0x1f, 0x2e, 0x7f, 0xbb, 0x0e, 0xf1, 0x4b, 0xcb, 0x27,
+  0xbb, 0x99, 0x7d, 0xbc, 0xb1, 0x9d, 0x31, 0x85, 0x6d, 0x5a, 0x89, 0x9e,
+  0xb5, 0xbf, 0x83, 0xb9, 0x9e, 0xee, 0x8a, 0xc3, 0xd5, 0xb5, 0x91, 0x81,
+  0xad, 0x30, 0xfa, 0x60, 0xeb, 0xc4, 0xaa, 0x0b, 0x67, 0xf9, 0xe2, 0x88,
+  0x9a, 0x25, 0xac, 0xd7, 0xb0, 0xbb, 0xf6, 0x94, 0x61, 0xd0, 0x19, 0xd9,
+  0x95, 0x09, 0x0d, 0x3d, 0x96, 0x02, 0xcf, 0xb3, 0x40, 0x19, 0x44, 0x86,
+  0x3f, 0xe0, 0x32, 0xd1, 0x63, 0xe5, 0x10, 0x9f, 0x8a, 0x34, 0xd8, 0x4e,
+  0x6d, 0x40, 0xb3, 0x61, 0x9e, 0x92, 0xed, 0x52, 0x83, 0xb7, 0x06, 0x18,
+  0xa6, 0x9d, 0x4d, 0xac, 0x4b, 0xd9, 0xbe, 0x7b, 0xb7, 0xcc, 0x7c, 0x74,
+  0x62, 0xe2, 0xb0, 0x4a, 0xc7, 0xd0, 0x75, 0x1c, 0x55, 0x6d, 0x34, 0x4d,
+  0x47, 0x01, 0x8a, 0x96, 0x2c, 0x80, 0xde, 0x86, 0xc7, 0xe1, 0x98, 0x75,
+  0xd0, 0x1f, 0x58, 0x52, 0x5e, 0xe5, 0x45, 0x5d, 0xe3, 0xae, 0x57, 0x96,
+  0x8c, 0xc0, 0x8c, 0x22, 0x31, 0xeb, 0xc4, 0x1d, 0x8b, 0x2b, 0xb7, 0x4f,
+  0x4d, 0x09, 0x88, 0x9f, 0x8e, 0x33, 0x5a, 0x12, 0x64, 0x68, 0xb1, 0xa4,
+  0xba, 0x3c, 0x93, 0xa5, 0xdd, 0xd3, 0xc3, 0xde, 0x0b, 0xbf, 0x11, 0x50,
+  0x74, 0x9a, 0x10, 0xee, 0x9e, 0xdf, 0x25, 0xe6, 0x5d, 0x42, 0xfb, 0x66,
+  0xf8, 0x33, 0x32, 0x58, 0x07, 0x21, 0xa5, 0xfa, 0xe1, 0x97, 0x9c, 0x94,
+  0x0d, 0x21, 0x09, 0x31, 0x04, 0x85, 0xfd, 0x53, 0x42, 0x3a, 0x66, 0xca,
+  0xb6, 0xc9, 0x55, 0x3a, 0x5f, 0x15, 0x07, 0x0c, 0x9d, 0xf3, 0xc8, 0x3c,
+  0x51, 0x9f, 0x88, 0x4f, 0xa0, 0x3b, 0xb3, 0x9a, 0x4e, 0x4b, 0x08, 0x01,
+  0xba, 0x97, 0x26, 0xe6, 0xfc, 0x6a, 0x77, 0xd8, 0x43, 0x7f, 0x9b, 0x4d,
+  0x46, 0xa1, 0x2f, 0x6c, 0xe7, 0xe1, 0xcb, 0xb9, 0x7c, 0xc4, 0x6f, 0xdc,
+  0x63, 0xea, 0x48, 0xbc, 0x5b, 0x6d, 0xf0, 0x40, 0x6b, 0x4e, 0x50, 0xbb,
+  0xc3, 0xf6, 0x91, 0x7c, 0xf0, 0xe9, 0xde, 0x26, 0xb7, 0xc5, 0xa1, 0x5e,
+  0xbc, 0x5b, 0xc3, 0xff, 0xb4, 0x9a, 0x11, 0xad, 0x65, 0xfb, 0x6c, 0x3d,
+  0x8b, 0x8a, 0x0f, 0x50, 0xb9, 0x4e, 0xea, 0xa4, 0x9d, 0x44, 0xfc, 0xf2,
+  0x13, 0xd0, 0x87, 0x68, 0xfa, 0x89, 0x0b, 0xab, 0x75, 0x55, 0xfe, 0xcc,
+  0x86, 0x55, 0x98, 0x56, 0x87, 0xcd, 0xc6, 0x7a, 0x3c, 0x0b, 0x11, 0xe1,
+  0x70, 0xc8, 0x27, 0x42, 0x51, 0xa7, 0xdb, 0x3d, 0xe1, 0x21, 0x7e, 0xc2,
+  0xb2, 0xf1, 0x69, 0x1d, 0xbc, 0x67, 0xa1, 0x34, 0xe6, 0x5a, 0x69, 0x71,
+  0xb8, 0xb9, 0x8a, 0x48, 0x87, 0x37, 0xa3, 0xe8, 0xd5, 0x7e, 0x77, 0x25,
+  0x9e, 0x4b, 0xae, 0x45, 0x31, 0x21, 0xd6, 0xc9, 0xb0, 0xab, 0x4f, 0xfc,
+  0xee, 0x88, 0x0a, 0x3b, 0x4f, 0x1b, 0x8c, 0x72, 0x3c, 0xaa, 0x60, 0xcb,
+  0x0e, 0xe0, 0xd7, 0x09, 0x89, 0xeb, 0xa5, 0x46, 0x94, 0xa5, 0x40, 0x4e,
+  0xa3, 0x75, 0x02, 0x9b, 0x4b, 0xf8, 0x0a, 0x1f, 0xab, 0xa2, 0xd8, 0xe1,
+  0x5f, 0x6c, 0xcb, 0x74, 0x86, 0x27, 0x0f, 0x65, 0xcd, 0x46, 0x52, 0x9d,
+  0xea, 0x74, 0x3a, 0x8c, 0x51, 0x0b, 0xe8, 0x9a, 0x3a, 0x40, 0xdc, 0xe5,
+  0xe4, 0xa1, 0x9a, 0xec, 0x6c, 0x2d, 0xb8, 0x80, 0x80, 0xbc, 0xaf, 0x46,
+  0xe7, 0xde, 0x91, 0x91, 0xf4, 0x0f, 0xac, 0x0d, 0xc9, 0x96, 0x8e, 0x50,
+  0x83, 0xd9, 0xbe, 0x29, 0xb7, 0xb5, 0x73, 0x15, 0xd0, 0xd0, 0x0c, 0x52,
+  0xa6, 0xc8, 0xd7, 0x0b, 0x9d, 0x04, 0x23, 0xcc, 0x66, 0x50, 0xe3, 0x36,
+  0x16, 0xc7, 0x13, 0x7a, 0xd1, 0xec, 0xb3, 0x55, 0x95, 0xfd, 0x90, 0x9a,
+  0x77, 0x6b, 0xf8, 0x1f, 0x90, 0x09, 0xdf, 0x7f, 0x48, 0xcb, 0x22, 0xb9,
+  0xcd, 0xaa, 0xe7, 0x6a, 0xbc, 0xd0, 0x28, 0x7a, 0x80, 0x20, 0x1c, 0xa8,
+  0x99, 0x23, 0x6c, 0x77, 0xb5, 0x02, 0x25, 0xb9, 0x98, 0x35, 0xab, 0xa0,
+  0xf7, 0x86, 0x1a, 0x67, 0x96, 0xc9, 0xea, 0xf5, 0x15, 0x85, 0x6a, 0x33,
+  0xdf, 0xa0, 0x07, 0x42, 0x8d, 0x71, 0xe7, 0xd2, 0x1d, 0x34, 0x7f, 0x05,
+  0xbd, 0xb9, 0x29, 0x76, 0x78, 0x61, 0x08, 0xe3, 0xd4, 0xe4, 0x67, 0x17,
+  0x4f, 0xe0, 0x13, 0xbe, 0xa9, 0x60, 0x6b, 0x90, 0x9a, 0x8b, 0xf3, 0x27,
+  0x46, 0x08, 0x3d, 0x7b, 0x1f, 0x42, 0x83, 0x97, 0x96, 0xda, 0x16, 0x72,
+  0x8f, 0xa8, 0x25, 0xee, 0x47, 0x64, 0xd9, 0x9e, 0x52, 0x9e, 0x5c, 0xf5,
+  0x58, 0xd1, 0x8e, 0x19, 0x8d, 0xd5, 0x26, 0x2b, 0x2b, 0x47, 0x1f, 0x22,
+  0x73, 0x26, 0xa5, 0xb1, 0xb8, 0x9d, 0x04, 0x5f, 0xa3, 0xeb, 0x10, 0xd9,
+  0xae, 0x5e, 0x50, 0x1c, 0x36, 0xf4, 0xad, 0x37, 0x6e, 0xca, 0x62, 0x88,
+  0x1b, 0xf1, 0x1a, 0x27, 0x5c, 0xea, 0x36, 0x69, 0x6f, 0x82, 0xe4, 0x85,
+  0x25, 0x6e, 0x2c, 0xda, 0x8b, 0xc5, 0x75, 0x69, 0x98, 0xac, 0xa4, 0xbc,
+  0x3a, 0x90, 0x9a, 0x00, 0x3b, 0x1e, 0xec, 0x46, 0x60, 0x56, 0x29, 0x7f,
+  0x3e, 0x8a, 0x11, 0xdb, 0x80, 0x9d, 0xd7, 0x68, 0x42, 0xb3, 0xd5, 0xc0,
+  0xaf, 0xbe, 0x7a, 0xa4, 0x85, 0xc7, 0x54, 0x24, 0xa6, 0x45, 0xa9, 0x22,
+  0x38, 0x26, 0x84, 0xc6, 0x7a, 0xcd, 0x61, 0x87, 0x91, 0xc2, 0xb5, 0x5d,
+  0x9d, 0x90, 0xbd, 0x23, 0x2c, 0xf6, 0x57, 0xbd, 0xe4, 0x9b, 0x08, 0x97,
+  0x74, 0x64, 0x08, 0x25, 0x2e, 0x61, 0x5a, 0x03, 0xae, 0xcb, 0x25, 0x6c,
+  0xea, 0x6a, 0x73, 0xb9, 0x02, 0x85, 0x31, 0x5d, 0x01, 0x51, 0x5e, 0x9f,
+  0xd3, 0x4a, 0x04, 0x7f, 0x13, 0xd8, 0x6c, 0xcf, 0x37, 0x65, 0x42, 0x2e,
+  0xcf, 0xe9, 0x23, 0xf4, 0xd8, 0x76, 0x00, 0x30, 0x60, 0xc9, 0x0e, 0x24,
+  0x4b, 0x0d, 0xbb, 0x0e, 0x05, 0x69, 0x2b, 0x35, 0x73, 0x03, 0x59, 0xc1,
+  0x2c, 0x61, 0x9f, 0x99, 0x29, 0x89, 0xa4, 0xca, 0xbb, 0xdd, 0x83, 0x6e,
+  0xae, 0x6d, 0x75, 0xb6, 0x55, 0x83, 0x6b, 0xee, 0x38, 0x47, 0xc5, 0x12,
+  0x8f, 0x03, 0x65, 0xef, 0x16, 0x3a, 0x79, 0x37, 0x42, 0x19, 0x64, 0xb7,
+  0xd6, 0x41, 0x20, 0x3e, 0x6a, 0x7f, 0x8e, 0x67, 0xed, 0x42, 0x90, 0x2b,
+  0x38, 0x22, 0x6a, 0x47, 0x0e, 0x91, 0x52, 0xe9, 0x51, 0x94, 0x1c, 0x30,
+  0x50, 0x17, 0x28, 0xb7, 0xa7, 0xba, 0x13, 0x1a, 0x95, 0x87, 0xdd, 0x0e,
+  0xa3, 0x3a, 0xda, 0xc0, 0x93, 0xeb, 0x14, 0xa3, 0x50, 0xde, 0xa5, 0xd5,
+  0x37, 0x23, 0x8a, 0xdb, 0xe5, 0x41, 0x48, 0xc0, 0xa9, 0x00, 0x84, 0x8f,
+  0x38, 0x03, 0x12, 0x27, 0x23, 0x8f, 0xbd, 0xb8, 0xd9, 0x4a, 0x53, 0x5f,
+  0xdb, 0x1b, 0x2d, 0x7f, 0xd0, 0xb6, 0x66, 0x74, 0x75, 0x40, 0xd8, 0xfc,
+  0x63, 0x1a, 0x1f, 0xa0, 0xdd, 0x94, 0x78, 0x16, 0x92, 0x60, 0xe0, 0xcd,
+  0xbe, 0x0e, 0xe9, 0x1a, 0x5e, 0xd3, 0x42, 0x69, 0x1b, 0xca, 0xb6, 0x1e,
+  0x6c, 0xc7, 0xe9, 0x1d, 0xca, 0x36, 0x3a, 0x37, 0x52, 0x11, 0xa4, 0x30,
+  0x4c, 0xb2, 0x55, 0xaa, 0x1e, 0x0a, 0xba, 0x63, 0xa6, 0x57, 0xbc, 0xbd,
+  0xe2, 0xaf, 0x7a, 0x7a, 0xc4, 0x3b, 0xe9, 0xf0, 0xdd, 0x5c, 0x84, 0xd6,
+  0x36, 0xbd, 0x49, 0x54, 0x4f, 0x17, 0x08, 0x01, 0xc1, 0x0d, 0x91, 0xea,
+  0xad, 0x61, 0x59, 0xcf, 0xfb, 0x3c, 0xf8, 0x40, 0x2d, 0xda, 0xe1, 0xc4,
+  0xe7, 0xdf, 0x3c, 0x6c, 0xc1, 0x41, 0x3c, 0x0b, 0x11, 0x2b, 0x9d, 0x84,
+  0x8c, 0x99, 0x5e, 0xb8, 0xb2, 0x64, 0x75, 0x8a, 0x8c, 0xf8, 0xee, 0x92,
+  0x96, 0xf0, 0x65, 0x85, 0xad, 0x4d, 0x2d, 0xfe, 0x09, 0xb5, 0x51, 0xef,
+  0x1c, 0x51, 0x0f, 0x69, 0xcd, 0x33, 0x9a, 0xb0, 0x6f, 0x6e, 0xd1, 0x59,
+  0xe1, 0x50, 0x2d, 0x71, 0x7f, 0xea, 0x8f, 0xc1, 0xab, 0x32, 0xdd, 0x27,
+  0x34, 0x35, 0x7f, 0x83, 0x8d, 0x33, 0x0f, 0x51, 0x7b, 0x91, 0x76, 0xce,
+  0x84, 0xec, 0x8d, 0xbe, 0x30, 0xd3, 0x0f, 0x80, 0x28, 0xff, 0x2b, 0x6b,
+  0x09, 0x4e, 0x79, 0x88, 0xd5, 0x09, 0xef, 0xa0, 0xa4, 0xba, 0xab, 0x40,
+  0x6f, 0x9b, 0x3b, 0x58, 0x50, 0x91, 0x58, 0x53, 0xe4, 0x35, 0x45, 0x45,
+  0xc4, 0xe9, 0x58, 0x74, 0x0a, 0xa7, 0x93, 0x3c, 0xf5, 0xd0, 0x38, 0xf5,
+  0x31, 0xd2, 0x27, 0x3d, 0x18, 0x1e, 0x59, 0xd0, 0xc8, 0x60, 0x80, 0xe8,
+  0x0e, 0x51, 0x9d, 0xd5, 0x07, 0x60, 0x2a, 0xea, 0xa6, 0x84, 0x76, 0xc2,
+  0xba, 0xf3, 0xe3, 0xf1, 0xd2, 0x68, 0xb0, 0x31, 0x8d, 0x2e, 0xe2, 0xac,
+  0x13, 0xfc, 0x0d, 0x18, 0x1b, 0x4c, 0x91, 0xb6, 0xca, 0xb6, 0x79, 0x01,
+  0xa7, 0x27, 0xcf, 0x61, 0x37, 0x33, 0x72, 0x5f, 0x23, 0x24, 0xea, 0xe7,
+  0xa1, 0xc3, 0x59, 0x5e, 0xa9, 0xbb, 0xbd, 0x15, 0x00, 0x89, 0x9e, 0xda,
+  0xed, 0xf1, 0xd3, 0x2c, 0xba, 0x9b, 0x30, 0x6b, 0xe9, 0x36, 0xf1, 0x0c,
+  0x18, 0xa4, 0xca, 0x1e, 0xb6, 0xc1, 0x7f, 0x0e, 0x50, 0xe6, 0x4d, 0x67,
+  0x27, 0xca, 0xc4, 0xe1, 0x7b, 0x2c, 0xba, 0xb9, 0xb7, 0x76, 0x95, 0x31,
+  0x52, 0xf2, 0x74, 0x8d, 0x57, 0x6d, 0x04, 0x13, 0x75, 0x3a, 0x46, 0x38,
+  0xb2, 0x36, 0x13, 0x7e, 0x6f, 0xaf, 0x15, 0xf0, 0xd0, 0x05, 0x33, 0x82,
+  0xb0, 0x2c, 0x84, 0x64, 0x6d, 0x5f, 0x27, 0xb0, 0xb6, 0x1f, 0xb5, 0x27,
+  0x73, 0x66, 0x77, 0x00, 0xda, 0xb6, 0x68, 0x27, 0x70, 0x3a, 0x86, 0x7f,
+  0x7d, 0x08, 0xec, 0xe5, 0x58, 0x8d, 0x43, 0xd3, 0x61, 0xf0, 0xe8, 0x5f,
+  0x09, 0xea, 0xa8, 0xde, 0x76, 0xe1, 0x99, 0x1d, 0x88, 0xa1, 0x22, 0xb8,
+  0x71, 0xa0, 0xed, 0xcc, 0x99, 0x63, 0x66, 0x8f, 0xa7, 0x54, 0xcc, 0x90,
+  0xcc, 0xb0, 0xfc, 0xaf, 0x6b, 0x46, 0x24, 0x7b, 0xf8, 0x35, 0x4e, 0x5c,
+  0xbb, 0xe0, 0x5b, 0x48, 0x02, 0x04, 0x7e, 0xb5, 0x56, 0x62, 0x8c, 0xd4,
+  0x0c, 0x8d, 0xce, 0xea, 0xeb, 0x05, 0x81, 0x97, 0xa1, 0xdc, 0x75, 0xe2,
+  0x58, 0xc5, 0x60, 0x54, 0xb0, 0x5d, 0x5c, 0x77, 0x16, 0x63, 0x67, 0xce,
+  0x6c, 0xb7, 0x2e, 0xde, 0x54, 0xf3, 0xdf, 0x7f, 0xf5, 0xc8, 0x4d, 0xbc,
+  0x47, 0xb8, 0xa0, 0x41, 0xfb, 0x36, 0x73, 0xf8, 0xfc, 0xec, 0xe9, 0x23,
+  0x09, 0xde, 0x1c, 0x2c, 0x0e, 0x28, 0x2f, 0xb0, 0xf5, 0x74, 0x4a, 0x8a,
+  0x42, 0xa3, 0xb1, 0x48, 0x80, 0x92, 0xb8, 0xaf, 0x5d, 0x17, 0x85, 0xd7,
+  0x4e, 0x51, 0xb0, 0x62, 0x21, 0x0c, 0x1a, 0x4b, 0x0b, 0x89, 0xbd, 0x7a,
+  0x6a, 0xa7, 0x17, 0xb9, 0x39, 0xd3, 0xfd, 0xe4, 0x82, 0x53, 0x12, 0xc9,
+  0xa8, 0xd9, 0x70, 0xab, 0xf8, 0xda, 0x9c, 0xb2, 0x23, 0x55, 0xfc, 0x79,
+  0xad, 0x9f, 0xc7, 0x58, 0xff, 0x42, 0x45, 0x92, 0xa6, 0xfb, 0xb1, 0x62,
+  0x8b, 0xe7, 0x4d, 0x61, 0x73, 0x1e, 0x59, 0xc1, 0x42, 0xb4, 0xf3, 0x20,
+  0x23, 0x9d, 0xf8, 0xd3, 0x1f, 0x5d, 0x75, 0x0d, 0x53, 0x29, 0x4f, 0xdf,
+  0x8d, 0xcf, 0x30, 0x61, 0x57, 0xc1, 0xfe, 0x6b, 0x8e, 0x0a, 0x3d, 0xf7,
+  0x54, 0xbb, 0x2b, 0x20, 0x1e, 0x53, 0xa1, 0x7d, 0x7c, 0x5d, 0x26, 0x6f,
+  0xe0, 0x0f, 0x22, 0xc6, 0xb4, 0x3f, 0xb8, 0xc0, 0x71, 0xad, 0xe4, 0xdd,
+  0xe5, 0xfb, 0x8d, 0x8d, 0x01, 0xed, 0xe2, 0x4d, 0xb6, 0xae, 0xaf, 0x61,
+  0x8a, 0xb5, 0x6d, 0x2e, 0x66, 0x74, 0x13, 0xae, 0x51, 0xe4, 0x9a, 0x9c,
+  0xb3, 0xb1, 0x4c, 0xd7, 0x9e, 0x83, 0xa9, 0xaa, 0x3b, 0x2b, 0x5e, 0x67,
+  0xb0, 0xea, 0x20, 0x79, 0x95, 0x39, 0x8b, 0x0b, 0xb7, 0xea, 0x10, 0x73,
+  0x6a, 0x15, 0xf3, 0x48, 0xc5, 0x63, 0x3e, 0xbf, 0x4e, 0x93, 0x75, 0xb4,
+  0xaf, 0xe8, 0xe8, 0x02, 0xd0, 0xf6, 0x8a, 0x64, 0x0d, 0x1b, 0x66, 0x78,
+  0x6f, 0xb7, 0x08, 0x5b, 0x50, 0x90, 0xb3, 0x3d, 0xb0, 0x20, 0x0d, 0xc6,
+  0x7c, 0x89, 0x91, 0xc7, 0x45, 0x2d, 0xb1, 0x9c, 0x39, 0xe3, 0x95, 0x2d,
+  0xe2, 0x54, 0xab, 0xb4, 0x54, 0x22, 0x41, 0x54, 0xa9, 0x49, 0x3c, 0x15,
+  0xc5, 0xd7, 0x50, 0xd0, 0x02, 0x31, 0xa0, 0xc4, 0x20, 0x48, 0x30, 0x9d,
+  0x6a, 0x2d, 0xe7, 0x6e, 0x4b, 0x59, 0xfd, 0x85, 0x0c, 0x24, 0x9e, 0xfe,
+  0x82, 0xbf, 0x7d, 0xfd, 0x45, 0xee, 0xa6, 0x75, 0xea, 0x2f, 0xca, 0xec,
+  0x3f, 0xa9, 0x1a, 0x73, 0x62, 0xbd, 0xb0, 0x6d, 0x77, 0xb9, 0x1b, 0x97,
+  0x68, 0xdc, 0xf8, 0x8c, 0xbf, 0x2c, 0x58, 0xe2, 0x55, 0xb8, 0x01, 0x3e,
+  0x33, 0x34, 0x54, 0x68, 0xd2, 0xe6, 0x81, 0x46, 0xe7, 0x39, 0x20, 0xb8,
+  0x30, 0x57, 0x80, 0xe7, 0x50, 0xa1, 0x0e, 0x21, 0x82, 0xd5, 0xc3, 0xc5,
+  0xe2, 0x21, 0xdb, 0xba, 0xdb, 0x70, 0x47, 0xea, 0x4e, 0x27, 0x5e, 0x18,
+  0x2f, 0x2c, 0xce, 0x6d, 0x0e, 0x23, 0x98, 0x51, 0x2f, 0x38, 0x06, 0x7b,
+  0xe0, 0x2d, 0x3b, 0x6e, 0xb9, 0xb3, 0x1e, 0x20, 0xbc, 0x7c, 0x0f, 0xad,
+  0xaf, 0x72, 0x41, 0xd4, 0x5f, 0xc2, 0xd8, 0x61, 0x24, 0xa8, 0x9a, 0x1a,
+  0xa4, 0x64, 0x4e, 0xc7, 0xbc, 0xfc, 0x32, 0x33, 0x0b, 0x9c, 0x18, 0x48,
+  0xb5, 0x54, 0xe8, 0x69, 0xe9, 0x70, 0xc5, 0xb3, 0xcd, 0x9a, 0x20, 0xc6,
+  0x32, 0x9b, 0xd6, 0x0b, 0xe8, 0xde, 0x9e, 0x02, 0x6e, 0x98, 0xce, 0xdc,
+  0x54, 0xb0, 0xf0, 0xd3, 0x58, 0x22, 0xd9, 0x2f, 0xdc, 0x02, 0x69, 0x80,
+  0xf3, 0xdd, 0x65, 0x1f, 0xea, 0x17, 0xf0, 0xd5, 0xdf, 0x5f, 0xbc, 0x7c,
+  0x97, 0x9c, 0x5f, 0xe1, 0x7d, 0x45, 0x78, 0xff, 0x52, 0x5d, 0xab, 0x4d,
+  0x54, 0x5f, 0x17, 0xef, 0xa0, 0x74, 0x27, 0xfe, 0xa9, 0x30, 0x07, 0x5f,
+  0xcc, 0x3f, 0x20, 0x37, 0xbe, 0xa0, 0xb1, 0x70, 0xac, 0x2e, 0x61, 0x17,
+  0xdc, 0x38, 0xdf, 0x83, 0x65, 0x7e, 0x84, 0xca, 0x7d, 0x22, 0x61, 0xe0,
+  0xba, 0xd5, 0x6e, 0x5f, 0x7e, 0x74, 0xea, 0xc3, 0x7a, 0x7b, 0x80, 0x6d,
+  0x99, 0xb1, 0x39, 0xba, 0xdd, 0x4c, 0x6d, 0xe1, 0x43, 0xdb, 0x70, 0x8b,
+  0xc1, 0xd8, 0x42, 0x8a, 0xac, 0xe9, 0x9c, 0x01, 0x3f, 0xe1, 0x04, 0x90,
+  0x9b, 0x9f, 0x8d, 0x49, 0xe9, 0x69, 0x47, 0x5e, 0x47, 0x87, 0xda, 0x9f,
+  0xaf, 0xdd, 0xa9, 0x2d, 0x18, 0x98, 0x89, 0x2d, 0xc0, 0xf0, 0xe0, 0xec,
+  0xbe, 0xb6, 0x88, 0x53, 0x23, 0xfc, 0xb7, 0x76, 0xab, 0x6e, 0x5a, 0xa8,
+  0xd0, 0x39, 0xe7, 0x8b, 0x88, 0x48, 0xe5, 0x7e, 0x8c, 0xfb, 0x80, 0x31,
+  0xb7, 0x7a, 0x81, 0x86, 0xec, 0x75, 0x56, 0x9a, 0x78, 0x18, 0xdc, 0xe4,
+  0xf8, 0x1b, 0x54, 0x16, 0x0c, 0x63, 0xa3, 0x26, 0xad, 0xa8, 0x4d, 0x96,
+  0x98, 0x58, 0x9a, 0x74, 0xcb, 0x93, 0x1e, 0x89, 0x72, 0xd6, 0x32, 0x16,
+  0x81, 0x36, 0xae, 0x11, 0x25, 0x8f, 0xd5, 0xc6, 0xbb, 0x6a, 0x54, 0xf5,
+  0xda, 0x13, 0x4d, 0x5d, 0x1d, 0xdd, 0x56, 0x1c, 0xfb, 0xc9, 0x2f, 0xdb,
+  0xda, 0x6f, 0x47, 0x88, 0xc2, 0x50, 0x12, 0xf6, 0xc9, 0x42, 0x35, 0x2a,
+  0x29, 0xa3, 0xcf, 0x7c, 0xe1, 0x13, 0x68, 0xf7, 0x2c, 0x23, 0x9a, 0x1a,
+  0xbe, 0x96, 0x18, 0x8d, 0x3c, 0xa5, 0x28, 0xd6, 0xd6, 0x17, 0x9e, 0x62,
+  0x14, 0xab, 0xec, 0xac, 0x34, 0xb1, 0x4a, 0x73, 0x0a, 0xba, 0x51, 0xf9,
+  0x74, 0xdd, 0x82, 0xc9, 0x6d, 0x18, 0x7e, 0x72, 0x5c, 0x4f, 0xd7, 0x3f,
+  0x25, 0xb6, 0x67, 0x47, 0x63, 0x7b, 0xd6, 0x86, 0x2d, 0xe8, 0xb1, 0xf7,
+  0xc4, 0xe5, 0x0e, 0x59, 0xb0, 0x69, 0x3f, 0x2b, 0x53, 0x1d, 0x60, 0xff,
+  0x9c, 0x65, 0xc8, 0x82, 0xf2, 0x13, 0x58, 0x4f, 0xfa, 0x2c, 0x27, 0x91,
+  0xf9, 0x6a, 0xd8, 0x1c, 0xd2, 0x63, 0x0a, 0x31, 0x9e, 0x9e, 0xf8, 0xde,
+  0xd6, 0x90, 0x78, 0xc1, 0x75, 0x06, 0x91, 0x1f, 0x61, 0x0c, 0xb9, 0x37,
+  0x5d, 0x91, 0x8d, 0xc3, 0xf3, 0x4b, 0x8f, 0x8d, 0x1c, 0x1f, 0x23, 0x75,
+  0xac, 0xd7, 0x1f, 0x6b, 0xc1, 0x18, 0xb2, 0x5e, 0xf4, 0x8a, 0xc8, 0x7b,
+  0x19, 0x2b, 0xee, 0x69, 0xa8, 0xb8, 0x97, 0x91, 0x42, 0xba, 0x84, 0x4d,
+  0xe3, 0x1c, 0x10, 0x25, 0x88, 0xf7, 0x72, 0xd6, 0x3c, 0x03, 0xb0, 0xc5,
+  0xcd, 0x08, 0xd4, 0x38, 0x9b, 0xfa, 0xd5, 0xb3, 0x4b, 0xb8, 0x29, 0xf3,
+  0xec, 0x1f, 0x53, 0xe6, 0xff, 0x87, 0x29, 0xa3, 0x5a, 0xc3, 0xbd, 0x66,
+  0xce, 0xb3, 0x7f, 0xcc, 0x9c, 0x9f, 0x70, 0xe6, 0x04, 0x53, 0x47, 0x17,
+  0xd2, 0xc6, 0xd4, 0xb1, 0x03, 0xc0, 0x30, 0xfe, 0x9d, 0x7a, 0xbd, 0x59,
+  0x47, 0x0b, 0xab, 0xd3, 0xb5, 0x1b, 0x78, 0x5b, 0xa7, 0xe4, 0x51, 0x78,
+  0x9f, 0xb5, 0xe0, 0xa5, 0xd3, 0x4c, 0x71, 0x53, 0x5b, 0x5c, 0x95, 0xc9,
+  0xfe, 0x3a, 0x5b, 0x55, 0x68, 0xc8, 0x70, 0xf5, 0xea, 0x6c, 0x3d, 0x2c,
+  0x19, 0x61, 0x5e, 0xd5, 0xce, 0x9a, 0x15, 0x59, 0x1f, 0x68, 0xd6, 0x5a,
+  0x03, 0x44, 0x8e, 0xfb, 0xba, 0x9c, 0xee, 0x72, 0xf3, 0x2c, 0xf5, 0x26,
+  0x41, 0x4e, 0x17, 0xea, 0xf0, 0x16, 0x02, 0x39, 0xbd, 0xe5, 0x33, 0x9e,
+  0xf4, 0x27, 0x6a, 0xa0, 0xc8, 0x5b, 0x1b, 0xdf, 0xd2, 0xf4, 0xf7, 0xb1,
+  0x23, 0x79, 0x7b, 0x37, 0x52, 0x14, 0x17, 0xa4, 0x6f, 0x88, 0x53, 0xbb,
+  0x6f, 0x41, 0xb4, 0xea, 0x78, 0xdc, 0x09, 0x2e, 0x8c, 0x40, 0x10, 0xe4,
+  0x47, 0xa0, 0x57, 0x2e, 0x4e, 0x8e, 0x9e, 0x5d, 0xdd, 0x63, 0x07, 0x48,
+  0x62, 0xe4, 0x98, 0x0d, 0xa0, 0x09, 0x44, 0x24, 0x74, 0x78, 0xdc, 0xa0,
+  0xd6, 0x2d, 0xa9, 0x14, 0x6c, 0x58, 0xae, 0xe0, 0x65, 0xa9, 0xc7, 0xd2,
+  0x2a, 0x75, 0x28, 0x9c, 0x51, 0x63, 0x2b, 0xe2, 0xed, 0x42, 0xf0, 0x76,
+  0x8b, 0x37, 0xfe, 0x3c, 0x0f, 0xad, 0x48, 0x69, 0x5a, 0x11, 0x8f, 0xdf,
+  0x85, 0xdc, 0xf3, 0x3c, 0xe0, 0x3d, 0x37, 0x1f, 0xef, 0xb3, 0xef, 0xb8,
+  0xcf, 0x96, 0x43, 0x1d, 0x77, 0x68, 0x4f, 0x35, 0x60, 0xf2, 0x65, 0xd4,
+  0xef, 0x65, 0xf2, 0x75, 0xe7, 0x1b, 0xef, 0x61, 0xf9, 0x65, 0xe2, 0xea,
+  0xce, 0xfa, 0x7b, 0x2d, 0xbf, 0x81, 0x6b, 0x61, 0x43, 0x92, 0xa8, 0x33,
+  0x22, 0x47, 0xed, 0xbc, 0xa7, 0xb8, 0x6d, 0x31, 0x26, 0x9c, 0xdc, 0xcf,
+  0x90, 0x70, 0xe2, 0xd9, 0xe7, 0x59, 0x66, 0x5b, 0xe7, 0xb1, 0x33, 0xb5,
+  0x7a, 0xba, 0xf9, 0xa2, 0x63, 0xeb, 0x2f, 0xb0, 0x6c, 0xfc, 0xc2, 0x94,
+  0x23, 0x6a, 0x24, 0xa8, 0x8a, 0x43, 0x49, 0x29, 0x3b, 0x69, 0x7b, 0xef,
+  0xde, 0x23, 0x9b, 0xb8, 0xb7, 0x83, 0x36, 0x86, 0x61, 0xb3, 0x40, 0x1b,
+  0x21, 0x64, 0x85, 0xfb, 0xfb, 0x53, 0xe2, 0x7c, 0xee, 0x42, 0xa5, 0x04,
+  0xc5, 0x03, 0x9f, 0xbf, 0xb2, 0xc1, 0x0c, 0x7f, 0xbf, 0xef, 0xd0, 0x1a,
+  0x8f, 0x8d, 0xa2, 0xf1, 0xe5, 0xc1, 0x6d, 0x31, 0x11, 0x35, 0x86, 0xd7,
+  0xb1, 0x63, 0x49, 0xd6, 0x94, 0x78, 0x3f, 0x89, 0xb3, 0x6e, 0x61, 0x15,
+  0xb4, 0x1f, 0xb9, 0x84, 0xc0, 0x74, 0x6b, 0x2e, 0x9d, 0x5e, 0xa4, 0x05,
+  0xcb, 0xed, 0xad, 0x66, 0xfa, 0xe8, 0x1c, 0x36, 0x5a, 0x33, 0xb0, 0x38,
+  0x50, 0x42, 0x51, 0x22, 0x82, 0x55, 0x90, 0x2e, 0x9a, 0xaf, 0x32, 0x90,
+  0x89, 0xe8, 0xf6, 0xf7, 0x0f, 0xe5, 0xfc, 0xbf, 0x8f, 0x72, 0x6e, 0x97,
+  0xd9, 0x70, 0x88, 0xe3, 0xd8, 0x0c, 0x56, 0x61, 0x3f, 0x39, 0x56, 0x61,
+  0x8f, 0x01, 0xef, 0xa7, 0xb0, 0xb7, 0xcc, 0xcb, 0x41, 0x83, 0xe0, 0xfd,
+  0xf4, 0xf6, 0x2e, 0xf0, 0xbf, 0xbf, 0xde, 0x0e, 0xf3, 0xb4, 0x06, 0xa1,
+  0xfa, 0x23, 0xe7, 0x16, 0x8f, 0x04, 0xcf, 0xa3, 0xca, 0x04, 0xbf, 0xfe,
+  0x31, 0xf9, 0xfe, 0x9f, 0x35, 0x26, 0x05, 0x63, 0x1f, 0x6c, 0x8c, 0x8d,
+  0xea, 0x56, 0x7f, 0xd7, 0x49, 0xd4, 0x5e, 0x6d, 0xbf, 0x47, 0x4e, 0x27,
+  0x95, 0x7d, 0x4e, 0x31, 0x9d, 0x85, 0xda, 0xe7, 0xdf, 0xdf, 0xce, 0xe4,
+  0x84, 0xe7, 0x82, 0x0b, 0x32, 0xa5, 0x33, 0x7f, 0xcb, 0xac, 0xbb, 0x6f,
+  0x45, 0x52, 0x89, 0xaf, 0xbb, 0xa9, 0x35, 0xde, 0xde, 0xd3, 0x91, 0xb0,
+  0xd2, 0xbf, 0x4c, 0xca, 0xba, 0xd8, 0x99, 0x3f, 0x66, 0x39, 0xb4, 0xff,
+  0xb4, 0xc2, 0x48, 0x6b, 0xfb, 0x43, 0x6d, 0xc3, 0xa0, 0x9c, 0x3f, 0x88,
+  0xc2, 0xa0, 0x8c, 0xa9, 0x42, 0x04, 0x99, 0x02, 0xa3, 0x7b, 0xde, 0xd8,
+  0xf5, 0xad, 0xc1, 0x48, 0x9e, 0x1a, 0x62, 0x34, 0x9a, 0x7c, 0x7b, 0x13,
+  0xc4, 0x7a, 0xda, 0x98, 0x94, 0x10, 0x66, 0xbb, 0x74, 0xce, 0x51, 0xc9,
+  0x8c, 0xeb, 0x59, 0xbd, 0x91, 0x36, 0xe6, 0x19, 0x21, 0x3e, 0x68, 0x32,
+  0x45, 0x51, 0x6b, 0xc0, 0xf3, 0xbe, 0x4a, 0xfd, 0x93, 0x6c, 0x05, 0x31,
+  0x1c, 0x8f, 0xa7, 0x05, 0x23, 0xa7, 0x9a, 0x56, 0x18, 0xe9, 0xc3, 0xe0,
+  0x02, 0xdd, 0xb8, 0xc2, 0x90, 0x89, 0x09, 0x23, 0x70, 0x94, 0x71, 0x93,
+  0xac, 0x1f, 0x38, 0xc6, 0x44, 0x15, 0x9f, 0x1d, 0xe7, 0x74, 0xbe, 0xdc,
+  0xcf, 0x22, 0xb1, 0x81, 0xfd, 0x72, 0xf1, 0x2f, 0x4f, 0x54, 0x6f, 0x8a,
+  0x90, 0x94, 0x2d, 0x48, 0xca, 0x26, 0x92, 0x32, 0x44, 0xe2, 0xc7, 0x4d,
+  0xac, 0x35, 0xb4, 0x1c, 0xca, 0x12, 0xed, 0x0e, 0xba, 0xf6, 0xf6, 0xc4,
+  0xf8, 0x3e, 0xcd, 0x53, 0x18, 0x36, 0xba, 0xc1, 0x94, 0xba, 0xaf, 0x72,
+  0x0f, 0x55, 0x73, 0x63, 0x78, 0xff, 0xe9, 0xfd, 0x0b, 0x1b, 0x65, 0xe5,
+  0x0a, 0xb6, 0x40, 0x77, 0x5e, 0x78, 0xa3, 0x00, 0x18, 0xc1, 0x96, 0xc5,
+  0xfa, 0xae, 0xed, 0x23, 0x30, 0xae, 0x0d, 0xa4, 0xd2, 0xf6, 0xd9, 0xab,
+  0x12, 0xc3, 0xde, 0xf5, 0x82, 0x58, 0xb2, 0xe6, 0xb7, 0x7e, 0xf8, 0xa0,
+  0xb3, 0xca, 0xbf, 0xe3, 0xd5, 0x53, 0xda, 0xef, 0x22, 0xc0, 0x31, 0x5c,
+  0x02, 0xff, 0x03, 0x40, 0x51, 0x61, 0xec, 0x35, 0x48, 0xea, 0xb5, 0x4b,
+  0x17, 0x40, 0xfd, 0x1d, 0x46, 0x23, 0x5f, 0xd3, 0x09, 0x7f, 0x99, 0xd6,
+  0x87, 0x72, 0x67, 0x12, 0xc3, 0xf5, 0x9c, 0xbf, 0x9b, 0x8c, 0xec, 0xe1,
+  0xa8, 0xe5, 0xab, 0xd3, 0x33, 0x37, 0x40, 0xb3, 0x41, 0xca, 0xcb, 0x16,
+  0x08, 0xb9, 0x5e, 0x2c, 0x41, 0xfd, 0x2c, 0x21, 0x3a, 0x5e, 0x78, 0xc9,
+  0xbb, 0x48, 0x61, 0x77, 0x04, 0xbd, 0xaf, 0xc7, 0xde, 0x92, 0x16, 0xf1,
+  0x4c, 0x07, 0x0b, 0x46, 0x5f, 0xcb, 0x75, 0xe2, 0xc7, 0x0d, 0x41, 0x6a,
+  0x6f, 0x2d, 0x5b, 0xec, 0x76, 0x5e, 0x61, 0x28, 0x35, 0x0c, 0x1c, 0xa5,
+  0x41, 0x16, 0x85, 0x15, 0x1d, 0xab, 0x9d, 0x86, 0x41, 0x18, 0x15, 0x95,
+  0xbb, 0xd3, 0x83, 0xf7, 0x8b, 0xed, 0xd5, 0x4f, 0x0a, 0x8c, 0xfd, 0xc0,
+  0xeb, 0x6a, 0x71, 0xac, 0xff, 0x6c, 0x8b, 0xe8, 0xd2, 0xd2, 0x3c, 0xf5,
+  0xef, 0x52, 0xd4, 0x85, 0xf9, 0x4e, 0x05, 0xd2, 0x29, 0x19, 0xdc, 0x1a,
+  0x31, 0x30, 0xcf, 0xe5, 0xc2, 0x24, 0x9b, 0x1e, 0x9a, 0xb5, 0x78, 0x73,
+  0x42, 0x8c, 0x7b, 0xf6, 0x62, 0x29, 0x0d, 0x8e, 0x86, 0xc0, 0xc1, 0xc7,
+  0x53, 0x1b, 0x1c, 0x92, 0x51, 0xd6, 0x01, 0x0a, 0xa6, 0x74, 0x18, 0x8f,
+  0x86, 0x7e, 0x89, 0x30, 0xc6, 0x1d, 0xca, 0x09, 0x89, 0xba, 0xba, 0x53,
+  0xd2, 0x15, 0x05, 0x9d, 0xe9, 0x80, 0x2a, 0x0f, 0x71, 0xfc, 0x0d, 0xa5,
+  0x91, 0x17, 0xd3, 0x39, 0xfe, 0x5c, 0xba, 0xcf, 0x2e, 0x4a, 0xb3, 0x25,
+  0x8a, 0x92, 0x3c, 0x75, 0xd1, 0xc4, 0x19, 0xa0, 0x3a, 0x48, 0xfa, 0xdb,
+  0xd1, 0xb4, 0x2f, 0xaa, 0xba, 0xaf, 0xa7, 0xf8, 0xf3, 0x4f, 0x41, 0x17,
+  0x57, 0x5c, 0x3b, 0x29, 0x60, 0xb9, 0x52, 0x39, 0xb2, 0x0a, 0x59, 0xf2,
+  0x5c, 0xae, 0x17, 0x3c, 0xf7, 0xff, 0xe3, 0x05, 0xf8, 0x93, 0x43, 0x5d,
+  0xcc, 0x71, 0x57, 0x8d, 0x97, 0xc3, 0x6c, 0xd0, 0xb1, 0xe7, 0x1a, 0x41,
+  0xc1, 0x8f, 0x1d, 0x90, 0x2f, 0x37, 0xb0, 0xe2, 0x9d, 0xa2, 0x83, 0x2a,
+  0x16, 0x80, 0xd5, 0x9d, 0xde, 0x8c, 0x1a, 0x41, 0x06, 0xf2, 0xd5, 0x36,
+  0x00, 0x23, 0xbc, 0x08, 0xd7, 0x46, 0xc0, 0x57, 0x75, 0x52, 0x03, 0x8b,
+  0xe2, 0x8e, 0xbd, 0xa5, 0x7e, 0x6b, 0x18, 0x47, 0x73, 0xc1, 0xaa, 0xd8,
+  0xee, 0xe9, 0x62, 0x9b, 0xb3, 0x8a, 0x6f, 0x93, 0x15, 0x68, 0x6b, 0x2b,
+  0x4a, 0xd3, 0x36, 0xaf, 0x2c, 0xaa, 0xf9, 0x9b, 0x12, 0x45, 0x7d, 0xc9,
+  0x59, 0x3c, 0xde, 0xdc, 0xc2, 0xbf, 0x2c, 0x58, 0xbe, 0x13, 0xfd, 0xe1,
+  0x8c, 0xde, 0x35, 0x77, 0x16, 0xc6, 0x33, 0x28, 0x04, 0x55, 0x52, 0xd6,
+  0x02, 0xb2, 0xca, 0x52, 0xca, 0x85, 0x15, 0x2c, 0xcf, 0xe8, 0xec, 0xbb,
+  0x4f, 0x57, 0x98, 0x6c, 0x37, 0x04, 0xa6, 0x01, 0x6a, 0x31, 0xdb, 0x9e,
+  0x51, 0x95, 0x2d, 0x26, 0x08, 0x1b, 0xc9, 0xdd, 0xdb, 0x7b, 0xda, 0xb3,
+  0x8b, 0x32, 0x75, 0xe7, 0x04, 0xdd, 0x0d, 0x1d, 0x5f, 0xc3, 0x8b, 0xe2,
+  0xaa, 0x4c, 0xb6, 0xa8, 0x1b, 0xd9, 0x1f, 0xb3, 0x81, 0x52, 0x15, 0x2c,
+  0x02, 0x98, 0xe0, 0x2e, 0xe7, 0xab, 0x7b, 0xde, 0xcf, 0xa1, 0x92, 0xcb,
+  0xa4, 0xac, 0xb4, 0x98, 0x3e, 0x0f, 0x95, 0xd9, 0x67, 0xe9, 0xea, 0x1a,
+  0x34, 0x3d, 0x52, 0xbd, 0xe5, 0x79, 0xb0, 0x9e, 0xe2, 0xd6, 0x56, 0xc3,
+  0x8f, 0x61, 0x8c, 0x27, 0xce, 0xa6, 0xe2, 0x9a, 0x8f, 0xe2, 0xcf, 0x6f,
+  0x16, 0xfd, 0x56, 0x02, 0xe9, 0x87, 0xd6, 0xcc, 0x5f, 0x04, 0x67, 0x23,
+  0x86, 0x09, 0xe1, 0xf5, 0x98, 0x78, 0x9d, 0x72, 0x20, 0x85, 0xec, 0xc6,
+  0x79, 0x63, 0x87, 0x24, 0x6c, 0xd3, 0x64, 0x47, 0x38, 0xb7, 0xe9, 0x3a,
+  0x93, 0x47, 0x60, 0x5e, 0x26, 0xa8, 0x5e, 0xd3, 0x5f, 0xcc, 0xa4, 0xbb,
+  0xb0, 0x80, 0xf6, 0x57, 0xb5, 0xd0, 0x9c, 0x27, 0xab, 0xd4, 0x7d, 0xd9,
+  0xe1, 0xee, 0x22, 0xcf, 0xea, 0x3b, 0x46, 0x81, 0xd6, 0x08, 0x8c, 0xc7,
+  0xb0, 0x4b, 0x93, 0x72, 0x51, 0xa6, 0x57, 0x12, 0xc4, 0x80, 0x3f, 0x1e,
+  0x96, 0x55, 0x82, 0xdf, 0x87, 0x1b, 0x42, 0xc1, 0x3a, 0xb5, 0x09, 0xc1,
+  0xb4, 0xad, 0xbe, 0x3f, 0x00, 0x57, 0x57, 0x0b, 0xa8, 0x9b, 0xdc, 0x39,
+  0xa2, 0xc9, 0x2e, 0x9f, 0x47, 0xcd, 0x92, 0x75, 0xb1, 0xc0, 0xa8, 0x2e,
+  0x8b, 0xaa, 0xc8, 0x6f, 0xd2, 0xa0, 0x50, 0xf0, 0xa5, 0x21, 0x01, 0x8e,
+  0xf8, 0xcf, 0xdb, 0x2b, 0x7c, 0x99, 0xb2, 0xaa, 0x6e, 0xc8, 0x08, 0x58,
+  0x15, 0x78, 0xa7, 0xb7, 0xc6, 0x44, 0x35, 0x14, 0xdb, 0x56, 0x42, 0x4c,
+  0x4b, 0x4a, 0x98, 0x30, 0x7e, 0xa2, 0x81, 0x9d, 0xe0, 0x9a, 0xef, 0x81,
+  0x93, 0x77, 0x3d, 0x76, 0x94, 0xb7, 0xad, 0x78, 0x0f, 0x9a, 0xf4, 0x2e,
+  0x21, 0x6b, 0x3d, 0x20, 0x42, 0x29, 0x06, 0x82, 0x9a, 0x27, 0x06, 0x6e,
+  0xfb, 0x25, 0xa3, 0xa3, 0xc3, 0x23, 0xfb, 0xbb, 0x01, 0x6f, 0x0f, 0x20,
+  0xd5, 0x53, 0xc3, 0x17, 0x87, 0x1d, 0xf4, 0xc1, 0x14, 0xff, 0x6d, 0xb9,
+  0xa1, 0xfe, 0x02, 0xdf, 0xd3, 0xdd, 0x7f, 0x7a, 0x18, 0x59, 0xfc, 0x42,
+  0x33, 0x15, 0x0b, 0x0f, 0xf8, 0x18, 0xab, 0xd5, 0xe4, 0xa6, 0x56, 0x78,
+  0x36, 0x54, 0xf1, 0xa8, 0xf9, 0x74, 0x33, 0x00, 0xa1, 0x65, 0x85, 0xea,
+  0x0a, 0x3a, 0xcc, 0x9e, 0x92, 0x71, 0x3c, 0xb8, 0x83, 0x9e, 0x7f, 0x68,
+  0x6c, 0x19, 0xdc, 0x29, 0x1d, 0x66, 0x0d, 0x82, 0xad, 0x65, 0xcb, 0x5e,
+  0x46, 0x38, 0xe0, 0x55, 0x04, 0x0a, 0x9a, 0xa3, 0x2e, 0xa7, 0xa2, 0xdd,
+  0x8e, 0xfe, 0x14, 0xb7, 0xf7, 0x41, 0x6c, 0x04, 0xe0, 0x6a, 0xd8, 0xc8,
+  0x71, 0x98, 0xcd, 0xec, 0x13, 0x3d, 0xc8, 0x4b, 0xe0, 0xe3, 0x3f, 0x6b,
+  0x2a, 0x10, 0x4a, 0x29, 0x1d, 0x37, 0x5b, 0xc0, 0x18, 0x84, 0xec, 0xc7,
+  0xdc, 0x0b, 0x6d, 0x97, 0x92, 0x47, 0x2f, 0xb4, 0x67, 0x39, 0x16, 0xa2,
+  0xfe, 0x78, 0x81, 0x46, 0xff, 0x1c, 0x66, 0x1d, 0xbc, 0x9e, 0xbe, 0xfb,
+  0x2f, 0xcc, 0x3a, 0xf9, 0x2e, 0xc1, 0xf4, 0x9f, 0xef, 0xbe, 0x3d, 0x33,
+  0xef, 0xfe, 0x3a, 0x7b, 0xf1, 0xd8, 0x02, 0x8c, 0x5c, 0x30, 0x49, 0xfb,
+  0xa0, 0x4b, 0x88, 0xac, 0xea, 0xeb, 0x35, 0x4d, 0x87, 0x1b, 0xbc, 0xe8,
+  0x8d, 0xd6, 0x06, 0x34, 0x6c, 0xd7, 0x05, 0xbd, 0x7b, 0x83, 0xaa, 0xa9,
+  0x91, 0x2d, 0x8e, 0xbd, 0x2a, 0x30, 0x4f, 0xd6, 0xeb, 0xb9, 0x82, 0xcb,
+  0xf0, 0xde, 0x24, 0x79, 0xc8, 0x51, 0xe8, 0x8e, 0xac, 0x30, 0x44, 0xbd,
+  0xfb, 0x31, 0x69, 0x70, 0x16, 0x96, 0xa6, 0x1e, 0x10, 0x7a, 0x70, 0x83,
+  0xb4, 0x3a, 0x94, 0x98, 0xd7, 0x09, 0x16, 0x38, 0x9e, 0xca, 0x6b, 0x4b,
+  0x61, 0x75, 0x04, 0x79, 0x80, 0x61, 0xee, 0xe0, 0xa7, 0x4d, 0xda, 0xa8,
+  0xec, 0xc2, 0x82, 0x2c, 0xa0, 0x10, 0x52, 0xa6, 0x77, 0x16, 0xd4, 0xce,
+  0xdf, 0xde, 0x5a, 0x0a, 0x56, 0xa3, 0x21, 0x7a, 0x1b, 0xa8, 0x1f, 0x77,
+  0xe1, 0x6e, 0xce, 0x47, 0xc2, 0xd1, 0xd2, 0x7b, 0x3c, 0xfa, 0xf4, 0x55,
+  0x3a, 0x0f, 0x9f, 0xba, 0xfa, 0xcd, 0x9b, 0x90, 0x50, 0x95, 0x9d, 0x8e,
+  0x0b, 0xe5, 0x02, 0xd5, 0x5d, 0x58, 0xb9, 0x0a, 0x26, 0x68, 0xcb, 0xbc,
+  0x8b, 0x39, 0x91, 0x7a, 0x8b, 0xed, 0x0d, 0x54, 0x79, 0xf5, 0x92, 0x42,
+  0x86, 0x7e, 0x3b, 0x7e, 0xf7, 0x57, 0x68, 0x6a, 0xf0, 0x61, 0xe4, 0xf5,
+  0x5c, 0x2c, 0x1b, 0xa4, 0x72, 0x8b, 0xbd, 0x45, 0xb7, 0x51, 0x10, 0xb6,
+  0xf0, 0x52, 0x78, 0x0e, 0x5b, 0x9c, 0x04, 0xf8, 0x3a, 0xe5, 0xa3, 0x68,
+  0x18, 0x52, 0x64, 0x11, 0xa9, 0xb6, 0x45, 0x5a, 0xfb, 0xfc, 0xf0, 0x8a,
+  0xe8, 0xf0, 0xbe, 0xa7, 0x5a, 0x4e, 0xd8, 0xa2, 0x37, 0x26, 0x7a, 0x67,
+  0x27, 0x08, 0xab, 0x00, 0x95, 0xbf, 0x51, 0x1a, 0x39, 0x84, 0x10, 0x9a,
+  0x46, 0xcb, 0x03, 0x8c, 0x7b, 0x8c, 0xc0, 0x76, 0x9b, 0x5c, 0x52, 0xb6,
+  0xfe, 0x08, 0x9d, 0x7d, 0xc6, 0xf1, 0xd4, 0xc7, 0x02, 0x37, 0xb6, 0x2b,
+  0x15, 0x9e, 0xfe, 0x81, 0x32, 0x6b, 0x33, 0x28, 0xf9, 0x1c, 0x1b, 0x30,
+  0x56, 0x58, 0x5e, 0x6e, 0x43, 0x8d, 0x89, 0x3a, 0xb7, 0x87, 0x47, 0xb7,
+  0xff, 0x75, 0x9a, 0xf0, 0xc5, 0x93, 0x2f, 0x8b, 0x25, 0x2c, 0x33, 0xe6,
+  0xd7, 0xc5, 0x3a, 0x4b, 0xcb, 0x4b, 0xfd, 0xfe, 0xbf, 0xed, 0x54, 0xd2,
+  0xc9, 0x88, 0x4e, 0xa3, 0x66, 0x0b, 0xbf, 0xcc, 0xba, 0xc0, 0xb4, 0x37,
+  0x58, 0x07, 0xd4, 0x9f, 0xed, 0x6c, 0x35, 0xa0, 0x92, 0xc0, 0x37, 0x9c,
+  0xa8, 0x77, 0xf4, 0x7a, 0x7b, 0x27, 0xf6, 0x74, 0x45, 0xba, 0x3c, 0xd4,
+  0xfc, 0xd5, 0x95, 0x7d, 0x64, 0x27, 0x9a, 0xc6, 0x44, 0x62, 0x64, 0x8f,
+  0xec, 0xb4, 0xbc, 0x4e, 0xaa, 0x6b, 0xb7, 0x10, 0xbc, 0x86, 0xd2, 0x34,
+  0x79, 0xdc, 0x75, 0x03, 0xd5, 0xb7, 0xb3, 0x2b, 0x20, 0x20, 0xe5, 0x29,
+  0x12, 0xdf, 0x89, 0xc7, 0x18, 0xf5, 0xf1, 0x0d, 0x03, 0x5c, 0x6a, 0x01,
+  0x1d, 0xa6, 0xdf, 0x34, 0x0f, 0xbf, 0x19, 0xeb, 0xf1, 0xa9, 0x3f, 0x7e,
+  0xb8, 0x18, 0xfb, 0xdd, 0x8b, 0xe0, 0x33, 0x8b, 0xbd, 0x93, 0x76, 0x31,
+  0xc5, 0x61, 0xb6, 0xb7, 0x1f, 0x70, 0x0d, 0xad, 0xcc, 0x9e, 0x3c, 0x52,
+  0xae, 0x85, 0x8d, 0x39, 0xe0, 0x3a, 0x7f, 0xc9, 0xd0, 0x0a, 0xe3, 0x9b,
+  0x32, 0x85, 0xe6, 0x25, 0x6e, 0x16, 0x30, 0xee, 0x3a, 0x01, 0xd3, 0x3a,
+  0x2e, 0x13, 0xf9, 0x64, 0xba, 0x2b, 0xe6, 0x6f, 0x92, 0x12, 0x2f, 0x98,
+  0xf3, 0x8b, 0x0e, 0x9e, 0xa3, 0x6f, 0x27, 0x0d, 0x4e, 0x61, 0x95, 0x80,
+  0x19, 0xc5, 0x47, 0xee, 0xf8, 0x23, 0x94, 0x6d, 0x6d, 0x93, 0x60, 0x20,
+  0x1e, 0xff, 0x7d, 0x95, 0xa6, 0x21, 0x9d, 0x4a, 0xfe, 0xdf, 0xfc, 0xaa,
+  0xd8, 0x6e, 0x81, 0xd8, 0x55, 0x22, 0x09, 0x01, 0xeb, 0x37, 0x69, 0xea,
+  0xee, 0xa4, 0x18, 0xce, 0x3d, 0xac, 0x3f, 0x96, 0x98, 0x20, 0xc1, 0x2d,
+  0x09, 0xf8, 0x71, 0x9d, 0x95, 0xe9, 0xaa, 0x2e, 0xca, 0x2c, 0xad, 0x38,
+  0x0e, 0x60, 0x88, 0x34, 0xa5, 0x45, 0x06, 0x8f, 0x18, 0x68, 0x9b, 0x0c,
+  0xaa, 0x62, 0xb0, 0x02, 0xd9, 0xbb, 0x2f, 0xfe, 0xda, 0xc3, 0xe2, 0xd4,
+  0xae, 0xa5, 0x98, 0xfa, 0xaf, 0x6f, 0x5d, 0x9c, 0xbc, 0x40, 0x99, 0x41,
+  0x22, 0x9e, 0x1e, 0x5a, 0x24, 0x7c, 0xa9, 0xa3, 0xc0, 0x0c, 0x3d, 0xa7,
+  0x7d, 0xbc, 0x46, 0xad, 0x8f, 0x4e, 0xb4, 0x6d, 0x1a, 0x02, 0x91, 0x09,
+  0x75, 0x9a, 0x7b, 0xeb, 0xc8, 0x17, 0xde, 0x3a, 0x12, 0xab, 0x9d, 0x53,
+  0x3a, 0xcf, 0xa6, 0xda, 0x5a, 0x87, 0xdd, 0x92, 0x1c, 0x27, 0x8f, 0x9a,
+  0x7f, 0x7f, 0x48, 0xcb, 0xbb, 0xd6, 0x16, 0x37, 0x3e, 0xaa, 0xf9, 0x9a,
+  0xab, 0x11, 0x19, 0xff, 0x15, 0x88, 0xa6, 0x4a, 0x34, 0x10, 0x92, 0x1b,
+  0x98, 0x18, 0x26, 0xcf, 0xbd, 0xbe, 0xce, 0x76, 0x4e, 0x5f, 0xa7, 0x8c,
+  0x82, 0x34, 0x49, 0xf0, 0xce, 0x1a, 0xd4, 0x67, 0x3b, 0xb3, 0x7a, 0xc9,
+  0xf8, 0xea, 0xe4, 0xea, 0x9c, 0xe2, 0x04, 0x89, 0x34, 0x06, 0x19, 0xb0,
+  0x4f, 0x2a, 0x54, 0xea, 0x13, 0xf8, 0x65, 0x64, 0xb9, 0xc1, 0xe8, 0xf4,
+  0xf4, 0x63, 0x6f, 0xb6, 0xe4, 0x6a, 0xc3, 0x81, 0x1b, 0xb1, 0x9e, 0xdd,
+  0x61, 0x0b, 0x22, 0x10, 0xc8, 0x60, 0x7c, 0xce, 0x4e, 0xe2, 0x26, 0xa6,
+  0x49, 0x56, 0xab, 0x74, 0xcf, 0xa6, 0x93, 0x0f, 0x9f, 0x9c, 0xf7, 0xf4,
+  0x47, 0xc5, 0xd9, 0x1f, 0xbb, 0x79, 0xa0, 0xf2, 0xb4, 0x0e, 0xdd, 0x24,
+  0xa2, 0x19, 0xc3, 0x95, 0xba, 0x07, 0xef, 0x34, 0x37, 0x13, 0x9d, 0x7b,
+  0x07, 0x19, 0x03, 0x15, 0x8b, 0x01, 0x6f, 0x9d, 0xf4, 0xb0, 0xd5, 0xbd,
+  0x98, 0x4a, 0xbc, 0x24, 0xf0, 0x90, 0xa0, 0xdc, 0x59, 0xee, 0x6a, 0x6b,
+  0x56, 0xa0, 0x1e, 0xf6, 0x31, 0x60, 0xd5, 0xd0, 0xa4, 0x1a, 0xb3, 0xee,
+  0xde, 0x0b, 0xbb, 0xc3, 0x3d, 0x72, 0xac, 0x1b, 0xcd, 0xe4, 0x53, 0x75,
+  0xb8, 0x81, 0xfd, 0x61, 0x09, 0x82, 0x63, 0x18, 0x50, 0x3c, 0x73, 0xba,
+  0x01, 0x1f, 0xc9, 0x35, 0xae, 0x6c, 0xb7, 0x81, 0xd5, 0xd6, 0x46, 0xeb,
+  0xea, 0x81, 0xbc, 0xae, 0xb7, 0x39, 0x43, 0xd2, 0xde, 0xe4, 0x79, 0x3f,
+  0x74, 0x5d, 0xec, 0xfb, 0xd1, 0xda, 0x43, 0x43, 0x50, 0x8c, 0x30, 0xff,
+  0xf9, 0x30, 0x01, 0xeb, 0x74, 0x3b, 0x44, 0xaa, 0xbd, 0x94, 0x2e, 0xae,
+  0x38, 0x8f, 0x30, 0x13, 0xe9, 0x17, 0x07, 0xe0, 0xeb, 0x65, 0x6a, 0x70,
+  0x72, 0x64, 0x30, 0x15, 0x97, 0xe9, 0x06, 0x17, 0x67, 0xbd, 0xc7, 0x06,
+  0x8b, 0x71, 0x8a, 0x4e, 0x4c, 0x59, 0x35, 0x48, 0x81, 0xc2, 0x1e, 0x45,
+  0xc2, 0x75, 0x51, 0xd5, 0x8f, 0x7a, 0xe4, 0x2f, 0xcf, 0xa0, 0x47, 0xb9,
+  0x86, 0x11, 0x7f, 0x24, 0x53, 0xa9, 0xa1, 0x79, 0xfb, 0x02, 0x90, 0x85,
+  0xeb, 0xc3, 0x0f, 0xaa, 0xe5, 0x0a, 0x78, 0x3b, 0xdd, 0x55, 0x07, 0x98,
+  0x39, 0x65, 0x0a, 0x5b, 0xc0, 0x65, 0x7e, 0xc7, 0xc4, 0x90, 0x16, 0xa0,
+  0x53, 0x90, 0xb0, 0x93, 0x41, 0x06, 0xc5, 0x08, 0xad, 0x55, 0x73, 0xcc,
+  0xaa, 0xa2, 0x62, 0xfa, 0xe1, 0x9c, 0x31, 0xf5, 0xc0, 0x1d, 0xd5, 0x00,
+  0xed, 0xef, 0xbf, 0x57, 0x1b, 0xd4, 0xd5, 0xea, 0x88, 0x66, 0x38, 0xd0,
+  0x81, 0x79, 0xfd, 0xf7, 0xd6, 0x26, 0x58, 0xc4, 0x5b, 0x25, 0x01, 0xb3,
+  0xdf, 0x56, 0xa8, 0x2a, 0xcb, 0x84, 0xa8, 0x42, 0x46, 0xa5, 0x90, 0x73,
+  0x4c, 0x14, 0xf0, 0x30, 0xca, 0xb6, 0x43, 0x42, 0x31, 0xe4, 0x60, 0xd9,
+  0x60, 0x4c, 0xfb, 0x32, 0xbd, 0xc9, 0x8a, 0x03, 0x2c, 0x62, 0xbb, 0xf4,
+  0xdc, 0x7c, 0x9a, 0xc0, 0xf6, 0x14, 0x96, 0x33, 0xce, 0x0f, 0x69, 0x71,
+  0x66, 0x15, 0xc2, 0xad, 0x52, 0xb4, 0xa3, 0x2f, 0x41, 0xfb, 0x35, 0x74,
+  0x20, 0x58, 0x17, 0x4a, 0xcc, 0x7c, 0x99, 0x5e, 0x65, 0xbb, 0xb9, 0xc0,
+  0xf3, 0xce, 0x07, 0x85, 0x6e, 0x85, 0xa9, 0x5c, 0x01, 0xa3, 0x7e, 0x80,
+  0xf5, 0x6a, 0x53, 0xe4, 0x79, 0xf1, 0x86, 0xb5, 0x19, 0x7e, 0x16, 0x9c,
+  0x0f, 0x24, 0xe7, 0x1a, 0x21, 0x46, 0x9c, 0xd0, 0x2a, 0x8b, 0x11, 0x17,
+  0x30, 0x8e, 0x78, 0x07, 0xc4, 0xa1, 0xd6, 0x09, 0x5a, 0xdf, 0x39, 0x5e,
+  0xfd, 0x65, 0x7d, 0x27, 0xc6, 0xce, 0xb8, 0xa0, 0xed, 0xa8, 0xe7, 0xef,
+  0xcb, 0x62, 0x7d, 0xc0, 0xf0, 0x70, 0xd0, 0x55, 0x3c, 0x30, 0x86, 0x13,
+  0x64, 0x4d, 0x99, 0x38, 0x32, 0x51, 0x62, 0x61, 0xea, 0xab, 0x24, 0xcb,
+  0x01, 0x14, 0x36, 0x02, 0xf8, 0x6b, 0x09, 0xda, 0xd9, 0x03, 0x49, 0x0f,
+  0x04, 0x0b, 0x42, 0x79, 0xd8, 0xd7, 0xe9, 0x7a, 0x16, 0x56, 0x5a, 0x19,
+  0xe4, 0x42, 0x73, 0xd8, 0xf3, 0x1e, 0x1f, 0x7e, 0x23, 0x9d, 0x67, 0xb4,
+  0x57, 0xc0, 0x93, 0x4a, 0xe9, 0xf4, 0x74, 0x7d, 0x86, 0x6d, 0x8e, 0x86,
+  0x0f, 0x43, 0x40, 0x17, 0x39, 0xc5, 0x01, 0xa4, 0x51, 0x04, 0x2a, 0x92,
+  0xab, 0x04, 0xb4, 0x85, 0x0c, 0x9b, 0x69, 0xaa, 0x1a, 0x23, 0x3f, 0xbf,
+  0x49, 0x28, 0xfe, 0x6b, 0x2d, 0xb1, 0x03, 0x2d, 0x42, 0x5d, 0xc5, 0x25,
+  0x79, 0xda, 0x1c, 0x43, 0x0c, 0x6b, 0x8f, 0xcd, 0x33, 0x4e, 0xc7, 0x64,
+  0x46, 0xa8, 0x58, 0x64, 0x6b, 0x19, 0x54, 0x43, 0x61, 0x88, 0x95, 0x76,
+  0x4b, 0x06, 0xb6, 0x15, 0xea, 0xaf, 0xf9, 0xb4, 0xa3, 0x0b, 0x25, 0xda,
+  0x56, 0x53, 0x0f, 0xeb, 0x18, 0x1b, 0x0a, 0xba, 0x47, 0x13, 0xf1, 0x55,
+  0x81, 0xd9, 0xa4, 0xcd, 0x65, 0xf5, 0x3a, 0x83, 0x8d, 0xd2, 0xba, 0x1f,
+  0x6d, 0xb6, 0x83, 0x21, 0xf1, 0xd0, 0xf2, 0x4e, 0x05, 0xe8, 0x5d, 0x28,
+  0x2f, 0x37, 0x09, 0x4f, 0xb8, 0xd7, 0x47, 0xd1, 0xaa, 0xaa, 0x28, 0x79,
+  0x14, 0xe7, 0x30, 0x21, 0x33, 0x5d, 0x22, 0xb0, 0x58, 0x5b, 0x27, 0xe1,
+  0xb1, 0x04, 0x7a, 0x02, 0x65, 0xed, 0x9f, 0xe9, 0xd8, 0x82, 0x73, 0x04,
+  0x77, 0x76, 0x88, 0x36, 0x53, 0xb7, 0x55, 0xe4, 0x7e, 0xb3, 0x2b, 0x24,
+  0x59, 0x13, 0x6c, 0x60, 0x60, 0xc4, 0xff, 0x08, 0x9b, 0xcf, 0x42, 0x39,
+  0xaf, 0xe2, 0x18, 0xdf, 0x0b, 0x99, 0x23, 0x59, 0xc8, 0xc6, 0x96, 0xf1,
+  0xb8, 0xa4, 0x1d, 0xee, 0x4b, 0x9d, 0xd3, 0x55, 0x6a, 0xd9, 0xc1, 0x2b,
+  0x77, 0x8a, 0x5a, 0x26, 0xf4, 0xe4, 0x99, 0xcc, 0xb9, 0x4c, 0xab, 0x5e,
+  0x2c, 0x80, 0x0f, 0xdf, 0x9c, 0x41, 0x9d, 0xab, 0xb4, 0x51, 0x91, 0xca,
+  0x86, 0xe6, 0x64, 0x22, 0x0d, 0x57, 0x50, 0x54, 0x64, 0x84, 0x43, 0x5b,
+  0x62, 0xc2, 0x8a, 0x2f, 0x08, 0x0b, 0x1d, 0x9c, 0x37, 0x29, 0x0a, 0x21,
+  0xe4, 0x74, 0x52, 0xb3, 0xb0, 0x2c, 0x28, 0xaf, 0x07, 0xbc, 0x8c, 0x4f,
+  0x53, 0x4a, 0x50, 0xf0, 0x90, 0x5c, 0x92, 0x9e, 0x6b, 0xe5, 0x0a, 0x09,
+  0x0a, 0x9e, 0xb3, 0xc4, 0xfa, 0x80, 0x0e, 0xd9, 0x90, 0xe7, 0xc0, 0x19,
+  0xd6, 0x04, 0x3b, 0xca, 0x13, 0x19, 0x01, 0xf2, 0xde, 0x80, 0x61, 0x18,
+  0x2f, 0xe0, 0x7f, 0x0b, 0x6b, 0x47, 0xd0, 0x77, 0x1d, 0x7c, 0xc5, 0x70,
+  0x40, 0xc0, 0x6b, 0x98, 0x4a, 0x53, 0x90, 0x2e, 0xb3, 0x33, 0x7e, 0xe4,
+  0x91, 0x98, 0xb1, 0xf1, 0x03, 0xa4, 0x9d, 0x0d, 0xb8, 0x69, 0x8a, 0x1b,
+  0xcc, 0x96, 0x83, 0xd6, 0x02, 0xd7, 0x03, 0x24, 0x7b, 0x58, 0xcf, 0xae,
+  0xce, 0xcd, 0x27, 0x26, 0x10, 0x75, 0xe8, 0x94, 0x40, 0x0f, 0x3a, 0x74,
+  0x6e, 0xd0, 0xec, 0x20, 0xa6, 0x32, 0xa7, 0xab, 0x50, 0x06, 0xad, 0x8b,
+  0x94, 0x84, 0x54, 0x7a, 0x0b, 0x7a, 0x34, 0xb7, 0x95, 0x1c, 0xd5, 0x5e,
+  0xba, 0xd9, 0xd5, 0xc1, 0x76, 0xce, 0x59, 0x9a, 0x7b, 0x46, 0xf6, 0xdb,
+  0xd6, 0x3c, 0x7c, 0xfa, 0xf6, 0xad, 0x19, 0x43, 0x5d, 0x64, 0x37, 0xe8,
+  0xc2, 0xa1, 0xbe, 0xf5, 0xc1, 0x2c, 0x0a, 0x85, 0x39, 0x4c, 0x21, 0xbb,
+  0x48, 0xcc, 0xed, 0x74, 0xb2, 0x69, 0x87, 0x9b, 0x73, 0x2e, 0x00, 0x3e,
+  0x31, 0x72, 0xba, 0x91, 0xac, 0x71, 0xd9, 0xc9, 0xc9, 0x12, 0x96, 0xed,
+  0xaa, 0x9a, 0xb2, 0x65, 0x6e, 0x0c, 0x45, 0x4c, 0xc5, 0x2f, 0x48, 0x66,
+  0xb2, 0x02, 0x21, 0x5b, 0xd9, 0x3e, 0x59, 0xa7, 0x64, 0x04, 0x2a, 0x76,
+  0x8a, 0x45, 0x03, 0x3a, 0xd0, 0x5a, 0x1b, 0x08, 0x30, 0x42, 0xe3, 0xe3,
+  0x80, 0x86, 0x57, 0xd9, 0x9a, 0xf9, 0xfd, 0x97, 0x5f, 0xbc, 0x3a, 0xf7,
+  0x23, 0x7c, 0x93, 0x05, 0xcb, 0x37, 0xa4, 0x5c, 0x92, 0x06, 0xf0, 0xfd,
+  0x21, 0x4b, 0xc9, 0x51, 0x29, 0x58, 0x79, 0xde, 0x25, 0xb3, 0x11, 0x08,
+  0x07, 0x67, 0x34, 0xf1, 0xee, 0x1d, 0x21, 0x4f, 0x7c, 0x84, 0x11, 0x22,
+  0x92, 0xf5, 0x9c, 0x7e, 0x3c, 0x82, 0x6e, 0xdd, 0xad, 0x93, 0x32, 0x10,
+  0x6a, 0x9a, 0x64, 0xd5, 0x68, 0x5e, 0x73, 0x44, 0x8b, 0xe0, 0xce, 0x35,
+  0x4e, 0xbc, 0x65, 0x1e, 0x7f, 0xa4, 0x4f, 0x73, 0xca, 0xc6, 0x3c, 0x87,
+  0xe7, 0xad, 0x39, 0x9d, 0x3e, 0xfc, 0xe6, 0x4b, 0x76, 0x77, 0x79, 0xf8,
+  0xcd, 0x57, 0x98, 0x38, 0x71, 0x46, 0xc5, 0x67, 0x26, 0xc5, 0xd3, 0x58,
+  0xbd, 0x68, 0x43, 0x27, 0xb2, 0xc7, 0x89, 0x28, 0x5f, 0x9d, 0x11, 0xc0,
+  0x85, 0x00, 0x90, 0xf6, 0x15, 0xbf, 0xe3, 0x0e, 0xf0, 0x43, 0x68, 0xf7,
+  0x56, 0xa6, 0x9c, 0xdb, 0x4b, 0x98, 0x74, 0xd0, 0x78, 0xd1, 0x43, 0x12,
+  0xce, 0xc6, 0x90, 0x20, 0x7a, 0xa3, 0xe3, 0x61, 0x7a, 0xb0, 0xc3, 0xea,
+  0x67, 0x79, 0x35, 0x54, 0xca, 0x22, 0x66, 0xf7, 0xc7, 0xda, 0xae, 0x16,
+  0xa3, 0x2f, 0x92, 0xf2, 0x35, 0x4b, 0x3a, 0xe2, 0x40, 0x4c, 0xfc, 0xea,
+  0x16, 0xcd, 0x68, 0x82, 0xf0, 0x6e, 0xfc, 0x3a, 0xb9, 0x49, 0x69, 0x19,
+  0x87, 0x3e, 0x1b, 0xc9, 0xe6, 0x38, 0x32, 0xec, 0x31, 0xd5, 0x7f, 0x03,
+  0x6d, 0x30, 0x36, 0x3a, 0x27, 0xac, 0x62, 0xd9, 0xd9, 0x41, 0xda, 0x45,
+  0x2d, 0xcb, 0x07, 0xac, 0x13, 0x72, 0x50, 0x61, 0xad, 0x49, 0x77, 0xbc,
+  0x94, 0x24, 0x1c, 0x48, 0x5c, 0x55, 0x05, 0x4c, 0x36, 0x01, 0x4b, 0x43,
+  0x5a, 0x87, 0xd6, 0x82, 0xd5, 0x1a, 0xb3, 0x7f, 0xe9, 0x26, 0xf1, 0x1a,
+  0x7a, 0x20, 0x4f, 0x4b, 0xda, 0xa1, 0xeb, 0x26, 0x99, 0x2f, 0xe2, 0x18,
+  0x13, 0x18, 0x7c, 0x70, 0xb3, 0xa4, 0x52, 0x63, 0x9f, 0xd4, 0xd7, 0xa8,
+  0xf1, 0xef, 0x91, 0x82, 0x19, 0xfd, 0x83, 0x4c, 0xe0, 0xfc, 0x44, 0xd5,
+  0x79, 0xcc, 0x7e, 0x39, 0xe1, 0x78, 0xf4, 0x5a, 0xd0, 0x5c, 0x3a, 0xd2,
+  0x2d, 0xb6, 0xb9, 0x7b, 0xa7, 0xe5, 0xb0, 0xa4, 0x62, 0xbd, 0xc4, 0xad,
+  0x95, 0x07, 0x4d, 0x3f, 0x5d, 0x05, 0x16, 0x6c, 0x0d, 0xd2, 0x0b, 0x13,
+  0x39, 0x3a, 0xb4, 0xfc, 0x62, 0x9d, 0x69, 0x34, 0x41, 0x4b, 0x27, 0xae,
+  0x47, 0xec, 0xa3, 0xb2, 0x5a, 0x53, 0x9f, 0x5c, 0x22, 0x94, 0xd9, 0xca,
+  0xd6, 0x51, 0x9d, 0xd3, 0x50, 0x15, 0x52, 0x6c, 0xec, 0xac, 0x42, 0x68,
+  0x1e, 0x7e, 0x60, 0x70, 0xa4, 0xd2, 0xab, 0xb2, 0xc0, 0x58, 0x86, 0xab,
+  0xfc, 0x72, 0x75, 0x4d, 0xf7, 0x62, 0x84, 0x26, 0xbb, 0xa9, 0x48, 0x6f,
+  0xeb, 0xcb, 0xd5, 0xda, 0x7f, 0xbf, 0x3d, 0xe8, 0x11, 0x35, 0x7e, 0xd3,
+  0x90, 0xae, 0xb6, 0xfd, 0x33, 0x1f, 0x16, 0xe7, 0xd5, 0x8e, 0x11, 0xad,
+  0xa0, 0x0e, 0x28, 0x36, 0x97, 0xf1, 0x6f, 0xe9, 0xb0, 0x87, 0x1f, 0x5c,
+  0xe1, 0x8e, 0xa8, 0xca, 0x2e, 0x1b, 0xc4, 0x20, 0x0a, 0x62, 0x09, 0x18,
+  0x74, 0xa2, 0x15, 0x03, 0xe1, 0xb4, 0xa2, 0xc8, 0x0f, 0xab, 0x0c, 0x7d,
+  0xad, 0x01, 0x0a, 0x0b, 0xa0, 0x38, 0x6b, 0x03, 0xe3, 0xcd, 0x57, 0xb5,
+  0x44, 0xe7, 0xa1, 0xec, 0xb6, 0x51, 0x9f, 0x7c, 0xa6, 0xb4, 0xa0, 0xda,
+  0x42, 0x6f, 0x4c, 0xe8, 0x45, 0xf5, 0x88, 0x10, 0x60, 0x27, 0xec, 0x28,
+  0xf1, 0x83, 0xe3, 0x90, 0xd0, 0x52, 0xfe, 0xc9, 0xbb, 0x4f, 0x46, 0x5e,
+  0x5d, 0x57, 0x69, 0xbd, 0x7a, 0x83, 0x27, 0xf8, 0x8f, 0x47, 0x76, 0x30,
+  0x56, 0x58, 0x1d, 0xf6, 0x10, 0x7c, 0xf1, 0xc8, 0x48, 0x5b, 0xfa, 0x43,
+  0x59, 0x1b, 0x26, 0xcb, 0x73, 0xf3, 0xfb, 0xcd, 0x26, 0x43, 0x37, 0x19,
+  0x50, 0xe8, 0xb0, 0xef, 0x24, 0x4e, 0x77, 0x45, 0x85, 0x5c, 0x19, 0x50,
+  0x66, 0x8a, 0xe2, 0xdc, 0xfc, 0x92, 0x0f, 0x10, 0x8c, 0x6c, 0x2f, 0x43,
+  0x4c, 0xd5, 0x35, 0x89, 0x5b, 0x56, 0x3d, 0xd6, 0xe9, 0x32, 0x83, 0x0d,
+  0x0b, 0x0a, 0x98, 0xc3, 0x12, 0x16, 0xb7, 0x03, 0x1e, 0xe6, 0x62, 0x92,
+  0xe9, 0x8a, 0x62, 0xdb, 0xfd, 0x26, 0x5d, 0x9a, 0xa7, 0x4f, 0x2e, 0xfe,
+  0x79, 0xa6, 0xab, 0xe5, 0xb9, 0x37, 0x7c, 0xb7, 0x71, 0x5f, 0x5e, 0x1d,
+  0xd5, 0x95, 0x04, 0x4f, 0x52, 0x3e, 0x30, 0xae, 0x1d, 0x59, 0x92, 0xab,
+  0x9a, 0xa3, 0xaa, 0xa6, 0x5c, 0xcd, 0xfc, 0x8b, 0xdc, 0xea, 0x71, 0x21,
+  0xd2, 0xe2, 0x78, 0x89, 0x79, 0x85, 0xc6, 0x1a, 0x07, 0x00, 0x7a, 0x7b,
+  0xe6, 0xd6, 0x02, 0xdf, 0x5b, 0x72, 0xf4, 0xd9, 0x6e, 0x53, 0x5c, 0x92,
+  0x4c, 0xab, 0xaf, 0xb7, 0xf9, 0xf9, 0x6a, 0xbf, 0xbf, 0x34, 0xbf, 0x42,
+  0x26, 0x94, 0xed, 0xac, 0x11, 0x5e, 0xa3, 0x29, 0xb8, 0x3e, 0xd0, 0xc4,
+  0x4b, 0x9c, 0xca, 0x4c, 0xde, 0x24, 0xa0, 0xd5, 0xa2, 0x62, 0x61, 0xf7,
+  0xfa, 0xe2, 0x37, 0x21, 0xbb, 0xb6, 0x6a, 0x7f, 0x4e, 0x3b, 0x15, 0xec,
+  0x01, 0x32, 0xc5, 0xf2, 0xec, 0xd5, 0x6e, 0x6c, 0x1a, 0x6e, 0x2a, 0xcf,
+  0x32, 0xc8, 0x82, 0x60, 0xba, 0x9a, 0x59, 0xb9, 0xe7, 0x56, 0xb4, 0x3f,
+  0xf2, 0x59, 0x07, 0xd0, 0x4b, 0xbb, 0x75, 0x4f, 0x12, 0x7b, 0x34, 0xcb,
+  0xfc, 0xc0, 0x6d, 0xa3, 0xe8, 0xd3, 0x3c, 0xc5, 0x50, 0x31, 0x96, 0xe6,
+  0x60, 0x2b, 0xa3, 0x06, 0x5d, 0xbe, 0x9b, 0xbc, 0xfb, 0x99, 0xb5, 0x43,
+  0x48, 0xcd, 0x62, 0x96, 0x7e, 0x62, 0x56, 0x2d, 0x9e, 0x71, 0xe1, 0xd2,
+  0x41, 0x46, 0x13, 0xf2, 0xf4, 0x37, 0xa1, 0x05, 0xc4, 0x4f, 0xc9, 0x8c,
+  0xa2, 0x17, 0xe3, 0x91, 0x03, 0x2b, 0xec, 0x9c, 0xfe, 0x77, 0x5c, 0x44,
+  0xb8, 0x9d, 0x8d, 0x05, 0x37, 0x12, 0x87, 0x7c, 0xc1, 0x5a, 0x23, 0x56,
+  0xbe, 0x66, 0x3a, 0xcd, 0x8d, 0xe2, 0xc5, 0x93, 0x23, 0xcc, 0x83, 0xf3,
+  0x44, 0x32, 0x58, 0x49, 0xb8, 0x27, 0x02, 0x43, 0xd6, 0xf0, 0x4b, 0xd1,
+  0x09, 0x31, 0xbe, 0x9c, 0x43, 0x81, 0x8b, 0x58, 0x91, 0x1d, 0x7b, 0x4d,
+  0x9b, 0xe2, 0x40, 0xf0, 0x89, 0x32, 0xc5, 0x53, 0x14, 0x43, 0x1c, 0xf9,
+  0x88, 0x6f, 0x93, 0x3d, 0xed, 0x6c, 0x00, 0xc4, 0xdd, 0xfa, 0x11, 0xb1,
+  0xee, 0x50, 0x5c, 0x72, 0x24, 0x31, 0xf5, 0x89, 0xad, 0x60, 0x33, 0x97,
+  0xb3, 0x27, 0x32, 0x0a, 0xfa, 0x1d, 0x6d, 0x8e, 0x5c, 0x8c, 0x71, 0x4e,
+  0x63, 0x0b, 0x75, 0x4e, 0xc7, 0xe4, 0x0e, 0x82, 0xb8, 0xa3, 0x4b, 0x80,
+  0x18, 0x55, 0x8c, 0x2e, 0x84, 0xb0, 0x03, 0x3e, 0x1d, 0x67, 0x39, 0xb0,
+  0x00, 0x47, 0xdb, 0xfd, 0x77, 0x55, 0x1c, 0x63, 0x3f, 0x13, 0x9b, 0x24,
+  0x31, 0x1c, 0x1b, 0xff, 0xf6, 0xae, 0x57, 0x57, 0xa8, 0x45, 0x79, 0x91,
+  0x29, 0xc3, 0xd2, 0x1c, 0xa3, 0xd2, 0x3f, 0x84, 0x2f, 0x8b, 0x37, 0x73,
+  0xc9, 0xeb, 0x64, 0x6f, 0xb3, 0xc3, 0x3b, 0x49, 0x49, 0x23, 0xf0, 0xec,
+  0xee, 0x92, 0x37, 0x00, 0xe1, 0xdd, 0x61, 0xbb, 0x6b, 0xc2, 0x6e, 0xdd,
+  0x35, 0x19, 0xe0, 0x72, 0xdb, 0xb6, 0x53, 0xbd, 0xbc, 0xef, 0xd3, 0x4d,
+  0x05, 0x76, 0xd6, 0xd7, 0xd8, 0xfb, 0x24, 0x26, 0xff, 0x12, 0x73, 0x74,
+  0x8b, 0x07, 0x63, 0xe3, 0xb2, 0x92, 0x25, 0xa5, 0x2e, 0x93, 0x5d, 0x05,
+  0x6b, 0x82, 0xc4, 0xd9, 0x7c, 0x70, 0x02, 0x2d, 0x43, 0x25, 0x76, 0x63,
+  0xb6, 0x66, 0x17, 0x97, 0x82, 0x7d, 0xa6, 0x6b, 0xf7, 0xe9, 0x18, 0x6d,
+  0xb6, 0xf6, 0x5a, 0x93, 0xd7, 0x21, 0xef, 0x31, 0x35, 0xb2, 0x59, 0x83,
+  0x44, 0xa8, 0xcc, 0xf5, 0x5d, 0x54, 0x99, 0xd7, 0xa9, 0x47, 0x57, 0xb6,
+  0xed, 0xa9, 0xcc, 0x12, 0xdf, 0xd2, 0x1a, 0x3d, 0x8a, 0xf7, 0x5e, 0xf9,
+  0xf2, 0x00, 0xa7, 0x9e, 0x8d, 0xae, 0x60, 0x61, 0x44, 0xc7, 0x39, 0xaa,
+  0x6b, 0xfc, 0x19, 0x8d, 0xa3, 0xe8, 0x90, 0x98, 0x5d, 0x83, 0x52, 0xdb,
+  0xf2, 0x96, 0xae, 0x50, 0x4a, 0xbd, 0x57, 0x21, 0xa5, 0x5b, 0x47, 0xa9,
+  0x85, 0x09, 0x28, 0x1d, 0xe8, 0xd7, 0x98, 0x52, 0x87, 0xc4, 0x6c, 0x9b,
+  0x03, 0x98, 0x04, 0x9d, 0xe6, 0x60, 0xdb, 0x28, 0xa7, 0xda, 0x46, 0xa3,
+  0x80, 0xac, 0x63, 0xe4, 0x80, 0xce, 0x91, 0x07, 0xd6, 0xef, 0xcb, 0x0a,
+  0x82, 0x72, 0xe6, 0x8d, 0x5d, 0x4f, 0x4f, 0x94, 0xd6, 0xb5, 0xeb, 0xa4,
+  0x21, 0x1c, 0x9a, 0x24, 0x58, 0x07, 0x5e, 0xc9, 0xf2, 0x1c, 0x48, 0xac,
+  0xc1, 0xb9, 0xe5, 0xe1, 0x71, 0x1f, 0x65, 0xd6, 0xf6, 0xf2, 0xa3, 0xdf,
+  0x7c, 0x3f, 0x27, 0x38, 0xbb, 0xa4, 0x39, 0x67, 0x14, 0x17, 0x2e, 0xa3,
+  0x0c, 0xea, 0xf0, 0x18, 0x33, 0x92, 0x22, 0x82, 0x1f, 0xc5, 0x85, 0x54,
+  0x00, 0xb0, 0x3c, 0x2c, 0xf8, 0x72, 0x90, 0xff, 0x82, 0x81, 0x89, 0x09,
+  0xa3, 0xf7, 0x3e, 0x53, 0xf5, 0xd7, 0x0c, 0x90, 0xad, 0x35, 0x07, 0xd7,
+  0xbb, 0xd5, 0x05, 0x27, 0xea, 0x08, 0x2e, 0x13, 0xc8, 0x41, 0x2e, 0x2d,
+  0xb7, 0xbb, 0x79, 0x65, 0x54, 0xa7, 0xfb, 0x53, 0x7f, 0x71, 0x84, 0xb5,
+  0x22, 0xbd, 0x21, 0x37, 0x48, 0x56, 0x09, 0x3e, 0x47, 0x07, 0x54, 0x5c,
+  0xed, 0xc4, 0x29, 0xc4, 0xb9, 0x9b, 0x62, 0x68, 0x7c, 0x5a, 0x29, 0x57,
+  0xe4, 0x30, 0x72, 0x0e, 0x0f, 0xb4, 0xa0, 0x0f, 0x38, 0x66, 0xbd, 0x87,
+  0x5b, 0x16, 0x5d, 0xe7, 0xf1, 0x17, 0xb8, 0xf7, 0xf2, 0x34, 0x92, 0x56,
+  0x87, 0xde, 0x26, 0xaa, 0xd4, 0x94, 0xe8, 0x70, 0x3b, 0x5f, 0x5d, 0xa7,
+  0xab, 0xd7, 0x40, 0xe1, 0xce, 0x8b, 0x24, 0xdd, 0xd8, 0xb8, 0xcb, 0x57,
+  0xf9, 0x5c, 0xab, 0x23, 0x40, 0x73, 0xe3, 0x8d, 0xbe, 0xbb, 0x95, 0x59,
+  0x66, 0x35, 0x50, 0x5d, 0xb1, 0xf0, 0xc5, 0xab, 0x82, 0x15, 0x1f, 0xe4,
+  0x53, 0xc0, 0x3a, 0xbc, 0x7d, 0x78, 0x2e, 0xc5, 0xbf, 0x2e, 0xd6, 0xa0,
+  0xd2, 0x7e, 0x99, 0xee, 0xf3, 0x84, 0x4c, 0xb3, 0x99, 0xbb, 0x25, 0x40,
+  0x47, 0x22, 0xaa, 0xef, 0x5f, 0x27, 0xf9, 0x06, 0x9a, 0x70, 0x47, 0xf7,
+  0x76, 0xb7, 0xd9, 0x0f, 0xa0, 0xb6, 0x7e, 0xfe, 0xd9, 0x57, 0xaf, 0x80,
+  0xb5, 0xd6, 0x69, 0x98, 0xe4, 0xc7, 0x25, 0x65, 0x28, 0xb6, 0x8b, 0x6c,
+  0x7b, 0xc5, 0xb5, 0x8b, 0x33, 0x9d, 0xc8, 0x1f, 0x6a, 0xa2, 0xbf, 0x47,
+  0x0f, 0xe2, 0xb1, 0xd6, 0xd7, 0x78, 0x4e, 0x4f, 0xa4, 0x1a, 0xab, 0x55,
+  0x0e, 0xe7, 0xa6, 0x08, 0xb0, 0x34, 0xb3, 0x47, 0x78, 0x97, 0x7c, 0x3d,
+  0x30, 0x4e, 0x37, 0xb1, 0xee, 0x4e, 0x52, 0xd1, 0x28, 0xf2, 0xd2, 0x91,
+  0x14, 0x6b, 0x3e, 0x78, 0x37, 0xe5, 0x84, 0xc3, 0xc1, 0xb3, 0x20, 0x24,
+  0xbd, 0xea, 0x36, 0x76, 0x37, 0x73, 0xf0, 0x4f, 0x7d, 0x95, 0xc8, 0xf7,
+  0x99, 0x7a, 0x3e, 0x32, 0xb7, 0x4f, 0x1b, 0x0a, 0x93, 0xe4, 0x03, 0x6c,
+  0x82, 0x3a, 0xd3, 0xa0, 0xdf, 0xc3, 0xd1, 0xa1, 0x21, 0x75, 0x28, 0xf6,
+  0xec, 0x63, 0xee, 0x61, 0xdb, 0x0e, 0xea, 0x98, 0x07, 0x4e, 0x7a, 0x52,
+  0xac, 0x90, 0x2a, 0x4d, 0xca, 0xd5, 0x35, 0x5e, 0x80, 0xb3, 0x07, 0xee,
+  0x59, 0xad, 0x27, 0xfd, 0x12, 0x26, 0x22, 0xfa, 0x66, 0x79, 0xf2, 0x37,
+  0xc8, 0x75, 0x9f, 0xe6, 0x59, 0x52, 0xc1, 0x7e, 0xa3, 0x20, 0x13, 0x68,
+  0x82, 0xf6, 0xe5, 0x1a, 0x4d, 0xa3, 0x6c, 0xd3, 0xa2, 0x0d, 0x72, 0xb1,
+  0x31, 0xc5, 0xa1, 0xb4, 0x0c, 0x07, 0x9b, 0x91, 0x7d, 0x82, 0x3d, 0x8f,
+  0xe6, 0x53, 0xc7, 0x53, 0xa0, 0xbe, 0x62, 0x47, 0xce, 0x91, 0xa1, 0xdc,
+  0xfd, 0xb7, 0xa9, 0x9b, 0x2d, 0xf1, 0x5e, 0x91, 0xfc, 0x85, 0xa7, 0x0a,
+  0x39, 0xe7, 0xde, 0x9e, 0xbb, 0xac, 0x84, 0xc6, 0x9b, 0x4a, 0x81, 0xbe,
+  0x1e, 0xd4, 0x24, 0x4d, 0x6b, 0xad, 0x50, 0x8e, 0x50, 0xa6, 0xd2, 0xbf,
+  0x94, 0x59, 0x6f, 0x0e, 0x4a, 0x39, 0xda, 0x82, 0x6e, 0xc4, 0x8f, 0x39,
+  0xc5, 0x63, 0x68, 0xf6, 0x1a, 0x71, 0x41, 0x4d, 0xe5, 0x12, 0xac, 0x96,
+  0x83, 0x9f, 0xec, 0x1c, 0x7b, 0x63, 0x2e, 0x93, 0xdd, 0x1d, 0xfe, 0x36,
+  0xb5, 0x2c, 0x85, 0x27, 0xca, 0x41, 0x5e, 0x78, 0x60, 0x79, 0x8b, 0x9e,
+  0x39, 0x65, 0xed, 0x45, 0x8b, 0xbf, 0x41, 0x07, 0x6d, 0xa2, 0xf7, 0xf2,
+  0x92, 0x1d, 0xb5, 0x67, 0x1e, 0xb8, 0x6f, 0x86, 0xf8, 0x13, 0xcb, 0x3b,
+  0xf4, 0x78, 0xfe, 0xb3, 0xef, 0x78, 0xda, 0xd2, 0x10, 0xe4, 0xb8, 0x1b,
+  0x6b, 0x9e, 0x17, 0x8e, 0x26, 0x31, 0xbb, 0xe5, 0xb4, 0x17, 0x85, 0x4d,
+  0x7d, 0x01, 0xb5, 0xe2, 0x45, 0x05, 0x6a, 0x8a, 0x23, 0x84, 0x12, 0x31,
+  0xb8, 0x88, 0x3d, 0x7d, 0xa0, 0x24, 0x2f, 0x3d, 0xb7, 0x40, 0xb5, 0xd3,
+  0x11, 0x0e, 0xdd, 0x6a, 0xa0, 0xcb, 0xe5, 0xe9, 0x96, 0x4f, 0x34, 0x77,
+  0x35, 0x6c, 0x57, 0x41, 0x0d, 0x58, 0x41, 0x47, 0xe0, 0x61, 0x25, 0x7b,
+  0xaa, 0xa9, 0x75, 0x5e, 0xdc, 0xcf, 0xc4, 0x8c, 0xe8, 0x95, 0xb7, 0xa3,
+  0x49, 0x1e, 0x99, 0x19, 0x3d, 0xe2, 0xf9, 0x35, 0x6c, 0xa7, 0xef, 0xce,
+  0xf0, 0xca, 0x03, 0x34, 0x10, 0xd8, 0x30, 0x59, 0xe3, 0xfd, 0x07, 0x3c,
+  0x70, 0xa2, 0x9e, 0xce, 0x38, 0xee, 0xad, 0x22, 0x61, 0x6e, 0xde, 0xa1,
+  0xe8, 0x63, 0x66, 0x56, 0x63, 0x26, 0xa5, 0x4b, 0x24, 0xfb, 0x3b, 0x99,
+  0xdc, 0xd8, 0x86, 0x59, 0x65, 0xf5, 0x21, 0x61, 0xc7, 0x44, 0xed, 0x89,
+  0xc6, 0xf8, 0x71, 0x57, 0x99, 0x53, 0x66, 0x55, 0xef, 0x5c, 0x89, 0xfb,
+  0x5b, 0xf8, 0x12, 0xb5, 0x20, 0xea, 0x96, 0xad, 0xcd, 0x2b, 0x62, 0xed,
+  0x80, 0x0d, 0x94, 0x52, 0xa6, 0x95, 0x31, 0xb4, 0x90, 0xcf, 0x18, 0x53,
+  0xc7, 0x18, 0xb3, 0x23, 0x18, 0x43, 0xd1, 0xcf, 0x3c, 0x6f, 0x5a, 0xcd,
+  0xf5, 0x6a, 0x46, 0x6a, 0x9d, 0x18, 0xc5, 0x3b, 0x62, 0x3b, 0x29, 0x2b,
+  0x98, 0xb3, 0x49, 0x7d, 0xc0, 0x15, 0xce, 0x9b, 0x57, 0xb4, 0x14, 0x92,
+  0xff, 0x06, 0x33, 0x08, 0x4f, 0x17, 0x6f, 0x5f, 0xbe, 0x91, 0x23, 0x26,
+  0x09, 0xd8, 0x33, 0x6d, 0x97, 0x0d, 0xde, 0x42, 0x8a, 0xe3, 0xf5, 0xe9,
+  0xe7, 0x5f, 0x7d, 0x7a, 0x69, 0x5e, 0x15, 0x30, 0xf9, 0x97, 0x39, 0xba,
+  0x0e, 0x88, 0x4d, 0x5a, 0xe1, 0xff, 0x55, 0xa5, 0x65, 0xef, 0xfc, 0x77,
+  0x21, 0x27, 0xac, 0x2b, 0xe5, 0xef, 0x88, 0xdd, 0xa0, 0x07, 0xdf, 0xa4,
+  0x6c, 0x7c, 0x97, 0x7b, 0x7e, 0xaa, 0xb9, 0xd0, 0xca, 0x2b, 0xa7, 0x93,
+  0xa6, 0x4c, 0xdf, 0x94, 0x98, 0x79, 0x5d, 0xd8, 0xc2, 0xe2, 0xc5, 0x32,
+  0x84, 0x4d, 0x26, 0xc8, 0xe3, 0xaa, 0x5c, 0x3d, 0xde, 0xe2, 0xdb, 0xf3,
+  0x9c, 0x92, 0x38, 0xbb, 0xec, 0xaa, 0xde, 0x0d, 0x3e, 0xb2, 0xca, 0x59,
+  0xef, 0x1d, 0xf1, 0xda, 0xdb, 0x80, 0xe0, 0x24, 0x54, 0x58, 0x9a, 0x8d,
+  0x4f, 0xd2, 0xd4, 0x7d, 0xb2, 0x7a, 0x8d, 0xd1, 0x06, 0x2a, 0x3e, 0xaf,
+  0xf5, 0xfd, 0xba, 0x2d, 0x4e, 0xba, 0x09, 0x45, 0x7e, 0xb5, 0xe2, 0x33,
+  0x41, 0xa8, 0x9c, 0xf7, 0x5e, 0xb3, 0x42, 0x3a, 0x31, 0xac, 0xce, 0x6d,
+  0x7f, 0xfc, 0x11, 0x30, 0xe7, 0x50, 0x05, 0xfa, 0x66, 0x81, 0x56, 0x17,
+  0xb9, 0x91, 0xfa, 0x62, 0x1f, 0x9f, 0x95, 0x26, 0x3a, 0xae, 0xb5, 0x10,
+  0x1b, 0x58, 0x22, 0x08, 0x19, 0xbb, 0x1f, 0xe0, 0x31, 0xbb, 0xf4, 0x2a,
+  0xaa, 0x23, 0x3b, 0x4e, 0x3c, 0x28, 0x45, 0xcf, 0xfd, 0x44, 0xd4, 0x72,
+  0xb0, 0x2f, 0xc3, 0xb6, 0x03, 0x6d, 0x23, 0x5d, 0xd3, 0xc5, 0xcb, 0xea,
+  0x91, 0x79, 0x62, 0x46, 0xff, 0x06, 0x63, 0xb5, 0x05, 0x19, 0xcb, 0x97,
+  0x9b, 0xec, 0xf1, 0x2f, 0xea, 0x58, 0x0c, 0x7b, 0xe6, 0x2e, 0x4f, 0xfc,
+  0xab, 0x7f, 0xe5, 0x32, 0xbe, 0x78, 0x7d, 0x8a, 0x08, 0x16, 0x45, 0x99,
+  0x5d, 0x61, 0x74, 0xb7, 0x85, 0xd6, 0x38, 0x6b, 0x81, 0xa4, 0x65, 0xd2,
+  0xae, 0xae, 0xad, 0x3a, 0x20, 0xaf, 0xa4, 0x53, 0x17, 0x84, 0xea, 0x81,
+  0x15, 0x75, 0x51, 0x27, 0x2a, 0xa3, 0x51, 0x01, 0x4e, 0xb4, 0x79, 0xfe,
+  0xc0, 0xa9, 0x46, 0x2f, 0x3a, 0x1b, 0x4f, 0x39, 0xa4, 0xbc, 0xd0, 0x64,
+  0x9d, 0x4e, 0x7c, 0x5d, 0x1f, 0xd5, 0x61, 0x0a, 0x4f, 0xb8, 0x00, 0xa5,
+  0x4b, 0x38, 0x71, 0xa4, 0xd7, 0x14, 0xe1, 0xed, 0x8e, 0x94, 0xd1, 0xac,
+  0x38, 0xf6, 0x5b, 0x54, 0xa5, 0x58, 0x53, 0x86, 0xb6, 0x35, 0x73, 0x66,
+  0x3b, 0xce, 0x6e, 0x1e, 0x24, 0x17, 0xa9, 0x21, 0x93, 0x17, 0xc6, 0x00,
+  0x9c, 0x43, 0x27, 0xd4, 0xe9, 0x0a, 0x0f, 0x10, 0xa7, 0xed, 0xa3, 0xd8,
+  0xc8, 0xe8, 0xe2, 0x3a, 0x0e, 0x75, 0x6d, 0x9c, 0x60, 0x76, 0x72, 0x69,
+  0x15, 0x97, 0xe6, 0x6b, 0xf4, 0x3a, 0xb0, 0x03, 0xa5, 0xc2, 0xc0, 0xfa,
+  0x3c, 0xc5, 0x05, 0x18, 0x19, 0x1d, 0xe4, 0xd1, 0x51, 0x99, 0x9b, 0x8c,
+  0x09, 0x87, 0x95, 0xe1, 0x8b, 0x16, 0x80, 0x07, 0x27, 0x23, 0xcf, 0x8d,
+  0xf3, 0x68, 0x0c, 0x61, 0x7f, 0xd0, 0xd9, 0x15, 0xc6, 0x0b, 0x13, 0x31,
+  0xc0, 0x16, 0xd2, 0xc6, 0x9e, 0xfb, 0x1e, 0xba, 0xfe, 0xc7, 0xca, 0xe4,
+  0x61, 0x4f, 0xea, 0xd4, 0xef, 0xe9, 0x44, 0x53, 0xb5, 0x49, 0x0c, 0x38,
+  0xc2, 0x5e, 0xfa, 0xe4, 0x8d, 0xbc, 0x4b, 0xdf, 0x98, 0xab, 0xbc, 0x58,
+  0x26, 0xbe, 0x63, 0xb2, 0x74, 0x34, 0x1f, 0x59, 0xe2, 0x42, 0x8d, 0xcb,
+  0xb7, 0xe7, 0x19, 0x7e, 0x2a, 0xae, 0x53, 0xe1, 0xdd, 0x14, 0xb3, 0x49,
+  0x69, 0xb9, 0xa0, 0xbd, 0x46, 0x1f, 0xb9, 0x0f, 0xda, 0xad, 0xe4, 0x21,
+  0xfd, 0x42, 0x6e, 0xec, 0x2b, 0x37, 0x7b, 0xf0, 0x7f, 0x01, 0x0e, 0x7a,
+  0xb0, 0xd1, 0x0b, 0x3c, 0x01, 0x00
 };
-unsigned int wxMathML_lisp_gz_len = 19420;
+unsigned int wxMathML_lisp_gz_len = 20406;
@@ -499,7 +499,7 @@
   (defprop mprogn (("<mrow><p>") "</p></mrow>") wxxmlsym)
 
   (defprop mlist wxxml-matchfix wxxml)
-  (defprop mlist (("<mrow list=\"true\"><t listdelim=\"true\">[</t>")"<t >]</t></mrow>") wxxmlsym)
+  (defprop mlist (("<mrow list=\"true\"><t listdelim=\"true\">[</t>")"<t listdelim=\"true\">]</t></mrow>") wxxmlsym)
 
   (defprop $set wxxml-matchfix wxxml)
   (defprop $set (("<mrow><t>{</t>")"<t>}</t></mrow>") wxxmlsym)
@@ -1969,11 +1969,20 @@
     (format t "</variable>"))
 
   (defun wx-query-variable (var)
-    (format t "<variables>~%<variable>~%<name>~a</name>" (wxxml-fix-string (maybe-invert-string-case var)))
-    (ignore-errors
-      (let (($display2d nil))
-	(mtell "<value>~M</value>" (wxxml-fix-string(meval (intern var))))))
-      (format t "</variable>~%</variables>~%"))
+    (wx-query-variables (list var)))
+
+  ;; Sends the values of all variables in the list vars in a single <variables>
+  ;; tag. The names are passed as a list since a lisp might limit the number of
+  ;; arguments a function accepts to 50.
+  (defun wx-query-variables (vars)
+    (format t "<variables>~%")
+    (dolist (var vars)
+      (format t "<variable>~%<name>~a</name>" (wxxml-fix-string (maybe-invert-string-case var)))
+      (ignore-errors
+	(let (($display2d nil))
+	  (mtell "<value>~M</value>" (wxxml-fix-string(meval (intern var))))))
+      (format t "</variable>~%"))
+    (format t "</variables>~%"))
 
   (defun wx-print-variables ()
     #+clisp (finish-output)
@@ -1998,6 +2007,57 @@
     #+clisp (finish-output)
     )
 
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+  ;; wxMaxima can send commands before maxima has finished evaluating the
+  ;; previous one. Each of these commands is preceded by a call to
+  ;; wx-begin-command that tells which command it follows and followed by a
+  ;; call to wx-end-command on a line of its own. If the command it follows
+  ;; hasn't produced an output label (which means it has failed or has been
+  ;; interrupted) the command is read up to this line, but not evaluated, and
+  ;; wxMaxima is told to send it again if it still wants it to be evaluated.
+  (defvar *wx-last-command-id* nil "The id of the last command wxMaxima has sent")
+  (defvar *wx-last-command-state* nil "The $linenum the last command got or :skipped")
+  (defvar *wx-last-command-input* nil "The value of _ before the last command was read")
+
+  (defun wx-command-failed-p (id)
+    (and *wx-last-command-id*
+	 (eql id *wx-last-command-id*)
+	 (or (eq *wx-last-command-state* :skipped)
+	     (if $nolabels
+		 ;; Without labels only _ tells if the command has been
+		 ;; evaluated: maxima sets it to the command's input, which is
+		 ;; __ now, once the command has finished. If the command is the
+		 ;; same atom as the one before we cannot tell and assume it has
+		 ;; failed: The commands that follow it are sent again, then.
+		 (or (not (eq $_ $__))
+		     (eq $_ *wx-last-command-input*))
+		 ;; kill(all), kill(labels) and reset() start over with the
+		 ;; line numbers. A command that did that has been evaluated
+		 ;; even if its output label doesn't exist.
+		 (and (> $linenum *wx-last-command-state*)
+		      (not (boundp ($concat '|| $outchar *wx-last-command-state*))))))))
+
+  (defun wx-begin-command (id previous-id)
+    (cond ((wx-command-failed-p previous-id)
+	   ;; Reading lines instead of counting characters doesn't depend on
+	   ;; how the lisp and wxMaxima count characters outside the BMP.
+	   (let ((end (format nil ":lisp-quiet (wx-end-command ~a)" id)))
+	     (loop for line = (read-line *standard-input* nil nil)
+		   while (and line
+			      (string/= (string-right-trim '(#\Return #\Space) line) end))))
+	   (setq *wx-last-command-state* :skipped)
+	   (format t "<command_skipped>~a</command_skipped>" id))
+	  (t
+	   (setq *wx-last-command-state* $linenum)
+	   (setq *wx-last-command-input* $_)
+	   (format t "<command_start>~a</command_start>" id)))
+    (setq *wx-last-command-id* id)
+    (finish-output))
+
+  (defun wx-end-command (id)
+    "Marks the end of a command wx-begin-command might have to skip"
+    (declare (ignore id)))
+
 ;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
   ;; A function that allows wxMaxima to set maxima's current directory to that
   ;; of the worksheet.
@@ -37,6 +37,9 @@
 #include "ErrorRedirector.h"
 #include <wx/wfstream.h>
 #include <wx/txtstrm.h>
+#include <algorithm>
+#include <iterator>
+#include <utility>
 
 AutoComplete::AutoComplete(Configuration *configuration)
 {
@@ -48,7 +51,7 @@ void AutoComplete::ClearWorksheetWords()
   #ifdef HAVE_OPENMP_TASKS
   #pragma omp critical (AutocompleteBuiltins)
   #endif
-  m_worksheetWords.clear();
+  m_worksheetWords.Clear();
 }
 
 void AutoComplete::ClearDemofileList()
@@ -138,7 +141,7 @@ void AutoComplete::AddWorksheetWords(WordList::const_iterator const begin, WordL
   #endif
   {
     for (auto word = begin; word != end; std::advance(word, 1))
-      m_worksheetWords[*word] = 1;
+      m_worksheetWords.Add(*word);
   }
 }
 
@@ -178,17 +181,12 @@ void AutoComplete::BuiltinSymbols_BackgroundTask()
     m_wordList[tmplte].Clear();
     m_wordList[esccommand].Clear();
     m_wordList[unit].Clear();
-  
-    LoadBuiltinSymbols();
-    
+
+    // Maxima's builtin symbols are compiled into BuiltinSymbols() => we only
+    // need to load the ones the user has added.
     for (auto it = Configuration::EscCodesBegin(); it != Configuration::EscCodesEnd(); ++it)
        m_wordList[esccommand].Add(it->first);
 
-    m_wordList[command].Sort();
-    m_wordList[tmplte].Sort();
-    m_wordList[unit].Sort();
-    m_wordList[esccommand].Sort();
-
     wxString line;
 
     /// Load private symbol list (do something different on Windows).
@@ -254,77 +252,92 @@ void AutoComplete::BuiltinSymbols_BackgroundTask()
 
 void AutoComplete::LoadSymbols_BackgroundTask()
 {
-  #ifdef HAVE_OPENMP_TASKS
-  #pragma omp critical (AutocompleteFiles)
-  #endif
+  // Error dialogues need to be created by the foreground thread.
+  SuppressErrorDialogs suppressor;
+
+  // The lists of files the last session has found are available at once...
+  DirectoryIndex index(Dirstructure::Get()->DirectoryIndexFile());
+  if(index.Load())
+  {
+    wxLogMessage(_("Autocompletion: Using the list of loadable files from the last session."));
+    ScanBuiltinFiles(index, false);
+  }
+
+  // ...and revalidating them only re-reads the directories that have changed since.
+  ScanBuiltinFiles(index, true);
+  if(!index.Save())
+    wxLogMessage(
+      wxString::Format(
+        _("Autocompletion: Cannot write the index of loadable files to %s."),
+        Dirstructure::Get()->DirectoryIndexFile().utf8_str()));
+}
+
+void AutoComplete::ScanBuiltinFiles(DirectoryIndex &index, bool validate)
+{
+  SymbolIndex loadFiles;
+  SymbolIndex demoFiles;
+
+  // Prepare a list of all built-in loadable files of maxima.
   {
-    // Error dialogues need to be created by the foreground thread.
-    SuppressErrorDialogs suppressor;
-    
-    // Prepare a list of all built-in loadable files of maxima.
+    GetMacFiles_includingSubdirs maximaLispIterator (loadFiles);
+    wxString sharedir = m_configuration->MaximaShareDir();
+    sharedir.Replace("\n","");
+    sharedir.Replace("\r","");
+    if(sharedir.IsEmpty())
+      wxLogMessage(_("Seems like the package with the maxima share files isn't installed."));
+    else
     {
-      GetMacFiles_includingSubdirs maximaLispIterator (m_builtInLoadFiles);
-      wxString sharedir = m_configuration->MaximaShareDir();
-      sharedir.Replace("\n","");
-      sharedir.Replace("\r","");
-      if(sharedir.IsEmpty())
-        wxLogMessage(_("Seems like the package with the maxima share files isn't installed."));
-      else
-      {
-        wxFileName shareDir(sharedir + "/");
-        shareDir.MakeAbsolute();
-        wxLogMessage(
-          wxString::Format(
-            _("Autocompletion: Scanning %s recursively for loadable lisp files."),
-            shareDir.GetFullPath().utf8_str()));
-        wxDir maximadir(shareDir.GetFullPath());
-        if(maximadir.IsOpened())
-          maximadir.Traverse(maximaLispIterator); //todo
-      }
-      GetMacFiles userLispIterator (m_builtInLoadFiles);
-      wxFileName userDir(Dirstructure::Get()->UserConfDir() + "/");
-      userDir.MakeAbsolute();
-      wxDir maximauserfilesdir(userDir.GetFullPath());
+      wxFileName shareDir(sharedir + "/");
+      shareDir.MakeAbsolute();
       wxLogMessage(
         wxString::Format(
-          _("Autocompletion: Scanning %s for loadable lisp files."),
-          userDir.GetFullPath().utf8_str()));
-      if(maximauserfilesdir.IsOpened())
-        maximauserfilesdir.Traverse(userLispIterator);
-      int num = m_builtInLoadFiles.GetCount();
-      wxLogMessage(
-        wxString::Format(
-          _("Found %i loadable files."),
-          num
-          )
-        );
+          _("Autocompletion: Scanning %s recursively for loadable lisp files."),
+          shareDir.GetFullPath().utf8_str()));
+      index.Traverse(shareDir.GetFullPath(), maximaLispIterator, validate);
     }
-  
+    GetMacFiles userLispIterator (loadFiles);
+    wxFileName userDir(Dirstructure::Get()->UserConfDir() + "/");
+    userDir.MakeAbsolute();
+    wxLogMessage(
+      wxString::Format(
+        _("Autocompletion: Scanning %s for loadable lisp files."),
+        userDir.GetFullPath().utf8_str()));
+    index.Traverse(userDir.GetFullPath(), userLispIterator, validate);
+    int num = loadFiles.GetCount();
+    wxLogMessage(
+      wxString::Format(
+        _("Found %i loadable files."),
+        num
+        )
+      );
+  }
 
-    // Prepare a list of all built-in demos of maxima.
-    {
-      wxFileName demoDir(m_configuration->MaximaShareDir() + "/");
-      demoDir.MakeAbsolute();
-      demoDir.RemoveLastDir();
-      GetDemoFiles_includingSubdirs maximaLispIterator (m_builtInDemoFiles);
-      wxLogMessage(
-        wxString::Format(
-          _("Autocompletion: Scanning %s for loadable demo files."),
-          demoDir.GetFullPath().utf8_str()));
+  // Prepare a list of all built-in demos of maxima.
+  {
+    wxFileName demoDir(m_configuration->MaximaShareDir() + "/");
+    demoDir.MakeAbsolute();
+    demoDir.RemoveLastDir();
+    GetDemoFiles_includingSubdirs maximaLispIterator (demoFiles);
+    wxLogMessage(
+      wxString::Format(
+        _("Autocompletion: Scanning %s for loadable demo files."),
+        demoDir.GetFullPath().utf8_str()));
+    index.Traverse(demoDir.GetFullPath(), maximaLispIterator, validate);
+    int num = demoFiles.GetCount();
+    wxLogMessage(
+      wxString::Format(
+        _("Found %i demo files."),
+        num
+        )
+      );
+  }
 
-      wxDir maximadir(demoDir.GetFullPath());
-      if(maximadir.IsOpened())
-        maximadir.Traverse(maximaLispIterator);
-      int num = m_builtInDemoFiles.GetCount();
-      wxLogMessage(
-        wxString::Format(
-          _("Found %i demo files."),
-          num
-          )
-        );
-    }
-    m_builtInLoadFiles.Sort();
-    m_builtInDemoFiles.Sort();
+  #ifdef HAVE_OPENMP_TASKS
+  #pragma omp critical (AutocompleteFiles)
+  #endif
+  {
+    m_builtInLoadFiles = std::move(loadFiles);
+    m_builtInDemoFiles = std::move(demoFiles);
   }
 }
 
@@ -364,9 +377,7 @@ void AutoComplete::UpdateDemoFiles(wxString partial, wxString maximaDir)
     if(partial != wxT("//"))
     {
       GetDemoFiles userLispIterator(m_wordList[demofile], prefix);
-      wxDir demofilesdir(partial);
-      if(demofilesdir.IsOpened())
-        demofilesdir.Traverse(userLispIterator);
+      m_typedDirs.Traverse(partial, userLispIterator);
     }
   }
 }
@@ -404,9 +415,7 @@ void AutoComplete::UpdateGeneralFiles(wxString partial, wxString maximaDir)
     if(partial != wxT("//"))
     {
       GetGeneralFiles fileIterator(m_wordList[generalfile], prefix);
-      wxDir generalfilesdir(partial);
-      if(generalfilesdir.IsOpened())
-        generalfilesdir.Traverse(fileIterator);
+      m_typedDirs.Traverse(partial, fileIterator);
     }
   }
 }
@@ -448,9 +457,7 @@ void AutoComplete::UpdateLoadFiles(wxString partial, wxString maximaDir)
     if(partial != wxT("//"))
     {
       GetMacFiles userLispIterator(m_wordList[loadfile], prefix);
-      wxDir loadfilesdir(partial);
-      if(loadfilesdir.IsOpened())
-        loadfilesdir.Traverse(userLispIterator);
+      m_typedDirs.Traverse(partial, userLispIterator);
     }
   }
 }
@@ -473,50 +480,37 @@ wxArrayString AutoComplete::CompleteSymbol(wxString partial, autoCompletionType
       partial = partial.Left(partial.Length() - 1);
   
     wxASSERT_MSG((type >= command) && (type <= unit), _("Bug: Autocompletion requested for unknown type of item."));
-  
-    if (type != tmplte)
-    {
-      for (size_t i = 0; i < m_wordList[type].GetCount(); i++)
-      {
-        if (m_wordList[type][i].StartsWith(partial) &&
-            completions.Index(m_wordList[type][i]) == wxNOT_FOUND)
-          completions.Add(m_wordList[type][i]);
-      }
-    }
-    else
-    {
-      for (size_t i = 0; i < m_wordList[type].GetCount(); i++)
-      {
-        wxString templ = m_wordList[type][i];
-        if (templ.StartsWith(partial))
-        {
-          if (completions.Index(templ) == wxNOT_FOUND)
-            completions.Add(templ);
-          if (templ.SubString(0, templ.Find(wxT("(")) - 1) == partial &&
-              perfectCompletions.Index(templ) == wxNOT_FOUND)
-            perfectCompletions.Add(templ);
-        }
-      }
-    }
 
-    // Add a list of words that were definied on the work sheet but that aren't
-    // defined as maxima commands or functions.
+    // The builtin symbols and the ones we have learned at runtime. All lists
+    // are sorted, so merging them keeps the result sorted.
+    std::vector<wxString> builtinMatches;
+    auto builtins = BuiltinSymbols(type).PrefixRange(partial);
+    for (auto word = builtins.first; word != builtins.second; ++word)
+      builtinMatches.push_back(wxString::FromUTF8(*word));
+    auto knownMatches = m_wordList[type].PrefixRange(partial);
+    std::vector<wxString> matches;
+    std::set_union(builtinMatches.begin(), builtinMatches.end(),
+                   knownMatches.first, knownMatches.second,
+                   std::back_inserter(matches));
+
     if (type == command)
     {
-      WorksheetWords::const_iterator it;
-      for (it = m_worksheetWords.begin(); it != m_worksheetWords.end(); ++it)
-      {
-        if (it->first.StartsWith(partial))
-        {
-          if (completions.Index(it->first) == wxNOT_FOUND)
-          {
-            completions.Add(it->first);
-          }
-        }
-      }
+      // Add the words that were defined on the work sheet but that aren't
+      // defined as maxima commands or functions.
+      auto worksheetMatches = m_worksheetWords.PrefixRange(partial);
+      std::vector<wxString> withWorksheetWords;
+      std::set_union(matches.begin(), matches.end(),
+                     worksheetMatches.first, worksheetMatches.second,
+                     std::back_inserter(withWorksheetWords));
+      matches.swap(withWorksheetWords);
     }
 
-    completions.Sort();
+    for (auto const &word : matches)
+    {
+      completions.Add(word);
+      if ((type == tmplte) && (word.SubString(0, word.Find(wxT("(")) - 1) == partial))
+        perfectCompletions.Add(word);
+    }
   }
   if (perfectCompletions.Count() > 0)
     return perfectCompletions;
@@ -550,8 +544,8 @@ void AutoComplete::AddSymbol_nowait(wxString fun, autoCompletionType type)
     type = unit;
   }
 
-  /// Add symbols
-  if ((type != tmplte) && m_wordList[type].Index(fun, true, true) == wxNOT_FOUND)
+  /// Add symbols. The builtin ones we already know.
+  if ((type != tmplte) && (!BuiltinSymbols(type).Contains(fun)))
     m_wordList[type].Add(fun);
 
   /// Add templates - for given function and given argument count we
@@ -561,14 +555,15 @@ void AutoComplete::AddSymbol_nowait(wxString fun, autoCompletionType type)
     fun = FixTemplate(fun);
     wxString funName = fun.SubString(0, fun.Find(wxT("(")));
     long count = fun.Freq('<');
-    size_t i = 0;
-    for (i = 0; i < m_wordList[type].GetCount(); i++)
-    {
-      wxString t = m_wordList[type][i];
-      if (t.StartsWith(funName) && (t.Freq('<') == count))
-        break;
-    }
-    if (i == m_wordList[type].GetCount())
+    auto builtinSameName = BuiltinSymbols(type).PrefixRange(funName);
+    for (auto builtin = builtinSameName.first; builtin != builtinSameName.second; ++builtin)
+      if (wxString::FromUTF8(*builtin).Freq('<') == count)
+        return;
+    auto sameName = m_wordList[type].PrefixRange(funName);
+    auto templ = sameName.first;
+    while ((templ != sameName.second) && (templ->Freq('<') != count))
+      ++templ;
+    if (templ == sameName.second)
       m_wordList[type].Add(fun);
   }
 }
@@ -38,6 +38,8 @@
 #include <wx/filename.h>
 #include <vector>
 #include "Configuration.h"
+#include "SymbolIndex.h"
+#include "DirectoryIndex.h"
 
 /* The autocompletion logic
 
@@ -46,12 +48,10 @@
      - wxMaxima::ReadLoadSymbols receive the contents of maxima's variables
        "values" and "functions" after a package is loaded.
      - all words that appear in the worksheet
-     - and a list of maxima's builtin commands.
+     - and a list of maxima's builtin commands that is compiled into wxMaxima.
  */
 class AutoComplete
 {
-  WX_DECLARE_STRING_HASH_MAP(int, WorksheetWords);
-
 public:
   using WordList = std::vector<wxString>;
 
@@ -74,13 +74,13 @@ public:
   //! Load all autocomplete symbols wxMaxima knows about by itself
   void LoadSymbols();
 
-  /*! Makes wxMaxima know all its builtin symbols.
+  /*! The builtin symbols of maxima of one type
 
-    This function might cause a compiler warning because it is 
-    suspiciously long. 
-    For the same reason it has been split into a separate file.
+    This table is generated at build time from Autocomplete_Builtins.txt and
+    only exists for commands, templates and units. The symbols maxima or the
+    user tell us about at runtime are stored in m_wordList, instead.
   */
-  bool LoadBuiltinSymbols();
+  static StaticSymbolTable BuiltinSymbols(autoCompletionType type);
 
   //! Manually add a autocompletable symbol to our symbols lists
   void AddSymbol(wxString fun, autoCompletionType type = command);
@@ -117,29 +117,40 @@ private:
   Configuration *m_configuration;
   //! Loads the list of loadable files and can be run in a background task
   void LoadSymbols_BackgroundTask();
+  /*! Compiles the lists of loadable and demo files maxima comes with
+
+    \param validate false = trust the lists \p index has read from the disk,
+    true = re-read every directory that has changed since then.
+   */
+  void ScanBuiltinFiles(DirectoryIndex &index, bool validate);
   //! Prepares the list of built-in symbols and can be run in a background task
   void BuiltinSymbols_BackgroundTask();
 
   //! Replace the list of files in the directory the worksheet file is in to the load files list
   void UpdateLoadFiles_BackgroundTask(wxString partial, wxString maximaDir);
   //! The list of loadable files maxima provides
-  wxArrayString m_builtInLoadFiles;
+  SymbolIndex m_builtInLoadFiles;
   //! The list of demo files maxima provides
-  wxArrayString m_builtInDemoFiles;
+  SymbolIndex m_builtInDemoFiles;
+  /*! The contents of the directories the user has typed the names of
+
+    Only re-reads a directory if it has changed since the last keypress.
+    Protected by the same critical section as the file lists.
+   */
+  DirectoryIndex m_typedDirs;
 
   //! Scans the maxima directory for a list of loadable files
   class GetGeneralFiles : public wxDirTraverser
   {
   public:
-    explicit GetGeneralFiles(wxArrayString& files, wxString prefix = wxEmptyString) :
+    explicit GetGeneralFiles(SymbolIndex& files, wxString prefix = wxEmptyString) :
       m_files(files), m_prefix(prefix) { }
     virtual wxDirTraverseResult OnFile(const wxString& filename) override
       {
         wxFileName newItemName(filename);
         wxString newItem = "\"" + m_prefix + newItemName.GetFullName() + "\"";
         newItem.Replace(wxFileName::GetPathSeparator(),"/");
-        if(m_files.Index(newItem) == wxNOT_FOUND)
-          m_files.Add(newItem);
+        m_files.Add(newItem);
         return wxDIR_CONTINUE;
       }
     virtual wxDirTraverseResult OnDir(const wxString& dirname) override
@@ -147,13 +158,12 @@ private:
         wxFileName newItemName(dirname);
         wxString newItem = "\"" + m_prefix + newItemName.GetFullName() + "/\"";
         newItem.Replace(wxFileName::GetPathSeparator(),"/");
-        if(m_files.Index(newItem) == wxNOT_FOUND)
-          m_files.Add(newItem);
+        m_files.Add(newItem);
         return wxDIR_IGNORE;
       }
-    wxArrayString& GetResult(){return m_files;}
+    SymbolIndex& GetResult(){return m_files;}
   protected: 
-    wxArrayString& m_files;
+    SymbolIndex& m_files;
     wxString m_prefix;
   };
 
@@ -161,7 +171,7 @@ private:
   class GetMacFiles_includingSubdirs : public wxDirTraverser
   {
   public:
-    explicit GetMacFiles_includingSubdirs(wxArrayString& files, wxString prefix = wxEmptyString) :
+    explicit GetMacFiles_includingSubdirs(SymbolIndex& files, wxString prefix = wxEmptyString) :
       m_files(files), m_prefix(prefix)  { }
     virtual wxDirTraverseResult OnFile(const wxString& filename) override
       {
@@ -174,8 +184,7 @@ private:
           wxFileName newItemName(filename);
           wxString newItem = "\"" + m_prefix + newItemName.GetName() + "\"";
           newItem.Replace(wxFileName::GetPathSeparator(),"/");
-          if(m_files.Index(newItem) == wxNOT_FOUND)
-            m_files.Add(newItem);
+          m_files.Add(newItem);
         }
         return wxDIR_CONTINUE;
       }
@@ -191,9 +200,9 @@ private:
         else
           return wxDIR_CONTINUE;
       }
-    wxArrayString& GetResult(){return m_files;}
+    SymbolIndex& GetResult(){return m_files;}
   protected: 
-    wxArrayString& m_files;
+    SymbolIndex& m_files;
     wxString m_prefix;
   };
   
@@ -201,15 +210,14 @@ private:
   class GetMacFiles : public GetMacFiles_includingSubdirs
   {
   public:
-    explicit GetMacFiles(wxArrayString& files, wxString prefix = wxEmptyString) :
+    explicit GetMacFiles(SymbolIndex& files, wxString prefix = wxEmptyString) :
       GetMacFiles_includingSubdirs(files, prefix){ }
     virtual wxDirTraverseResult OnDir(const wxString& dirname) override
       {
         wxFileName newItemName(dirname);
         wxString newItem = "\"" + m_prefix + newItemName.GetFullName() + "/\"";
         newItem.Replace(wxFileName::GetPathSeparator(),"/");
-        if(m_files.Index(newItem) == wxNOT_FOUND)
-          m_files.Add(newItem);
+        m_files.Add(newItem);
         return wxDIR_IGNORE;
       }
   };
@@ -218,7 +226,7 @@ private:
   class GetDemoFiles_includingSubdirs : public wxDirTraverser
   {
   public:
-    explicit GetDemoFiles_includingSubdirs(wxArrayString& files, wxString prefix = wxEmptyString) :
+    explicit GetDemoFiles_includingSubdirs(SymbolIndex& files, wxString prefix = wxEmptyString) :
       m_files(files), m_prefix(prefix) { }
     virtual wxDirTraverseResult OnFile(const wxString& filename) override
       {
@@ -227,8 +235,7 @@ private:
           wxFileName newItemName(filename);
           wxString newItem = "\"" + m_prefix + newItemName.GetName() + "\"";
           newItem.Replace(wxFileName::GetPathSeparator(),"/");
-          if(m_files.Index(newItem) == wxNOT_FOUND)
-            m_files.Add(newItem);
+          m_files.Add(newItem);
         }
         return wxDIR_CONTINUE;
       }
@@ -244,9 +251,9 @@ private:
         else
           return wxDIR_CONTINUE;
       }
-    wxArrayString& GetResult(){return m_files;}
+    SymbolIndex& GetResult(){return m_files;}
   protected: 
-    wxArrayString& m_files;
+    SymbolIndex& m_files;
     wxString m_prefix;
   };
   
@@ -254,23 +261,23 @@ private:
   class GetDemoFiles : public GetDemoFiles_includingSubdirs
   {
   public:
-    explicit GetDemoFiles(wxArrayString& files, wxString prefix = wxEmptyString) :
+    explicit GetDemoFiles(SymbolIndex& files, wxString prefix = wxEmptyString) :
       GetDemoFiles_includingSubdirs(files, prefix){ }
     virtual wxDirTraverseResult OnDir(const wxString& dirname) override
       {
         wxFileName newItemName(dirname);
         wxString newItem = "\"" + m_prefix + newItemName.GetFullName() + "/\"";
         newItem.Replace(wxFileName::GetPathSeparator(),"/");
-        if(m_files.Index(newItem) == wxNOT_FOUND)
-          m_files.Add(newItem);
+        m_files.Add(newItem);
         return wxDIR_IGNORE;
       }
   };
 
   //! The lists of autocompletible symbols for the classes defined in autoCompletionType
-  wxArrayString m_wordList[7];
+  SymbolIndex m_wordList[7];
   static wxRegEx m_args;
-  WorksheetWords m_worksheetWords;
+  //! The words that appear in the worksheet's code cells
+  SymbolIndex m_worksheetWords;
 };
 
 #endif // AUTOCOMPLETE_H
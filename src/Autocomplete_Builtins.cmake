@@ -0,0 +1,77 @@
+# -*- mode: CMake; cmake-tab-width: 4; -*-
+#
+# Generates Autocomplete_Builtins.cpp from Autocomplete_Builtins.txt:
+#
+#   cmake -DINPUT=Autocomplete_Builtins.txt -DOUTPUT=Autocomplete_Builtins.cpp -P Autocomplete_Builtins.cmake
+#
+# Each kind of symbol gets an array that is sorted byte by byte, which is the
+# order AutoComplete's binary search expects.
+#
+# The file is processed as hex dump: The templates contain brackets and
+# semicolons cmake's lists cannot cope with. Sorting the hex strings sorts the
+# symbols they encode in the same order, and every byte can be written to the
+# generated C++ file as a \x escape sequence.
+
+file(READ "${INPUT}" hex HEX)
+# Split the dump into lines, making sure not to match across byte boundaries.
+string(REGEX REPLACE "(..)" "\\1 " hex "${hex}")
+string(REPLACE "0d " "" hex "${hex}")
+string(REPLACE "0a " ";" hex "${hex}")
+string(REPLACE " " "" hex "${hex}")
+
+set(commands)
+set(templates)
+set(units)
+foreach(line ${hex})
+    # "FUNCTION: " or "OPTION: "
+    if(line MATCHES "^(46554e4354494f4e|4f5054494f4e)3a20(.+)$")
+        list(APPEND commands "${CMAKE_MATCH_2}")
+    # "TEMPLATE: "
+    elseif(line MATCHES "^54454d504c4154453a20(.+)$")
+        list(APPEND templates "${CMAKE_MATCH_1}")
+    # "UNIT: "
+    elseif(line MATCHES "^554e49543a20(.+)$")
+        list(APPEND units "${CMAKE_MATCH_1}")
+    # Anything that isn't empty or a comment starting with "#"
+    elseif(NOT ((line STREQUAL "") OR (line MATCHES "^23")))
+        message(FATAL_ERROR "${INPUT}: Cannot interpret the line with the hex dump ${line}")
+    endif()
+endforeach()
+
+set(cpp "// Generated from Autocomplete_Builtins.txt by Autocomplete_Builtins.cmake. Do not edit.\n\n")
+string(APPEND cpp "#include \"Autocomplete.h\"\n")
+foreach(table commands templates units)
+    list(REMOVE_DUPLICATES ${table})
+    list(SORT ${table})
+    string(APPEND cpp "\nstatic constexpr const char *builtin_${table}[] = {\n")
+    foreach(symbol ${${table}})
+        string(REGEX REPLACE "(..)" "\\\\x\\1" symbol "${symbol}")
+        string(APPEND cpp "  \"${symbol}\",\n")
+    endforeach()
+    string(APPEND cpp "};\n")
+endforeach()
+
+string(APPEND cpp "
+StaticSymbolTable AutoComplete::BuiltinSymbols(autoCompletionType type)
+{
+  switch (type)
+  {
+  case command:
+    return StaticSymbolTable(builtin_commands);
+  case tmplte:
+    return StaticSymbolTable(builtin_templates);
+  case unit:
+    return StaticSymbolTable(builtin_units);
+  default:
+    return StaticSymbolTable();
+  }
+}
+")
+
+# Don't touch the output if nothing has changed: That would trigger a recompile.
+if(EXISTS "${OUTPUT}")
+    file(READ "${OUTPUT}" oldcpp)
+endif()
+if(NOT (oldcpp STREQUAL cpp))
+    file(WRITE "${OUTPUT}" "${cpp}")
+endif()
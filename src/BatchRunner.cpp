@@ -0,0 +1,168 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file defines the class BatchRunner that evaluates many files in
+  parallel, each of them in its own headless wxMaxima window.
+ */
+
+#include "BatchRunner.h"
+#include <wx/filename.h>
+#include <wx/ffile.h>
+#include <wx/intl.h>
+#include <wx/log.h>
+#include <wx/time.h>
+#include <algorithm>
+#include <iostream>
+
+BatchRunner::BatchRunner(WindowFactory openWindow, size_t maxJobs, const wxString &summaryFile) :
+  m_openWindow(std::move(openWindow)),
+  m_maxJobs(std::max(maxJobs, size_t(1))),
+  m_summaryFile(summaryFile)
+{
+}
+
+void BatchRunner::AddFile(const wxString &file)
+{
+  m_jobs.emplace_back(file);
+}
+
+void BatchRunner::Start()
+{
+  m_startTime = wxGetUTCTimeMillis();
+
+  // Start the biggest files first: If one of them were started last the other
+  // processes would be idle until it is finished.
+  std::stable_sort(m_jobs.begin(), m_jobs.end(), [](const Job &a, const Job &b) {
+      return wxFileName::GetSize(a.m_file) > wxFileName::GetSize(b.m_file);
+    });
+
+  while ((m_running < m_maxJobs) && StartNext())
+  {}
+  if (Done())
+    WriteSummary();
+}
+
+bool BatchRunner::StartNext()
+{
+  while (m_nextJob < m_jobs.size())
+  {
+    Job &job = m_jobs[m_nextJob++];
+    job.m_startTime = wxGetUTCTimeMillis();
+    wxLogMessage(_("Batch: Starting to evaluate %s"), job.m_file);
+    job.m_window = m_openWindow(job.m_file);
+    if (job.m_window)
+    {
+      m_running++;
+      return true;
+    }
+    job.m_seconds = 0;
+    job.m_error = _("Cannot open a window for this file");
+  }
+  return false;
+}
+
+void BatchRunner::WindowClosed(const wxMaxima *window, const wxString &error)
+{
+  auto job = std::find_if(m_jobs.begin(), m_jobs.end(),
+                          [window](const Job &j){return j.m_window == window;});
+  if (job == m_jobs.end())
+    return;
+
+  job->m_window = NULL;
+  job->m_seconds = (wxGetUTCTimeMillis() - job->m_startTime).ToDouble() / 1000.0;
+  job->m_error = error;
+  m_running--;
+  wxLogMessage(_("Batch: %s done after %.3fs"), job->m_file, job->m_seconds);
+
+  // The window that has closed has left a free slot in the pool.
+  while ((m_running < m_maxJobs) && StartNext())
+  {}
+  if (Done())
+    WriteSummary();
+}
+
+wxString BatchRunner::JSONString(const wxString &str)
+{
+  wxString retval = wxT("\"");
+  for (wxUniChar const ch : str)
+  {
+    switch (ch.GetValue())
+    {
+    case '"':
+      retval += wxT("\\\"");
+      break;
+    case '\\':
+      retval += wxT("\\\\");
+      break;
+    case '\n':
+      retval += wxT("\\n");
+      break;
+    case '\r':
+      retval += wxT("\\r");
+      break;
+    case '\t':
+      retval += wxT("\\t");
+      break;
+    default:
+      if (ch.GetValue() < 0x20)
+        retval += wxString::Format(wxT("\\u%04x"), static_cast<unsigned>(ch.GetValue()));
+      else
+        retval += ch;
+    }
+  }
+  return retval + wxT("\"");
+}
+
+bool BatchRunner::WriteSummary() const
+{
+  size_t failed = 0;
+  wxString jobs;
+  for (auto const &job : m_jobs)
+  {
+    if (!job.m_error.IsEmpty())
+      failed++;
+    if (!jobs.IsEmpty())
+      jobs += wxT(",\n");
+    jobs += wxString::Format(wxT("    {\"file\": %s, \"seconds\": %.3f, \"success\": %s, \"error\": %s}"),
+                             JSONString(job.m_file), job.m_seconds,
+                             job.m_error.IsEmpty() ? wxT("true") : wxT("false"),
+                             JSONString(job.m_error));
+  }
+  wxString summary = wxString::Format(
+    wxT("{\n  \"jobs\": %li,\n  \"files\": %li,\n  \"failed\": %li,\n  \"seconds\": %.3f,\n  \"results\": [\n%s\n  ]\n}\n"),
+    static_cast<long>(m_maxJobs), static_cast<long>(m_jobs.size()), static_cast<long>(failed),
+    (wxGetUTCTimeMillis() - m_startTime).ToDouble() / 1000.0, jobs);
+
+  if (m_summaryFile.IsEmpty())
+  {
+    std::cout << summary.utf8_str() << std::flush;
+    return true;
+  }
+
+  wxFFile file(m_summaryFile, wxT("w"));
+  if (!file.IsOpened() || !file.Write(summary, wxConvUTF8))
+  {
+    wxLogMessage(_("Batch: Cannot write the summary to %s"), m_summaryFile);
+    return false;
+  }
+  return file.Close();
+}
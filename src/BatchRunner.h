@@ -0,0 +1,107 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file declares the class BatchRunner that evaluates many files in
+  parallel, each of them in its own headless wxMaxima window.
+ */
+
+#ifndef WXMAXIMA_BATCHRUNNER_H
+#define WXMAXIMA_BATCHRUNNER_H
+
+#include <wx/longlong.h>
+#include <wx/string.h>
+#include <functional>
+#include <vector>
+
+class wxMaxima;
+
+/*! Evaluates a list of files using a bounded pool of maxima processes
+
+  Each file is evaluated by a headless wxMaxima window that starts its own
+  maxima process and its own server on a free port. At most maxJobs of these
+  windows exist at the same time: Whenever one of them closes the next file
+  from the shared list is started. The biggest files are started first so
+  that no big file is left over for the end when all other jobs are done.
+
+  When the last file is done a summary containing the time each file needed
+  and the errors that occurred is written in JSON format.
+ */
+class BatchRunner final
+{
+public:
+  //! Opens a headless window that evaluates file and saves the result
+  using WindowFactory = std::function<wxMaxima *(const wxString &file)>;
+
+  /*! Constructor
+
+    \param openWindow Opens a headless window for a file
+    \param maxJobs How many files may be evaluated at the same time
+    \param summaryFile The file the summary is written to. Empty = stdout.
+   */
+  BatchRunner(WindowFactory openWindow, size_t maxJobs, const wxString &summaryFile);
+
+  //! Adds a file to the list of files to evaluate
+  void AddFile(const wxString &file);
+  //! Starts evaluating the first files
+  void Start();
+  /*! Informs the batch runner that a window has closed
+
+    \param window The window
+    \param error Empty, if the file has been evaluated and saved successfully,
+                 else a description of the problem
+   */
+  void WindowClosed(const wxMaxima *window, const wxString &error);
+  //! Have all files been evaluated?
+  bool Done() const { return (m_nextJob >= m_jobs.size()) && (m_running == 0); }
+
+private:
+  struct Job
+  {
+    explicit Job(const wxString &file) : m_file(file) {}
+    wxString m_file;
+    //! The window that evaluates the file, if it has been started and isn't closed yet
+    const wxMaxima *m_window = NULL;
+    wxLongLong m_startTime;
+    //! The time the evaluation took [s], or -1, if it hasn't finished
+    double m_seconds = -1;
+    wxString m_error;
+  };
+  //! Starts the next file. Returns false, if there is none.
+  bool StartNext();
+  //! Writes the summary. Returns false if that failed.
+  bool WriteSummary() const;
+  //! Quotes a string for JSON
+  static wxString JSONString(const wxString &str);
+
+  WindowFactory m_openWindow;
+  size_t m_maxJobs;
+  wxString m_summaryFile;
+  std::vector<Job> m_jobs;
+  //! The index of the next job to start
+  size_t m_nextJob = 0;
+  //! How many windows are currently open?
+  size_t m_running = 0;
+  //! When has Start() been called?
+  wxLongLong m_startTime;
+};
+
+#endif // WXMAXIMA_BATCHRUNNER_H
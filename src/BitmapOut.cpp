@@ -124,7 +124,7 @@ void BitmapOut::Draw()
   m_cmn.Draw(m_tree.get());
 }
 
-wxSize BitmapOut::ToFile(const wxString &file)
+wxImage BitmapOut::GetImage() const
 {
   // Assign a resolution to the bitmap.
   wxImage img = m_bmp.ConvertToImage();
@@ -132,23 +132,25 @@ wxSize BitmapOut::ToFile(const wxString &file)
   if (resolution <= 0)
     resolution = 75;
   img.SetOption(wxIMAGE_OPTION_RESOLUTION, resolution * m_cmn.GetScale());
+  return img;
+}
 
-  bool success = false;
+bool BitmapOut::ToFile(const wxImage &img, const wxString &file)
+{
   if (file.EndsWith(wxT(".bmp")))
-    success = img.SaveFile(file, wxBITMAP_TYPE_BMP);
-  else if (file.EndsWith(wxT(".xpm")))
-    success = img.SaveFile(file, wxBITMAP_TYPE_XPM);
-  else if (file.EndsWith(wxT(".jpg")))
-    success = img.SaveFile(file, wxBITMAP_TYPE_JPEG);
-  else
-  {
-    if (file.EndsWith(wxT(".png")))
-      success = img.SaveFile(file, wxBITMAP_TYPE_PNG);
-    else
-      success = img.SaveFile(file + wxT(".png"), wxBITMAP_TYPE_PNG);
-  }
+    return img.SaveFile(file, wxBITMAP_TYPE_BMP);
+  if (file.EndsWith(wxT(".xpm")))
+    return img.SaveFile(file, wxBITMAP_TYPE_XPM);
+  if (file.EndsWith(wxT(".jpg")))
+    return img.SaveFile(file, wxBITMAP_TYPE_JPEG);
+  if (file.EndsWith(wxT(".png")))
+    return img.SaveFile(file, wxBITMAP_TYPE_PNG);
+  return img.SaveFile(file + wxT(".png"), wxBITMAP_TYPE_PNG);
+}
 
-  if (success)
+wxSize BitmapOut::ToFile(const wxString &file)
+{
+  if (ToFile(GetImage(), file))
     return m_cmn.GetScaledSize();
   else
     return wxDefaultSize;
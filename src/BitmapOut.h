@@ -70,6 +70,23 @@ public:
    */
   wxSize ToFile(const wxString &file);
 
+  /*! Returns the bitmap as an image that can be handed to ToFile(const wxImage &, ...)
+
+    Converting the bitmap needs the GUI thread, writing the image doesn't.
+   */
+  wxImage GetImage() const;
+
+  /*! Writes an image returned by GetImage() to a file
+
+    The file format is determined by the file name's extension. Needs no GUI
+    and therefore may be called from a background task.
+    \return true, if the file could be written.
+   */
+  static bool ToFile(const wxImage &img, const wxString &file);
+
+  //! The size the image is displayed with
+  wxSize GetScaledSize() const { return m_cmn.GetScaledSize(); }
+
   //! Returns the bitmap representation of the list of cells that was passed to SetData()
   wxBitmap GetBitmap() const { return m_bmp; }
 
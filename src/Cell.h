@@ -261,6 +261,14 @@ public:
    */
   void ClearCacheList();
 
+  /*! Prepares the scaled versions of images in the background
+
+    Is called for cells that are near the visible region of the worksheet so
+    they can be drawn fast once they are scrolled into view.
+   */
+  virtual void PrefetchImages()
+  {}
+
   /*! Draw this cell
 
     \param point The x and y position this cell is drawn at: All top-level cells get their
@@ -34,6 +34,7 @@
 
 #include <wx/debug.h>
 #include <wx/log.h>
+#include <atomic>
 #include <memory>
 #include <type_traits>
 #include <cstddef>
@@ -57,7 +58,8 @@ class Observed
 {
   friend class CellPtrBase;
 
-  static size_t m_instanceCount;
+  //! The number of live objects. Atomic, since cells can be created in a background task.
+  static std::atomic<size_t> m_instanceCount;
 
   class ControlBlock final
   {
@@ -83,8 +85,15 @@ class Observed
       const_cast<const ControlBlock *>(this)->Ref(cellptr);
       return this;
     }
-    //! References the control block.
+    /*! References the control block.
+
+      The empty block is shared by all null pointers and is never deleted.
+      It therefore doesn't need a reference count - which means that null
+      pointers can be created and destroyed by several threads at once.
+     */
     const ControlBlock *Ref(const CellPtrBase *cellptr) const {
+      if (this == &empty)
+        return this;
       if (CELLPTR_LOG_REFS)
         wxLogMessage("%p CB::Ref (%d->%d) cb=%p obj=%p", cellptr, m_refCount, m_refCount+1, this, m_object);
       else
@@ -105,11 +114,13 @@ class Observed
     //! or its address if the block should be deleted.
     const ControlBlock *Deref(const CellPtrBase *cellptr) const
     {
+      if (this == &empty)
+        return nullptr;
       if (CELLPTR_LOG_REFS)
         wxLogMessage("%p CB::Deref (%d->%d) cb=%p obj=%p", cellptr, m_refCount, m_refCount-1, this, m_object);
       else
         wxUnusedVar(cellptr);
-      wxASSERT(m_refCount > 1 || (m_refCount == 1 && this != &empty));
+      wxASSERT(m_refCount >= 1);
       if (!--m_refCount)
       {
         wxASSERT(!m_object);
@@ -143,7 +154,8 @@ class CellPtrBase
 {
 private:
   using ControlBlock = Observed::ControlBlock;
-  static size_t m_instanceCount;
+  //! The number of live pointers. Atomic, since cells can be created in a background task.
+  static std::atomic<size_t> m_instanceCount;
 
   const ControlBlock *m_cb = nullptr;
 
@@ -307,6 +307,8 @@ void ConfigDialogue::SetProperties()
   m_openHCaret->SetToolTip(_("If this checkbox is set a new code cell is opened as soon as maxima requests data. If it isn't set a new code cell is opened in this case as soon as the user starts typing in code."));
   m_restartOnReEvaluation->SetToolTip(
           _("Maxima provides no \"forget all\" command that flushes all settings a maxima session could make. wxMaxima therefore normally defaults to starting a fresh maxima process every time the worksheet is to be re-evaluated. As this needs a little bit of time this switch allows to disable this behavior."));
+  m_pipelineDepth->SetToolTip(
+          _("If many small cells are evaluated, waiting for maxima to answer each command before sending the next one takes most of the time. This many commands are therefore sent to maxima before it has answered the current one. Commands that might cause maxima to ask a question and :lisp commands are always sent one by one. If a command fails, maxima skips the commands that were sent in advance. 0 means: Always wait for maxima's answer."));
   m_maximaUserLocation->SetToolTip(_("Enter the path to the Maxima executable."));
   m_additionalParameters->SetToolTip(_("Additional parameters for Maxima"
                                                " (e.g. -l clisp)."));
@@ -317,6 +319,7 @@ void ConfigDialogue::SetProperties()
           _("If this checkbox is checked wxMaxima automatically saves the file closing and every few minutes giving wxMaxima a more cellphone-app-like feel as the file is virtually always saved. If this checkbox is unchecked from time to time a backup is made in the temp folder instead."));
   m_defaultFramerate->SetToolTip(_("Define the default speed (in frames per second) animations are played back with."));
   m_maxGnuplotMegabytes->SetToolTip(_("wxMaxima normally stores the gnuplot sources for every plot made using draw() in order to be able to open plots interactively in gnuplot later. This setting defines the limit [in Megabytes per plot] for this feature."));
+  m_bitmapCacheMegabytes->SetToolTip(_("wxMaxima keeps the images of the worksheet in the size they are displayed with in order to be able to redraw them fast. If the scaled images need more memory than this the ones that haven't been drawn for the longest time are discarded."));
   m_defaultPlotWidth->SetToolTip(
           _("The default width for embedded plots. Can be read out or overridden by the maxima variable wxplot_size"));
   m_defaultPlotHeight->SetToolTip(
@@ -366,6 +369,8 @@ void ConfigDialogue::SetProperties()
   m_defaultPort->SetToolTip(_("The default port used for communication between Maxima and wxMaxima."));
   m_undoLimit->SetToolTip(
           _("Save only this number of actions in the undo buffer. 0 means: save an infinite number of actions."));
+  m_editorUndoMemoryLimit->SetToolTip(
+          _("The maximum amount of memory in kilobytes the undo history of a single cell may use. If it grows beyond that the oldest changes are forgotten. 0 means: no limit."));
   m_recentItems->SetToolTip(_("The number of recently opened files that is to be remembered."));
   m_incrementalSearch->SetToolTip(_("Start searching while the phrase to search for is still being typed."));
   m_notifyIfIdle->SetToolTip(_("Issue a notification if maxima finishes calculating while the wxMaxima window isn't in focus."));
@@ -481,8 +486,11 @@ void ConfigDialogue::SetProperties()
   m_keepPercentWithSpecials->SetValue(keepPercent);
   m_abortOnError->SetValue(configuration->GetAbortOnError());
   m_restartOnReEvaluation->SetValue(configuration->RestartOnReEvaluation());
+  m_pipelineDepth->SetValue(configuration->PipelineDepth());
   m_defaultFramerate->SetValue(defaultFramerate);
   m_maxGnuplotMegabytes->SetValue(configuration->MaxGnuplotMegabytes());
+  m_bitmapCacheMegabytes->SetValue(configuration->BitmapCacheMegabytes());
+  m_editorUndoMemoryLimit->SetValue(configuration->EditorUndoMemoryLimit());
   m_defaultPlotWidth->SetValue(defaultPlotWidth);
   m_defaultPlotHeight->SetValue(defaultPlotHeight);
   m_displayedDigits->SetValue(configuration->GetDisplayedDigits());
@@ -849,6 +857,11 @@ wxPanel *ConfigDialogue::CreateOptionsPanel()
   grid_sizer->Add(ul, 0, wxALL | wxALIGN_CENTER_VERTICAL, 5);
   grid_sizer->Add(m_undoLimit, 0, wxALL, 5);
 
+  wxStaticText *eul = new wxStaticText(panel, -1, _("Undo memory per cell [kB]:"));
+  m_editorUndoMemoryLimit = new wxSpinCtrl(panel, -1, wxEmptyString, wxDefaultPosition, wxSize(150*GetContentScaleFactor(), -1), wxSP_ARROW_KEYS, 0, 100000);
+  grid_sizer->Add(eul, 0, wxALL | wxALIGN_CENTER_VERTICAL, 5);
+  grid_sizer->Add(m_editorUndoMemoryLimit, 0, wxALL, 5);
+
   wxStaticText *rf = new wxStaticText(panel, -1, _("Recent files list length:"));
   m_recentItems = new wxSpinCtrl(panel, -1, wxEmptyString, wxDefaultPosition, wxSize(150*GetContentScaleFactor(), -1), wxSP_ARROW_KEYS, 5, 30);
   grid_sizer->Add(rf, 0, wxALL | wxALIGN_CENTER_VERTICAL, 5);
@@ -867,6 +880,13 @@ wxPanel *ConfigDialogue::CreateOptionsPanel()
   grid_sizer->Add(mm, 0, wxALL | wxALIGN_CENTER_VERTICAL, 5);
   grid_sizer->Add(m_maxGnuplotMegabytes, 0, wxALL | wxALIGN_CENTER_VERTICAL, 5);
 
+  wxStaticText *bc = new wxStaticText(panel, -1, _("Memory for scaled images [MB]:"));
+  m_bitmapCacheMegabytes = new wxSpinCtrl(panel, -1, wxEmptyString, wxDefaultPosition, wxSize(150*GetContentScaleFactor(), -1), wxSP_ARROW_KEYS, 1,
+                                          16000);
+
+  grid_sizer->Add(bc, 0, wxALL | wxALIGN_CENTER_VERTICAL, 5);
+  grid_sizer->Add(m_bitmapCacheMegabytes, 0, wxALL | wxALIGN_CENTER_VERTICAL, 5);
+
   vsizer->Add(grid_sizer, 1, wxEXPAND, 5);
   
   m_savePanes = new wxCheckBox(panel, -1, _("Save panes layout"));
@@ -1010,6 +1030,14 @@ wxPanel *ConfigDialogue::CreateMaximaPanel()
 
   m_restartOnReEvaluation = new wxCheckBox(panel, -1, _("Start a new maxima for each re-evaluation"));
   vsizer->Add(m_restartOnReEvaluation, 0, wxALL, 5);
+
+  wxBoxSizer *pipelineSizer = new wxBoxSizer(wxHORIZONTAL);
+  pipelineSizer->Add(new wxStaticText(panel, -1, _("Commands to send to maxima in advance:")),
+                     0, wxALL | wxALIGN_CENTER_VERTICAL, 5);
+  m_pipelineDepth = new wxSpinCtrl(panel, -1, wxEmptyString, wxDefaultPosition, wxSize(150*GetContentScaleFactor(), -1), wxSP_ARROW_KEYS, 0,
+                                   64);
+  pipelineSizer->Add(m_pipelineDepth, 0, wxALL | wxALIGN_CENTER_VERTICAL, 5);
+  vsizer->Add(pipelineSizer);
   panel->SetSizerAndFit(vsizer);
 
   return panel;
@@ -1173,6 +1201,7 @@ void ConfigDialogue::WriteSettings()
   Configuration *configuration = m_configuration;
   configuration->SetAbortOnError(m_abortOnError->GetValue());
   configuration->RestartOnReEvaluation(m_restartOnReEvaluation->GetValue());
+  configuration->PipelineDepth(m_pipelineDepth->GetValue());
   configuration->MaximaUserLocation(m_maximaUserLocation->GetValue());
   configuration->AutodetectMaxima(m_autodetectMaxima->GetValue());
   configuration->HelpBrowserUserLocation(m_helpBrowserUserLocation->GetValue());
@@ -1212,6 +1241,8 @@ void ConfigDialogue::WriteSettings()
   configuration->AntiAliasLines(m_antialiasLines->GetValue());
   config->Write(wxT("DefaultFramerate"), m_defaultFramerate->GetValue());
   configuration->MaxGnuplotMegabytes(m_maxGnuplotMegabytes->GetValue());
+  configuration->BitmapCacheMegabytes(m_bitmapCacheMegabytes->GetValue());
+  configuration->EditorUndoMemoryLimit(m_editorUndoMemoryLimit->GetValue());
   config->Write(wxT("defaultPlotWidth"), m_defaultPlotWidth->GetValue());
   config->Write(wxT("defaultPlotHeight"), m_defaultPlotHeight->GetValue());
   configuration->SetDisplayedDigits(m_displayedDigits->GetValue());
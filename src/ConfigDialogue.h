@@ -246,6 +246,7 @@ protected:
   wxCheckBox *m_abortOnError;
   wxCheckBox *m_offerKnownAnswers;
   wxCheckBox *m_restartOnReEvaluation;
+  wxSpinCtrl *m_pipelineDepth;
   wxCheckBox *m_wrapLatexMath;
   wxCheckBox *m_savePanes;
   wxCheckBox *m_usesvg;
@@ -278,6 +279,7 @@ protected:
   wxChoice *m_autoWrap;
   wxSpinCtrl *m_labelWidth;
   wxSpinCtrl *m_undoLimit;
+  wxSpinCtrl *m_editorUndoMemoryLimit;
   wxSpinCtrl *m_recentItems;
   wxSpinCtrl *m_bitmapScale;
   wxSpinCtrlDouble *m_printScale;
@@ -307,6 +309,7 @@ protected:
   wxSpinCtrl *m_defaultPort;
   ExamplePanel *m_examplePanel;
   wxSpinCtrl *m_maxGnuplotMegabytes;
+  wxSpinCtrl *m_bitmapCacheMegabytes;
 
   //! Is called when the path to the maxima binary was changed.
   void MaximaLocationChanged(wxCommandEvent &unused);
@@ -58,6 +58,7 @@ Configuration::Configuration(wxDC *dc, InitOpt options) :
   #endif
 
   m_autoSaveAsTempFile = false;
+  m_profileEvaluations = false;
   m_inLispMode = false;
   m_htmlEquationFormat = mathJaX_TeX;
   m_autodetectMaxima = true;
@@ -91,6 +92,9 @@ Configuration::Configuration(wxDC *dc, InitOpt options) :
   m_abortOnError = true;
   m_defaultPort = 49152;
   m_maxGnuplotMegabytes = 12;
+  m_editorUndoMemoryLimit = 1024;
+  m_bitmapCacheMegabytes = 256;
+  m_pipelineDepth = 0;
   m_clientWidth = 1024;
   m_clientHeight = 768;
   m_indentMaths=true;
@@ -405,12 +409,22 @@ void Configuration::ReadConfig()
     config->Read(wxT("autoSaveMinutes"), &autoSaveMinutes);
     m_autoSaveAsTempFile = (autoSaveMinutes == 0);
   }
+  config->Read(wxT("profileEvaluations"), &m_profileEvaluations);
   config->Read("language", &m_language);
   if (m_language == wxLANGUAGE_UNKNOWN)
     m_language = wxLANGUAGE_DEFAULT;
 
   config->Read("invertBackground", &m_invertBackground);
   config->Read("maxGnuplotMegabytes", &m_maxGnuplotMegabytes);
+  config->Read("editorUndoMemoryLimit", &m_editorUndoMemoryLimit);
+  if (m_editorUndoMemoryLimit < 0)
+    m_editorUndoMemoryLimit = 0;
+  config->Read("bitmapCacheMegabytes", &m_bitmapCacheMegabytes);
+  if (m_bitmapCacheMegabytes < 1)
+    m_bitmapCacheMegabytes = 1;
+  config->Read("pipelineDepth", &m_pipelineDepth);
+  if (m_pipelineDepth < 0)
+    m_pipelineDepth = 0;
   config->Read("offerKnownAnswers", &m_offerKnownAnswers);
   config->Read(wxT("documentclass"), &m_documentclass);
   config->Read(wxT("documentclassoptions"), &m_documentclassOptions);
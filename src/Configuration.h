@@ -392,6 +392,11 @@ public:
   bool AutoSaveAsTempFile() const {return m_autoSaveAsTempFile;}
   void AutoSaveAsTempFile(bool asTempFile){wxConfig::Get()->Write(wxT("AutoSaveAsTempFile"), m_autoSaveAsTempFile = asTempFile);}
 
+  //! Do we want to measure what the evaluation of each cell costs?
+  bool ProfileEvaluations() const {return m_profileEvaluations;}
+  void ProfileEvaluations(bool profile)
+    {wxConfig::Get()->Write(wxT("profileEvaluations"), m_profileEvaluations = profile);}
+
   //! Set the minimum sensible line width in widths of a letter.
   void LineWidth_em(long width)
   { m_lineWidth_em = width; }
@@ -854,6 +859,24 @@ public:
   void MaxGnuplotMegabytes(long megaBytes)
     {wxConfig::Get()->Write("maxGnuplotMegabytes",m_maxGnuplotMegabytes = megaBytes);}
 
+  //! The maximum number of kilobytes the undo history of a single editor cell may use. 0 = unlimited
+  long EditorUndoMemoryLimit() const {return m_editorUndoMemoryLimit;}
+  void EditorUndoMemoryLimit(long kiloBytes)
+    {wxConfig::Get()->Write("editorUndoMemoryLimit",m_editorUndoMemoryLimit = kiloBytes);}
+
+  //! The maximum number of Megabytes the scaled versions of all images may use
+  long BitmapCacheMegabytes() const {return m_bitmapCacheMegabytes;}
+  void BitmapCacheMegabytes(long megaBytes)
+    {wxConfig::Get()->Write("bitmapCacheMegabytes",m_bitmapCacheMegabytes = megaBytes);}
+
+  /*! How many commands may be sent to maxima before it has answered the first one?
+
+    0 means: Send each command only after maxima has answered the last one.
+   */
+  long PipelineDepth() const {return m_pipelineDepth;}
+  void PipelineDepth(long depth)
+    {wxConfig::Get()->Write("pipelineDepth",m_pipelineDepth = depth);}
+
   bool OfferKnownAnswers() const {return m_offerKnownAnswers;}
   void OfferKnownAnswers(bool offerKnownAnswers)
     {wxConfig::Get()->Write("offerKnownAnswers",m_offerKnownAnswers = offerKnownAnswers);}
@@ -908,6 +931,7 @@ private:
 
   //! true = Autosave doesn't save into the current file.
   bool m_autoSaveAsTempFile;
+  bool m_profileEvaluations;
   //! The number of the language wxMaxima uses.
   long m_language;
   //! Autodetect maxima's location?
@@ -1019,6 +1043,9 @@ private:
   bool m_offerKnownAnswers;
   long m_defaultPort;
   long m_maxGnuplotMegabytes;
+  long m_editorUndoMemoryLimit;
+  long m_bitmapCacheMegabytes;
+  long m_pipelineDepth;
   std::unique_ptr<CellRedrawTrace> m_cellRedrawTrace;
   wxString m_documentclass;
   wxString m_documentclassOptions;
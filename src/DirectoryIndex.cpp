@@ -0,0 +1,260 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file defines the class DirectoryIndex that remembers the contents of
+  directories between wxMaxima sessions.
+
+  The index file is a text file:
+    - The first line is DirectoryIndex::m_header
+    - "D <mtime> <path>" starts the listing of a directory
+    - "F <name>" is a file in the last directory
+    - "S <name>" is a subdirectory of the last directory
+ */
+
+#include "DirectoryIndex.h"
+#include <wx/ffile.h>
+#include <wx/filefn.h>
+#include <wx/filename.h>
+#include <wx/tokenzr.h>
+#include <algorithm>
+#include <utility>
+
+const wxString DirectoryIndex::m_header = wxT("wxMaxima directory index 1");
+
+DirectoryIndex::DirectoryIndex(const wxString &indexFile) :
+  m_indexFile(indexFile)
+{
+}
+
+bool DirectoryIndex::Load()
+{
+  m_listings.clear();
+  if (m_indexFile.IsEmpty() || !wxFileExists(m_indexFile))
+    return false;
+
+  wxString contents;
+  {
+    wxFFile file(m_indexFile, wxT("rb"));
+    if (!file.IsOpened() || !file.ReadAll(&contents, wxConvUTF8))
+      return false;
+  }
+
+  wxStringTokenizer lines(contents, wxT("\n"), wxTOKEN_STRTOK);
+  if (lines.GetNextToken() != m_header)
+    return false;
+
+  Listing *listing = NULL;
+  while (lines.HasMoreTokens())
+  {
+    wxString line = lines.GetNextToken();
+    if ((line.Length() < 3) || (line[1] != wxT(' ')))
+    {
+      m_listings.clear();
+      return false;
+    }
+    wxString value = line.Mid(2);
+    if (line[0] == wxT('D'))
+    {
+      wxLongLong_t mtime;
+      if (!value.BeforeFirst(wxT(' ')).ToLongLong(&mtime))
+      {
+        m_listings.clear();
+        return false;
+      }
+      listing = &m_listings[value.AfterFirst(wxT(' '))];
+      listing->m_mtime = static_cast<time_t>(mtime);
+      listing->m_used = false;
+    }
+    else if ((line[0] == wxT('F')) && listing)
+      listing->m_files.push_back(value);
+    else if ((line[0] == wxT('S')) && listing)
+      listing->m_dirs.push_back(value);
+    else
+    {
+      m_listings.clear();
+      return false;
+    }
+  }
+  m_changed = false;
+  return true;
+}
+
+bool DirectoryIndex::Save()
+{
+  if (m_indexFile.IsEmpty())
+    return false;
+  for (const auto &listing : m_listings)
+    if (!listing.second.m_used)
+      m_changed = true;
+  if (!m_changed)
+    return true;
+
+  wxString contents = m_header + wxT("\n");
+  for (const auto &listing : m_listings)
+  {
+    if (!listing.second.m_used)
+      continue;
+    contents += wxString::Format(wxT("D %") wxLongLongFmtSpec wxT("d "),
+                                 static_cast<wxLongLong_t>(listing.second.m_mtime));
+    contents += listing.first + wxT("\n");
+    for (const auto &file : listing.second.m_files)
+      contents += wxT("F ") + file + wxT("\n");
+    for (const auto &dir : listing.second.m_dirs)
+      contents += wxT("S ") + dir + wxT("\n");
+  }
+
+  // Another wxMaxima process might read or write the index at the same time
+  // => each process writes to a file of its own and renames it.
+  wxString tempFile = wxFileName::CreateTempFileName(m_indexFile);
+  if (tempFile.IsEmpty())
+    return false;
+  bool written;
+  {
+    wxFFile file(tempFile, wxT("wb"));
+    written = file.IsOpened() && file.Write(contents, wxConvUTF8) && file.Close();
+  }
+  if (!written || !wxRenameFile(tempFile, m_indexFile, true))
+  {
+    wxRemoveFile(tempFile);
+    return false;
+  }
+  m_changed = false;
+  return true;
+}
+
+bool DirectoryIndex::Traverse(const wxString &dir, wxDirTraverser &traverser, bool validate)
+{
+  wxString path = dir;
+  while ((path.Length() > 1) && wxFileName::IsPathSeparator(path.Last()))
+    path.RemoveLast();
+
+  const Listing *listing = GetListing(path, validate);
+  if (!listing)
+    return false;
+  TraverseListing(path, *listing, traverser, validate);
+  return true;
+}
+
+wxDirTraverseResult DirectoryIndex::TraverseListing(const wxString &dir, const Listing &listing,
+                                                    wxDirTraverser &traverser, bool validate)
+{
+  // Reading the subdirectories may modify the index, and with it our listing.
+  const std::vector<wxString> dirs = listing.m_dirs;
+  const std::vector<wxString> files = listing.m_files;
+
+  wxString prefix = dir;
+  if (!wxFileName::IsPathSeparator(prefix.Last()))
+    prefix += wxFILE_SEP_PATH;
+
+  // Like wxDir::Traverse() we enumerate the subdirectories first.
+  for (const auto &subdir : dirs)
+  {
+    wxString path = prefix + subdir;
+    switch (traverser.OnDir(path))
+    {
+    case wxDIR_STOP:
+      return wxDIR_STOP;
+    case wxDIR_CONTINUE:
+    {
+      const Listing *sublisting = GetListing(path, validate);
+      wxDirTraverseResult result;
+      if (sublisting)
+        result = TraverseListing(path, *sublisting, traverser, validate);
+      else
+        result = traverser.OnOpenError(path);
+      if (result == wxDIR_STOP)
+        return wxDIR_STOP;
+      break;
+    }
+    default:
+      break;
+    }
+  }
+
+  for (const auto &file : files)
+    if (traverser.OnFile(prefix + file) == wxDIR_STOP)
+      return wxDIR_STOP;
+  return wxDIR_CONTINUE;
+}
+
+const DirectoryIndex::Listing *DirectoryIndex::GetListing(const wxString &dir, bool validate)
+{
+  auto cached = m_listings.find(dir);
+  if ((cached != m_listings.end()) && !validate)
+  {
+    cached->second.m_used = true;
+    return &cached->second;
+  }
+
+  time_t mtime = ModificationTime(dir);
+  if ((cached != m_listings.end()) && (mtime != -1) && (cached->second.m_mtime == mtime))
+  {
+    cached->second.m_used = true;
+    return &cached->second;
+  }
+
+  m_changed = true;
+  wxDir directory;
+  if ((mtime == -1) || !directory.Open(dir))
+  {
+    if (cached != m_listings.end())
+      m_listings.erase(cached);
+    return NULL;
+  }
+
+  Listing listing;
+  wxString name;
+  for (bool found = directory.GetFirst(&name, wxEmptyString, wxDIR_FILES | wxDIR_HIDDEN);
+       found; found = directory.GetNext(&name))
+    listing.m_files.push_back(name);
+  for (bool found = directory.GetFirst(&name, wxEmptyString, wxDIR_DIRS | wxDIR_HIDDEN);
+       found; found = directory.GetNext(&name))
+    listing.m_dirs.push_back(name);
+
+  // Names that contain a newline cannot be stored in the index file. They
+  // cannot be loaded by maxima, either.
+  auto hasNewline = [](const wxString &name){return name.Find(wxT('\n')) != wxNOT_FOUND;};
+  listing.m_files.erase(std::remove_if(listing.m_files.begin(), listing.m_files.end(), hasNewline),
+                        listing.m_files.end());
+  listing.m_dirs.erase(std::remove_if(listing.m_dirs.begin(), listing.m_dirs.end(), hasNewline),
+                       listing.m_dirs.end());
+
+  // A file that is created in the same second we read the directory in might not
+  // change the directory's modification time. Some file systems only store
+  // it to the next 2 seconds => don't trust very recent modification times.
+  if (mtime + 2 < time(NULL))
+    listing.m_mtime = mtime;
+
+  Listing &entry = m_listings[dir];
+  entry = std::move(listing);
+  return &entry;
+}
+
+time_t DirectoryIndex::ModificationTime(const wxString &dir)
+{
+  // Unlike wxFileModificationTime() wxStat() doesn't log an error if the
+  // directory doesn't exist.
+  wxStructStat status;
+  if (wxStat(dir, &status) != 0)
+    return -1;
+  return status.st_mtime;
+}
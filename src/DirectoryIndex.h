@@ -0,0 +1,118 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file declares the class DirectoryIndex that remembers the contents of
+  directories between wxMaxima sessions.
+ */
+
+#ifndef WXMAXIMA_DIRECTORYINDEX_H
+#define WXMAXIMA_DIRECTORYINDEX_H
+
+#include <wx/string.h>
+#include <wx/dir.h>
+#include <wx/hashmap.h>
+#include <ctime>
+#include <unordered_map>
+#include <vector>
+
+/*! A cache of directory listings that are validated by the directories' mtime
+
+  Adding a file to a directory or removing one from it changes the directory's
+  modification time. Asking the file system for this time is one stat() per
+  directory, which on network file systems is far cheaper than re-reading
+  the directory. Traverse() therefore only re-reads the directories whose
+  modification time differs from the one we saw when reading them last time.
+
+  The index can be stored in a file: Load() reads it in one go so the lists of
+  files are available at startup without touching the directories at all.
+
+  DirectoryIndex does no locking of its own.
+ */
+class DirectoryIndex
+{
+public:
+  //! An index that is stored in \p indexFile, or in memory only, if that is empty.
+  explicit DirectoryIndex(const wxString &indexFile = wxEmptyString);
+
+  /*! Reads the index file
+
+    \return false, if there is no index file or it cannot be used.
+   */
+  bool Load();
+
+  /*! Writes the listings Traverse() has used since Load() to the index file
+
+    Listings Traverse() didn't need are dropped: Those are the ones of
+    directories that no more exist or no more are of interest to us.
+    Does nothing if nothing has changed.
+   */
+  bool Save();
+
+  /*! Enumerates the contents of \p dir the same way wxDir::Traverse() does
+
+    \param dir The directory to enumerate
+    \param traverser Gets told about all files and subdirectories
+    \param validate
+      - true: Re-read all directories whose modification time has changed since
+        they were read the last time.
+      - false: Use the listings we have without checking if they are still
+        up-to-date. Only directories that aren't in the index yet are read from
+        the disk.
+    \return false, if \p dir cannot be read.
+   */
+  bool Traverse(const wxString &dir, wxDirTraverser &traverser, bool validate = true);
+
+private:
+  //! The contents of one directory
+  struct Listing
+  {
+    //! The directory's modification time, or -1, if we cannot rely on it.
+    time_t m_mtime = -1;
+    //! The names of the files in the directory
+    std::vector<wxString> m_files;
+    //! The names of the subdirectories
+    std::vector<wxString> m_dirs;
+    //! Has Traverse() needed this listing since the index was loaded?
+    bool m_used = true;
+  };
+
+  //! The listing of \p dir, or NULL, if it cannot be read
+  const Listing *GetListing(const wxString &dir, bool validate);
+
+  //! The recursive part of Traverse()
+  wxDirTraverseResult TraverseListing(const wxString &dir, const Listing &listing,
+                                      wxDirTraverser &traverser, bool validate);
+
+  //! The modification time of \p dir, or -1, if it doesn't exist.
+  static time_t ModificationTime(const wxString &dir);
+
+  //! The listings, by the full path of the directory
+  std::unordered_map<wxString, Listing, wxStringHash> m_listings;
+  //! The file the index is stored in
+  wxString m_indexFile;
+  //! Does the index file need to be written?
+  bool m_changed = false;
+  //! The first line of the index file. Change this if the format changes.
+  static const wxString m_header;
+};
+
+#endif // WXMAXIMA_DIRECTORYINDEX_H
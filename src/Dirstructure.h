@@ -98,6 +98,18 @@ public:
     {
       return UserConfDir() + "/manual_anchors.xml";
     }
+
+  //! The file the full-text index of maxima's manual is stored in
+  static wxString ManualIndexFile()
+    {
+      return UserConfDir() + "/manual_index.txt";
+    }
+
+  //! The file the DirectoryIndex of maxima's packages and demos is stored in
+  static wxString DirectoryIndexFile()
+    {
+      return UserConfDir() + "/directory_index.txt";
+    }
   
   static Dirstructure *Get()
     {
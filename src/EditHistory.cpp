@@ -0,0 +1,132 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+#include "EditHistory.h"
+
+void EditHistory::Push(const wxString &text, int caretPosition, int selStart, int selEnd)
+{
+  if (!m_selections.empty())
+  {
+    // Find the part at the start and at the end both texts have in common
+    size_t oldLength = m_lastText.Length();
+    size_t newLength = text.Length();
+    size_t prefix = 0;
+    wxString::const_iterator oldChar = m_lastText.begin();
+    wxString::const_iterator newChar = text.begin();
+    while ((oldChar != m_lastText.end()) && (newChar != text.end()) && (*oldChar == *newChar))
+    {
+      ++oldChar;
+      ++newChar;
+      ++prefix;
+    }
+    size_t suffix = 0;
+    wxString::const_reverse_iterator oldRChar = m_lastText.rbegin();
+    wxString::const_reverse_iterator newRChar = text.rbegin();
+    while ((prefix + suffix < oldLength) && (prefix + suffix < newLength) &&
+           (*oldRChar == *newRChar))
+    {
+      ++oldRChar;
+      ++newRChar;
+      ++suffix;
+    }
+
+    Delta delta;
+    delta.start = prefix;
+    delta.removed = m_lastText.Mid(prefix, oldLength - prefix - suffix);
+    delta.inserted = text.Mid(prefix, newLength - prefix - suffix);
+    m_bytes += delta.GetBytes();
+    m_deltas.push_back(std::move(delta));
+  }
+  m_selections.push_back({caretPosition, selStart, selEnd});
+  m_lastText = text;
+}
+
+const EditHistory::State &EditHistory::Get(size_t index)
+{
+  wxASSERT(index < size());
+  if (m_cursorIndex >= size())
+  {
+    m_cursorIndex = size() - 1;
+    m_cursor.text = m_lastText;
+  }
+
+  while (m_cursorIndex > index)
+  {
+    const Delta &delta = m_deltas[--m_cursorIndex];
+    m_cursor.text.replace(delta.start, delta.inserted.Length(), delta.removed);
+  }
+  while (m_cursorIndex < index)
+  {
+    const Delta &delta = m_deltas[m_cursorIndex++];
+    m_cursor.text.replace(delta.start, delta.removed.Length(), delta.inserted);
+  }
+
+  const Selection &selection = m_selections[index];
+  m_cursor.caretPosition = selection.caretPosition;
+  m_cursor.selStart = selection.selStart;
+  m_cursor.selEnd = selection.selEnd;
+  return m_cursor;
+}
+
+void EditHistory::Truncate(size_t count)
+{
+  if (count >= size())
+    return;
+  if (count == 0)
+  {
+    Clear();
+    return;
+  }
+
+  m_lastText = Get(count - 1).text;
+  while (m_deltas.size() > count - 1)
+  {
+    m_bytes -= m_deltas.back().GetBytes();
+    m_deltas.pop_back();
+  }
+  m_selections.resize(count);
+}
+
+void EditHistory::Limit(size_t maxBytes)
+{
+  if (maxBytes == 0)
+    return;
+  while ((m_bytes > maxBytes) && !m_deltas.empty())
+  {
+    m_bytes -= m_deltas.front().GetBytes();
+    m_deltas.pop_front();
+    m_selections.pop_front();
+    if (m_cursorIndex > 0)
+      m_cursorIndex--;
+    else
+      m_cursorIndex = noCursor;
+  }
+}
+
+void EditHistory::Clear()
+{
+  m_selections.clear();
+  m_deltas.clear();
+  m_lastText.Clear();
+  m_cursor = {};
+  m_cursorIndex = noCursor;
+  m_bytes = 0;
+}
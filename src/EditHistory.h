@@ -0,0 +1,123 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file declares the class EditHistory that stores the undo history of an
+  EditorCell.
+ */
+
+#ifndef WXMAXIMA_EDITHISTORY_H
+#define WXMAXIMA_EDITHISTORY_H
+
+#include <wx/string.h>
+#include <cstddef>
+#include <deque>
+
+/*! The undo history of an EditorCell
+
+  Only the newest text is stored in full. For every other state we only store
+  the range of text that differs from the following state. A long cell that
+  has been edited for an hour therefore doesn't hold hundreds of copies of
+  itself. Earlier states are rebuilt on demand by applying these differences,
+  starting from the state that was rebuilt last. This is cheap as undo and
+  redo only ever move to a neighbouring state.
+ */
+class EditHistory
+{
+public:
+  //! One state of the editor
+  struct State
+  {
+    wxString text;
+    int caretPosition = -1;
+    int selStart = -1;
+    int selEnd = -1;
+  };
+
+  //! The number of states in the history
+  size_t size() const { return m_selections.size(); }
+  bool empty() const { return m_selections.empty(); }
+
+  //! Append a state to the history
+  void Push(const wxString &text, int caretPosition, int selStart, int selEnd);
+
+  //! The text of the newest state
+  const wxString &LastText() const { return m_lastText; }
+
+  /*! Returns the state with the given index
+
+    The reference stays valid until the history is changed or Get() is called
+    again.
+  */
+  const State &Get(size_t index);
+
+  //! Drop all states but the first count ones
+  void Truncate(size_t count);
+
+  /*! Drop the oldest states until the stored differences use no more than maxBytes
+
+    0 means: Don't limit the memory usage.
+   */
+  void Limit(size_t maxBytes);
+
+  //! The approximate number of bytes the stored differences use
+  size_t GetMemoryUsage() const { return m_bytes; }
+
+  void Clear();
+
+private:
+  //! The caret position and selection of a state
+  struct Selection
+  {
+    int caretPosition;
+    int selStart;
+    int selEnd;
+  };
+
+  //! What needs to be replaced in a state's text to get the next state's text
+  struct Delta
+  {
+    //! Where the two texts start to differ
+    size_t start;
+    //! The text that is only in the older state
+    wxString removed;
+    //! The text that is only in the newer state
+    wxString inserted;
+    size_t GetBytes() const
+      { return sizeof(Delta) + (removed.Length() + inserted.Length()) * sizeof(wxChar); }
+  };
+
+  //! The caret positions and selections of all states, the oldest one first
+  std::deque<Selection> m_selections;
+  //! m_deltas[i] turns the text of state i into the one of state i + 1
+  std::deque<Delta> m_deltas;
+  //! The text of the newest state
+  wxString m_lastText;
+  //! The state Get() has rebuilt last
+  State m_cursor;
+  //! The index of m_cursor; Invalid if it is >= size()
+  size_t m_cursorIndex = noCursor;
+  static constexpr size_t noCursor = static_cast<size_t>(-1);
+  //! The sum of the sizes of the deltas
+  size_t m_bytes = 0;
+};
+
+#endif // WXMAXIMA_EDITHISTORY_H
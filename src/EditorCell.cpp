@@ -31,6 +31,7 @@
 
 #include "CellPointers.h"
 #include "MarkDown.h"
+#include "TextExtentCache.h"
 #include "wxMaxima.h"
 #include "wxMaximaFrame.h"
 #include <wx/clipbrd.h>
@@ -618,12 +619,13 @@ void EditorCell::RecalculateWidths(AFontSize fontsize)
 
     // Measure the text hight using characters that might extend below or above the region
     // ordinary characters move in.
-    int charWidth;
-    dc->GetTextExtent(wxT("äXÄgy"), &charWidth, &m_charHeight);
+    wxSize charSize = TextExtentCache::GetATextExtent(dc, wxT("äXÄgy"));
+    int charWidth = charSize.GetWidth();
+    m_charHeight = charSize.GetHeight();
 
     // We want a little bit of vertical space between two text lines (and between two labels).
     m_charHeight += 2 * MC_TEXT_PADDING;
-    int width = 0, tokenwidth, tokenheight, linewidth = 0;
+    int width = 0, linewidth = 0;
 
     m_numberOfLines = 1;
 
@@ -642,8 +644,7 @@ void EditorCell::RecalculateWidths(AFontSize fontsize)
       }
       else
       {
-        dc->GetTextExtent(textSnippet->GetText(), &tokenwidth, &tokenheight);
-        linewidth += tokenwidth;
+        linewidth += GetTextSize(textSnippet->GetText()).GetWidth();
         width = wxMax(width, linewidth);
       }
     }
@@ -1064,8 +1065,8 @@ wxSize EditorCell::GetTextSize(wxString const &text)
   if(it != m_widths.end())
     return it->second;
 
-  // Ask wxWidgets to return this text piece's size (slow!)
-  wxSize sz = dc->GetTextExtent(text);
+  // Ask the process-wide cache, which asks wxWidgets (slow!) if need be
+  wxSize sz = TextExtentCache::GetATextExtent(dc, text);
   m_widths[text] = sz;
   return sz;
 }
@@ -2234,7 +2235,7 @@ bool EditorCell::HandleOrdinaryKey(wxKeyEvent &event)
 
   if (m_historyPosition != -1)
   {
-    m_history.erase(m_history.begin() + m_historyPosition + 1, m_history.end());
+    m_history.Truncate(m_historyPosition + 1);
     m_historyPosition = -1;
   }
 
@@ -2595,7 +2596,7 @@ void EditorCell::ActivateCursor()
     FindMatchingParens();
 }
 
-bool EditorCell::AddEnding()
+bool EditorCell::NeedsEnding() const
 {
   // Lisp cells don't require a maxima line ending
   if((*m_configuration)->InLispMode())
@@ -2626,15 +2627,18 @@ bool EditorCell::AddEnding()
         endingNeeded = true;
     }
   }
+  return endingNeeded;
+}
 
-  if(endingNeeded)
-  {
-    m_text += wxT(";");
-    m_paren1 = m_paren2 = m_width = -1;
-    StyleText();
-    return true;
-  }
-  return false;
+bool EditorCell::AddEnding()
+{
+  if(!NeedsEnding())
+    return false;
+
+  m_text += wxT(";");
+  m_paren1 = m_paren2 = m_width = -1;
+  StyleText();
+  return true;
 }
 
 //
@@ -3246,7 +3250,7 @@ int EditorCell::GetLineWidth(unsigned int line, int pos)
   return width;
 }
 
-void EditorCell::SetState(const HistoryEntry &state)
+void EditorCell::SetState(const EditHistory::State &state)
 {
   m_text = state.text;
   StyleText();
@@ -3256,7 +3260,7 @@ void EditorCell::SetState(const HistoryEntry &state)
 
 void EditorCell::AppendStateToHistory()
 {
-  m_history.emplace_back(m_text, m_positionOfCaret, m_selectionStart, m_selectionEnd);
+  m_history.Push(m_text, m_positionOfCaret, m_selectionStart, m_selectionEnd);
 }
 
 bool EditorCell::IsActive() const
@@ -3281,7 +3285,7 @@ void EditorCell::Undo()
     return;
 
   // We cannot use SetValue() here, since SetValue() tends to move the cursor.
-  SetState(m_history[m_historyPosition]);
+  SetState(m_history.Get(m_historyPosition));
 
   m_paren1 = m_paren2 = -1;
   m_isDirty = true;
@@ -3307,7 +3311,7 @@ void EditorCell::Redo()
     return;
 
   // We cannot use SetValue() here, since SetValue() tends to move the cursor.
-  SetState(m_history[m_historyPosition]);
+  SetState(m_history.Get(m_historyPosition));
 
   m_paren1 = m_paren2 = -1;
   m_isDirty = true;
@@ -3317,21 +3321,22 @@ void EditorCell::Redo()
 
 void EditorCell::SaveValue()
 {
-  if (!m_history.empty() && m_history.back().text == m_text)
+  if (!m_history.empty() && m_history.LastText() == m_text)
     return;
 
   if (m_historyPosition != -1)
   {
-    m_history.erase(m_history.begin() + m_historyPosition, m_history.end());
+    m_history.Truncate(m_historyPosition);
   }
 
   AppendStateToHistory();
   m_historyPosition = -1;
+  m_history.Limit((*m_configuration)->EditorUndoMemoryLimit() * 1024);
 }
 
 void EditorCell::ClearUndo()
 {
-  m_history.clear();
+  m_history.Clear();
   m_historyPosition = -1;
 }
 
@@ -3401,8 +3406,19 @@ void EditorCell::StyleTextCode()
     }
   }
 
-  // Split the line into commands, numbers etc.
-  m_tokens = MaximaTokenizer(textToStyle, *m_configuration).PopTokens();
+  // Split the line into commands, numbers etc. Only the lines that have changed
+  // since the last time need to be split again.
+  if (m_firstLineOnly)
+  {
+    m_tokens = MaximaTokenizer(textToStyle, *m_configuration).PopTokens();
+    m_tokensText.Clear();
+  }
+  else
+  {
+    m_tokens = MaximaTokenizer(textToStyle, *m_configuration,
+                               m_tokensText, std::move(m_tokens)).PopTokens();
+    m_tokensText = textToStyle;
+  }
 
   // Now handle the text pieces one by one
   wxString lastTokenWithText;
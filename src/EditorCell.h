@@ -27,6 +27,7 @@
 #include "Cell.h"
 #include "FontAttribs.h"
 #include "MaximaTokenizer.h"
+#include "EditHistory.h"
 #include <vector>
 #include <list>
 
@@ -191,6 +192,8 @@ public:
   //! Return the index of the last char of the line containing the letter \#pos,
   size_t EndOfLine(long pos);
 
+  //! Does the last command in this cell lack a ";" or "$" at its end?
+  bool NeedsEnding() const;
   //! Adds a ";" to the end of the last command in this cell in case that it doesn't end in $ or ;
   bool AddEnding() override;
 
@@ -532,6 +535,9 @@ private:
     ResetSize();
     ResetData();
     m_widths.clear();
+    // The tokens depend on the configuration, too
+    m_tokensText.Clear();
+    m_tokens.clear();
   }
 
   /*! Adds soft line breaks to code cells, if needed.
@@ -564,18 +570,8 @@ private:
   //! Determines the size of a text snippet
   wxSize GetTextSize(const wxString &text);
 
-  struct HistoryEntry // 64 bytes
-  {
-    wxString text;
-    int caretPosition = -1;
-    int selStart = -1;
-    int selEnd = -1;
-    HistoryEntry() = default;
-    HistoryEntry(const wxString &text, int caretPosition, int selStart, int selEnd) :
-      text(text), caretPosition(caretPosition), selStart(selStart), selEnd(selEnd) {}
-  };
   //! Set the editor's state from a history entry
-  void SetState(const HistoryEntry &state);
+  void SetState(const EditHistory::State &state);
   //! Append the editor's state to the history
   void AppendStateToHistory();
 
@@ -590,11 +586,14 @@ private:
 
   //! The individual commands, parenthesis, strings and whitespaces a code cell consists of
   MaximaTokenizer::TokenList m_tokens;
+  //! The text m_tokens was generated from
+  wxString m_tokensText;
 
   wxString m_text;
   std::vector<StyledText> m_styledText;
 
-  std::vector<HistoryEntry> m_history;
+  //! The undo history of this cell
+  EditHistory m_history;
 
 //** 8/4 bytes
 //**
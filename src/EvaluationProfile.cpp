@@ -0,0 +1,298 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file defines the classes that measure what the evaluation of a cell costs.
+ */
+
+#include "EvaluationProfile.h"
+#include <wx/ffile.h>
+#include <wx/log.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#ifdef __WXMSW__
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+//! Formats a time with a "." as decimal separator, whatever the locale says
+static wxString Seconds(double seconds)
+{
+  long long milliseconds = std::llround(seconds * 1000);
+  return wxString::Format(wxT("%") wxLongLongFmtSpec wxT("d.%03") wxLongLongFmtSpec wxT("d"),
+                          milliseconds / 1000, milliseconds % 1000);
+}
+
+//! Quotes a field of a CSV file
+static wxString CSVQuote(wxString text)
+{
+  text.Replace(wxT("\""), wxT("\"\""));
+  return wxT("\"") + text + wxT("\"");
+}
+
+//! Quotes a JSON string
+static wxString JSONQuote(const wxString &text)
+{
+  wxString quoted = wxT("\"");
+  for (wxString::const_iterator it = text.begin(); it != text.end(); ++it)
+  {
+    wxUniChar ch = *it;
+    if ((ch == wxT('"')) || (ch == wxT('\\')))
+      quoted += wxString(wxT("\\")) + ch;
+    else if (ch == wxT('\n'))
+      quoted += wxT("\\n");
+    else if (ch == wxT('\t'))
+      quoted += wxT("\\t");
+    else if (ch.GetValue() < 0x20)
+      quoted += wxString::Format(wxT("\\u%04x"), static_cast<unsigned int>(ch.GetValue()));
+    else
+      quoted += ch;
+  }
+  return quoted + wxT("\"");
+}
+
+wxString EvaluationProfile::CSVHeader()
+{
+  return wxT("cell,wall_time_s,user_cpu_s,system_cpu_s,peak_memory_bytes,output_bytes");
+}
+
+wxString EvaluationProfile::ToCSV(const wxString &label) const
+{
+  // Unknown values are left empty
+  wxString csv = CSVQuote(label) + wxT(",") + Seconds(m_wallTime) + wxT(",");
+  if (m_userTime >= 0)
+    csv += Seconds(m_userTime);
+  csv += wxT(",");
+  if (m_systemTime >= 0)
+    csv += Seconds(m_systemTime);
+  csv += wxT(",");
+  if (m_peakMemory >= 0)
+    csv += wxString::Format(wxT("%") wxLongLongFmtSpec wxT("d"), m_peakMemory);
+  csv += wxString::Format(wxT(",%") wxLongLongFmtSpec wxT("d"), m_outputBytes);
+  return csv;
+}
+
+wxString EvaluationProfile::ToJSON(const wxString &label) const
+{
+  wxString json = wxT("{\"cell\": ") + JSONQuote(label);
+  json += wxT(", \"wall_time_s\": ") + Seconds(m_wallTime);
+  json += wxT(", \"user_cpu_s\": ") + ((m_userTime >= 0) ? Seconds(m_userTime) : wxString(wxT("null")));
+  json += wxT(", \"system_cpu_s\": ") +
+    ((m_systemTime >= 0) ? Seconds(m_systemTime) : wxString(wxT("null")));
+  json += wxT(", \"peak_memory_bytes\": ") +
+    ((m_peakMemory >= 0) ? wxString::Format(wxT("%") wxLongLongFmtSpec wxT("d"), m_peakMemory) :
+     wxString(wxT("null")));
+  json += wxString::Format(wxT(", \"output_bytes\": %") wxLongLongFmtSpec wxT("d}"), m_outputBytes);
+  return json;
+}
+
+#ifndef __WXMSW__
+/*! Reads a file from /proc
+
+  These files are small and generated on the fly => a single read gets all of
+  the file and nothing needs to be converted to a wxString.
+ */
+static bool ReadProcFile(const wxString &name, char *buffer, size_t size)
+{
+  // Called on every tick of a timer => even a log message would be too much
+  wxLogNull suppressor;
+  wxFFile file(name, wxT("rb"));
+  if (!file.IsOpened())
+    return false;
+  size_t length = file.Read(buffer, size - 1);
+  buffer[length] = '\0';
+  return length > 0;
+}
+#endif
+
+bool ProcessStats::Read(long pid)
+{
+#ifdef __WXMSW__
+  HANDLE process = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, false, pid);
+  if (process == NULL)
+    return false;
+  FILETIME creationTime, exitTime, kernelTime, userTime;
+  bool ok = GetProcessTimes(process, &creationTime, &exitTime, &kernelTime, &userTime);
+  CloseHandle(process);
+  if (!ok)
+    return false;
+  // A FILETIME counts 100ns intervals
+  m_userTime = ((static_cast<unsigned long long>(userTime.dwHighDateTime) << 32) +
+                userTime.dwLowDateTime) / 1e7;
+  m_systemTime = ((static_cast<unsigned long long>(kernelTime.dwHighDateTime) << 32) +
+                  kernelTime.dwLowDateTime) / 1e7;
+  return true;
+#else
+  char buffer[4096];
+  bool ok = false;
+  long ticksPerSecond = sysconf(_SC_CLK_TCK);
+  if ((ticksPerSecond > 0) &&
+      ReadProcFile(wxString::Format(wxT("/proc/%li/stat"), pid), buffer, sizeof(buffer)))
+    ok = ParseStat(buffer, ticksPerSecond);
+  if (ReadProcFile(wxString::Format(wxT("/proc/%li/status"), pid), buffer, sizeof(buffer)))
+    ok = ParseStatus(buffer) || ok;
+  return ok;
+#endif
+}
+
+double ProcessStats::TotalCPUTime()
+{
+#ifdef __WXMSW__
+  return -1;
+#else
+  char buffer[4096];
+  long ticksPerSecond = sysconf(_SC_CLK_TCK);
+  if ((ticksPerSecond <= 0) || !ReadProcFile(wxT("/proc/stat"), buffer, sizeof(buffer)))
+    return -1;
+  return ParseTotalCPUTime(buffer, ticksPerSecond);
+#endif
+}
+
+double ProcessStats::ParseTotalCPUTime(const char *stat, double ticksPerSecond)
+{
+  // The line starting with "cpu " sums up all CPUs. We add up the time spent
+  // in user mode, in user mode with low priority and in the kernel.
+  if (strncmp(stat, "cpu ", 4) != 0)
+    return -1;
+  const char *pos = stat + 4;
+  unsigned long long ticks = 0;
+  for (int i = 0; i < 3; i++)
+  {
+    char *end;
+    ticks += strtoull(pos, &end, 10);
+    if (end == pos)
+      return -1;
+    pos = end;
+  }
+  return ticks / ticksPerSecond;
+}
+
+bool ProcessStats::ParseStat(const char *stat, double ticksPerSecond)
+{
+  // The 2nd field is the name of the executable in parenthesis. It might contain spaces.
+  const char *pos = strrchr(stat, ')');
+  if (!pos)
+    return false;
+  pos++;
+
+  // Skip the fields 3 to 13. utime and stime are the fields 14 and 15.
+  for (int field = 3; field <= 13; field++)
+  {
+    while (*pos == ' ')
+      pos++;
+    while ((*pos != '\0') && (*pos != ' '))
+      pos++;
+  }
+  char *end;
+  unsigned long long userTicks = strtoull(pos, &end, 10);
+  if (end == pos)
+    return false;
+  pos = end;
+  unsigned long long systemTicks = strtoull(pos, &end, 10);
+  if (end == pos)
+    return false;
+  pos = end;
+
+  m_userTime = userTicks / ticksPerSecond;
+  m_systemTime = systemTicks / ticksPerSecond;
+
+  // cutime and cstime follow
+  unsigned long long childTicks = 0;
+  for (int field = 16; field <= 17; field++)
+  {
+    long long ticks = strtoll(pos, &end, 10);
+    if (end == pos)
+      break;
+    pos = end;
+    if (ticks > 0)
+      childTicks += ticks;
+  }
+  m_childTime = childTicks / ticksPerSecond;
+  return true;
+}
+
+//! The value of a "key: value kB" line of /proc/<pid>/status in bytes, or -1
+static long long StatusValue(const char *status, const char *key)
+{
+  const char *pos = strstr(status, key);
+  if (!pos)
+    return -1;
+  pos += strlen(key);
+  char *end;
+  long long kiloBytes = strtoll(pos, &end, 10);
+  if (end == pos)
+    return -1;
+  return kiloBytes * 1024;
+}
+
+bool ProcessStats::ParseStatus(const char *status)
+{
+  m_memory = StatusValue(status, "\nVmRSS:");
+  // The "high water mark" of the resident set size
+  m_peakMemory = StatusValue(status, "\nVmHWM:");
+  return (m_memory >= 0) || (m_peakMemory >= 0);
+}
+
+void EvaluationProfiler::Start(long pid)
+{
+  m_pid = pid;
+  m_running = true;
+  m_profile = EvaluationProfile();
+  m_start = ProcessStats();
+  m_start.Read(pid);
+  m_sampledPeakMemory = m_start.m_memory;
+  m_stopWatch.Start();
+}
+
+void EvaluationProfiler::Sample()
+{
+  if (!m_running)
+    return;
+  ProcessStats now;
+  if (now.Read(m_pid))
+    m_sampledPeakMemory = std::max(m_sampledPeakMemory, now.m_memory);
+}
+
+EvaluationProfile EvaluationProfiler::Stop()
+{
+  if (!m_running)
+    return m_profile;
+  m_running = false;
+  m_profile.m_wallTime = m_stopWatch.Time() / 1000.0;
+
+  ProcessStats end;
+  if (!end.Read(m_pid))
+    return m_profile;
+  if ((m_start.m_userTime >= 0) && (end.m_userTime >= 0))
+    m_profile.m_userTime = end.m_userTime - m_start.m_userTime;
+  if ((m_start.m_systemTime >= 0) && (end.m_systemTime >= 0))
+    m_profile.m_systemTime = end.m_systemTime - m_start.m_systemTime;
+  // If the highest memory usage of maxima's lifetime has risen during this
+  // evaluation we know the exact peak. Else our samples are the best guess.
+  if ((end.m_peakMemory >= 0) && (end.m_peakMemory > m_start.m_peakMemory))
+    m_profile.m_peakMemory = end.m_peakMemory;
+  else
+    m_profile.m_peakMemory = std::max(m_sampledPeakMemory, end.m_memory);
+  return m_profile;
+}
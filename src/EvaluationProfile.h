@@ -0,0 +1,131 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file declares the classes that measure what the evaluation of a cell costs.
+ */
+
+#ifndef WXMAXIMA_EVALUATIONPROFILE_H
+#define WXMAXIMA_EVALUATIONPROFILE_H
+
+#include <wx/string.h>
+#include <wx/stopwatch.h>
+
+//! What the evaluation of a cell has cost
+struct EvaluationProfile
+{
+  //! The time from sending the cell to maxima to its last prompt, in seconds
+  double m_wallTime = 0;
+  //! The CPU time maxima has spent in user mode in seconds, or -1, if unknown
+  double m_userTime = -1;
+  //! The CPU time maxima has spent in the kernel in seconds, or -1, if unknown
+  double m_systemTime = -1;
+  //! The highest amount of RAM maxima has used, in bytes, or -1, if unknown
+  long long m_peakMemory = -1;
+  //! The number of bytes maxima has output
+  long long m_outputBytes = 0;
+
+  //! The column names for ToCSV()
+  static wxString CSVHeader();
+  //! One line of a CSV file that describes the evaluation of the cell \p label
+  wxString ToCSV(const wxString &label) const;
+  //! A JSON object that describes the evaluation of the cell \p label
+  wxString ToJSON(const wxString &label) const;
+};
+
+//! A snapshot of the resources a process has used
+struct ProcessStats
+{
+  //! The CPU time the process has spent in user mode in seconds, or -1, if unknown
+  double m_userTime = -1;
+  //! The CPU time the process has spent in the kernel in seconds, or -1, if unknown
+  double m_systemTime = -1;
+  //! The CPU time the children the process has waited for have used, in seconds
+  double m_childTime = 0;
+  //! The amount of RAM the process currently uses in bytes, or -1, if unknown
+  long long m_memory = -1;
+  //! The highest amount of RAM the process has used, in bytes, or -1, if unknown
+  long long m_peakMemory = -1;
+
+  /*! Reads the statistics of the process \p pid
+
+    On Linux these come from /proc/<pid>/stat and /proc/<pid>/status, each of which
+    is read with a single read() and parsed in place.
+    \return false, if the operating system cannot tell us anything.
+   */
+  bool Read(long pid);
+
+  /*! Extracts the CPU times from the contents of /proc/<pid>/stat
+
+    This includes the times of the children the process has waited for, for
+    example of gnuplot.
+
+    \param stat The file's contents
+    \param ticksPerSecond The unit the times are measured in
+   */
+  bool ParseStat(const char *stat, double ticksPerSecond);
+  //! Extracts the memory usage from the contents of /proc/<pid>/status
+  bool ParseStatus(const char *status);
+
+  /*! The CPU time all processes together have used since the system has started
+
+    \return The time in seconds, or -1, if the operating system doesn't tell us.
+   */
+  static double TotalCPUTime();
+  //! Extracts the total CPU time from the contents of /proc/stat
+  static double ParseTotalCPUTime(const char *stat, double ticksPerSecond);
+};
+
+/*! Measures what the evaluation of a cell costs
+
+  Start() is called when wxMaxima sends a cell to maxima and Stop() when maxima
+  has finished it. Sample() is called by the timer that polls maxima while it
+  is busy: Unless the operating system tells us the peak memory usage directly
+  the samples are the best guess for it we have.
+ */
+class EvaluationProfiler
+{
+public:
+  //! Starts measuring the evaluation of a cell by the maxima process \p pid
+  void Start(long pid);
+  //! Records the current memory usage of maxima
+  void Sample();
+  //! Counts output maxima has sent
+  void AddOutput(size_t bytes) { m_profile.m_outputBytes += bytes; }
+  //! Are we measuring the evaluation of a cell?
+  bool IsRunning() const { return m_running; }
+  //! Stops measuring and returns what the evaluation has cost
+  EvaluationProfile Stop();
+
+private:
+  //! The process we measure
+  long m_pid = -1;
+  bool m_running = false;
+  //! Measures the wall time
+  wxStopWatch m_stopWatch;
+  //! The resources maxima had used before the evaluation started
+  ProcessStats m_start;
+  //! The highest memory usage Sample() has seen
+  long long m_sampledPeakMemory = -1;
+  EvaluationProfile m_profile;
+};
+
+#endif // WXMAXIMA_EVALUATIONPROFILE_H
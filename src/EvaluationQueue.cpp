@@ -129,41 +129,8 @@ void EvaluationQueue::AddTokens(GroupCell *cell)
 {
   if (cell == NULL)
     return;
-  wxString token;
-  int index = 0;
-  for (auto const &tok : cell->GetEditable()->GetTokens())
-  {
-    const TextStyle itemStyle = tok.GetStyle();
-    wxString itemText = tok.GetText();
-    itemText.Replace(wxT("\u00a0"), " ");
-    index += itemText.Length();
-    if (itemStyle != TS_CODE_COMMENT)
-      token += itemText;
-
-    if(itemStyle == TS_CODE_LISP)
-    {
-      token.Trim(true);
-      token.Trim(false);
-      if (!token.IsEmpty())
-        m_commands.emplace_back(token, index);
-      token.Clear();
-      continue;
-    }
-
-    if(itemStyle == TS_CODE_ENDOFLINE)
-    {
-      token.Trim(true);
-      token.Trim(false);
-      if (!token.IsEmpty())
-        m_commands.emplace_back(token, index);
-      token.Clear();
-      continue;
-    }
-  }
-  token.Trim(true);
-  token.Trim(false);
-  if(!token.IsEmpty())
-    m_commands.emplace_back(token, index);
+  std::vector<Command> commands = SplitCommands(cell->GetEditable()->GetTokens());
+  m_commands.insert(m_commands.end(), commands.begin(), commands.end());
 }
 
 GroupCell *EvaluationQueue::GetCell()
@@ -212,3 +179,36 @@ wxString EvaluationQueue::GetCommand()
   return retval;
 }
 
+bool EvaluationQueue::PeekCommand(size_t n, QueuedCommand &cmd) const
+{
+  if (m_queue.empty())
+    return false;
+
+  if (n < m_commands.size())
+  {
+    cmd.m_cell = m_queue.front();
+    cmd.m_command = m_commands[n].GetString();
+    if ((n + 1 == m_commands.size()) && m_queue.front()->GetEditable()->NeedsEnding())
+      cmd.m_command += wxT(";");
+    cmd.m_index = m_commands[n].GetIndex();
+    cmd.m_firstInCell = (n == 0) && m_workingGroupChanged;
+    return true;
+  }
+  n -= m_commands.size();
+
+  for (auto cell = m_queue.begin() + 1; cell != m_queue.end(); ++cell)
+  {
+    EditorCell *const editor = (*cell)->GetEditable();
+    std::vector<Command> commands = SplitCommands(editor->GetTokens(), editor->NeedsEnding());
+    if (n < commands.size())
+    {
+      cmd.m_cell = *cell;
+      cmd.m_command = commands[n].GetString();
+      cmd.m_index = commands[n].GetIndex();
+      cmd.m_firstInCell = (n == 0);
+      return true;
+    }
+    n -= commands.size();
+  }
+  return false;
+}
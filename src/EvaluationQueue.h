@@ -34,14 +34,15 @@ that still have to be sent to maxima.
 
 #include "precomp.h"
 #include "GroupCell.h"
+#include "MaximaTokenizer.h"
 #include "wx/arrstr.h"
 #include <vector>
 
 //! A simple FIFO queue with manual removal of elements
 class EvaluationQueue
 {
-private:
-
+public:
+  //! A command and the position of its end in the cell's input
   class Command{
   public:
     Command(const wxString &string, int index) : m_indexStart(index), m_command(string) {}
@@ -67,7 +68,8 @@ private:
     int m_indexStart;
     wxString m_command;
   };
-    
+
+private:
   /*! A list of all the commands in the current cell
     
     We need to track each single command:
@@ -90,6 +92,56 @@ private:
   wxArrayString m_knownQuestions;
 
 public:
+  /*! Splits the input of a cell into the commands that are sent to maxima
+
+    \param tokens The tokens of the cell's input
+    \param addEnding Append a ";" to the last command, as EditorCell::AddEnding()
+           does to the cell once it becomes the current one.
+   */
+  static std::vector<Command> SplitCommands(const MaximaTokenizer::TokenList &tokens,
+                                            bool addEnding = false)
+  {
+    std::vector<Command> commands;
+    wxString token;
+    int index = 0;
+    for (auto const &tok : tokens)
+    {
+      const TextStyle itemStyle = tok.GetStyle();
+      wxString itemText = tok.GetText();
+      itemText.Replace(wxT("\u00a0"), " ");
+      index += itemText.Length();
+      if (itemStyle != TS_CODE_COMMENT)
+        token += itemText;
+
+      if ((itemStyle == TS_CODE_LISP) || (itemStyle == TS_CODE_ENDOFLINE))
+      {
+        token.Trim(true);
+        token.Trim(false);
+        if (!token.IsEmpty())
+          commands.emplace_back(token, index);
+        token.Clear();
+      }
+    }
+    token.Trim(true);
+    token.Trim(false);
+    if(!token.IsEmpty())
+      commands.emplace_back(token, index);
+    if (addEnding && !commands.empty())
+      commands.back().AddEnding();
+    return commands;
+  }
+
+  //! A command that is still to be sent to maxima, and where it comes from
+  struct QueuedCommand
+  {
+    GroupCell *m_cell = NULL;
+    wxString m_command;
+    //! The position of the end of the command in the cell's input
+    int m_index = -1;
+    //! Is this the first command of its cell that is sent to maxima?
+    bool m_firstInCell = false;
+  };
+
   /*! Query for the label the user has assigned to the current command.  
 
     If there is no such label or the label as hidden deep down inside the command
@@ -156,6 +208,17 @@ public:
   //! Return the next command that needs to be evaluated.
   wxString GetCommand();
 
+  /*! Looks up a command that will be evaluated later
+
+    \param n 0 means the command GetCommand() returns, 1 the one after it...
+    \param cmd Receives the command and the cell it belongs to
+    \return false, if the queue contains less commands
+
+    Doesn't change the cells: If the last command of a cell lacks its
+    semicolon it is appended only to the command that is returned.
+   */
+  bool PeekCommand(size_t n, QueuedCommand &cmd) const;
+
   //! Get the size of the queue [in cells]
   int Size() const { return m_size; }
 
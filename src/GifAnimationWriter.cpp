@@ -0,0 +1,464 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+#include "GifAnimationWriter.h"
+#include "Version.h"
+#include <wx/quantize.h>
+#include <algorithm>
+#include <limits>
+
+#ifdef HAVE_OMP_HEADER
+#include <omp.h>
+#endif
+
+//! Appends a 16-bit number in the little-endian byte order gif files use
+static void AppendWord(std::vector<unsigned char> &data, int word)
+{
+  data.push_back(word & 0xff);
+  data.push_back((word >> 8) & 0xff);
+}
+
+GifAnimationWriter::GifAnimationWriter(wxOutputStream &stream, wxSize size,
+                                       int delayMilliSecs, PaletteMode mode) :
+  m_stream(stream),
+  m_size(size),
+  m_delay(std::max(delayMilliSecs / 10, 0)),
+  m_paletteMode(mode)
+{
+}
+
+bool GifAnimationWriter::Write(size_t frameCount, const FrameSource &frames,
+                               const ProgressCallback &progress)
+{
+  m_cancelled = false;
+  m_frames.clear();
+  if ((frameCount == 0) || (m_size.x <= 0) || (m_size.y <= 0) ||
+      (m_size.x > 0xffff) || (m_size.y > 0xffff))
+    return false;
+
+  if ((m_paletteMode == sharedPalette) && !ChooseSharedPalette(frameCount, frames))
+    return false;
+
+  if (!WriteHeader())
+    return false;
+
+  // Only a few frames are held in memory at once: The ones the background
+  // tasks are working on and the ones that wait for their predecessors to be
+  // written.
+  size_t batchSize = BatchSize();
+  for (size_t first = 0; first < frameCount; first += batchSize)
+  {
+    size_t last = std::min(first + batchSize, frameCount);
+    std::vector<std::vector<unsigned char>> encoded(last - first);
+    #ifdef HAVE_OPENMP_TASKS
+    #pragma omp taskgroup
+    #endif
+    {
+      for (size_t i = first; i < last; i++)
+      {
+        #ifdef HAVE_OPENMP_TASKS
+        #pragma omp task default(shared) firstprivate(i)
+        #endif
+        {
+          if ((i < m_frames.size()) && m_frames[i].IsOk())
+          {
+            encoded[i - first] = EncodeFrame(m_frames[i]);
+            m_frames[i] = wxImage();
+          }
+          else
+            encoded[i - first] = EncodeFrame(frames(i));
+        }
+      }
+    }
+
+    for (size_t i = first; i < last; i++)
+    {
+      const std::vector<unsigned char> &frame = encoded[i - first];
+      if (frame.empty())
+        return false;
+      m_stream.Write(frame.data(), frame.size());
+      if (!m_stream.IsOk())
+        return false;
+      if (progress && !progress(i + 1, frameCount))
+      {
+        m_cancelled = true;
+        return false;
+      }
+    }
+  }
+
+  const unsigned char trailer = 0x3b;
+  m_stream.Write(&trailer, 1);
+  return m_stream.IsOk();
+}
+
+bool GifAnimationWriter::WriteHeader()
+{
+  std::vector<unsigned char> header = {'G', 'I', 'F', '8', '9', 'a'};
+  // The logical screen descriptor
+  AppendWord(header, m_size.x);
+  AppendWord(header, m_size.y);
+  if (m_paletteMode == sharedPalette)
+    header.push_back(0xf7); // A global palette with 256 colors follows
+  else
+    header.push_back(0x70);
+  header.push_back(0); // The background color
+  header.push_back(0); // The pixel aspect ratio: not given
+  if (m_paletteMode == sharedPalette)
+    header.insert(header.end(), m_sharedPalette.begin(), m_sharedPalette.end());
+
+  // Tell the viewer to loop the animation forever
+  const unsigned char loop[] = {0x21, 0xff, 0x0b,
+                                'N', 'E', 'T', 'S', 'C', 'A', 'P', 'E', '2', '.', '0',
+                                0x03, 0x01, 0x00, 0x00, 0x00};
+  header.insert(header.end(), loop, loop + sizeof(loop));
+
+  m_stream.Write(header.data(), header.size());
+  return m_stream.IsOk();
+}
+
+bool GifAnimationWriter::ChooseSharedPalette(size_t frameCount, const FrameSource &frames)
+{
+  // Choosing the palette from all pixels of a long animation would need lots
+  // of memory and time => We look at a fixed number of evenly spaced pixels.
+  const size_t maxSamples = 1 << 20;
+  size_t samplesPerFrame = std::max(maxSamples / frameCount, static_cast<size_t>(1));
+  // Write() needs the frames again. If they fit in memory we keep them instead
+  // of asking the frame source for each of them a second time.
+  const size_t maxKeptBytes = 256 * 1024 * 1024;
+  size_t keptBytes = 0;
+  m_frames.assign(frameCount, wxImage());
+  std::vector<std::vector<unsigned char>> samples(frameCount);
+  // A std::vector<bool> cannot be written to by several threads at once.
+  std::vector<char> transparent(frameCount, false);
+  std::vector<char> ok(frameCount, false);
+
+  size_t batchSize = BatchSize();
+  for (size_t first = 0; first < frameCount; first += batchSize)
+  {
+    size_t last = std::min(first + batchSize, frameCount);
+    #ifdef HAVE_OPENMP_TASKS
+    #pragma omp taskgroup
+    #endif
+    {
+      for (size_t i = first; i < last; i++)
+      {
+        #ifdef HAVE_OPENMP_TASKS
+        #pragma omp task default(shared) firstprivate(i)
+        #endif
+        {
+          wxImage image = frames(i);
+          if (image.IsOk())
+          {
+            if (!m_frames.empty())
+              m_frames[i] = image;
+            ok[i] = true;
+            transparent[i] = image.HasAlpha() || image.HasMask();
+            size_t pixels = static_cast<size_t>(image.GetWidth()) * image.GetHeight();
+            size_t step = std::max(pixels / samplesPerFrame, static_cast<size_t>(1));
+            const unsigned char *rgb = image.GetData();
+            for (size_t pixel = 0; pixel < pixels; pixel += step)
+              samples[i].insert(samples[i].end(), rgb + 3 * pixel, rgb + 3 * pixel + 3);
+          }
+        }
+      }
+    }
+
+    if (!m_frames.empty())
+    {
+      for (size_t i = first; i < last; i++)
+        if (m_frames[i].IsOk())
+          keptBytes += static_cast<size_t>(m_frames[i].GetWidth()) *
+            m_frames[i].GetHeight() * (m_frames[i].HasAlpha() ? 4 : 3);
+      if (keptBytes > maxKeptBytes)
+        m_frames.clear();
+    }
+  }
+
+  std::vector<unsigned char> row;
+  for (size_t i = 0; i < frameCount; i++)
+  {
+    if (!ok[i])
+      return false;
+    if (transparent[i])
+      m_sharedPaletteTransparent = true;
+    row.insert(row.end(), samples[i].begin(), samples[i].end());
+    samples[i] = {};
+  }
+  if (row.empty())
+    return false;
+
+  // Color 255 is reserved for transparent pixels, if there are any.
+  int colors = m_sharedPaletteTransparent ? 255 : 256;
+  m_sharedPalette.assign(3 * 256, 0);
+  std::vector<unsigned char> indices(row.size() / 3);
+  unsigned char *inRow = row.data();
+  unsigned char *outRow = indices.data();
+  wxQuantize::DoQuantize(indices.size(), 1, &inRow, &outRow, m_sharedPalette.data(), colors);
+
+  m_sharedPaletteIndex.clear();
+  for (int i = 0; i < colors; i++)
+  {
+    uint32_t rgb = (m_sharedPalette[3 * i] << 16) | (m_sharedPalette[3 * i + 1] << 8) |
+      m_sharedPalette[3 * i + 2];
+    m_sharedPaletteIndex.emplace(rgb, i);
+  }
+
+  // The colors that weren't sampled are mapped to the palette color that is
+  // nearest to the center of their 5-bit-per-channel cube.
+  m_sharedPaletteLookup.resize(1 << 15);
+  for (int cube = 0; cube < (1 << 15); cube++)
+  {
+    int r = (((cube >> 10) & 0x1f) << 3) | 4;
+    int g = (((cube >> 5) & 0x1f) << 3) | 4;
+    int b = ((cube & 0x1f) << 3) | 4;
+    int bestDistance = std::numeric_limits<int>::max();
+    for (int i = 0; i < colors; i++)
+    {
+      int dr = r - m_sharedPalette[3 * i];
+      int dg = g - m_sharedPalette[3 * i + 1];
+      int db = b - m_sharedPalette[3 * i + 2];
+      int distance = dr * dr + dg * dg + db * db;
+      if (distance < bestDistance)
+      {
+        bestDistance = distance;
+        m_sharedPaletteLookup[cube] = i;
+      }
+    }
+  }
+  return true;
+}
+
+unsigned char GifAnimationWriter::NearestColor(unsigned char r, unsigned char g,
+                                               unsigned char b) const
+{
+  auto exact = m_sharedPaletteIndex.find((r << 16) | (g << 8) | b);
+  if (exact != m_sharedPaletteIndex.end())
+    return exact->second;
+  return m_sharedPaletteLookup[((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3)];
+}
+
+std::vector<unsigned char> GifAnimationWriter::EncodeFrame(const wxImage &image) const
+{
+  std::vector<unsigned char> frame;
+  if (!image.IsOk())
+    return frame;
+
+  int width = std::min(image.GetWidth(), m_size.x);
+  int height = std::min(image.GetHeight(), m_size.y);
+  size_t count = static_cast<size_t>(width) * height;
+  int stride = image.GetWidth();
+  const unsigned char *rgb = image.GetData();
+
+  // Gif knows only fully transparent and fully opaque pixels.
+  std::vector<char> transparent;
+  if (image.HasAlpha())
+  {
+    const unsigned char *alpha = image.GetAlpha();
+    transparent.resize(count);
+    for (int y = 0; y < height; y++)
+      for (int x = 0; x < width; x++)
+        transparent[y * width + x] = alpha[y * stride + x] < wxIMAGE_ALPHA_THRESHOLD;
+  }
+  else if (image.HasMask())
+  {
+    unsigned char maskR = image.GetMaskRed();
+    unsigned char maskG = image.GetMaskGreen();
+    unsigned char maskB = image.GetMaskBlue();
+    transparent.resize(count);
+    for (int y = 0; y < height; y++)
+      for (int x = 0; x < width; x++)
+      {
+        const unsigned char *pixel = rgb + 3 * (y * stride + x);
+        transparent[y * width + x] =
+          (pixel[0] == maskR) && (pixel[1] == maskG) && (pixel[2] == maskB);
+      }
+  }
+  bool hasTransparency = !transparent.empty();
+
+  std::vector<unsigned char> pixels(count);
+  Palette localPalette;
+  if (m_paletteMode == sharedPalette)
+  {
+    // Neighbouring pixels of plots tend to have the same color.
+    int lastColor = -1;
+    unsigned char lastIndex = 0;
+    for (int y = 0; y < height; y++)
+      for (int x = 0; x < width; x++)
+      {
+        const unsigned char *pixel = rgb + 3 * (y * stride + x);
+        int color = (pixel[0] << 16) | (pixel[1] << 8) | pixel[2];
+        if (color != lastColor)
+        {
+          lastColor = color;
+          lastIndex = NearestColor(pixel[0], pixel[1], pixel[2]);
+        }
+        pixels[y * width + x] = lastIndex;
+      }
+  }
+  else
+  {
+    localPalette.assign(3 * 256, 0);
+    std::vector<unsigned char *> inRows(height);
+    std::vector<unsigned char *> outRows(height);
+    for (int y = 0; y < height; y++)
+    {
+      inRows[y] = const_cast<unsigned char *>(rgb) + 3 * y * stride;
+      outRows[y] = pixels.data() + y * width;
+    }
+    wxQuantize::DoQuantize(width, height, inRows.data(), outRows.data(),
+                           localPalette.data(), hasTransparency ? 255 : 256);
+  }
+  if (hasTransparency)
+    for (size_t i = 0; i < count; i++)
+      if (transparent[i])
+        pixels[i] = 255;
+
+  // The graphic control extension: How long to show the frame and which
+  // color is transparent. Frames with transparent pixels are erased before
+  // the next frame is drawn, the others are drawn over by the next frame.
+  frame = {0x21, 0xf9, 0x04,
+           static_cast<unsigned char>(hasTransparency ? (2 << 2) | 1 : (1 << 2))};
+  AppendWord(frame, m_delay);
+  frame.push_back(hasTransparency ? 255 : 0);
+  frame.push_back(0);
+
+  // The image descriptor
+  frame.push_back(0x2c);
+  AppendWord(frame, 0);
+  AppendWord(frame, 0);
+  AppendWord(frame, width);
+  AppendWord(frame, height);
+  if (localPalette.empty())
+    frame.push_back(0x00);
+  else
+  {
+    frame.push_back(0x87); // A local palette with 256 colors follows
+    frame.insert(frame.end(), localPalette.begin(), localPalette.end());
+  }
+
+  // The image data
+  frame.push_back(8); // The LZW minimum code size
+  std::vector<unsigned char> data = LZWCompress(pixels.data(), count);
+  frame.insert(frame.end(), data.begin(), data.end());
+  return frame;
+}
+
+std::vector<unsigned char> GifAnimationWriter::LZWCompress(const unsigned char *pixels,
+                                                           size_t count)
+{
+  const int clearCode = 256;
+  const int endCode = 257;
+  // Codes are at most 12 bits long. When the dictionary is full we start over.
+  const int maxCode = 4095;
+
+  // An open-addressing hash table that maps a code followed by a pixel to the
+  // code of this string of pixels
+  const int hashBits = 13;
+  std::vector<int32_t> keys(1 << hashBits);
+  std::vector<int16_t> values(1 << hashBits);
+  int nextCode = 0;
+  // The number of codes written since the last clear code. The decoder
+  // derives the code size from it.
+  int written = 0;
+  auto reset = [&]{
+    std::fill(keys.begin(), keys.end(), -1);
+    nextCode = endCode + 1;
+    written = 0;
+  };
+
+  std::vector<unsigned char> bytes;
+  uint32_t bitBuffer = 0;
+  int bufferedBits = 0;
+  auto emit = [&](int code){
+    int codeSize = 9;
+    while ((codeSize < 12) && (endCode + 1 + written > (1 << codeSize)))
+      codeSize++;
+    bitBuffer |= static_cast<uint32_t>(code) << bufferedBits;
+    bufferedBits += codeSize;
+    while (bufferedBits >= 8)
+    {
+      bytes.push_back(bitBuffer & 0xff);
+      bitBuffer >>= 8;
+      bufferedBits -= 8;
+    }
+    written++;
+  };
+
+  reset();
+  emit(clearCode);
+  reset();
+  if (count > 0)
+  {
+    int prefix = pixels[0];
+    for (size_t i = 1; i < count; i++)
+    {
+      int pixel = pixels[i];
+      int32_t key = (prefix << 8) | pixel;
+      size_t hash = (static_cast<uint32_t>(key) * 2654435761u) >> (32 - hashBits);
+      while ((keys[hash] != -1) && (keys[hash] != key))
+        hash = (hash + 1) & ((1 << hashBits) - 1);
+      if (keys[hash] == key)
+      {
+        prefix = values[hash];
+        continue;
+      }
+      emit(prefix);
+      if (nextCode < maxCode)
+      {
+        keys[hash] = key;
+        values[hash] = nextCode++;
+      }
+      else
+      {
+        emit(clearCode);
+        reset();
+      }
+      prefix = pixel;
+    }
+    emit(prefix);
+  }
+  emit(endCode);
+  if (bufferedBits > 0)
+    bytes.push_back(bitBuffer & 0xff);
+
+  // Gif stores the data in blocks of at most 255 bytes, each preceded by its
+  // length and the last one followed by an empty block.
+  std::vector<unsigned char> blocks;
+  blocks.reserve(bytes.size() + bytes.size() / 255 + 2);
+  for (size_t start = 0; start < bytes.size(); start += 255)
+  {
+    size_t length = std::min(bytes.size() - start, static_cast<size_t>(255));
+    blocks.push_back(length);
+    blocks.insert(blocks.end(), bytes.begin() + start, bytes.begin() + start + length);
+  }
+  blocks.push_back(0);
+  return blocks;
+}
+
+size_t GifAnimationWriter::BatchSize()
+{
+  #ifdef HAVE_OMP_HEADER
+  return std::max(2 * omp_get_max_threads(), 2);
+  #else
+  return 8;
+  #endif
+}
@@ -0,0 +1,134 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file declares the class GifAnimationWriter that exports animations as
+  animated .gif files.
+ */
+
+#ifndef WXMAXIMA_GIFANIMATIONWRITER_H
+#define WXMAXIMA_GIFANIMATIONWRITER_H
+
+#include <wx/image.h>
+#include <wx/stream.h>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+/*! Writes an animated .gif file frame by frame
+
+  wxGIFHandler::SaveAnimation() needs all frames, reduced to 256 colors, in
+  memory at once and quantizes them one after another. This class instead
+  fetches, quantizes and compresses a few frames at a time in background tasks
+  and writes each of them to the output stream as soon as all frames before it
+  are written. Between these batches a progress callback is informed which
+  can cancel the export.
+
+  The colors can either be chosen for each frame individually or one palette
+  can be chosen for the whole animation, which makes the file smaller and
+  avoids colors that flicker between frames.
+ */
+class GifAnimationWriter final
+{
+public:
+  enum PaletteMode
+  {
+    perFramePalette, //!< Each frame gets the 256 colors that best fit it
+    sharedPalette    //!< One set of 256 colors for all frames
+  };
+
+  /*! Returns the frame with the given index
+
+    Is called from background tasks, in parallel and in no particular order.
+  */
+  using FrameSource = std::function<wxImage (size_t frame)>;
+
+  /*! Is told how many of the frames have been written
+
+    Is called by the thread that called Write(). Returning false cancels the
+    export.
+  */
+  using ProgressCallback = std::function<bool (size_t written, size_t total)>;
+
+  /*! Prepares writing an animation
+
+    \param stream The stream the .gif file is written to
+    \param size The size of the animation. Smaller frames are drawn in the
+           upper left corner of the animation.
+    \param delayMilliSecs The time each frame is displayed
+    \param mode How the colors of the frames are chosen
+  */
+  GifAnimationWriter(wxOutputStream &stream, wxSize size, int delayMilliSecs,
+                     PaletteMode mode = perFramePalette);
+
+  /*! Writes the animation
+
+    \return false if the export failed or was cancelled. In this case the
+            stream contains an incomplete file.
+  */
+  bool Write(size_t frameCount, const FrameSource &frames,
+             const ProgressCallback &progress = ProgressCallback());
+
+  //! Has the last call to Write() been cancelled by the progress callback?
+  bool Cancelled() const { return m_cancelled; }
+
+  //! Compresses 8-bit pixel data to the data sub-blocks of a gif image
+  static std::vector<unsigned char> LZWCompress(const unsigned char *pixels, size_t count);
+
+private:
+  //! A palette with 256 colors, 3 bytes per color
+  using Palette = std::vector<unsigned char>;
+
+  //! Writes the file header, and the global palette, if there is one
+  bool WriteHeader();
+  /*! Chooses the shared palette from a sample of the pixels of all frames
+
+    Keeps the frames in m_frames for Write(), as long as they don't need too
+    much memory.
+  */
+  bool ChooseSharedPalette(size_t frameCount, const FrameSource &frames);
+  //! Reduces a frame to 256 colors and encodes it as a gif image block
+  std::vector<unsigned char> EncodeFrame(const wxImage &image) const;
+  //! Returns the index of the color of the shared palette nearest to r,g,b
+  unsigned char NearestColor(unsigned char r, unsigned char g, unsigned char b) const;
+  //! How many frames we compress at the same time
+  static size_t BatchSize();
+
+  wxOutputStream &m_stream;
+  wxSize m_size;
+  //! The time each frame is displayed [in 1/100 s]
+  int m_delay;
+  PaletteMode m_paletteMode;
+  bool m_cancelled = false;
+  //! The palette all frames share, if m_paletteMode is sharedPalette
+  Palette m_sharedPalette;
+  //! The index of each color of m_sharedPalette
+  std::unordered_map<uint32_t, unsigned char> m_sharedPaletteIndex;
+  //! Maps colors reduced to 5 bits per channel to the nearest color of m_sharedPalette
+  std::vector<unsigned char> m_sharedPaletteLookup;
+  //! Does the shared palette reserve the color 255 for transparent pixels?
+  bool m_sharedPaletteTransparent = false;
+  //! The frames ChooseSharedPalette() has fetched already, if they fit in memory
+  std::vector<wxImage> m_frames;
+};
+
+#endif // WXMAXIMA_GIFANIMATIONWRITER_H
@@ -185,7 +185,7 @@ GroupCell::GroupCell(Configuration **config, GroupType groupType, const wxString
   {
     std::unique_ptr<Cell> ic;
     if (wxImage::GetImageCount(initString) < 2)
-      ic = std::make_unique<ImgCell>(this, m_configuration, initString, std::shared_ptr<wxFileSystem>{} /* system fs */, false);
+      ic = std::make_unique<ImgCell>(this, m_configuration, initString, std::shared_ptr<ZipArchiveIndex>{} /* system fs */, false);
     else
       ic = std::make_unique<SlideShow>(this, m_configuration, initString, false);
     AppendOutput(std::move(ic));
@@ -32,6 +32,7 @@
 
 #include "Cell.h"
 #include "EditorCell.h"
+#include "EvaluationProfile.h"
 
 //! All types a GroupCell can be of
 // This enum's elements must be synchronized with (WXMFormat.h) WXMHeaderId.
@@ -421,6 +422,12 @@ public:
   bool GetSuppressTooltipMarker() const { return m_suppressTooltipMarker; }
   void SetSuppressTooltipMarker(bool suppress)
     {m_suppressTooltipMarker = suppress;}
+
+  //! What the last evaluation of this cell has cost, or NULL, if it wasn't profiled
+  const EvaluationProfile *GetProfile() const { return m_profile.get(); }
+  //! Remembers what the last evaluation of this cell has cost
+  void SetProfile(const EvaluationProfile &profile)
+    { m_profile = std::make_unique<EvaluationProfile>(profile); }
 protected:
   bool NeedsRecalculation(AFontSize fontSize) const override;
   int GetInputIndent();
@@ -431,12 +438,14 @@ protected:
 //**
   wxRect m_outputRect{-1, -1, 0, 0};
 
-//** 8/4 byte objects (40 bytes)
+//** 8/4 byte objects (48 bytes)
 //**
   CellPtr<Cell> m_nextToDraw;
 
   GroupCell *m_hiddenTree = {}; //!< here hidden (folded) tree of GCs is stored
   GroupCell *m_hiddenTreeParent = {}; //!< store linkage to the parent of the fold
+  //! What the last evaluation has cost. Only allocated for cells that have been profiled.
+  std::unique_ptr<EvaluationProfile> m_profile;
 
   // The pointers below point to inner cells and must be kept contiguous.
   // ** All pointers must be the same: either Cell * or std::unique_ptr<Cell>.
@@ -28,6 +28,7 @@
 #define NANOSVG_IMPLEMENTATION
 #define NANOSVGRAST_IMPLEMENTATION
 #include <wx/mstream.h>
+#include <cstring>
 #include <wx/wfstream.h>
 #include <wx/zstream.h>
 #include <wx/txtstrm.h>
@@ -71,7 +72,9 @@ Image::Image(Configuration **config, wxMemoryBuffer image, wxString type)
   m_originalHeight = 480;
   
   wxImage Image;
-  if (m_compressedImage.GetDataLen() > 0)
+  if (GetImageSizeFromHeader(m_compressedImage, m_originalWidth, m_originalHeight))
+    m_isOk = true;
+  else if (m_compressedImage.GetDataLen() > 0)
   {
     wxMemoryInputStream istream(m_compressedImage.GetData(), m_compressedImage.GetDataLen());
     Image.LoadFile(istream);
@@ -104,11 +107,11 @@ Image::Image(Configuration **config, const wxBitmap &bitmap)
 }
 
 // constructor which loads an image
-// filesystem cannot be passed by const reference as we want to keep the
-// pointer to the file system alive in a background task
-// cppcheck-suppress performance symbolName=filesystem
-Image::Image(Configuration **config, wxString image, std::shared_ptr<wxFileSystem> filesystem, bool remove):
-    m_fs_keepalive_imagedata(filesystem)
+// archive cannot be passed by const reference as we want to keep the
+// pointer to the archive index alive in a background task
+// cppcheck-suppress performance symbolName=archive
+Image::Image(Configuration **config, wxString image, std::shared_ptr<ZipArchiveIndex> archive, bool remove):
+    m_archive_keepalive_imagedata(archive)
 {
   #ifdef HAVE_OMP_HEADER
   omp_init_lock(&m_gnuplotLock);
@@ -124,7 +127,7 @@ Image::Image(Configuration **config, wxString image, std::shared_ptr<wxFileSyste
   m_maxHeight = -1;
   m_originalWidth = 640;
   m_originalHeight = 480;
-  LoadImage(image, filesystem, remove);
+  LoadImage(image, archive, remove);
 }
 
 Image::~Image()
@@ -154,6 +157,7 @@ Image::~Image()
         wxRemoveFile(m_gnuplotData);
     }
   }
+  ClearCache();
   if(m_svgImage)
     free(m_svgImage);
 }
@@ -172,6 +176,73 @@ wxMemoryBuffer Image::ReadCompressedImage(wxInputStream *data)
   return retval;
 }
 
+bool Image::GetImageSizeFromHeader(const wxMemoryBuffer &image, size_t &width, size_t &height)
+{
+  const unsigned char *data = static_cast<const unsigned char *>(image.GetData());
+  size_t length = image.GetDataLen();
+  if (!data)
+    return false;
+
+  size_t w = 0;
+  size_t h = 0;
+  // PNG: The signature is followed by the IHDR chunk that starts with the size
+  if ((length >= 24) && (memcmp(data, "\x89PNG\r\n\x1a\n", 8) == 0) &&
+      (memcmp(data + 12, "IHDR", 4) == 0))
+  {
+    w = (size_t(data[16]) << 24) | (size_t(data[17]) << 16) | (size_t(data[18]) << 8) | data[19];
+    h = (size_t(data[20]) << 24) | (size_t(data[21]) << 16) | (size_t(data[22]) << 8) | data[23];
+  }
+  // GIF: The size of the logical screen follows the signature
+  else if ((length >= 10) &&
+           ((memcmp(data, "GIF87a", 6) == 0) || (memcmp(data, "GIF89a", 6) == 0)))
+  {
+    w = data[6] | (size_t(data[7]) << 8);
+    h = data[8] | (size_t(data[9]) << 8);
+  }
+  // JPEG: The size is part of the first "start of frame" segment
+  else if ((length >= 4) && (data[0] == 0xFF) && (data[1] == 0xD8))
+  {
+    size_t pos = 2;
+    while (pos + 4 <= length)
+    {
+      if (data[pos] != 0xFF)
+        return false;
+      unsigned char marker = data[pos + 1];
+      if (marker == 0xFF)
+      {
+        pos++;
+        continue;
+      }
+      // Markers without a length field
+      if ((marker == 0x01) || ((marker >= 0xD0) && (marker <= 0xD7)))
+      {
+        pos += 2;
+        continue;
+      }
+      size_t segmentLength = (size_t(data[pos + 2]) << 8) | data[pos + 3];
+      if ((marker >= 0xC0) && (marker <= 0xCF) &&
+          (marker != 0xC4) && (marker != 0xC8) && (marker != 0xCC))
+      {
+        if (pos + 9 > length)
+          return false;
+        h = (size_t(data[pos + 5]) << 8) | data[pos + 6];
+        w = (size_t(data[pos + 7]) << 8) | data[pos + 8];
+        break;
+      }
+      // The image data starts, but we haven't found the size
+      if ((marker == 0xDA) || (marker == 0xD9) || (segmentLength < 2))
+        return false;
+      pos += 2 + segmentLength;
+    }
+  }
+
+  if ((w < 1) || (h < 1))
+    return false;
+  width = w;
+  height = h;
+  return true;
+}
+
 wxBitmap Image::GetUnscaledBitmap()
 {
   #ifdef HAVE_OMP_HEADER
@@ -203,6 +274,44 @@ wxBitmap Image::GetUnscaledBitmap()
   }
 }
 
+wxImage Image::GetUnscaledImage()
+{
+  #ifdef HAVE_OMP_HEADER
+  WaitForLoad waitforload(&m_imageLoadLock);
+  #endif
+
+  if(!m_isOk)
+    return wxImage();
+
+  if (m_svgRast)
+  {
+    // The rasterizer holds state => a background task needs one of its own
+    std::unique_ptr<struct NSVGrasterizer, decltype(std::free)*>
+      svgRast{nsvgCreateRasterizer(), std::free};
+    if (!svgRast)
+      return wxImage();
+    std::vector<unsigned char> imgdata(m_originalWidth*m_originalHeight*4);
+    nsvgRasterize(svgRast.get(), m_svgImage, 0,0,1, imgdata.data(),
+                  m_originalWidth, m_originalHeight, m_originalWidth*4);
+
+    wxImage img(m_originalWidth, m_originalHeight, false);
+    img.SetAlpha();
+    unsigned char *rgb = img.GetData();
+    unsigned char *alpha = img.GetAlpha();
+    for (size_t i = 0; i < m_originalWidth * m_originalHeight; i++)
+    {
+      *rgb++ = imgdata[4 * i];
+      *rgb++ = imgdata[4 * i + 1];
+      *rgb++ = imgdata[4 * i + 2];
+      *alpha++ = imgdata[4 * i + 3];
+    }
+    return img;
+  }
+
+  wxMemoryInputStream istream(m_compressedImage.GetData(), m_compressedImage.GetDataLen());
+  return wxImage(istream, wxBITMAP_TYPE_ANY);
+}
+
 wxMemoryBuffer Image::GetCompressedImage()
 {
   #ifdef HAVE_OMP_HEADER
@@ -236,20 +345,20 @@ bool Image::IsOk()
 }
 
 
-// filesystem cannot be passed by const reference as we want to keep the
-// pointer to the file system alive in a background task
-// cppcheck-suppress performance symbolName=filesystem
-void Image::GnuplotSource(wxString gnuplotFilename, wxString dataFilename, std::shared_ptr<wxFileSystem> filesystem)
+// archive cannot be passed by const reference as we want to keep the
+// pointer to the archive index alive in a background task
+// cppcheck-suppress performance symbolName=archive
+void Image::GnuplotSource(wxString gnuplotFilename, wxString dataFilename, std::shared_ptr<ZipArchiveIndex> archive)
 {
-  m_fs_keepalive_gnuplotdata = filesystem;
+  m_archive_keepalive_gnuplotdata = archive;
   #ifdef HAVE_OPENMP_TASKS
   wxLogMessage(_("Scheduling background task that loads the gnuplot data for a plot."));
   #pragma omp task
   #endif
-  LoadGnuplotSource_Backgroundtask(gnuplotFilename, dataFilename, filesystem);
+  LoadGnuplotSource_Backgroundtask(gnuplotFilename, dataFilename, archive);
 }
 
-void Image::LoadGnuplotSource_Backgroundtask(wxString gnuplotFilename, wxString dataFilename, std::shared_ptr<wxFileSystem> filesystem)
+void Image::LoadGnuplotSource_Backgroundtask(wxString gnuplotFilename, wxString dataFilename, std::shared_ptr<ZipArchiveIndex> archive)
 {
   #ifdef HAVE_OMP_HEADER
   omp_set_lock(&m_gnuplotLock);
@@ -260,7 +369,7 @@ void Image::LoadGnuplotSource_Backgroundtask(wxString gnuplotFilename, wxString
   m_gnuplotSource = gnuplotFilename;
   m_gnuplotData = dataFilename;
 
-  if(filesystem == NULL)
+  if(archive == NULL)
   {
     if(wxFileExists(dataFilename))
     {    
@@ -355,14 +464,11 @@ void Image::LoadGnuplotSource_Backgroundtask(wxString gnuplotFilename, wxString
   else
   {
     {
-      wxFSFile *fsfile;
-      #ifdef HAVE_OPENMP_TASKS
-      #pragma omp critical (OpenFSFile)
-      #endif
-      fsfile = filesystem->OpenFile(m_gnuplotSource);
-      if (fsfile)
+      wxMemoryBuffer gnuplotSource;
+      if (archive->Read(m_gnuplotSource, gnuplotSource))
       { // open successful
-        std::unique_ptr<wxInputStream> input(fsfile->GetStream());
+        std::unique_ptr<wxInputStream> input(
+          new wxMemoryInputStream(gnuplotSource.GetData(), gnuplotSource.GetDataLen()));
         if(input->IsOk())
         {
           wxTextInputStream textIn(*input, wxT('\t'), wxConvAuto(wxFONTENCODING_UTF8));
@@ -409,14 +515,11 @@ void Image::LoadGnuplotSource_Backgroundtask(wxString gnuplotFilename, wxString
       }
     }
     {
-      wxFSFile *fsfile;
-      #ifdef HAVE_OPENMP_TASKS
-      #pragma omp critical (OpenFSFile)
-      #endif
-      fsfile = filesystem->OpenFile(m_gnuplotData);
-      if (fsfile)
+      wxMemoryBuffer gnuplotData;
+      if (archive->Read(m_gnuplotData, gnuplotData))
       { // open successful
-        wxInputStream *input = fsfile->GetStream();
+        std::unique_ptr<wxInputStream> input(
+          new wxMemoryInputStream(gnuplotData.GetData(), gnuplotData.GetDataLen()));
         if(input->IsOk())
         {
           wxTextInputStream textIn(*input, wxT('\t'), wxConvAuto(wxFONTENCODING_UTF8));
@@ -452,7 +555,7 @@ void Image::LoadGnuplotSource_Backgroundtask(wxString gnuplotFilename, wxString
       }
     }
   }
-  m_fs_keepalive_gnuplotdata.reset();
+  m_archive_keepalive_gnuplotdata.reset();
   #ifdef HAVE_OMP_HEADER
   omp_unset_lock(&m_gnuplotLock);
   #endif
@@ -754,10 +857,18 @@ wxBitmap Image::GetBitmap(double scale)
     InvalidBitmap();
     return m_scaledBitmap;    
   }
-  
+
+  // Make sure we stay within sane defaults
+  if (m_width < 1)m_width = 1;
+  if (m_height < 1)m_height = 1;
+  wxSize size(m_width, m_height);
+
   // Let's see if we have cached the scaled bitmap with the right size
-  if (m_scaledBitmap.GetWidth() == m_width)
-    return m_scaledBitmap;
+  ScaledBitmapCache &cache = ScaledBitmapCache::Get();
+  cache.SetMemoryLimit(size_t((*m_configuration)->BitmapCacheMegabytes()) * 1024 * 1024);
+  wxBitmap bitmap;
+  if (cache.Lookup(this, size, bitmap))
+    return bitmap;
   
   // Seems like we need to create a new scaled bitmap.
   if (m_svgRast)
@@ -768,45 +879,58 @@ wxBitmap Image::GetBitmap(double scale)
     nsvgRasterize(m_svgRast.get(), m_svgImage, 0,0,
                   ((double)m_width)/((double)m_originalWidth),
                   imgdata.data(), m_width, m_height, m_width*4);
-    #ifdef HAVE_OMP_HEADER
-    omp_unset_lock(&m_gnuplotLock);
-    #endif
-    return m_scaledBitmap = SvgBitmap::RGBA2wxBitmap(imgdata.data(), m_width, m_height);
+    bitmap = SvgBitmap::RGBA2wxBitmap(imgdata.data(), m_width, m_height);
   }
   else
   {
-    wxImage img;
-    if (m_compressedImage.GetDataLen() > 0)
+    wxImage img = ScaleImage(size);
+    if (!img.IsOk())
     {
-      wxMemoryInputStream istream(m_compressedImage.GetData(), m_compressedImage.GetDataLen());
-
-      img = wxImage(istream, wxBITMAP_TYPE_ANY);
+      InvalidBitmap();
+      return m_scaledBitmap;
     }
-    m_isOk = true;
+    bitmap = wxBitmap(img, 24);
+  }
 
-    if (img.Ok())
-      m_scaledBitmap = wxBitmap(img);
-    else
-      InvalidBitmap();
+  cache.Add(this, size, bitmap);
+  return bitmap;
+}
+
+wxImage Image::ScaleImage(wxSize size) const
+{
+  wxImage img;
+  if (m_compressedImage.GetDataLen() > 0)
+  {
+    wxMemoryInputStream istream(m_compressedImage.GetData(), m_compressedImage.GetDataLen());
+
+    img = wxImage(istream, wxBITMAP_TYPE_ANY);
   }
+  if (img.IsOk())
+    img.Rescale(size.x, size.y, wxIMAGE_QUALITY_BICUBIC);
+  return img;
+}
 
-  // Make sure we stay within sane defaults
-  if (m_width < 1)m_width = 1;
-  if (m_height < 1)m_height = 1;
+void Image::PrefetchBitmap()
+{
+  #ifdef HAVE_OPENMP_TASKS
+  // SVG images are rasterized directly into a bitmap by the GUI thread.
+  if (m_svgRast || (m_width <= 1) || (m_height <= 1))
+    return;
+  wxSize size(m_width, m_height);
+  if (!ScaledBitmapCache::Get().StartPrefetch(this, size))
+    return;
 
-  // Create a scaled bitmap and return it.
-  if(m_scaledBitmap.IsOk())
+  #pragma omp task firstprivate(size)
   {
-    wxImage img = m_scaledBitmap.ConvertToImage();
-    img.Rescale(m_width, m_height, wxIMAGE_QUALITY_BICUBIC);
-    m_scaledBitmap = wxBitmap(img, 24);
+    #ifdef HAVE_OMP_HEADER
+    WaitForLoad waitforload(&m_imageLoadLock);
+    #endif
+    wxImage scaled;
+    if (m_isOk)
+      scaled = ScaleImage(size);
+    ScaledBitmapCache::Get().AddPrefetched(this, size, scaled);
   }
-  else
-    m_scaledBitmap = wxBitmap(1,1);
-  #ifdef HAVE_OMP_HEADER
-  omp_unset_lock(&m_gnuplotLock);
   #endif
-  return m_scaledBitmap;
 }
 
 void Image::InvalidBitmap()
@@ -842,6 +966,7 @@ void Image::LoadImage(const wxBitmap &bitmap)
   #ifdef HAVE_OMP_HEADER
   WaitForLoad waitforload(&m_imageLoadLock);
   #endif
+  ClearCache();
   // Convert the bitmap to a png image we can use as m_compressedImage
   wxImage image = bitmap.ConvertToImage();
   m_isOk = image.IsOk();
@@ -864,12 +989,13 @@ wxString Image::GetExtension()
   return m_extension;
 }
 
-// filesystem cannot be passed by const reference as we want to keep the
-// pointer to the file system alive in a background task
-// cppcheck-suppress performance symbolName=filesystem
-void Image::LoadImage(wxString image, std::shared_ptr<wxFileSystem> filesystem, bool remove)
+// archive cannot be passed by const reference as we want to keep the
+// pointer to the archive index alive in a background task
+// cppcheck-suppress performance symbolName=archive
+void Image::LoadImage(wxString image, std::shared_ptr<ZipArchiveIndex> archive, bool remove)
 {
-  m_fs_keepalive_imagedata = filesystem;
+  m_archive_keepalive_imagedata = archive;
+  ClearCache();
   m_extension = wxFileName(image).GetExt();
   m_extension = m_extension.Lower();
   // If we don't have fine-grained locking using omp.h we don't profit from sending the
@@ -882,10 +1008,10 @@ void Image::LoadImage(wxString image, std::shared_ptr<wxFileSystem> filesystem,
   #pragma omp task
   #endif
   #endif
-  LoadImage_Backgroundtask(image, filesystem, remove);
+  LoadImage_Backgroundtask(image, archive, remove);
 }
 
-void Image::LoadImage_Backgroundtask(wxString image, std::shared_ptr<wxFileSystem> filesystem, bool remove)
+void Image::LoadImage_Backgroundtask(wxString image, std::shared_ptr<ZipArchiveIndex> archive, bool remove)
 {
   #ifdef HAVE_OMP_HEADER
   WaitForLoad waitforload(&m_imageLoadLock);
@@ -895,24 +1021,12 @@ void Image::LoadImage_Backgroundtask(wxString image, std::shared_ptr<wxFileSyste
   m_compressedImage.Clear();
   m_scaledBitmap.Create(1, 1);
 
-  if (filesystem)
+  if (archive)
   {
-    wxFSFile * fsfile;
-    #ifdef HAVE_OPENMP_TASKS
-    #pragma omp critical (OpenFSFile)
-    #endif
-    fsfile = filesystem->OpenFile(image);
-    if (fsfile)
-    { // open successful
-
-      wxInputStream *istream = fsfile->GetStream();
-
-      m_compressedImage = ReadCompressedImage(istream);
-    }
-
-    // Closing and deleting fsfile is important: If this line is missing
-    // opening .wxmx files containing hundreds of images might lead to a
-    // "too many open files" error.
+    // Only reads the file from the archive. Every background task uses its
+    // own file handle, so several images can be read at once.
+    if (!archive->Read(image, m_compressedImage))
+      m_compressedImage.Clear();
   }
   else
   {
@@ -1009,6 +1123,11 @@ void Image::LoadImage_Backgroundtask(wxString image, std::shared_ptr<wxFileSyste
         m_originalHeight = m_svgImage->height;
       }
     }
+    else if (GetImageSizeFromHeader(m_compressedImage, m_originalWidth, m_originalHeight))
+    {
+      // The image is only decompressed when GetBitmap() actually needs it.
+      m_isOk = true;
+    }
     else
     {   
       wxMemoryInputStream istream(m_compressedImage.GetData(), m_compressedImage.GetDataLen());
@@ -1028,7 +1147,7 @@ void Image::LoadImage_Backgroundtask(wxString image, std::shared_ptr<wxFileSyste
       }
     }
   }
-  m_fs_keepalive_imagedata.reset();
+  m_archive_keepalive_imagedata.reset();
   #ifdef HAVE_OMP_HEADER
   omp_unset_lock(&m_imageLoadLock);
   #endif
@@ -1098,11 +1217,6 @@ void Image::Recalculate(double scale)
     m_height = 100;
     m_width = 100;
   }
-  // Clear this cell's image cache if it doesn't contain an image of the size
-  // we need right now. Printing uses unscaled bitmaps, so the cache is left
-  // unchanged then.
-  if (!configuration->GetPrinting() && m_scaledBitmap.GetWidth() != m_width)
-    ClearCache();
 }
 
 const wxString &Image::GetBadImageToolTip()
@@ -37,6 +37,8 @@
 #include <wx/filesys.h>
 #include <wx/fs_arc.h>
 #include <wx/buffer.h>
+#include "ZipArchiveIndex.h"
+#include "ScaledBitmapCache.h"
 #include "nanoSVG/nanosvg.h"
 #include "nanoSVG/nanosvgrast.h"
 
@@ -87,10 +89,10 @@ public:
 
     \param config The pointer to the current configuration storage for the worksheet
     \param image The name of the file
-    \param filesystem The filesystem to load it from
+    \param archive The .wxmx archive to load it from. NULL = the operating system's filesystem
     \param remove true = Delete the file after loading it
    */
-  Image(Configuration **config, wxString image, std::shared_ptr<wxFileSystem> filesystem, bool remove = true);
+  Image(Configuration **config, wxString image, std::shared_ptr<ZipArchiveIndex> archive, bool remove = true);
 
   ~Image();
 
@@ -103,7 +105,7 @@ public:
     are text-only they profit from being compressed and are stored in the 
     memory in their compressed form.
    */
-  void GnuplotSource(wxString gnuplotFilename, wxString dataFilename, std::shared_ptr<wxFileSystem> filesystem);
+  void GnuplotSource(wxString gnuplotFilename, wxString dataFilename, std::shared_ptr<ZipArchiveIndex> archive);
 
   //! Load the gnuplot source file from the system's filesystem
   void GnuplotSource(wxString gnuplotFilename, wxString dataFilename)
@@ -142,10 +144,13 @@ public:
     Will recreate the scaled image as soon as needed.
    */
   void ClearCache()
-    {
-      if ((m_scaledBitmap.GetWidth() > 1) || (m_scaledBitmap.GetHeight() > 1))
-        m_scaledBitmap.Create(1, 1);
-    }
+    { ScaledBitmapCache::Get().Remove(this); }
+
+  /*! Starts scaling the image to its current display size in the background
+
+    Makes sure that the image can be drawn fast once it is scrolled into view.
+   */
+  void PrefetchBitmap();
   
   //! Returns the file name extension of the current image
   wxString GetExtension();
@@ -173,6 +178,13 @@ public:
   //! Returns the image in its unscaled form
   wxBitmap GetUnscaledBitmap();
 
+  /*! Returns the image in its unscaled form as a wxImage
+
+    In contrast to GetUnscaledBitmap() this function may be called from
+    background tasks. Returns an image that isn't Ok() if the image is broken.
+   */
+  wxImage GetUnscaledImage();
+
   //! Can be called to specify a specific scale
   void Recalculate(double scale = 1.0);
 
@@ -227,7 +239,10 @@ private:
   size_t m_originalWidth;
   //! The height of the unscaled image
   size_t m_originalHeight;
-  //! The bitmap, scaled down to the screen size
+  /*! The "broken image" bitmap, if the image cannot be displayed
+
+    All other scaled versions of the image are kept by the ScaledBitmapCache.
+   */
   wxBitmap m_scaledBitmap;
   //! The file extension for the current image type
   wxString m_extension;
@@ -237,13 +252,26 @@ private:
   wxString m_gnuplotSource;
   //! The gnuplot data file for this image, if any.
   wxString m_gnuplotData;
-  void LoadImage_Backgroundtask(wxString image, std::shared_ptr<wxFileSystem> filesystem, bool remove);
-  void LoadGnuplotSource_Backgroundtask(wxString gnuplotFilename, wxString dataFilename, std::shared_ptr<wxFileSystem> filesystem);
+  void LoadImage_Backgroundtask(wxString image, std::shared_ptr<ZipArchiveIndex> archive, bool remove);
+  void LoadGnuplotSource_Backgroundtask(wxString gnuplotFilename, wxString dataFilename, std::shared_ptr<ZipArchiveIndex> archive);
 
   //! Loads an image from a file
-  void LoadImage(wxString image, std::shared_ptr<wxFileSystem> filesystem, bool remove = true);
+  void LoadImage(wxString image, std::shared_ptr<ZipArchiveIndex> archive, bool remove = true);
+  /*! Decompresses the image and scales it to size
+
+    The caller has to own m_imageLoadLock. Doesn't create any bitmaps, which
+    means that it can be called from a background task.
+   */
+  wxImage ScaleImage(wxSize size) const;
   //! Reads the compressed image into a memory buffer
   static wxMemoryBuffer ReadCompressedImage(wxInputStream *data);
+  /*! Reads the size of a .png, .gif or .jpeg image from its header
+
+    This avoids decompressing images whose size is all we need to know.
+    \return false, if the image has none of these formats or its header
+    seems to be broken. In this case width and height aren't changed.
+   */
+  static bool GetImageSizeFromHeader(const wxMemoryBuffer &image, size_t &width, size_t &height);
   Configuration **m_configuration;
   //! The upper width limit for displaying this image
   double m_maxWidth;
@@ -255,8 +283,8 @@ private:
   NSVGimage* m_svgImage = {};
   std::unique_ptr<struct NSVGrasterizer, decltype(std::free)*> m_svgRast{nullptr, std::free};
 
-  std::shared_ptr<wxFileSystem> m_fs_keepalive_gnuplotdata;
-  std::shared_ptr<wxFileSystem> m_fs_keepalive_imagedata;
+  std::shared_ptr<ZipArchiveIndex> m_archive_keepalive_gnuplotdata;
+  std::shared_ptr<ZipArchiveIndex> m_archive_keepalive_imagedata;
   #ifdef HAVE_OMP_HEADER
   omp_lock_t m_gnuplotLock;
   omp_lock_t m_imageLoadLock;
@@ -70,13 +70,13 @@ ImgCell::ImgCell(GroupCell *parent, Configuration **config, const wxBitmap &bitm
 int ImgCell::s_counter = 0;
 
 // constructor which load image
-ImgCell::ImgCell(GroupCell *parent, Configuration **config, const wxString &image, std::shared_ptr<wxFileSystem> filesystem, bool remove)
+ImgCell::ImgCell(GroupCell *parent, Configuration **config, const wxString &image, std::shared_ptr<ZipArchiveIndex> archive, bool remove)
   : Cell(parent, config)
 {
   InitBitFields();
   m_type = MC_TYPE_IMAGE;
   if (image != wxEmptyString)
-    m_image = std::make_shared<Image>(m_configuration, image, filesystem, remove);
+    m_image = std::make_shared<Image>(m_configuration, image, archive, remove);
   else
     m_image = std::make_shared<Image>(m_configuration);
   m_drawBoundingBox = false;
@@ -209,9 +209,6 @@ void ImgCell::Draw(wxPoint point)
     else
       dc->Blit(xDst, yDst, widthDst, heightDst, &bitmapDC, xSrc, ySrc);
   }
-  else
-    // The cell isn't drawn => No need to keep it's image cache for now.
-    ClearCache();
 
   // The next time we need to draw a bounding box we will be informed again.
   m_drawBoundingBox = false;
@@ -35,7 +35,7 @@ class ImgCell final : public Cell
 public:
   ImgCell(GroupCell *parent, Configuration **config);
   ImgCell(GroupCell *parent, Configuration **config, const wxMemoryBuffer &image, const wxString &type);
-  ImgCell(GroupCell *parent, Configuration **config, const wxString &image, std::shared_ptr<wxFileSystem> filesystem, bool remove = true);
+  ImgCell(GroupCell *parent, Configuration **config, const wxString &image, std::shared_ptr<ZipArchiveIndex> archive, bool remove = true);
 
   ImgCell(GroupCell *parent, Configuration **config, const wxBitmap &bitmap);
   ImgCell(const ImgCell &cell);
@@ -46,8 +46,8 @@ public:
   ImgCell &operator=(const ImgCell&) = delete;
 
   //! Tell the image which gnuplot files it was made from
-  void GnuplotSource(wxString sourcefile, wxString datafile, std::shared_ptr<wxFileSystem> filesystem)
-  { if (m_image) m_image->GnuplotSource(sourcefile,datafile, filesystem); }
+  void GnuplotSource(wxString sourcefile, wxString datafile, std::shared_ptr<ZipArchiveIndex> archive)
+  { if (m_image) m_image->GnuplotSource(sourcefile,datafile, archive); }
 
   //! The name of the file with gnuplot commands that created this file
   wxString GnuplotSource() const override
@@ -81,6 +81,8 @@ public:
    */
   void ClearCache() override { if (m_image) m_image->ClearCache(); }
 
+  void PrefetchImages() override { if (m_image) m_image->PrefetchBitmap(); }
+
   const wxString &GetToolTip(wxPoint point) const override;
   
   //! Sets the bitmap that is shown
@@ -95,6 +97,9 @@ public:
   wxString GetExtension() const
   { if (m_image)return m_image->GetExtension(); else return wxEmptyString; }
 
+  //! Returns the width of the image ToImageFile() writes if asked for GetExtension()
+  size_t GetOriginalWidth() const { return m_image ? m_image->GetOriginalWidth() : 0; }
+
   //! Returns the original compressed version of the image
   wxMemoryBuffer GetCompressedImage() const { return m_image->m_compressedImage; }
 
@@ -0,0 +1,440 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file defines the class ManualIndex that knows which keywords and
+  words maxima's HTML manual explains where.
+
+  The index file is a text file:
+    - The first line is ManualIndex::m_header
+    - The second line is the version of maxima the manual belongs to
+    - "S <id> <title>" is a section
+    - "W <word> <section> <count> <section> <count>..." lists the sections that
+      contain a word by their number and how often they contain it.
+ */
+
+#include "ManualIndex.h"
+#include <wx/ffile.h>
+#include <wx/filefn.h>
+#include <wx/filename.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+const char ManualIndex::m_header[] = "wxMaxima manual index 1";
+
+//! Which chars can be part of a word of the manual's text?
+static bool IsWordChar(unsigned char c)
+{
+  return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) ||
+    ((c >= '0') && (c <= '9')) || (c == '_') || (c == '%') ||
+    // Any byte of a multibyte UTF-8 char
+    (c >= 0x80);
+}
+
+//! Which chars can be part of the id of an anchor?
+static bool IsIdChar(unsigned char c)
+{
+  return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) ||
+    ((c >= '0') && (c <= '9')) || (c == '_') || (c == '-');
+}
+
+//! texinfo writes the codes of escaped chars in lower-case hex
+static bool IsLowerHexDigit(char c)
+{
+  return ((c >= '0') && (c <= '9')) || ((c >= 'a') && (c <= 'f'));
+}
+
+static char ToLower(char c)
+{
+  if ((c >= 'A') && (c <= 'Z'))
+    return c - 'A' + 'a';
+  return c;
+}
+
+//! Does the tag that starts at \p tag begin with \p prefix?
+static bool StartsWith(const char *tag, size_t length, const char *prefix)
+{
+  size_t prefixLength = strlen(prefix);
+  return (length >= prefixLength) && (memcmp(tag, prefix, prefixLength) == 0);
+}
+
+//! Is \p name the name of the tag that starts at \p tag?
+static bool IsTag(const char *tag, size_t length, const char *name)
+{
+  size_t nameLength = strlen(name);
+  if (length < nameLength)
+    return false;
+  for (size_t i = 0; i < nameLength; i++)
+    if (ToLower(tag[i]) != name[i])
+      return false;
+  return (length == nameLength) || (tag[nameLength] == ' ');
+}
+
+//! Splits UTF-8 text into lower-case words
+template <class Callback> static void ForEachWord(const char *text, size_t length,
+                                                  Callback callback)
+{
+  std::string word;
+  for (size_t i = 0; i <= length; i++)
+  {
+    if ((i < length) && IsWordChar(text[i]))
+      word.push_back(ToLower(text[i]));
+    else if (!word.empty())
+    {
+      callback(word);
+      word.clear();
+    }
+  }
+}
+
+bool ManualIndex::Scan(const wxString &htmlFile)
+{
+  // The manual is a few megabytes => it is much faster to read it in one
+  // go than to read it line by line.
+  std::vector<char> html;
+  {
+    wxFFile file(htmlFile, wxT("rb"));
+    if (!file.IsOpened())
+      return false;
+    wxFileOffset length = file.Length();
+    if (length < 0)
+      return false;
+    html.resize(length);
+    if ((length > 0) && (file.Read(html.data(), length) != static_cast<size_t>(length)))
+      return false;
+  }
+  Scan(html.data(), html.size());
+  return true;
+}
+
+void ManualIndex::Scan(const char *html, size_t length)
+{
+  m_words.clear();
+  m_sections.clear();
+  m_keywords.clear();
+  m_word.clear();
+
+  const char *pos = html;
+  const char *end = html + length;
+  while (pos < end)
+  {
+    unsigned char c = *pos;
+    if (c == '<')
+    {
+      FlushWord();
+      const char *tagEnd = static_cast<const char *>(memchr(pos, '>', end - pos));
+      if (!tagEnd)
+        break;
+      const char *tag = pos + 1;
+      size_t tagLength = tagEnd - tag;
+      pos = tagEnd + 1;
+
+      const char *id = NULL;
+      if (StartsWith(tag, tagLength, "span id=\""))
+        id = tag + 9;
+      // The anchors of manuals generated by old texinfo versions
+      else if (StartsWith(tag, tagLength, "a name=\""))
+        id = tag + 8;
+      if (id)
+      {
+        const char *idEnd = id;
+        while ((idEnd < tagEnd) && IsIdChar(*idEnd))
+          idEnd++;
+        if ((idEnd > id) && (idEnd < tagEnd) && (*idEnd == '"'))
+          Anchor(std::string(id, idEnd));
+      }
+      else
+      {
+        // The contents of style sheets and scripts aren't text.
+        const char *closingTag = NULL;
+        if (IsTag(tag, tagLength, "style"))
+          closingTag = "</style";
+        if (IsTag(tag, tagLength, "script"))
+          closingTag = "</script";
+        if (closingTag)
+          pos = std::search(pos, end, closingTag, closingTag + strlen(closingTag));
+      }
+    }
+    else if (c == '&')
+    {
+      // An entity like &amp; separates words
+      FlushWord();
+      const char *semicolon = static_cast<const char *>(
+        memchr(pos, ';', std::min<size_t>(end - pos, 10)));
+      pos = semicolon ? semicolon + 1 : pos + 1;
+    }
+    else if (IsWordChar(c))
+    {
+      m_word.push_back(ToLower(c));
+      pos++;
+    }
+    else
+    {
+      FlushWord();
+      pos++;
+    }
+  }
+  FlushWord();
+}
+
+void ManualIndex::FlushWord()
+{
+  // Text before the first anchor cannot be linked to. Very short and very
+  // long words aren't worth searching for.
+  if ((!m_sections.empty()) && (m_word.length() >= 2) && (m_word.length() <= 64))
+  {
+    uint32_t section = m_sections.size() - 1;
+    std::vector<Posting> &postings = m_words[m_word];
+    if (postings.empty() || (postings.back().m_section != section))
+      postings.push_back({section, 1});
+    else
+      postings.back().m_count++;
+  }
+  m_word.clear();
+}
+
+void ManualIndex::Anchor(const std::string &id)
+{
+  Section section;
+  section.m_id = wxString::FromUTF8(id.c_str());
+  wxString keyword = DecodeId(id);
+  section.m_title = keyword;
+  if (section.m_title.StartsWith(wxT("index ")))
+    section.m_title = section.m_title.Mid(6);
+  m_sections.push_back(section);
+
+  // Tokens that end with "-1" aren't too useful, normally.
+  if ((!keyword.EndsWith(wxT("-1"))) && (!keyword.Contains(wxT(" "))))
+    m_keywords.push_back(std::make_pair(keyword, section.m_id));
+}
+
+wxString ManualIndex::DecodeId(const std::string &id)
+{
+  static const char escapeChars[] = "<=>[]`%?;\\$%&+-*/.!\'@#:^_";
+  std::string text;
+  text.reserve(id.length());
+  for (size_t i = 0; i < id.length(); i++)
+  {
+    // In anchors a space is represented by a hyphen
+    if (id[i] == '-')
+    {
+      text.push_back(' ');
+      continue;
+    }
+    // Some other chars including the minus are represented by "_00xx"
+    // where xx is being the ascii code of the char.
+    if ((id.compare(i, 3, "_00") == 0) && (i + 5 <= id.length()) &&
+        IsLowerHexDigit(id[i + 3]) && IsLowerHexDigit(id[i + 4]))
+    {
+      char code = strtol(id.substr(i + 3, 2).c_str(), NULL, 16);
+      if ((code != 0) && strchr(escapeChars, code))
+      {
+        text.push_back(code);
+        i += 4;
+        continue;
+      }
+    }
+    text.push_back(id[i]);
+  }
+  // What the g_t means I don't know. But we don't need it
+  if (text.compare(0, 3, "g_t") == 0)
+    text = text.substr(3);
+  return wxString::FromUTF8(text.c_str());
+}
+
+std::vector<ManualIndex::Section> ManualIndex::Search(const wxString &query, size_t maxHits) const
+{
+  struct Hit
+  {
+    uint32_t m_section;
+    //! How many of the query's words the section contains
+    unsigned int m_words;
+    double m_score;
+  };
+  std::unordered_map<uint32_t, Hit> hits;
+
+  wxScopedCharBuffer utf8 = query.utf8_str();
+  ForEachWord(utf8.data(), utf8.length(), [&](const std::string &word){
+      auto postings = m_words.find(word);
+      if (postings == m_words.end())
+        return;
+      // Words that appear in only a few sections say more about a section than
+      // words that appear everywhere.
+      double idf = std::log(1.0 + static_cast<double>(m_sections.size()) / postings->second.size());
+      for (const auto &posting : postings->second)
+      {
+        Hit &hit = hits[posting.m_section];
+        hit.m_section = posting.m_section;
+        hit.m_words++;
+        hit.m_score += (1.0 + std::log(static_cast<double>(posting.m_count))) * idf;
+      }
+    });
+
+  std::vector<Hit> ranked;
+  ranked.reserve(hits.size());
+  for (const auto &hit : hits)
+    ranked.push_back(hit.second);
+  auto better = [](const Hit &a, const Hit &b) {
+    if (a.m_words != b.m_words)
+      return a.m_words > b.m_words;
+    if (a.m_score != b.m_score)
+      return a.m_score > b.m_score;
+    return a.m_section < b.m_section;
+  };
+  maxHits = std::min(maxHits, ranked.size());
+  std::partial_sort(ranked.begin(), ranked.begin() + maxHits, ranked.end(), better);
+
+  std::vector<Section> result;
+  for (size_t i = 0; i < maxHits; i++)
+    result.push_back(m_sections[ranked[i].m_section]);
+  return result;
+}
+
+bool ManualIndex::Save(const wxString &file, const wxString &maximaVersion) const
+{
+  std::string contents = m_header;
+  contents += '\n';
+  contents += maximaVersion.utf8_str().data();
+  contents += '\n';
+  for (const auto &section : m_sections)
+  {
+    contents += "S ";
+    contents += section.m_id.utf8_str().data();
+    contents += ' ';
+    contents += section.m_title.utf8_str().data();
+    contents += '\n';
+  }
+  for (const auto &word : m_words)
+  {
+    contents += "W ";
+    contents += word.first;
+    for (const auto &posting : word.second)
+    {
+      contents += ' ';
+      contents += std::to_string(posting.m_section);
+      contents += ' ';
+      contents += std::to_string(posting.m_count);
+    }
+    contents += '\n';
+  }
+
+  // Another wxMaxima process might read or write the index at the same time
+  // => each process writes to a file of its own and renames it.
+  wxString tempFile = wxFileName::CreateTempFileName(file);
+  if (tempFile.IsEmpty())
+    return false;
+  bool written;
+  {
+    wxFFile output(tempFile, wxT("wb"));
+    written = output.IsOpened() &&
+      (output.Write(contents.data(), contents.length()) == contents.length()) &&
+      output.Close();
+  }
+  if (!written || !wxRenameFile(tempFile, file, true))
+  {
+    wxRemoveFile(tempFile);
+    return false;
+  }
+  return true;
+}
+
+bool ManualIndex::Load(const wxString &file, const wxString &maximaVersion)
+{
+  m_words.clear();
+  m_sections.clear();
+  m_keywords.clear();
+
+  std::string contents;
+  {
+    wxFFile input(file, wxT("rb"));
+    if (!input.IsOpened())
+      return false;
+    wxFileOffset length = input.Length();
+    if (length <= 0)
+      return false;
+    contents.resize(length);
+    if (input.Read(&contents[0], length) != static_cast<size_t>(length))
+      return false;
+  }
+
+  const char *pos = contents.c_str();
+  const char *end = pos + contents.length();
+  std::string version = maximaVersion.utf8_str().data();
+  bool ok = true;
+  for (unsigned int lineNumber = 0; ok && (pos < end); lineNumber++)
+  {
+    const char *lineEnd = static_cast<const char *>(memchr(pos, '\n', end - pos));
+    if (!lineEnd)
+    {
+      ok = false;
+      break;
+    }
+    std::string line(pos, lineEnd);
+    pos = lineEnd + 1;
+
+    if (lineNumber == 0)
+      ok = (line == m_header);
+    else if (lineNumber == 1)
+      ok = (line == version);
+    else if (line.compare(0, 2, "S ") == 0)
+    {
+      size_t space = line.find(' ', 2);
+      ok = (space != std::string::npos);
+      if (ok)
+      {
+        Section section;
+        section.m_id = wxString::FromUTF8(line.substr(2, space - 2).c_str());
+        section.m_title = wxString::FromUTF8(line.substr(space + 1).c_str());
+        m_sections.push_back(section);
+      }
+    }
+    else if (line.compare(0, 2, "W ") == 0)
+    {
+      size_t space = line.find(' ', 2);
+      std::vector<Posting> &postings = m_words[line.substr(2, space - 2)];
+      const char *number = line.c_str() + ((space == std::string::npos) ? line.length() : space);
+      while (ok && (*number != '\0'))
+      {
+        char *numberEnd;
+        unsigned long section = strtoul(number, &numberEnd, 10);
+        ok = (numberEnd != number) && (section < m_sections.size());
+        number = numberEnd;
+        unsigned long count = strtoul(number, &numberEnd, 10);
+        ok = ok && (numberEnd != number) && (count > 0);
+        number = numberEnd;
+        if (ok)
+          postings.push_back({static_cast<uint32_t>(section), static_cast<uint32_t>(count)});
+      }
+      ok = ok && !postings.empty();
+    }
+    else
+      ok = false;
+  }
+
+  if (!ok)
+  {
+    m_words.clear();
+    m_sections.clear();
+  }
+  return ok && !m_sections.empty();
+}
@@ -0,0 +1,114 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file declares the class ManualIndex that knows which keywords and
+  words maxima's HTML manual explains where.
+ */
+
+#ifndef WXMAXIMA_MANUALINDEX_H
+#define WXMAXIMA_MANUALINDEX_H
+
+#include <wx/string.h>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/*! The anchors of maxima's HTML manual and a full-text index of its text
+
+  Scan() reads the manual in one go and finds everything in a single pass over
+  the bytes: The anchors that the help for a keyword links to and, for every
+  word in the manual's text, the sections that contain it and how often.
+
+  The full-text index is stored in a file and allows Search() to find the
+  sections that best match a few words, even if there is no anchor for them.
+ */
+class ManualIndex
+{
+public:
+  //! A place in the manual a link can point to
+  struct Section
+  {
+    //! The id of the HTML anchor
+    wxString m_id;
+    //! A human-readable form of the id
+    wxString m_title;
+  };
+  //! Keywords and the ids of the anchors that explain them
+  using Keywords = std::vector<std::pair<wxString, wxString>>;
+
+  //! Scans the manual's HTML file. Returns false, if it cannot be read.
+  bool Scan(const wxString &htmlFile);
+  //! Scans the manual's HTML (UTF-8-encoded) from memory
+  void Scan(const char *html, size_t length);
+
+  //! The keywords the last Scan() has found anchors for
+  const Keywords &GetKeywords() const { return m_keywords; }
+  //! Has no manual been scanned or loaded?
+  bool IsEmpty() const { return m_sections.empty(); }
+
+  //! Stores the full-text index in \p file
+  bool Save(const wxString &file, const wxString &maximaVersion) const;
+  /*! Reads the full-text index from \p file
+
+    \return false, if the file cannot be read or is for a different maxima version.
+   */
+  bool Load(const wxString &file, const wxString &maximaVersion);
+
+  //! The sections that contain the words in \p query, best match first
+  std::vector<Section> Search(const wxString &query, size_t maxHits = 20) const;
+
+  /*! Converts the id of an anchor to the text it was generated from
+
+    texinfo replaces spaces by "-" and most punctuation by "_00xx", xx being
+    the character's ASCII code in hex.
+   */
+  static wxString DecodeId(const std::string &id);
+
+private:
+  //! A section that contains a word
+  struct Posting
+  {
+    //! The index of the section in m_sections
+    uint32_t m_section;
+    //! How often the section contains the word
+    uint32_t m_count;
+  };
+
+  //! Remembers that the current section contains m_word. Empties m_word.
+  void FlushWord();
+  //! Starts a new section at the anchor with this id
+  void Anchor(const std::string &id);
+
+  //! The lower-case words of the manual and the sections that contain them
+  std::unordered_map<std::string, std::vector<Posting>> m_words;
+  //! The anchors that divide the manual into sections
+  std::vector<Section> m_sections;
+  Keywords m_keywords;
+  //! The word Scan() currently reads
+  std::string m_word;
+  //! The first line of the index file. Change this if the format changes.
+  static const char m_header[];
+};
+
+#endif // WXMAXIMA_MANUALINDEX_H
@@ -27,6 +27,7 @@
 #include <wx/config.h>
 #include <wx/tokenzr.h>
 #include <wx/sstream.h>
+#include <wx/mstream.h>
 #include <wx/intl.h>
 
 #include "MathParser.h"
@@ -165,8 +166,7 @@ MathParser::MathParser(Configuration **cfg, const wxString &zipfile)
   m_highlight = false;
   if (zipfile.Length() > 0)
   {
-    m_fileSystem = std::unique_ptr<wxFileSystem>(new wxFileSystem());
-    m_fileSystem->ChangePathTo(zipfile + wxT("#zip:/"), true);
+    m_archive = std::make_shared<ZipArchiveIndex>(zipfile);
   }
 }
 
@@ -253,7 +253,7 @@ Cell *MathParser::ParseSlideshowTag(wxXmlNode *node)
   bool del = node->GetAttribute(wxT("del"), wxT("false")) == wxT("true");
   node->GetAttribute(wxT("gnuplotSources"), &gnuplotSources);
   node->GetAttribute(wxT("gnuplotData"), &gnuplotData);
-  SlideShow *slideShow = new SlideShow(NULL, m_configuration, m_fileSystem);
+  SlideShow *slideShow = new SlideShow(NULL, m_configuration, m_archive);
   wxString str(node->GetChildren()->GetContent());
   wxArrayString images;
   wxString framerate;
@@ -294,7 +294,7 @@ Cell *MathParser::ParseSlideshowTag(wxXmlNode *node)
         i,
         gnuplotFiles.GetNextToken(),
         dataFiles.GetNextToken(),
-        m_fileSystem
+        m_archive
         );
     }
   }
@@ -307,8 +307,8 @@ Cell *MathParser::ParseImageTag(wxXmlNode *node)
   ImgCell *imageCell = {};
   wxString filename(node->GetChildren()->GetContent());
 
-  if (m_fileSystem) // loading from zip
-    imageCell = new ImgCell(NULL, m_configuration, filename, m_fileSystem, false);
+  if (m_archive) // loading from zip
+    imageCell = new ImgCell(NULL, m_configuration, filename, m_archive, false);
   else
   {
     if (node->GetAttribute(wxT("del"), wxT("yes")) != wxT("no"))
@@ -337,7 +337,7 @@ Cell *MathParser::ParseImageTag(wxXmlNode *node)
   wxString gnuplotData = node->GetAttribute(wxT("gnuplotdata"), wxEmptyString);
 
   if (!gnuplotSource.empty())
-    imageCell->GnuplotSource(gnuplotSource, gnuplotData, m_fileSystem);
+    imageCell->GnuplotSource(gnuplotSource, gnuplotData, m_archive);
 
   if (node->GetAttribute(wxT("rect"), wxT("true")) == wxT("false"))
     imageCell->DrawRectangle(false);
@@ -1112,9 +1112,11 @@ Cell *MathParser::ParseTag_(wxXmlNode *node, bool all)
       if (cell != NULL) name = cell->ToString();
       if (name.Length() != 0)
       {
-        LoggingMessageBox(_("Parts of the document will not be loaded correctly:\nFound unknown XML Tag name " + name),
-                     _("Warning"),
-                     wxOK | wxICON_WARNING);
+        wxString message = _("Parts of the document will not be loaded correctly:\nFound unknown XML Tag name " + name);
+        if (m_collectWarnings)
+          m_warnings.Add(message);
+        else
+          LoggingMessageBox(message, _("Warning"), wxOK | wxICON_WARNING);
         warning = false;
       }
     }
@@ -1133,6 +1135,105 @@ std::unique_ptr<Cell> MathParser::ParseTag(wxXmlNode *node, bool all)
   return std::unique_ptr<Cell>(ParseTag_(node, all));
 }
 
+wxArrayString MathParser::TakeWarnings()
+{
+  wxArrayString warnings;
+  warnings.swap(m_warnings);
+  return warnings;
+}
+
+constexpr size_t MathParser::XMLChunkSize;
+
+size_t MathParser::FindTagEnd(const wxString &xml, size_t pos)
+{
+  wxUniChar quote = wxT('\0');
+  for (; pos < xml.Length(); pos++)
+  {
+    wxUniChar const ch = xml[pos];
+    if (quote != wxT('\0'))
+    {
+      if (ch == quote)
+        quote = wxT('\0');
+    }
+    else if ((ch == wxT('"')) || (ch == wxT('\'')))
+      quote = ch;
+    else if (ch == wxT('>'))
+      return pos;
+  }
+  return wxString::npos;
+}
+
+bool MathParser::SplitXML(const wxString &xml, size_t chunkSize, std::vector<XMLChunk> &chunks,
+                          wxString &rootStart, wxString &rootEnd)
+{
+  // The start tag of the root element
+  size_t pos = 0;
+  while ((pos < xml.Length()) && wxIsspace(xml[pos]))
+    pos++;
+  if ((pos + 1 >= xml.Length()) || (xml[pos] != wxT('<')) ||
+      (xml[pos + 1] == wxT('?')) || (xml[pos + 1] == wxT('!')) || (xml[pos + 1] == wxT('/')))
+    return false;
+  size_t const rootStartEnd = FindTagEnd(xml, pos);
+  if ((rootStartEnd == wxString::npos) || (xml[rootStartEnd - 1] == wxT('/')))
+    return false;
+  size_t nameEnd = pos + 1;
+  while ((nameEnd < rootStartEnd) && !wxIsspace(xml[nameEnd]) && (xml[nameEnd] != wxT('/')))
+    nameEnd++;
+  rootStart = xml.Mid(pos, rootStartEnd + 1 - pos);
+  rootEnd = wxT("</") + xml.Mid(pos + 1, nameEnd - pos - 1) + wxT(">");
+
+  // The end tag of the root element, followed by nothing but whitespace
+  size_t const contentEnd = xml.rfind(rootEnd.Left(rootEnd.Length() - 1));
+  if ((contentEnd == wxString::npos) || (contentEnd <= rootStartEnd))
+    return false;
+  pos = contentEnd + rootEnd.Length() - 1;
+  while ((pos < xml.Length()) && wxIsspace(xml[pos]))
+    pos++;
+  if ((pos >= xml.Length()) || (xml[pos] != wxT('>')))
+    return false;
+  for (pos++; pos < xml.Length(); pos++)
+    if (!wxIsspace(xml[pos]))
+      return false;
+
+  // The root's children. A new chunk only starts at a tag that directly follows
+  // another top-level tag: A text node at the start of a chunk might be skipped
+  // as whitespace.
+  size_t chunkStart = rootStartEnd + 1;
+  int depth = 0;
+  pos = chunkStart;
+  while ((pos = xml.find(wxT('<'), pos)) < contentEnd)
+  {
+    if (pos + 1 >= contentEnd)
+      return false;
+    wxUniChar const next = xml[pos + 1];
+    // Comments, CDATA sections and processing instructions are left to the XML
+    // parser.
+    if ((next == wxT('!')) || (next == wxT('?')))
+      return false;
+    if ((depth == 0) && (next != wxT('/')) && (pos > chunkStart) &&
+        (pos - chunkStart >= chunkSize) && (xml[pos - 1] == wxT('>')))
+    {
+      chunks.push_back({chunkStart, pos});
+      chunkStart = pos;
+    }
+    size_t const tagEnd = FindTagEnd(xml, pos);
+    if ((tagEnd == wxString::npos) || (tagEnd >= contentEnd))
+      return false;
+    if (next == wxT('/'))
+    {
+      if (--depth < 0)
+        return false;
+    }
+    else if (xml[tagEnd - 1] != wxT('/'))
+      depth++;
+    pos = tagEnd + 1;
+  }
+  if (depth != 0)
+    return false;
+  chunks.push_back({chunkStart, contentEnd});
+  return true;
+}
+
 Cell *MathParser::ParseLine(wxString s, CellType style)
 {
   m_ParserStyle = style;
@@ -1160,21 +1261,49 @@ Cell *MathParser::ParseLine(wxString s, CellType style)
       showLength = 50000;    
   }
 
-  m_graphRegex.Replace(&s, wxT("\uFFFD"));
-
   if (((long) s.Length() < showLength) || (showLength == 0))
   {
+    // Replace all control characters by a placeholder. Doing this by hand
+    // instead of running a regex over the string saves us a pass over the
+    // data and a copy of it.
+    for (wxString::iterator it = s.begin(); it != s.end(); ++it)
+      if (IsControlChar(*it))
+        *it = wxUniChar(0xFFFD);
+
+    // Build the XML tree for a chunk of top-level tags at a time and convert it to
+    // cells before the next chunk is parsed: For a big output the tree for all of
+    // it would need several times the memory the text does.
+    std::vector<XMLChunk> chunks;
+    wxString rootStart;
+    wxString rootEnd;
+    if (!SplitXML(s, XMLChunkSize, chunks, rootStart, rootEnd))
+    {
+      chunks.clear();
+      chunks.push_back({0, s.Length()});
+      rootStart.Clear();
+      rootEnd.Clear();
+    }
 
-    wxXmlDocument xml;
-
-    wxStringInputStream xmlStream(s);
-
-    xml.Load(xmlStream, wxT("UTF-8"), wxXMLDOC_KEEP_WHITESPACE_NODES);
-
-    wxXmlNode *doc = xml.GetRoot();
-
-    if (doc != NULL)
-      cell = ParseTag_(doc->GetChildren());
+    for (const auto &chunk : chunks)
+    {
+      // Convert the chunk to UTF-8 only once and let the XML parser read the
+      // result directly instead of copying it into a wxStringInputStream.
+      wxCharBuffer const utf8(
+        (rootStart + s.Mid(chunk.start, chunk.end - chunk.start) + rootEnd).utf8_str());
+      wxMemoryInputStream xmlStream(utf8.data(), utf8.length());
+
+      wxXmlDocument xml;
+      xml.Load(xmlStream, wxT("UTF-8"), wxXMLDOC_KEEP_WHITESPACE_NODES);
+
+      wxXmlNode *doc = xml.GetRoot();
+      if (doc == NULL)
+        continue;
+      Cell *chunkCells = ParseTag_(doc->GetChildren());
+      if (cell == NULL)
+        cell = chunkCells;
+      else
+        cell->AppendCell(chunkCells);
+    }
   }
   else
   {
@@ -1187,7 +1316,6 @@ Cell *MathParser::ParseLine(wxString s, CellType style)
   return cell;
 }
 
-wxRegEx MathParser::m_graphRegex(wxT("[[:cntrl:]]"));
 MathParser::MathCellFunctionHash MathParser::m_innerTags;
 MathParser::GroupCellFunctionHash MathParser::m_groupTags;
 wxString MathParser::m_unknownXMLTagToolTip;
@@ -33,8 +33,10 @@ The header file for the xml cell parser
 
 #include <wx/filesys.h>
 #include <wx/fs_arc.h>
+#include "ZipArchiveIndex.h"
 #include <wx/regex.h>
 #include <wx/hashmap.h>
+#include <vector>
 #include "Cell.h"
 #include "TextCell.h"
 #include "EditorCell.h"
@@ -62,6 +64,14 @@ public:
   ~MathParser();
 
   void SetUserLabel(wxString label){ m_userDefinedLabel = label; }
+  /*! Collect the warnings instead of showing them in a message box
+
+    Needed by parsers that run in a background task: Only the GUI thread may
+    open windows.
+   */
+  void CollectWarnings(bool collect){ m_collectWarnings = collect; }
+  //! Returns the warnings that were collected since the last call and forgets them
+  wxArrayString TakeWarnings();
   /***
    * Parse the string s, which is (correct) xml fragment.
    * Put the result in line.
@@ -278,14 +288,57 @@ private:
   // @}
   //! The last user defined label
   wxString m_userDefinedLabel;
-  //! A RegEx that catches the last graphics placeholder
-  static wxRegEx m_graphRegex;
+  /*! Is this a control character we need to replace before parsing?
+
+    Matches the same characters as the POSIX class [[:cntrl:]].
+   */
+  static bool IsControlChar(wxUniChar ch)
+    {
+      wxUint32 const value = ch.GetValue();
+      return (value < 0x20) || ((value >= 0x7F) && (value <= 0x9F));
+    }
+
+  //! A range [start, end) of the text of an XML element's children
+  struct XMLChunk
+  {
+    size_t start;
+    size_t end;
+  };
+
+  //! The approximate number of characters ParseLine() builds an XML tree for at once
+  static constexpr size_t XMLChunkSize = 65536;
+
+  /*! The position of the '>' that ends the tag starting at pos
+
+    \return The position, or wxString::npos if the tag doesn't end.
+   */
+  static size_t FindTagEnd(const wxString &xml, size_t pos);
+
+  /*! Splits the children of the root element of xml into chunks of top-level tags
+
+    Lets ParseLine() build the XML tree for one chunk at a time. Each chunk is
+    at least chunkSize characters long, except for the last one.
+    \param xml The XML text to split
+    \param chunkSize The size a chunk needs to have before a new one is started
+    \param chunks The ranges of xml that make up the chunks
+    \param rootStart The start tag of the root element. Each chunk needs to be
+           enclosed in rootStart and rootEnd in order to form a valid XML document.
+    \param rootEnd The end tag of the root element
+    \return false, if the XML contains anything this simple scanner doesn't
+            understand. In this case the whole of xml has to be parsed at once.
+   */
+  static bool SplitXML(const wxString &xml, size_t chunkSize, std::vector<XMLChunk> &chunks,
+                       wxString &rootStart, wxString &rootEnd);
 
   CellType m_ParserStyle;
   FracCell::FracType m_FracStyle;
   Configuration **m_configuration;
   bool m_highlight;
-  std::shared_ptr<wxFileSystem> m_fileSystem; // used for loading pictures in <img> and <slide>
+  //! true = Don't show warnings, but add them to m_warnings
+  bool m_collectWarnings = false;
+  //! The warnings that were collected if m_collectWarnings is true
+  wxArrayString m_warnings;
+  std::shared_ptr<ZipArchiveIndex> m_archive; // used for loading pictures in <img> and <slide>
   static wxString m_unknownXMLTagToolTip;
 };
 
@@ -53,6 +53,9 @@ static wxString const attr_extralong = "el";  // wxCommandEvent::ExtraLong
 static wxString const attr_string = "str";    // wxCommandEvent::String
 static wxString const attr_keycode = "key";   // wxKeyCode::keyCode
 
+const wxString &MaximaIPC::Prefix() { return ipcPrefix; }
+const wxString &MaximaIPC::Suffix() { return ipcSuffix; }
+
 #define ID_(id) {#id, wxEVT_##id}
 #define ID2_(id, name) {name, wxEVT_##id}
 static const std::unordered_map<wxString, wxEventType, wxStringHash> EVENT_TYPE_NAMES =
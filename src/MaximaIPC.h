@@ -45,6 +45,11 @@ public:
    */
   void ReadInputData(wxString &data);
   static void EnableIPC() { m_enabled = true; }
+  static bool IsEnabled() { return m_enabled; }
+  //! The tag the interprocess communication data starts with
+  static const wxString &Prefix();
+  //! The tag the interprocess communication data ends with
+  static const wxString &Suffix();
 
 private:
   wxMaxima *m_wxMaxima = nullptr;
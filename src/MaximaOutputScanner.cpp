@@ -0,0 +1,84 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file defines the class MaximaOutputScanner that finds the tags in the
+  output maxima sends us.
+ */
+
+#include "MaximaOutputScanner.h"
+
+constexpr std::size_t MaximaOutputScanner::NoTag;
+
+std::size_t MaximaOutputScanner::AddTag(const wxString &prefix, const wxString &suffix)
+{
+  m_tags.push_back({prefix, suffix, true});
+  return m_tags.size() - 1;
+}
+
+std::size_t MaximaOutputScanner::TagAt(const wxString &data, std::size_t pos) const
+{
+  // All of our tags start with a '<'.
+  if ((pos >= data.Length()) || (data[pos] != wxT('<')))
+    return NoTag;
+  for (std::size_t tag = 0; tag < m_tags.size(); tag++)
+  {
+    if (!m_tags[tag].enabled)
+      continue;
+    if (data.compare(pos, m_tags[tag].prefix.Length(), m_tags[tag].prefix) == 0)
+      return tag;
+  }
+  return NoTag;
+}
+
+std::size_t MaximaOutputScanner::MiscTextEnd(const wxString &data, std::size_t start) const
+{
+  // Only a '<' can start a tag => we only need to look at these.
+  std::size_t pos = start;
+  while ((pos = data.find(wxT('<'), pos)) != wxString::npos)
+  {
+    if (TagAt(data, pos) != NoTag)
+      return pos;
+    pos++;
+  }
+  return data.Length();
+}
+
+std::size_t MaximaOutputScanner::TagEnd(const wxString &data, std::size_t pos, std::size_t tag)
+{
+  const wxString &suffix = m_tags[tag].suffix;
+  std::size_t searchStart = pos + m_tags[tag].prefix.Length();
+  if ((pos == 0) && (m_tagEndSearchStart > searchStart))
+    searchStart = m_tagEndSearchStart;
+  std::size_t end = data.find(suffix, searchStart);
+  if (end == wxString::npos)
+  {
+    // Next time we only need to search the data that has arrived since then.
+    std::size_t tagLength = data.Length() - pos;
+    if (tagLength > suffix.Length())
+      m_tagEndSearchStart = tagLength - suffix.Length() + 1;
+    else
+      m_tagEndSearchStart = 0;
+    return wxString::npos;
+  }
+  m_tagEndSearchStart = 0;
+  return end + suffix.Length();
+}
@@ -0,0 +1,101 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file declares the class MaximaOutputScanner that finds the tags in the
+  output maxima sends us.
+ */
+
+#ifndef WXMAXIMA_MAXIMAOUTPUTSCANNER_H
+#define WXMAXIMA_MAXIMAOUTPUTSCANNER_H
+
+#include <wx/string.h>
+#include <cstddef>
+#include <vector>
+
+/*! Finds the tags wxMaxima knows about in maxima's output
+
+  The scanner only knows where each tag starts and ends. What the tags mean is up
+  to the caller who identifies them by the index AddTag() has returned.
+
+  Maxima's output arrives in many small packets. If a tag is incomplete TagEnd()
+  remembers how far it has searched for its end so a big tag isn't searched again
+  from the start every time a few more bytes of it arrive.
+ */
+class MaximaOutputScanner
+{
+public:
+  //! Returned by TagAt() if the text doesn't start a tag
+  static constexpr std::size_t NoTag = static_cast<std::size_t>(-1);
+
+  /*! Adds a tag the scanner shall recognize
+
+    \return The index that identifies the tag.
+   */
+  std::size_t AddTag(const wxString &prefix, const wxString &suffix);
+
+  //! Tells the scanner to ignore a tag for now, or to recognize it again
+  void EnableTag(std::size_t tag, bool enable) { m_tags[tag].enabled = enable; }
+
+  /*! Returns the tag starting at position pos of data
+
+    \return The index of the tag, or NoTag if the text at pos doesn't start a tag.
+   */
+  std::size_t TagAt(const wxString &data, std::size_t pos) const;
+
+  /*! Determine where the text that isn't part of a tag ends
+
+    Every error message or other line maxima outputs should end in a newline character.
+    But sometimes it doesn't and a tag comes first.
+    \return The position of the next tag after start, or the length of data.
+   */
+  std::size_t MiscTextEnd(const wxString &data, std::size_t start) const;
+
+  /*! Where the tag that starts at position pos ends
+
+    The caller is expected to remove everything up to pos from data before the next
+    call: The search for the end of an incomplete tag is only continued if that tag
+    starts data.
+    \return The position behind the tag's suffix, or wxString::npos if the suffix
+            hasn't arrived yet.
+   */
+  std::size_t TagEnd(const wxString &data, std::size_t pos, std::size_t tag);
+
+  //! Forget about the incomplete tag, for example because maxima has been restarted.
+  void Reset() { m_tagEndSearchStart = 0; }
+
+private:
+  struct Tag
+  {
+    wxString prefix;
+    wxString suffix;
+    bool enabled;
+  };
+  //! All tags we know about
+  std::vector<Tag> m_tags;
+  /*! Where to continue searching for the end of the incomplete tag data starts with
+
+    Relative to the start of data.
+   */
+  std::size_t m_tagEndSearchStart = 0;
+};
+
+#endif // WXMAXIMA_MAXIMAOUTPUTSCANNER_H
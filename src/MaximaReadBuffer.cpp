@@ -0,0 +1,135 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file defines the class MaximaReadBuffer that collects the raw bytes maxima
+  sends us and converts them to text in big chunks.
+ */
+
+#include "MaximaReadBuffer.h"
+#include <wx/socket.h>
+#include <wx/strconv.h>
+#include <algorithm>
+#include <cstring>
+
+constexpr std::size_t MaximaReadBuffer::BlockSize;
+
+std::size_t MaximaReadBuffer::ReadFrom(wxSocketBase &socket, std::size_t maxBytes)
+{
+  std::size_t bytesRead = 0;
+  while (socket.IsConnected() && socket.IsData() && (bytesRead < maxBytes))
+  {
+    char *dest = Reserve(BlockSize);
+    socket.Read(dest, BlockSize);
+    std::size_t count = socket.LastReadCount();
+    if (count == 0)
+      break;
+    m_end += count;
+    bytesRead += count;
+  }
+  return bytesRead;
+}
+
+void MaximaReadBuffer::Append(const char *data, std::size_t length)
+{
+  if (length == 0)
+    return;
+  std::memcpy(Reserve(length), data, length);
+  m_end += length;
+}
+
+char *MaximaReadBuffer::Reserve(std::size_t minFree)
+{
+  if (m_buffer.size() - m_end >= minFree)
+    return m_buffer.data() + m_end;
+
+  // Move the data we still need to the beginning of the buffer. Normally
+  // that is at most the 3 bytes of an incomplete UTF-8 character.
+  std::size_t const pending = m_end - m_start;
+  if (m_start > 0)
+  {
+    if (pending > 0)
+      std::memmove(m_buffer.data(), m_buffer.data() + m_start, pending);
+    m_start = 0;
+    m_end = pending;
+  }
+  if (m_buffer.size() - m_end < minFree)
+    m_buffer.resize(std::max(m_buffer.size() * 2, m_end + minFree));
+  return m_buffer.data() + m_end;
+}
+
+std::size_t MaximaReadBuffer::CompleteUTF8Length(const char *data, std::size_t length)
+{
+  // Search backwards for the lead byte of the last character
+  std::size_t const lookBack = std::min<std::size_t>(length, 4);
+  for (std::size_t i = 1; i <= lookBack; i++)
+  {
+    unsigned char const ch = data[length - i];
+    // A continuation byte: The lead byte is further back
+    if ((ch & 0xC0) == 0x80)
+      continue;
+    std::size_t seqLen = 1;
+    if ((ch & 0xE0) == 0xC0)
+      seqLen = 2;
+    else if ((ch & 0xF0) == 0xE0)
+      seqLen = 3;
+    else if ((ch & 0xF8) == 0xF0)
+      seqLen = 4;
+    if (seqLen > i)
+      return length - i;
+    return length;
+  }
+  // Only continuation bytes: That's invalid UTF-8 we cannot fix by waiting
+  // for more data. Let the converter deal with it.
+  return length;
+}
+
+void MaximaReadBuffer::DecodeTo(wxString &dest)
+{
+  if (m_end == m_start)
+    return;
+
+  char *const data = m_buffer.data() + m_start;
+  // Remove the NUL bytes in place. In UTF-8 a 0 byte is never part of a
+  // multibyte character, so this cannot break any of them.
+  char *const dataEnd = std::remove(data, m_buffer.data() + m_end, '\0');
+  m_end = dataEnd - m_buffer.data();
+
+  std::size_t const length = CompleteUTF8Length(data, m_end - m_start);
+  if (length == 0)
+    return;
+
+  wxString decoded = wxString::FromUTF8(data, length);
+  if (decoded.IsEmpty())
+  {
+    // Not valid UTF-8. Don't lose the data, but show the invalid bytes
+    // as something the user can see.
+    static wxMBConvUTF8 const lenientConv(wxMBConvUTF8::MAP_INVALID_UTF8_TO_OCTAL);
+    decoded = wxString(data, lenientConv, length);
+  }
+  if (dest.IsEmpty())
+    dest = std::move(decoded);
+  else
+    dest += decoded;
+  m_start += length;
+  if (m_start == m_end)
+    m_start = m_end = 0;
+}
@@ -0,0 +1,104 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file declares the class MaximaReadBuffer that collects the raw bytes maxima
+  sends us and converts them to text in big chunks.
+ */
+
+#ifndef WXMAXIMA_MAXIMAREADBUFFER_H
+#define WXMAXIMA_MAXIMAREADBUFFER_H
+
+#include <wx/string.h>
+#include <cstddef>
+#include <vector>
+
+class wxSocketBase;
+
+/*! A growable byte buffer that collects the raw data maxima sends us
+
+  Reading the socket one wxChar at a time through a wxTextInputStream makes
+  multi-megabyte outputs crawl. This buffer instead reads everything the socket
+  offers in big blocks and converts the result to a wxString in one go.
+
+  UTF-8 sequences can be split between two reads: The incomplete tail of a read
+  stays in the buffer until the rest of the character arrives.
+ */
+class MaximaReadBuffer
+{
+public:
+  //! The size of the blocks we request from the socket
+  static constexpr std::size_t BlockSize = 65536;
+
+  /*! Reads all data the socket currently has to offer
+
+    \param socket The socket to read from.
+    \param maxBytes Stop reading after approximately that many bytes so the GUI
+           stays responsive during a big data transfer.
+    \return The number of bytes read.
+   */
+  std::size_t ReadFrom(wxSocketBase &socket, std::size_t maxBytes);
+
+  /*! Appends raw bytes to the buffer.
+
+    Used by ReadFrom() and for feeding the buffer with data that didn't come from a
+    socket.
+   */
+  void Append(const char *data, std::size_t length);
+
+  /*! Converts all complete UTF-8 characters in the buffer to a string
+
+    NUL bytes are dropped. An incomplete UTF-8 sequence at the end of the buffer is
+    kept for the next call.
+    \param dest The string the decoded text is appended to
+   */
+  void DecodeTo(wxString &dest);
+
+  //! The number of bytes in the buffer that haven't been decoded yet.
+  std::size_t GetPendingBytes() const { return m_end - m_start; }
+
+  //! Discards all data in the buffer, for example when maxima has been restarted.
+  void Clear() { m_start = m_end = 0; }
+
+private:
+  /*! Makes sure that there are at least minFree bytes of free space behind m_end
+
+    Moves the undecoded data to the start of the buffer first and only grows the
+    buffer if that doesn't free enough space.
+   */
+  char *Reserve(std::size_t minFree);
+
+  /*! How many bytes at the start of [data, data+length) form complete UTF-8 characters
+
+    Only the last 3 bytes can belong to an incomplete character, so this never
+    looks further back than that.
+   */
+  static std::size_t CompleteUTF8Length(const char *data, std::size_t length);
+
+  //! The bytes we received
+  std::vector<char> m_buffer;
+  //! The index of the first byte that hasn't been decoded yet
+  std::size_t m_start = 0;
+  //! The index after the last byte we received
+  std::size_t m_end = 0;
+};
+
+#endif // WXMAXIMA_MAXIMAREADBUFFER_H
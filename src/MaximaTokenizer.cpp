@@ -29,6 +29,8 @@
 #include "MaximaTokenizer.h"
 #include <wx/wx.h>
 #include <wx/string.h>
+#include <algorithm>
+#include <iterator>
 #include <vector>
 
 
@@ -411,6 +413,153 @@ MaximaTokenizer::MaximaTokenizer(wxString commands,
   m_tokens = initialTokens;
 }
 
+MaximaTokenizer::MaximaTokenizer(const wxString &commands,
+                                 Configuration *configuration,
+                                 const wxString &oldCommands,
+                                 TokenList &&oldTokens)
+{
+  if (commands == oldCommands)
+  {
+    m_tokens = std::move(oldTokens);
+    return;
+  }
+  // In lisp mode the first token can span many lines.
+  if (configuration->InLispMode() || oldTokens.empty())
+  {
+    m_tokens = MaximaTokenizer(commands, configuration).PopTokens();
+    return;
+  }
+
+  // Determine which part of the text has changed
+  size_t oldLength = oldCommands.Length();
+  size_t newLength = commands.Length();
+  size_t prefix = 0;
+  {
+    wxString::const_iterator oldChar = oldCommands.begin();
+    wxString::const_iterator newChar = commands.begin();
+    while ((oldChar != oldCommands.end()) && (newChar != commands.end()) &&
+           (*oldChar == *newChar))
+    {
+      ++oldChar;
+      ++newChar;
+      ++prefix;
+    }
+  }
+  size_t suffix = 0;
+  {
+    wxString::const_reverse_iterator oldChar = oldCommands.rbegin();
+    wxString::const_reverse_iterator newChar = commands.rbegin();
+    while ((prefix + suffix < oldLength) && (prefix + suffix < newLength) &&
+           (*oldChar == *newChar))
+    {
+      ++oldChar;
+      ++newChar;
+      ++suffix;
+    }
+  }
+
+  // The start position of each old token
+  std::vector<size_t> oldStarts;
+  oldStarts.reserve(oldTokens.size() + 1);
+  size_t pos = 0;
+  for (auto const &token : oldTokens)
+  {
+    oldStarts.push_back(pos);
+    pos += token.GetText().Length();
+  }
+  oldStarts.push_back(pos);
+  if (pos != oldLength)
+  {
+    // The tokens don't belong to oldCommands
+    m_tokens = MaximaTokenizer(commands, configuration).PopTokens();
+    return;
+  }
+
+  // The last token that starts a line and isn't behind the first change
+  size_t restartToken = 0;
+  for (size_t i = 1; (i < oldTokens.size()) && (oldStarts[i] <= prefix); i++)
+    if (IsLineBreak(oldTokens[i - 1]))
+      restartToken = i;
+  size_t restartPos = oldStarts[restartToken];
+
+  // The first token that starts a line and is part of the unchanged end of the text
+  size_t resumeToken = oldTokens.size();
+  for (size_t i = restartToken + 1; i < oldTokens.size(); i++)
+    if ((oldStarts[i] >= oldLength - suffix) && IsLineBreak(oldTokens[i - 1]))
+    {
+      resumeToken = i;
+      break;
+    }
+
+  m_tokens.reserve(oldTokens.size() + 16);
+  std::move(oldTokens.begin(), oldTokens.begin() + restartToken, std::back_inserter(m_tokens));
+
+  bool converged = false;
+  if (resumeToken < oldTokens.size())
+  {
+    size_t resumePos = oldStarts[resumeToken] + newLength - oldLength;
+    TokenList changed = MaximaTokenizer(
+      commands.Mid(restartPos, resumePos - restartPos), configuration).PopTokens();
+    // Only if the changed lines end in a line break of their own the tokenizer
+    // is in the same state as it was in at the start of the unchanged lines.
+    if (!changed.empty() && IsLineBreak(changed.back()))
+    {
+      std::move(changed.begin(), changed.end(), std::back_inserter(m_tokens));
+      size_t changedEnd = m_tokens.size();
+      std::move(oldTokens.begin() + resumeToken, oldTokens.end(), std::back_inserter(m_tokens));
+      UpdateFunctionStyleBefore(changedEnd);
+      converged = true;
+    }
+  }
+  if (!converged)
+  {
+    TokenList changed = MaximaTokenizer(commands.Mid(restartPos), configuration).PopTokens();
+    std::move(changed.begin(), changed.end(), std::back_inserter(m_tokens));
+  }
+  UpdateFunctionStyleBefore(restartToken);
+}
+
+bool MaximaTokenizer::IsLineBreak(const Token &token)
+{
+  const wxString &text = token.GetText();
+  return (text.Length() == 1) && m_linebreaks.Contains(text);
+}
+
+void MaximaTokenizer::UpdateFunctionStyleBefore(size_t index)
+{
+  auto IsWhitespace = [](const wxString &text) {
+    for (auto const &ch : text)
+      if ((ch != ' ') && (ch != '\t') && (ch != '\n') && (ch != '\r'))
+        return false;
+    return true;
+  };
+
+  // A backslash at the end of a line leaves behind an empty identifier whose
+  // style is determined, too, so empty tokens aren't skipped here.
+  size_t identifier = index;
+  while ((identifier > 0) && !m_tokens[identifier - 1].GetText().IsEmpty() &&
+         IsWhitespace(m_tokens[identifier - 1].GetText()))
+    identifier--;
+  if (identifier == 0)
+    return;
+  identifier--;
+
+  const Token &token = m_tokens[identifier];
+  if ((token.GetStyle() != TS_CODE_VARIABLE) && (token.GetStyle() != TS_CODE_FUNCTION))
+    return;
+  if (m_hardcodedFunctions.find(token.GetText()) != m_hardcodedFunctions.end())
+    return;
+
+  size_t next = index;
+  while ((next < m_tokens.size()) && IsWhitespace(m_tokens[next].GetText()))
+    next++;
+  TextStyle style = TS_CODE_VARIABLE;
+  if ((next < m_tokens.size()) && m_tokens[next].GetText().StartsWith(wxT("(")))
+    style = TS_CODE_FUNCTION;
+  if (style != token.GetStyle())
+    m_tokens[identifier] = Token(token.GetText(), style);
+}
+
 bool MaximaTokenizer::IsAlpha(wxChar ch)
 {
   if (wxIsalpha(ch))
@@ -80,9 +80,33 @@ public:
   MaximaTokenizer(wxString commands, Configuration *configuration,
                   const TokenList &initialTokens);
 
+  /*! A constructor that re-uses the tokens of an earlier version of the text
+
+    At the start of a line the tokenizer carries no state from the lines before.
+    This constructor therefore only tokenizes the lines from the first changed
+    one up to the first line start after the last change at which the old and
+    the new tokens agree again, and copies all other tokens from oldTokens.
+
+    \param commands The text to tokenize
+    \param configuration The configuration to use
+    \param oldCommands The text oldTokens was generated from
+    \param oldTokens The tokens of oldCommands
+  */
+  MaximaTokenizer(const wxString &commands, Configuration *configuration,
+                  const wxString &oldCommands, TokenList &&oldTokens);
+
 protected:
   //! The tokens the string is divided into
   TokenList m_tokens;
+  //! Is this token a hard line break?
+  static bool IsLineBreak(const Token &token);
+  /*! Re-determine if the last identifier before m_tokens[index] is a function
+
+    A name is a function name if the next thing that isn't whitespace is an
+    opening parenthesis, which might be in a line that has been tokenized
+    separately from the name.
+  */
+  void UpdateFunctionStyleBefore(size_t index);
   //! ASCII symbols that wxIsalnum() doesn't see as chars, but maxima does.
   static const wxString m_additional_alphas;
   //! Unicode Operators and other special non-ascii characters
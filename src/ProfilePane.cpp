@@ -0,0 +1,195 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file defines the class ProfilePane that lists what the evaluation of
+  each cell has cost.
+ */
+
+#include "ProfilePane.h"
+#include <wx/ffile.h>
+#include <wx/filedlg.h>
+#include <wx/sizer.h>
+#include <algorithm>
+
+ProfilePane::ProfilePane(wxWindow *parent, int id) : wxPanel(parent, id)
+{
+  m_list = new wxListCtrl(this, profile_ctrl_id, wxDefaultPosition, wxDefaultSize,
+                          wxLC_SINGLE_SEL | wxLC_REPORT);
+  m_list->AppendColumn(_("Cell"));
+  m_list->AppendColumn(_("Time [s]"), wxLIST_FORMAT_RIGHT);
+  m_list->AppendColumn(_("User CPU [s]"), wxLIST_FORMAT_RIGHT);
+  m_list->AppendColumn(_("System CPU [s]"), wxLIST_FORMAT_RIGHT);
+  m_list->AppendColumn(_("Peak RAM [MiB]"), wxLIST_FORMAT_RIGHT);
+  m_list->AppendColumn(_("Output [KiB]"), wxLIST_FORMAT_RIGHT);
+  wxButton *exportButton = new wxButton(this, profile_export_id, _("Export..."));
+  exportButton->SetToolTip(_("Save the list as CSV or JSON file"));
+
+  // A box whose 1st row is growable
+  wxFlexGridSizer *box = new wxFlexGridSizer(1);
+  box->AddGrowableCol(0);
+  box->AddGrowableRow(0);
+  box->Add(m_list, wxSizerFlags().Expand());
+  box->Add(exportButton, wxSizerFlags().Right().Border(wxALL, 2));
+  SetSizer(box);
+  box->Fit(this);
+  box->SetSizeHints(this);
+
+  Connect(profile_ctrl_id, wxEVT_LIST_COL_CLICK, wxListEventHandler(ProfilePane::OnColumnClick));
+  Connect(profile_export_id, wxEVT_BUTTON, wxCommandEventHandler(ProfilePane::OnExport));
+  Connect(wxEVT_SIZE, wxSizeEventHandler(ProfilePane::OnSize));
+}
+
+void ProfilePane::OnSize(wxSizeEvent &event)
+{
+  // The numbers are short => the column with the cells' contents gets all space
+  // the numbers don't need.
+  int numbersWidth = 0;
+  for (int column = column_wallTime; column <= column_output; column++)
+    numbersWidth += m_list->GetColumnWidth(column);
+  m_list->SetColumnWidth(column_cell, std::max(event.GetSize().x - numbersWidth, 100));
+  event.Skip();
+}
+
+void ProfilePane::UpdateProfiles(GroupCell *tree)
+{
+  m_entries.clear();
+  for (GroupCell *cell = tree; cell; cell = cell->GetNext())
+  {
+    if (!cell->GetProfile())
+      continue;
+    Entry entry;
+    entry.m_cell = cell;
+    if (cell->GetPrompt())
+      entry.m_label = cell->GetPrompt()->ToString() + wxT(" ");
+    if (cell->GetEditable())
+      entry.m_label += cell->GetEditable()->ToString(true).BeforeFirst(wxT('\n'));
+    entry.m_label.Trim(false);
+    entry.m_profile = *cell->GetProfile();
+    m_entries.push_back(entry);
+  }
+  Sort();
+  UpdateDisplay();
+}
+
+GroupCell *ProfilePane::GetCell(long index) const
+{
+  if ((index < 0) || (index >= static_cast<long>(m_entries.size())))
+    return NULL;
+  return m_entries[index].m_cell;
+}
+
+void ProfilePane::OnColumnClick(wxListEvent &event)
+{
+  Column column = static_cast<Column>(event.GetColumn());
+  if (column == m_sortColumn)
+    m_sortAscending = !m_sortAscending;
+  else
+  {
+    m_sortColumn = column;
+    // The cells are sorted by name, the numbers the biggest first.
+    m_sortAscending = (column == column_cell);
+  }
+  Sort();
+  UpdateDisplay();
+}
+
+void ProfilePane::Sort()
+{
+  Column column = m_sortColumn;
+  auto value = [column](const Entry &entry) -> double {
+    switch (column)
+    {
+    case column_userTime:
+      return entry.m_profile.m_userTime;
+    case column_systemTime:
+      return entry.m_profile.m_systemTime;
+    case column_peakMemory:
+      return entry.m_profile.m_peakMemory;
+    case column_output:
+      return entry.m_profile.m_outputBytes;
+    default:
+      return entry.m_profile.m_wallTime;
+    }
+  };
+  bool ascending = m_sortAscending;
+  std::stable_sort(m_entries.begin(), m_entries.end(),
+                   [column, ascending, value](const Entry &a, const Entry &b) {
+                     if (column == column_cell)
+                       return ascending ? (a.m_label < b.m_label) : (b.m_label < a.m_label);
+                     return ascending ? (value(a) < value(b)) : (value(b) < value(a));
+                   });
+}
+
+void ProfilePane::UpdateDisplay()
+{
+  auto seconds = [](double value) {
+    return (value < 0) ? wxString(wxT("?")) : wxString::Format(wxT("%.3f"), value);
+  };
+  // We don't empty the list and create a new one since on Windows this causes
+  // excessive flickering.
+  for (size_t i = 0; i < m_entries.size(); i++)
+  {
+    const EvaluationProfile &profile = m_entries[i].m_profile;
+    if (static_cast<long>(i) >= m_list->GetItemCount())
+      m_list->InsertItem(i, m_entries[i].m_label);
+    else
+      m_list->SetItem(i, column_cell, m_entries[i].m_label);
+    m_list->SetItem(i, column_wallTime, seconds(profile.m_wallTime));
+    m_list->SetItem(i, column_userTime, seconds(profile.m_userTime));
+    m_list->SetItem(i, column_systemTime, seconds(profile.m_systemTime));
+    m_list->SetItem(i, column_peakMemory, (profile.m_peakMemory < 0) ? wxString(wxT("?")) :
+                    wxString::Format(wxT("%.1f"), profile.m_peakMemory / 1048576.0));
+    m_list->SetItem(i, column_output, wxString::Format(wxT("%.1f"), profile.m_outputBytes / 1024.0));
+  }
+  for (long i = m_list->GetItemCount(); i > static_cast<long>(m_entries.size()); i--)
+    m_list->DeleteItem(i - 1);
+}
+
+void ProfilePane::OnExport(wxCommandEvent &WXUNUSED(event))
+{
+  wxFileDialog dialog(this, _("Export the evaluation profile"), wxEmptyString,
+                      wxT("profile.csv"),
+                      _("CSV file (*.csv)|*.csv|JSON file (*.json)|*.json"),
+                      wxFD_SAVE | wxFD_OVERWRITE_PROMPT);
+  if (dialog.ShowModal() != wxID_OK)
+    return;
+
+  wxString contents;
+  if (dialog.GetFilterIndex() == 1)
+  {
+    contents = wxT("[");
+    for (size_t i = 0; i < m_entries.size(); i++)
+      contents += ((i > 0) ? wxT(",\n  ") : wxT("\n  ")) +
+        m_entries[i].m_profile.ToJSON(m_entries[i].m_label);
+    contents += wxT("\n]\n");
+  }
+  else
+  {
+    contents = EvaluationProfile::CSVHeader() + wxT("\n");
+    for (const auto &entry : m_entries)
+      contents += entry.m_profile.ToCSV(entry.m_label) + wxT("\n");
+  }
+
+  wxFFile file(dialog.GetPath(), wxT("wb"));
+  if (!file.IsOpened() || !file.Write(contents, wxConvUTF8))
+    wxLogError(_("Cannot write the evaluation profile to %s."), dialog.GetPath());
+}
@@ -0,0 +1,97 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file declares the class ProfilePane that lists what the evaluation of
+  each cell has cost.
+ */
+
+#ifndef WXMAXIMA_PROFILEPANE_H
+#define WXMAXIMA_PROFILEPANE_H
+
+#include "precomp.h"
+#include "GroupCell.h"
+#include <wx/wx.h>
+#include <wx/listctrl.h>
+#include <vector>
+
+enum
+{
+  profile_ctrl_id = wxID_HIGHEST + 1600,
+  profile_export_id
+};
+
+/*! The "slowest cells" pane
+
+  Lists the cells of the worksheet whose evaluation has been profiled, the
+  slowest first by default. Clicking at a column header sorts the list by this
+  column, activating an item is handled by wxMaxima, which moves the cursor
+  to the cell.
+ */
+class ProfilePane : public wxPanel
+{
+public:
+  ProfilePane(wxWindow *parent, int id);
+
+  /*! Re-reads the profiles from the worksheet
+
+    Traverses the whole worksheet => should only be called if the pane is shown.
+   */
+  void UpdateProfiles(GroupCell *tree);
+
+  //! The cell the nth item of the list describes
+  GroupCell *GetCell(long index) const;
+
+private:
+  //! The columns of the list
+  enum Column
+  {
+    column_cell,
+    column_wallTime,
+    column_userTime,
+    column_systemTime,
+    column_peakMemory,
+    column_output
+  };
+
+  //! A profiled cell
+  struct Entry
+  {
+    GroupCell *m_cell;
+    wxString m_label;
+    EvaluationProfile m_profile;
+  };
+
+  void OnColumnClick(wxListEvent &event);
+  void OnExport(wxCommandEvent &event);
+  void OnSize(wxSizeEvent &event);
+  //! Sorts m_entries by m_sortColumn
+  void Sort();
+  //! Displays m_entries
+  void UpdateDisplay();
+
+  wxListCtrl *m_list;
+  std::vector<Entry> m_entries;
+  Column m_sortColumn = column_wallTime;
+  bool m_sortAscending = false;
+};
+
+#endif // WXMAXIMA_PROFILEPANE_H
@@ -0,0 +1,277 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+#include "ScaledBitmapCache.h"
+#include <wx/intl.h>
+#include <wx/log.h>
+#include <functional>
+#include <iterator>
+
+ScaledBitmapCache::ScaledBitmapCache()
+{
+  #ifdef HAVE_OMP_HEADER
+  omp_init_lock(&m_lock);
+  #endif
+}
+
+ScaledBitmapCache::~ScaledBitmapCache()
+{
+  #ifdef HAVE_OMP_HEADER
+  omp_destroy_lock(&m_lock);
+  #endif
+}
+
+size_t ScaledBitmapCache::KeyHasher::operator()(const Key &key) const
+{
+  size_t hash = std::hash<const void *>()(key.image);
+  hash ^= std::hash<int>()(key.width) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  hash ^= std::hash<int>()(key.height) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  return hash;
+}
+
+bool ScaledBitmapCache::Lookup(const Image *image, wxSize size, wxBitmap &bitmap)
+{
+  Key key{image, size.x, size.y};
+  wxImage prefetched;
+  #ifdef HAVE_OMP_HEADER
+  omp_set_lock(&m_lock);
+  #endif
+  auto it = m_index.find(key);
+  if (it != m_index.end())
+  {
+    ++ m_hits;
+    // Mark the entry as the most recently used one
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    bitmap = it->second->bitmap;
+    #ifdef HAVE_OMP_HEADER
+    omp_unset_lock(&m_lock);
+    #endif
+    return true;
+  }
+
+  // Maybe a background task has already scaled this image for us.
+  auto pre = m_prefetchIndex.find(key);
+  if ((pre != m_prefetchIndex.end()) && pre->second->image.IsOk())
+  {
+    prefetched = pre->second->image;
+    ErasePrefetch(pre->second);
+  }
+  #ifdef HAVE_OMP_HEADER
+  omp_unset_lock(&m_lock);
+  #endif
+  if (prefetched.IsOk())
+  {
+    ++ m_prefetchHits;
+    bitmap = wxBitmap(prefetched, 24);
+    Add(image, size, bitmap);
+    return true;
+  }
+
+  ++ m_misses;
+  LogStatisticsIfDue();
+  return false;
+}
+
+void ScaledBitmapCache::Add(const Image *image, wxSize size, const wxBitmap &bitmap)
+{
+  Key key{image, size.x, size.y};
+  size_t bytes = size_t(bitmap.GetWidth()) * bitmap.GetHeight() * 4;
+  #ifdef HAVE_OMP_HEADER
+  omp_set_lock(&m_lock);
+  #endif
+  auto it = m_index.find(key);
+  if (it != m_index.end())
+  {
+    m_bytes -= it->second->bytes;
+    m_entries.erase(it->second);
+    m_index.erase(it);
+  }
+
+  // An image a background task has scaled, or is still scaling, for us isn't
+  // needed any more.
+  auto pre = m_prefetchIndex.find(key);
+  if (pre != m_prefetchIndex.end())
+    ErasePrefetch(pre->second);
+
+  m_entries.push_front({key, bitmap, bytes});
+  m_index.emplace(key, m_entries.begin());
+  m_bytes += bytes;
+  Shrink();
+  #ifdef HAVE_OMP_HEADER
+  omp_unset_lock(&m_lock);
+  #endif
+}
+
+bool ScaledBitmapCache::StartPrefetch(const Image *image, wxSize size)
+{
+  Key key{image, size.x, size.y};
+  size_t bytes = size_t(size.x) * size.y * 4;
+  bool start = false;
+  #ifdef HAVE_OMP_HEADER
+  omp_set_lock(&m_lock);
+  #endif
+  // Don't prefetch what is cached already or more than we could keep. The memory
+  // the image will need is reserved right now.
+  if ((m_index.find(key) == m_index.end()) &&
+      (m_bytes + bytes <= m_memoryLimit) &&
+      (m_prefetchIndex.find(key) == m_prefetchIndex.end()))
+  {
+    m_prefetches.push_front({key, wxImage(), bytes});
+    m_prefetchIndex.emplace(key, m_prefetches.begin());
+    m_bytes += bytes;
+    m_prefetchBytes += bytes;
+    start = true;
+  }
+  #ifdef HAVE_OMP_HEADER
+  omp_unset_lock(&m_lock);
+  #endif
+  return start;
+}
+
+void ScaledBitmapCache::AddPrefetched(const Image *image, wxSize size, const wxImage &scaled)
+{
+  Key key{image, size.x, size.y};
+  #ifdef HAVE_OMP_HEADER
+  omp_set_lock(&m_lock);
+  #endif
+  // If the image has been discarded while it was scaled nobody needs it.
+  auto pre = m_prefetchIndex.find(key);
+  if (pre != m_prefetchIndex.end())
+  {
+    if (scaled.IsOk())
+      pre->second->image = scaled;
+    else
+      ErasePrefetch(pre->second);
+  }
+  #ifdef HAVE_OMP_HEADER
+  omp_unset_lock(&m_lock);
+  #endif
+}
+
+void ScaledBitmapCache::Remove(const Image *image)
+{
+  #ifdef HAVE_OMP_HEADER
+  omp_set_lock(&m_lock);
+  #endif
+  for (auto it = m_entries.begin(); it != m_entries.end();)
+  {
+    if (it->key.image == image)
+    {
+      m_bytes -= it->bytes;
+      m_index.erase(it->key);
+      it = m_entries.erase(it);
+    }
+    else
+      ++it;
+  }
+
+  for (auto it = m_prefetches.begin(); it != m_prefetches.end();)
+  {
+    auto next = std::next(it);
+    if (it->key.image == image)
+      ErasePrefetch(it);
+    it = next;
+  }
+  #ifdef HAVE_OMP_HEADER
+  omp_unset_lock(&m_lock);
+  #endif
+}
+
+void ScaledBitmapCache::SetMemoryLimit(size_t bytes)
+{
+  if (bytes == m_memoryLimit)
+    return;
+  #ifdef HAVE_OMP_HEADER
+  omp_set_lock(&m_lock);
+  #endif
+  m_memoryLimit = bytes;
+  Shrink();
+  #ifdef HAVE_OMP_HEADER
+  omp_unset_lock(&m_lock);
+  #endif
+}
+
+void ScaledBitmapCache::ErasePrefetch(Prefetches::iterator prefetch)
+{
+  m_bytes -= prefetch->bytes;
+  m_prefetchBytes -= prefetch->bytes;
+  m_prefetchIndex.erase(prefetch->key);
+  m_prefetches.erase(prefetch);
+}
+
+void ScaledBitmapCache::Shrink()
+{
+  // Images that have been scaled in advance, but haven't been needed yet, are
+  // the least likely ones to be needed soon. A background task that is still
+  // working on one of them will find that its result isn't wanted any more.
+  while ((m_bytes > m_memoryLimit) && !m_prefetches.empty())
+  {
+    ErasePrefetch(std::prev(m_prefetches.end()));
+    ++ m_prefetchEvictions;
+  }
+
+  // The most recently used bitmap is always kept, even if it alone is bigger
+  // than the memory limit: It is the one that is about to be drawn.
+  while ((m_bytes > m_memoryLimit) && (m_entries.size() > 1))
+  {
+    m_bytes -= m_entries.back().bytes;
+    m_index.erase(m_entries.back().key);
+    m_entries.pop_back();
+    ++ m_evictions;
+  }
+}
+
+void ScaledBitmapCache::LogStatisticsIfDue()
+{
+  if ((m_misses % 100) == 0)
+    LogStatistics();
+}
+
+void ScaledBitmapCache::LogStatistics() const
+{
+  int lookups = m_hits + m_prefetchHits + m_misses;
+  wxLogMessage(_("Scaled image cache: %li images, %.1f of %.1f MB used (%.1f MB by prefetched images), hit rate %.1f%% (%i prefetched), %i images discarded (%i prefetched ones that were never used)"),
+               static_cast<long>(m_entries.size()),
+               m_bytes / 1048576.0, m_memoryLimit / 1048576.0, m_prefetchBytes / 1048576.0,
+               lookups ? 100.0 * (m_hits + m_prefetchHits) / lookups : 0.0,
+               m_prefetchHits, m_evictions, m_prefetchEvictions);
+}
+
+void ScaledBitmapCache::Clear()
+{
+  #ifdef HAVE_OMP_HEADER
+  omp_set_lock(&m_lock);
+  #endif
+  m_entries.clear();
+  m_index.clear();
+  m_bytes = m_prefetchBytes;
+  // Background tasks that are still scaling an image will find that their
+  // result isn't wanted any more.
+  for (auto it = m_prefetches.begin(); it != m_prefetches.end();)
+  {
+    auto next = std::next(it);
+    ErasePrefetch(it);
+    it = next;
+  }
+  #ifdef HAVE_OMP_HEADER
+  omp_unset_lock(&m_lock);
+  #endif
+}
@@ -0,0 +1,161 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+#ifndef SCALEDBITMAPCACHE_H
+#define SCALEDBITMAPCACHE_H
+
+#include "precomp.h"
+#include <wx/bitmap.h>
+#include <wx/image.h>
+#include <list>
+#include <unordered_map>
+
+#ifdef HAVE_OMP_HEADER
+#include <omp.h>
+#endif
+
+class Image;
+
+/*! \file
+ * This file implements a process-wide cache of scaled images.
+ */
+
+/*! A least-recently-used cache of the bitmaps Image::GetBitmap() creates
+
+  Decompressing an image and scaling it to the size it is displayed with is
+  slow. This cache keeps the results for all images of all worksheets, up to a
+  memory limit the user can configure. If the limit is reached, the bitmaps
+  that haven't been drawn for the longest time are discarded.
+
+  Creating bitmaps is only safe in the GUI thread. Background tasks that scale
+  images in advance therefore hand over a wxImage that the GUI thread converts
+  to a bitmap once it is needed. These images count against the memory limit,
+  too, and are the first ones to be discarded if memory gets scarce.
+ */
+class ScaledBitmapCache final
+{
+  struct Key
+  {
+    const Image *image;
+    int width;
+    int height;
+    bool operator==(const Key &o) const
+    { return image == o.image && width == o.width && height == o.height; }
+  };
+  struct KeyHasher
+  {
+    size_t operator()(const Key &key) const;
+  };
+  struct Entry
+  {
+    Key key;
+    wxBitmap bitmap;
+    size_t bytes;
+  };
+  using Entries = std::list<Entry>;
+  struct Prefetch
+  {
+    Key key;
+    //! Not Ok() as long as a background task is still working on it
+    wxImage image;
+    size_t bytes;
+  };
+  using Prefetches = std::list<Prefetch>;
+
+  ScaledBitmapCache(const ScaledBitmapCache &) = delete;
+  ScaledBitmapCache &operator=(const ScaledBitmapCache &) = delete;
+  /*! Discards images until we are within our memory limit
+
+    Images that have been scaled in advance, but haven't been drawn yet, go
+    first, the oldest one first. Then the least recently used bitmaps follow.
+   */
+  void Shrink();
+  //! Forgets an image that has been scaled in advance
+  void ErasePrefetch(Prefetches::iterator prefetch);
+  //! Logs the statistics every now and then
+  void LogStatisticsIfDue();
+
+  //! The cached bitmaps, the most recently used one first
+  Entries m_entries;
+  //! Finds the bitmaps by their key
+  std::unordered_map<Key, Entries::iterator, KeyHasher> m_index;
+  //! Images that have been scaled in advance by background tasks, the newest one first
+  Prefetches m_prefetches;
+  //! Finds the images in m_prefetches by their key
+  std::unordered_map<Key, Prefetches::iterator, KeyHasher> m_prefetchIndex;
+  #ifdef HAVE_OMP_HEADER
+  /*! Guards the entries, the prefetched images, their indices and the statistics
+
+    Remove() is called from background tasks, too: Image::LoadImage() and
+    ~Image may run there.
+   */
+  omp_lock_t m_lock;
+  #endif
+  size_t m_memoryLimit = 256 * 1024 * 1024;
+  //! The memory the bitmaps and the prefetched images use
+  size_t m_bytes = 0;
+  //! The part of m_bytes that is used by prefetched images
+  size_t m_prefetchBytes = 0;
+  int m_hits = 0;
+  int m_prefetchHits = 0;
+  int m_misses = 0;
+  int m_evictions = 0;
+  int m_prefetchEvictions = 0;
+public:
+  ScaledBitmapCache();
+  ~ScaledBitmapCache();
+  /*! Looks up the bitmap of image in the given size
+
+    Must be called from the GUI thread.
+    \return false, if we don't have that bitmap.
+   */
+  bool Lookup(const Image *image, wxSize size, wxBitmap &bitmap);
+  //! Remembers the bitmap of image in the given size. GUI thread only.
+  void Add(const Image *image, wxSize size, const wxBitmap &bitmap);
+  /*! Tells that a background task is about to scale an image to the given size
+
+    \return false, if the bitmap is cached or a task already is working on it.
+   */
+  bool StartPrefetch(const Image *image, wxSize size);
+  //! Hands over an image a background task has scaled. Thread-safe.
+  void AddPrefetched(const Image *image, wxSize size, const wxImage &scaled);
+  //! Forgets all bitmaps of an image, for example since it is deleted. Thread-safe.
+  void Remove(const Image *image);
+  //! Sets the amount of memory the bitmaps may use
+  void SetMemoryLimit(size_t bytes);
+  size_t GetMemoryLimit() const { return m_memoryLimit; }
+  //! The amount of memory the cached bitmaps and the prefetched images use
+  size_t GetBytes() const { return m_bytes; }
+  size_t GetSize() const { return m_entries.size(); }
+  int GetHits() const { return m_hits; }
+  int GetMisses() const { return m_misses; }
+  //! Writes the memory usage and hit rate to the log pane
+  void LogStatistics() const;
+  //! Forget all bitmaps
+  void Clear();
+  static ScaledBitmapCache &Get()
+  {
+    static ScaledBitmapCache globalCache;
+    return globalCache;
+  }
+};
+
+#endif  // SCALEDBITMAPCACHE_H
@@ -34,8 +34,6 @@
 #include "ImgCell.h"
 #include "StringUtils.h"
 
-#include <wx/quantize.h>
-#include <wx/imaggif.h>
 #include <wx/file.h>
 #include <wx/filename.h>
 #include <wx/filesys.h>
@@ -47,13 +45,13 @@
 #include <wx/wfstream.h>
 #include <wx/anidecod.h>
 
-// filesystem cannot be passed by const reference as we want to keep the
-// pointer to the file system alive in a background task
-// cppcheck-suppress performance symbolName=filesystem
-SlideShow::SlideShow(GroupCell *parent, Configuration **config, std::shared_ptr <wxFileSystem> filesystem, int framerate) :
+// archive cannot be passed by const reference as we want to keep the
+// pointer to the archive index alive in a background task
+// cppcheck-suppress performance symbolName=archive
+SlideShow::SlideShow(GroupCell *parent, Configuration **config, std::shared_ptr<ZipArchiveIndex> archive, int framerate) :
     Cell(parent, config),
     m_timer(m_cellPointers->GetWorksheet(), wxNewId()),
-    m_fileSystem(filesystem),
+    m_archive(archive),
     m_framerate(framerate),
     m_imageBorderWidth(Scale_Px(1))
 {
@@ -207,7 +205,7 @@ void SlideShow::LoadImages(wxArrayString images, bool deleteRead)
         else
         {
           m_images.push_back(
-            std::make_shared<Image>(m_configuration, images[i], m_fileSystem, deleteRead));
+            std::make_shared<Image>(m_configuration, images[i], m_archive, deleteRead));
           if(gnuplotFilename != wxEmptyString)
           {
             if(m_images.back())
@@ -217,7 +215,7 @@ void SlideShow::LoadImages(wxArrayString images, bool deleteRead)
         }
       }
     }
-  m_fileSystem = NULL;
+  m_archive = NULL;
   m_displayed = 0;
 }
 
@@ -340,9 +338,6 @@ void SlideShow::Draw(wxPoint point)
              imageBorderWidth - m_imageBorderWidth, imageBorderWidth - m_imageBorderWidth);
 
   }
-  else
-    // The cell isn't drawn => No need to keep it's image cache for now.
-    ClearCache();
 
   // If we need a selection border on another redraw we will be informed by OnPaint() again.
   m_drawBoundingBox = false;
@@ -507,36 +502,56 @@ const wxString &SlideShow::GetToolTip(const wxPoint point) const
   return GetLocalToolTip();
 }
 
-wxSize SlideShow::ToGif(wxString file)
+wxSize SlideShow::GetAnimationSize() const
+{
+  // The animation is as big as its biggest frame.
+  wxSize size(0, 0);
+  for (int i = 0; i < m_size; i++)
+    if (m_images[i] != NULL)
+    {
+      size.x = wxMax(size.x, static_cast<int>(m_images[i]->GetOriginalWidth()));
+      size.y = wxMax(size.y, static_cast<int>(m_images[i]->GetOriginalHeight()));
+    }
+  return size;
+}
+
+bool SlideShow::WriteGif(wxOutputStream &stream, GifAnimationWriter::PaletteMode paletteMode,
+                         const GifAnimationWriter::ProgressCallback &progress) const
+{
+  GifAnimationWriter gif(stream, GetAnimationSize(), 1000 / GetFrameRate(), paletteMode);
+  // The frames are decoded by background tasks.
+  return gif.Write(m_size,
+                   [this](size_t frame){
+                     if (m_images[frame] == NULL)
+                       return wxImage();
+                     return m_images[frame]->GetUnscaledImage();
+                   },
+                   progress);
+}
+
+wxSize SlideShow::ToGif(wxString file, GifAnimationWriter::PaletteMode paletteMode,
+                        const GifAnimationWriter::ProgressCallback &progress)
 {
   // Show a busy cursor as long as we export a .gif file (which might be a lengthy
   // action).
   wxBusyCursor crs;
 
-  wxImageArray gifFrames;
-
-  for (int i = 0; i < m_size; i++)
-  {
-    wxImage frame;
-    // Reduce the frame to at most 256 colors
-    wxQuantize::Quantize(m_images[i]->GetUnscaledBitmap().ConvertToImage(),frame);
-    // Gif supports only fully transparent or not transparent at all.
-    frame.ConvertAlphaToMask();
-    gifFrames.Add(frame);
-  }
-
-  wxFile fl(file, wxFile::write);
-  if(fl.IsOpened())
+  bool success = false;
   {
-    wxFileOutputStream outStream(fl);
-    if(outStream.IsOk())
+    wxFile fl(file, wxFile::write);
+    if(fl.IsOpened())
     {
-      wxGIFHandler gif;
-      
-      if(gif.SaveAnimation(gifFrames, &outStream, true, 1000 / GetFrameRate()))
-        return wxSize(m_images[1]->GetOriginalWidth(), m_images[1]->GetOriginalHeight());
+      wxFileOutputStream outStream(fl);
+      if(outStream.IsOk())
+        success = WriteGif(outStream, paletteMode, progress);
     }
   }
+  if (success)
+    return GetAnimationSize();
+
+  // Don't leave an incomplete animation behind.
+  if (wxFileExists(file))
+    wxRemoveFile(file);
   return wxSize(-1,-1);
 }
 
@@ -547,6 +562,32 @@ void SlideShow::ClearCache()
       m_images[i]->ClearCache();
 }
 
+void SlideShow::PrefetchImages()
+{
+  if ((m_displayed < 0) || (m_displayed >= m_size))
+    return;
+  // Printing uses other sizes than the screen does.
+  if ((*m_configuration)->GetPrinting())
+    return;
+
+  // The frames the animation timer will display next, in that order. The
+  // frame before the displayed one is added, as well, since the slider or the
+  // cursor keys might step backwards.
+  int window = wxMin(m_framesToPrefetch + 1, m_size);
+  for (int i = 0; i < window; i++)
+  {
+    int frame = (m_displayed + i) % m_size;
+    if (m_images[frame])
+      m_images[frame]->PrefetchBitmap();
+  }
+  if (m_size > window)
+  {
+    int previous = (m_displayed + m_size - 1) % m_size;
+    if (m_images[previous])
+      m_images[previous]->PrefetchBitmap();
+  }
+}
+
 SlideShow::GifDataObject::GifDataObject(const wxMemoryOutputStream &str) : wxCustomDataObject(m_gifFormat)
 {
   SetData(str.GetOutputStreamBuffer()->GetBufferSize(),
@@ -573,22 +614,12 @@ bool SlideShow::CopyAnimationToClipboard()
     // action).
     wxBusyCursor crs;
     
-    wxImageArray gifFrames;
-    
-    for (int i = 0; i < m_size; i++)
-    {
-      wxImage frame;
-      // Reduce the frame to at most 256 colors
-      wxQuantize::Quantize(m_images[i]->GetUnscaledBitmap().ConvertToImage(),frame);
-      // Gif supports only fully transparent or not transparent at all.
-      frame.ConvertAlphaToMask();
-      gifFrames.Add(frame);
-    }
-
     wxMemoryOutputStream stream;
-    wxGIFHandler gif;
-    if(!gif.SaveAnimation(gifFrames, &stream, true, 1000 / GetFrameRate()))
+    if(!WriteGif(stream))
+    {
+      wxTheClipboard->Close();
       return false;
+    }
 
     GifDataObject *clpbrdObj = new GifDataObject(stream);
     bool res = wxTheClipboard->SetData(clpbrdObj);
@@ -31,6 +31,7 @@
 
 #include "Cell.h"
 #include "Image.h"
+#include "GifAnimationWriter.h"
 #include <wx/image.h>
 #include <wx/timer.h>
 
@@ -51,11 +52,11 @@ public:
     has to be set to -1.
     \param config A pointer to the pointer to the configuration storage of the 
                   worksheet this cell belongs to.
-    \param filesystem The filesystem the contents of this slideshow can be found in.
+    \param archive   The .wxmx archive the contents of this slideshow can be found in.
                       NULL = the operating system's filesystem
     \param parent     The parent GroupCell this cell belongs to.
    */
-  SlideShow(GroupCell *parent, Configuration **config, std::shared_ptr<wxFileSystem> filesystem, int framerate = -1);
+  SlideShow(GroupCell *parent, Configuration **config, std::shared_ptr<ZipArchiveIndex> archive, int framerate = -1);
   SlideShow(GroupCell *parent, Configuration **config, int framerate = -1);
   SlideShow(const SlideShow &cell);
   //! A constructor that loads the compressed file from a wxMemoryBuffer
@@ -96,6 +97,14 @@ public:
    */
   void ClearCache() override;
 
+  /*! Scales the displayed frame and the next few ones in background tasks
+
+    Only this window of frames is kept at display size in advance. All other
+    frames stay compressed until they are needed, and their bitmaps are
+    discarded by the ScaledBitmapCache once its memory limit is reached.
+   */
+  void PrefetchImages() override;
+
   void LoadImages(wxArrayString images, bool deleteRead);
 
   int GetDisplayedIndex() const { return m_displayed; }
@@ -110,8 +119,18 @@ public:
   //! Exports the image the slideshow currently displays
   wxSize ToImageFile(wxString file);
 
-  //! Exports the whole animation as animated gif
-  wxSize ToGif(wxString file);
+  /*! Exports the whole animation as animated gif
+
+    \param file The name of the .gif file
+    \param paletteMode Shall all frames use the same 256 colors?
+    \param progress Is told how many frames are written and can cancel the
+           export by returning false
+    \return The size of the animation, or wxSize(-1,-1) if the export failed
+   */
+  wxSize ToGif(wxString file,
+               GifAnimationWriter::PaletteMode paletteMode = GifAnimationWriter::perFramePalette,
+               const GifAnimationWriter::ProgressCallback &progress =
+               GifAnimationWriter::ProgressCallback());
 
   bool CopyToClipboard() const override;
   
@@ -149,8 +168,8 @@ public:
   bool CanPopOut() const override
   { return (!m_images[m_displayed]->GnuplotSource().empty()); }
 
-  void GnuplotSource(int image, wxString gnuplotFilename, wxString dataFilename, std::shared_ptr<wxFileSystem> filesystem)
-  { m_images[image]->GnuplotSource(gnuplotFilename, dataFilename, filesystem); }
+  void GnuplotSource(int image, wxString gnuplotFilename, wxString dataFilename, std::shared_ptr<ZipArchiveIndex> archive)
+  { m_images[image]->GnuplotSource(gnuplotFilename, dataFilename, archive); }
 
   wxString GnuplotSource() const override
   {
@@ -173,7 +192,7 @@ public:
 private:
   wxTimer m_timer;
   std::vector<std::shared_ptr<Image>> m_images;
-  std::shared_ptr<wxFileSystem> m_fileSystem;
+  std::shared_ptr<ZipArchiveIndex> m_archive;
   CellPtr<Cell> m_nextToDraw;
 
   /*! The framerate of this cell.
@@ -181,8 +200,18 @@ private:
     Can contain a frame rate [in Hz] or a -1, which means: Use the default frame rate.
   */
   int m_framerate = -1;
+  //! The size of the biggest frame
+  wxSize GetAnimationSize() const;
+  //! Writes the animation as a .gif file to a stream
+  bool WriteGif(wxOutputStream &stream,
+                GifAnimationWriter::PaletteMode paletteMode = GifAnimationWriter::perFramePalette,
+                const GifAnimationWriter::ProgressCallback &progress =
+                GifAnimationWriter::ProgressCallback()) const;
+
   int m_size = 0;
   int m_displayed = 0;
+  //! How many frames after the displayed one PrefetchImages() scales in advance
+  static constexpr int m_framesToPrefetch = 4;
   int m_imageBorderWidth = 0;
 
 //** Bitfield objects (1 bytes)
@@ -0,0 +1,128 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file declares the classes SymbolIndex and StaticSymbolTable that store
+  sorted lists of autocompletable symbols.
+ */
+
+#ifndef WXMAXIMA_SYMBOLINDEX_H
+#define WXMAXIMA_SYMBOLINDEX_H
+
+#include <wx/string.h>
+#include <algorithm>
+#include <cstring>
+#include <set>
+#include <utility>
+
+/*! A sorted set of symbols that can be searched for prefixes
+
+  All symbols starting with a common prefix form a contiguous range of a sorted
+  list. Finding them therefore takes only O(log n + k) for k matches instead of
+  a StartsWith() test on every symbol we know. Adding a symbol twice adds it only
+  once.
+
+  SymbolIndex does no locking of its own: AutoComplete protects its indexes by
+  the same critical sections it used for its word lists.
+ */
+class SymbolIndex
+{
+public:
+  using const_iterator = std::set<wxString>::const_iterator;
+
+  //! Adds a symbol, if it isn't already known
+  void Add(const wxString &symbol) { m_symbols.insert(symbol); }
+  //! Is this symbol known?
+  bool Contains(const wxString &symbol) const
+    { return m_symbols.find(symbol) != m_symbols.end(); }
+  void Clear() { m_symbols.clear(); }
+  size_t GetCount() const { return m_symbols.size(); }
+
+  const_iterator begin() const { return m_symbols.begin(); }
+  const_iterator end() const { return m_symbols.end(); }
+
+  //! The range of all symbols that start with prefix, in sorted order
+  std::pair<const_iterator, const_iterator> PrefixRange(const wxString &prefix) const
+    {
+      const_iterator first = m_symbols.lower_bound(prefix);
+      const_iterator last = first;
+      while ((last != m_symbols.end()) && last->StartsWith(prefix))
+        ++last;
+      return {first, last};
+    }
+
+private:
+  std::set<wxString> m_symbols;
+};
+
+/*! A sorted list of symbols that is compiled into the program
+
+  The tables of maxima's builtin symbols are generated and sorted at build time
+  (see Autocomplete_Builtins.cmake). Looking a prefix up in them therefore needs
+  neither a sort at startup nor any memory on the heap. The symbols are UTF-8
+  strings that are sorted byte by byte.
+ */
+class StaticSymbolTable
+{
+public:
+  using const_iterator = const char *const *;
+
+  constexpr StaticSymbolTable() : m_begin(nullptr), m_end(nullptr) {}
+  template <size_t N>
+  constexpr explicit StaticSymbolTable(const char *const (&symbols)[N]) :
+    m_begin(symbols), m_end(symbols + N) {}
+
+  //! Is this symbol in the table?
+  bool Contains(const wxString &symbol) const
+    {
+      wxScopedCharBuffer utf8 = symbol.utf8_str();
+      const_iterator found = LowerBound(utf8.data());
+      return (found != m_end) && (std::strcmp(*found, utf8.data()) == 0);
+    }
+  size_t GetCount() const { return m_end - m_begin; }
+
+  const_iterator begin() const { return m_begin; }
+  const_iterator end() const { return m_end; }
+
+  //! The range of all symbols that start with prefix, in sorted order
+  std::pair<const_iterator, const_iterator> PrefixRange(const wxString &prefix) const
+    {
+      wxScopedCharBuffer utf8 = prefix.utf8_str();
+      const_iterator first = LowerBound(utf8.data());
+      const_iterator last = first;
+      while ((last != m_end) && (std::strncmp(*last, utf8.data(), utf8.length()) == 0))
+        ++last;
+      return {first, last};
+    }
+
+private:
+  //! The first symbol that isn't sorted before str
+  const_iterator LowerBound(const char *str) const
+    {
+      return std::lower_bound(m_begin, m_end, str,
+                              [](const char *a, const char *b) {return std::strcmp(a, b) < 0;});
+    }
+
+  const_iterator m_begin;
+  const_iterator m_end;
+};
+
+#endif // WXMAXIMA_SYMBOLINDEX_H
@@ -30,6 +30,7 @@
 
 #include "TextCell.h"
 #include "StringUtils.h"
+#include "TextExtentCache.h"
 #include "wx/config.h"
 
 TextCell::TextCell(GroupCell *parent, Configuration **config,
@@ -116,6 +117,30 @@ void TextCell::SetAltCopyText(const wxString &text)
   m_altCopyText() = text;
 }
 
+/*! Does the number contain something like .000000000000123 or .999999999999876?
+
+  These digits have to be followed by the end of the number or its exponent.
+  Doesn't use a wxRegEx since cells are created by background tasks, too, and
+  wxRegEx objects mustn't be shared between threads.
+ */
+static bool LooksLikeRoundingError(const wxString &number)
+{
+  for (const wxString &run : {wxString(wxT(".000000000000")), wxString(wxT(".999999999999"))})
+  {
+    for (size_t pos = number.find(run); pos != wxString::npos; pos = number.find(run, pos + 1))
+    {
+      size_t digitsStart = pos + run.Length();
+      size_t digitsEnd = digitsStart;
+      while ((digitsEnd < number.Length()) && wxIsdigit(number[digitsEnd]))
+        digitsEnd++;
+      if ((digitsEnd > digitsStart) &&
+          ((digitsEnd == number.Length()) || (number[digitsEnd] == wxT('e'))))
+        return true;
+    }
+  }
+  return false;
+}
+
 void TextCell::UpdateToolTip()
 {
   if (m_promptTooltip)
@@ -185,12 +210,7 @@ void TextCell::UpdateToolTip()
   else if (m_textStyle == TS_NUMBER)
   {
     if (m_ellipsis.IsEmpty())
-      if(
-        (m_roundingErrorRegEx1.Matches(m_text)) ||
-        (m_roundingErrorRegEx2.Matches(m_text)) ||
-        (m_roundingErrorRegEx3.Matches(m_text)) ||
-        (m_roundingErrorRegEx4.Matches(m_text))
-        )
+      if(LooksLikeRoundingError(m_text))
         SetToolTip(&T_("As calculating 0.1^12 demonstrates maxima by default doesn't tend to "
                        "hide what looks like being the small error using floating-point "
                        "numbers introduces.\n"
@@ -408,7 +428,7 @@ wxSize TextCell::GetTextSizeFor(wxDC *const dc, TextCell::TextIndex const index)
   if (text.empty())
     return {};
 
-  auto const size = dc->GetTextExtent(text);
+  auto const size = TextExtentCache::GetATextExtent(dc, text);
   m_sizeCache.emplace_back(size, fontSize, index);
   return size;
 }
@@ -1882,7 +1902,3 @@ wxString TextCell::GetSymbolTeX() const
 
 // RegExes all TextCells share.
 wxRegEx TextCell::m_unescapeRegEx(wxT("\\\\(.)"));
-wxRegEx TextCell::m_roundingErrorRegEx1(wxT("\\.000000000000[0-9]+$"));
-wxRegEx TextCell::m_roundingErrorRegEx2(wxT("\\.999999999999[0-9]+$"));
-wxRegEx TextCell::m_roundingErrorRegEx3(wxT("\\.000000000000[0-9]+e"));
-wxRegEx TextCell::m_roundingErrorRegEx4(wxT("\\.999999999999[0-9]+e"));
@@ -138,10 +138,6 @@ private:
   wxSize GetTextSizeFor(wxDC *dc, TextIndex index);
 
   static wxRegEx m_unescapeRegEx;
-  static wxRegEx m_roundingErrorRegEx1;
-  static wxRegEx m_roundingErrorRegEx2;
-  static wxRegEx m_roundingErrorRegEx3;
-  static wxRegEx m_roundingErrorRegEx4;
 
   //! The user-defined label for this label cell. Reuses m_numEnd since
   //! otherwise it'd be unused for labels.
@@ -0,0 +1,87 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+#include "TextExtentCache.h"
+#include <wx/log.h>
+#include <functional>
+
+TextExtentCache::TextExtentCache()
+{}
+
+TextExtentCache::~TextExtentCache()
+{
+  wxLogMessage("~TextExtentCache: hits=%d misses=%d h:m ratio=%.2f",
+               m_hits, m_misses, double(m_hits)/m_misses);
+}
+
+size_t TextExtentCache::KeyPtrHasher::operator()(const Key *key) const
+{
+  size_t hash = wxStringHash()(key->text);
+  hash ^= std::hash<const void *>()(key->font) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  hash ^= std::hash<const void *>()(key->dcKind) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  hash ^= std::hash<int>()(key->ppi.y) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  hash ^= std::hash<double>()(key->userScaleY) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  return hash;
+}
+
+wxSize TextExtentCache::GetTextExtent(wxDC *dc, const wxString &text)
+{
+  const wxFont &font = dc->GetFont();
+  Key key;
+  key.font = font.GetRefData();
+  key.dcKind = dc->GetImpl() ? dc->GetImpl()->GetClassInfo() : NULL;
+  key.ppi = dc->GetPPI();
+  dc->GetUserScale(&key.userScaleX, &key.userScaleY);
+  key.text = text;
+
+  // A font that owns no data cannot be told apart from other fonts
+  // of this kind, which means we cannot cache its sizes.
+  if (!key.font)
+    return dc->GetTextExtent(text);
+
+  auto it = m_index.find(&key);
+  if (it != m_index.end())
+  {
+    ++ m_hits;
+    // Mark the entry as the most recently used one
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return it->second->size;
+  }
+
+  ++ m_misses;
+  wxSize size = dc->GetTextExtent(text);
+  if (m_entries.size() >= maxEntries)
+  {
+    m_index.erase(&m_entries.back().key);
+    m_entries.pop_back();
+  }
+  m_entries.push_front({std::move(key), font, size});
+  m_index.emplace(&m_entries.front().key, m_entries.begin());
+  return size;
+}
+
+void TextExtentCache::Clear()
+{
+  m_index.clear();
+  m_entries.clear();
+  m_hits = 0;
+  m_misses = 0;
+}
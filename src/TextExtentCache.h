@@ -0,0 +1,120 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+#ifndef TEXTEXTENTCACHE_H
+#define TEXTEXTENTCACHE_H
+
+#include "precomp.h"
+#include <wx/dc.h>
+#include <wx/font.h>
+#include <wx/string.h>
+#include <list>
+#include <unordered_map>
+
+/*! \file
+ * This file implements a process-wide cache of text extents.
+ */
+
+/*! A least-recently-used cache of the sizes wxDC::GetTextExtent() returns
+
+  Asking wxWidgets for the size of a text is slow, and most of the texts in a
+  worksheet are tokens like "x", "+", "(" or "%pi" that appear in thousands of
+  cells. This cache remembers their sizes for every font they have been
+  measured in.
+
+  The font is identified by its shared font data: All cells that use the same
+  Style get their wxFont from the FontCache, which means that they share this
+  data. Each cache entry keeps a copy of the font so the address of the data
+  can never be reused by a different font while the entry exists.
+
+  The same font can have different sizes on the screen, a wxGCDC, a printer or
+  in a SVG file => the kind of the DC is part of the key, too.
+ */
+class TextExtentCache final
+{
+  //! The maximum number of texts we remember the size of
+  static constexpr size_t maxEntries = 32768;
+
+  struct Key
+  {
+    const wxObjectRefData *font;
+    //! The class of the DC's implementation, which tells what kind of DC it is
+    const wxClassInfo *dcKind;
+    wxSize ppi;
+    double userScaleX;
+    double userScaleY;
+    wxString text;
+    bool operator==(const Key &o) const
+    {
+      return font == o.font && dcKind == o.dcKind && ppi == o.ppi && userScaleX == o.userScaleX &&
+        userScaleY == o.userScaleY && text == o.text;
+    }
+  };
+  struct Entry
+  {
+    Key key;
+    //! Keeps the font data key.font points to alive
+    wxFont font;
+    wxSize size;
+  };
+  using Entries = std::list<Entry>;
+  struct KeyPtrHasher
+  {
+    size_t operator()(const Key *key) const;
+  };
+  struct KeyPtrEquals
+  {
+    bool operator()(const Key *l, const Key *r) const { return *l == *r; }
+  };
+
+  TextExtentCache(const TextExtentCache &) = delete;
+  TextExtentCache &operator=(const TextExtentCache &) = delete;
+  //! The cached entries, the most recently used one first
+  Entries m_entries;
+  //! Finds the entries by their key
+  std::unordered_map<const Key *, Entries::iterator, KeyPtrHasher, KeyPtrEquals> m_index;
+  int m_hits = 0;
+  int m_misses = 0;
+public:
+  TextExtentCache();
+  ~TextExtentCache();
+  //! The size of text if it is drawn on dc using dc's current font
+  wxSize GetTextExtent(wxDC *dc, const wxString &text);
+  int GetHits() const { return m_hits; }
+  int GetMisses() const { return m_misses; }
+  size_t GetSize() const { return m_entries.size(); }
+  //! Forget all sizes - needed if the fonts have changed
+  void Clear();
+  static TextExtentCache &Get()
+  {
+#ifdef _WIN32
+    // The fonts we are keyed on are per-thread on Windows, see FontCache.
+    static thread_local TextExtentCache globalCache;
+#else
+    static TextExtentCache globalCache;
+#endif // _WIN32
+    return globalCache;
+  }
+  static wxSize GetATextExtent(wxDC *dc, const wxString &text)
+  { return Get().GetTextExtent(dc, text); }
+};
+
+#endif  // TEXTEXTENTCACHE_H
@@ -21,21 +21,145 @@
 
 #include "VariablesPane.h"
 #include "memory"
+#include <algorithm>
+
+VariablesTable::VariablesTable() :
+  m_rows(1),
+  m_greyedOut(new wxGridCellAttr),
+  m_invalidName(new wxGridCellAttr)
+{
+  m_greyedOut->SetTextColour(*wxLIGHT_GREY);
+  m_invalidName->SetTextColour(*wxRED);
+  UpdateIndex();
+}
+
+VariablesTable::~VariablesTable()
+{
+  m_greyedOut->DecRef();
+  m_invalidName->DecRef();
+}
+
+wxString VariablesTable::GetValue(int row, int col)
+{
+  if ((row < 0) || (row >= GetNumberRows()))
+    return wxEmptyString;
+  if (col == 0)
+    return m_rows[row].m_name;
+  else
+    return m_rows[row].m_value;
+}
+
+void VariablesTable::SetValue(int row, int col, const wxString &value)
+{
+  if ((row < 0) || (row >= GetNumberRows()))
+    return;
+  if (col == 0)
+  {
+    m_rows[row].m_name = value;
+    UpdateIndex();
+  }
+  else
+    m_rows[row].m_value = value;
+}
+
+bool VariablesTable::InsertRows(size_t pos, size_t numRows)
+{
+  if (pos > m_rows.size())
+    return false;
+  m_rows.insert(m_rows.begin() + pos, numRows, Row());
+  UpdateIndex();
+  NotifyGrid(wxGRIDTABLE_NOTIFY_ROWS_INSERTED, pos, numRows);
+  return true;
+}
+
+bool VariablesTable::AppendRows(size_t numRows)
+{
+  // An empty row doesn't contain a variable => the index stays valid.
+  m_rows.resize(m_rows.size() + numRows);
+  NotifyGrid(wxGRIDTABLE_NOTIFY_ROWS_APPENDED, numRows);
+  return true;
+}
+
+bool VariablesTable::DeleteRows(size_t pos, size_t numRows)
+{
+  if (pos >= m_rows.size())
+    return false;
+  numRows = std::min(numRows, m_rows.size() - pos);
+  m_rows.erase(m_rows.begin() + pos, m_rows.begin() + pos + numRows);
+  UpdateIndex();
+  NotifyGrid(wxGRIDTABLE_NOTIFY_ROWS_DELETED, pos, numRows);
+  return true;
+}
+
+wxString VariablesTable::GetColLabelValue(int col)
+{
+  if (col == 0)
+    return _("Variable");
+  else
+    return _("Contents");
+}
+
+wxGridCellAttr *VariablesTable::GetAttr(int row, int col, wxGridCellAttr::wxAttrKind WXUNUSED(kind))
+{
+  if ((row < 0) || (row >= GetNumberRows()))
+    return NULL;
+  wxGridCellAttr *attr = NULL;
+  switch (m_rows[row].m_state)
+  {
+  case invalid:
+    attr = (col == 0) ? m_invalidName : m_greyedOut;
+    break;
+  case undefined:
+    if (col == 1)
+      attr = m_greyedOut;
+    break;
+  default:
+    break;
+  }
+  // The grid releases the attribute once it is done with it.
+  if (attr)
+    attr->IncRef();
+  return attr;
+}
+
+int VariablesTable::GetRow(const wxString &name) const
+{
+  auto row = m_index.find(name);
+  if (row == m_index.end())
+    return -1;
+  return row->second;
+}
+
+void VariablesTable::SetState(int row, ValueState state)
+{
+  if ((row < 0) || (row >= GetNumberRows()))
+    return;
+  m_rows[row].m_state = state;
+}
+
+void VariablesTable::UpdateIndex()
+{
+  m_index.clear();
+  for (int i = GetNumberRows() - 1; i >= 0; i--)
+    if (!m_rows[i].m_name.IsEmpty())
+      m_index[m_rows[i].m_name] = i;
+}
+
+void VariablesTable::NotifyGrid(int id, int comInt1, int comInt2)
+{
+  if (!GetView())
+    return;
+  wxGridTableMessage message(this, id, comInt1, comInt2);
+  GetView()->ProcessTableMessage(message);
+}
 
 Variablespane::Variablespane(wxWindow *parent, wxWindowID id) : wxGrid(parent, id)
 {
   SetMinSize(wxSize(wxSystemSettings::GetMetric ( wxSYS_SCREEN_X )/10,
                     wxSystemSettings::GetMetric ( wxSYS_SCREEN_Y )/10));
-  CreateGrid(1,2);
+  m_table = new VariablesTable;
+  SetTable(m_table, true);
   SetUseNativeColLabels();
-  wxGridCellAttr *attr0, *attr1;
-  attr0 = new wxGridCellAttr;
-  SetColAttr(0,attr0);
-  SetColLabelValue(0,_("Variable"));
-  attr1 = new wxGridCellAttr;
-//  attr1->SetReadOnly();
-  SetColAttr(1,attr1);
-  SetColLabelValue(1,_("Contents"));
   m_rightClickRow = -1;
   Connect(wxEVT_GRID_CELL_CHANGED,
           wxGridEventHandler(Variablespane::OnTextChange),
@@ -149,39 +273,37 @@ void Variablespane::InsertMenu(wxCommandEvent &event)
 void Variablespane::OnRightClick(wxGridEvent &event)
 {
   m_rightClickRow = event.GetRow();
-  m_vars.clear();
-  for(auto i = 0; i < GetNumberRows(); i++)
-    m_vars[GetCellValue(i,0)] = 1;
-  
+  auto watched = [this](const wxString &name){return m_table->GetRow(name) >= 0;};
+
   std::unique_ptr<wxMenu> popupMenu(new wxMenu);
-  if(m_vars["values"] != 1)
+  if(!watched("values"))
     popupMenu->Append(varID_values,
                       _("List of user variables"), wxEmptyString, wxITEM_NORMAL);
-  if(m_vars["functions"] != 1)
+  if(!watched("functions"))
     popupMenu->Append(varID_functions,
                       _("List of user functions"), wxEmptyString, wxITEM_NORMAL);
-  if(m_vars["arrays"] != 1)
+  if(!watched("arrays"))
     popupMenu->Append(varID_arrays,
                       _("List of arrays"), wxEmptyString, wxITEM_NORMAL);
-  if(m_vars["myoptions"] != 1)
+  if(!watched("myoptions"))
     popupMenu->Append(varID_myoptions,
                       _("List of changed options"), wxEmptyString, wxITEM_NORMAL);
-  if(m_vars["rules"] != 1)
+  if(!watched("rules"))
     popupMenu->Append(varID_rules,
                       _("List of user rules"), wxEmptyString, wxITEM_NORMAL);
-  if(m_vars["aliases"] != 1)
+  if(!watched("aliases"))
     popupMenu->Append(varID_aliases,
                       _("List of user aliases"), wxEmptyString, wxITEM_NORMAL);
-  if(m_vars["structures"] != 1)
+  if(!watched("structures"))
     popupMenu->Append(varID_structs,
                       _("List of structs"), wxEmptyString, wxITEM_NORMAL);
-  if(m_vars["gradefs"] != 1)
+  if(!watched("gradefs"))
     popupMenu->Append(varID_gradefs,
                       _("List of user-defined derivatives"), wxEmptyString, wxITEM_NORMAL);
-  if(m_vars["props"] != 1)
+  if(!watched("props"))
     popupMenu->Append(varID_prop,
                       _("List of user-defined properties"), wxEmptyString, wxITEM_NORMAL);
-  if(m_vars["gradefs"] != 1)
+  if(!watched("gradefs"))
     popupMenu->Append(varID_gradefs,
                       _("List of user-defined let rule packages"), wxEmptyString, wxITEM_NORMAL);
   popupMenu->AppendSeparator();    
@@ -221,20 +343,19 @@ void Variablespane::OnTextChange(wxGridEvent &event)
   BeginBatch();
   if(IsValidVariable(GetCellValue(event.GetRow(),0)))
   {
+    m_table->SetState(event.GetRow(), VariablesTable::unknown);
     SetCellValue(event.GetRow(),1,wxT(""));
-    SetCellTextColour(event.GetRow(),0,*wxBLACK);
   }
   else
   {
     if(GetCellValue(event.GetRow(),0) != wxEmptyString)
     {
-      SetCellTextColour(event.GetRow(),0,*wxRED);
-      SetCellTextColour(event.GetRow(),1,*wxLIGHT_GREY);
+      m_table->SetState(event.GetRow(), VariablesTable::invalid);
       SetCellValue(event.GetRow(),1,_("(Not a valid variable name)"));
-      RefreshAttr(event.GetRow(), 1);
     }
   }
   RefreshAttr(event.GetRow(), 0);
+  RefreshAttr(event.GetRow(), 1);
 
   if((GetNumberRows() == 0) || (GetCellValue(GetNumberRows()-1,0) != wxEmptyString))
     AppendRows();
@@ -246,41 +367,40 @@ void Variablespane::OnTextChange(wxGridEvent &event)
   GetParent()->GetParent()->GetEventHandler()->QueueEvent(VarReadEvent);
 
   // Avoid introducing a cell with the same name twice.
-  m_vars.clear();
-  for(auto i = 0; i < GetNumberRows(); i++)
+  wxString name = GetCellValue(event.GetRow(),0);
+  if(name != wxEmptyString)
   {
-    if(i!=event.GetRow())
-      m_vars[GetCellValue(i,0)] = i+1;      
-  }
-  int identicalVar = m_vars[GetCellValue(event.GetRow(),0)];
-  if(identicalVar > 0)
-  {
-    wxEventBlocker blocker(this);
-    DeleteRows(identicalVar-1);
+    for(auto i = 0; i < GetNumberRows(); i++)
+    {
+      if((i != event.GetRow()) && (GetCellValue(i,0) == name))
+      {
+        wxEventBlocker blocker(this);
+        DeleteRows(i);
+        break;
+      }
+    }
   }
   EndBatch();
 }
 
 void Variablespane::VariableValue(wxString var, wxString val)
 {
-  for(auto i = 0; i < GetNumberRows(); i++)
-    if(GetCellValue(i,0) == UnescapeVarname(var))
-    {
-      SetCellTextColour(i,1,*wxBLACK);
-      SetCellValue(i,1,val);
-      RefreshAttr(i, 1);
-    }
+  int row = m_table->GetRow(UnescapeVarname(var));
+  if(row < 0)
+    return;
+  m_table->SetState(row, VariablesTable::defined);
+  RefreshAttr(row, 1);
+  SetCellValue(row, 1, val);
 }
 
 void Variablespane::VariableUndefined(wxString var)
 {
-  for(auto i = 0; i < GetNumberRows(); i++)
-    if(GetCellValue(i,0) == UnescapeVarname(var))
-    {
-      SetCellTextColour(i,1,*wxLIGHT_GREY);
-      SetCellValue(i,1,_("Undefined"));
-      RefreshAttr(i, 1);
-    }
+  int row = m_table->GetRow(UnescapeVarname(var));
+  if(row < 0)
+    return;
+  m_table->SetState(row, VariablesTable::undefined);
+  RefreshAttr(row, 1);
+  SetCellValue(row, 1, _("Undefined"));
 }
 
 wxArrayString Variablespane::GetEscapedVarnames()
@@ -419,19 +539,24 @@ void Variablespane::ResetValues()
   {
     if(GetCellValue(i,0) != wxEmptyString)
     {
-      SetCellTextColour(i,1,*wxLIGHT_GREY);
-      SetCellValue(i,1,_("Undefined"));
-      RefreshAttr(i,1);
+      m_table->SetState(i, VariablesTable::undefined);
+      m_table->SetValue(i, 1, _("Undefined"));
     }
     else
-      SetCellValue(i,1,wxT(""));
+    {
+      m_table->SetState(i, VariablesTable::unknown);
+      m_table->SetValue(i, 1, wxEmptyString);
+    }
+    RefreshAttr(i, 1);
   }
+  // Redraws only the rows that are visible
+  ForceRefresh();
 }
 
 void Variablespane::Clear()
 {
-  while(GetNumberRows() > 1)
-    DeleteRows(0);    
+  if(GetNumberRows() > 1)
+    DeleteRows(0, GetNumberRows() - 1);
 }
 
 Variablespane::~Variablespane()
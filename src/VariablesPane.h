@@ -26,6 +26,8 @@
 #include <wx/wx.h>
 #include <wx/grid.h>
 #include <wx/arrstr.h>
+#include <unordered_map>
+#include <vector>
 
 /*! \file 
 The file that contains the "variables" sidepane
@@ -33,6 +35,63 @@ The file that contains the "variables" sidepane
 This file contains the class Variablespane.
 */
 
+/*! The contents of the "variables" sidepane
+
+  The grid only asks this table for the cells it actually draws. A hash that
+  maps the variable names to their rows means that maxima can tell us the
+  value of a variable without us having to search the whole list for it.
+*/
+class VariablesTable : public wxGridTableBase
+{
+public:
+  //! What we know about a variable's value
+  enum ValueState
+  {
+    unknown,   //!< Maxima hasn't told us about this variable, yet
+    defined,   //!< The variable has a value
+    undefined, //!< The variable has no value
+    invalid    //!< The name isn't a valid variable name
+  };
+
+  VariablesTable();
+  ~VariablesTable() override;
+  int GetNumberRows() override { return static_cast<int>(m_rows.size()); }
+  int GetNumberCols() override { return 2; }
+  bool IsEmptyCell(int row, int col) override { return GetValue(row, col).IsEmpty(); }
+  wxString GetValue(int row, int col) override;
+  void SetValue(int row, int col, const wxString &value) override;
+  bool InsertRows(size_t pos = 0, size_t numRows = 1) override;
+  bool AppendRows(size_t numRows = 1) override;
+  bool DeleteRows(size_t pos = 0, size_t numRows = 1) override;
+  wxString GetColLabelValue(int col) override;
+  //! Greys out unknown values and marks invalid names red
+  wxGridCellAttr *GetAttr(int row, int col, wxGridCellAttr::wxAttrKind kind) override;
+  //! The row that contains the variable name, or -1, if there is none
+  int GetRow(const wxString &name) const;
+  //! Sets what we know about the value of the variable in row
+  void SetState(int row, ValueState state);
+
+private:
+  //! One variable
+  struct Row
+  {
+    wxString m_name;
+    wxString m_value;
+    ValueState m_state = unknown;
+  };
+  //! Re-creates m_index after rows have been added, removed or renamed
+  void UpdateIndex();
+  //! Tells the grid about a change in the number of rows
+  void NotifyGrid(int id, int comInt1, int comInt2 = -1);
+  std::vector<Row> m_rows;
+  //! The row each variable name can be found in
+  std::unordered_map<wxString, int, wxStringHash> m_index;
+  //! The attribute of a value that is unknown
+  wxGridCellAttr *m_greyedOut;
+  //! The attribute of a name that isn't a valid variable name
+  wxGridCellAttr *m_invalidName;
+};
+
 /*! A "variables" sidepane
 
 */
@@ -98,9 +157,8 @@ public:
   ~Variablespane();
 private:
   wxString InvertCase(wxString var);
-  WX_DECLARE_STRING_HASH_MAP(int, IntHash);
-  //! A list of all symbols that can be entered using Esc-Codes
-  IntHash m_vars;
+  //! The table that holds our contents. Owned by wxGrid.
+  VariablesTable *m_table;
   //! The row that was right-clicked at
   int m_rightClickRow;
   //! Compares two integers.
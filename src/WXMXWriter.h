@@ -0,0 +1,110 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file declares the class WXMXWriter that writes a snapshot of a worksheet
+  to a .wxmx file.
+ */
+
+#ifndef WXMAXIMA_WXMXWRITER_H
+#define WXMAXIMA_WXMXWRITER_H
+
+#include <wx/string.h>
+#include <wx/buffer.h>
+#include <cstdint>
+#include <vector>
+
+/*! Writes a .wxmx file from a snapshot of the worksheet
+
+  The worksheet fills this object with its XML representation and with the
+  images and gnuplot files that belong to it. This is quick and needs to be done
+  by the GUI thread. Compressing and writing the data, testing that the
+  resulting file can be read again and replacing the old file by the new one
+  takes much longer, but doesn't need the GUI, which means that Write() can be
+  called from a background task.
+
+  Files that exist in the old version of the .wxmx file with the same size and
+  checksum are copied from there without decompressing and re-compressing them.
+ */
+class WXMXWriter
+{
+public:
+  explicit WXMXWriter(const wxString &file) : m_file(file) {}
+
+  //! The name of the .wxmx file that is to be written
+  const wxString &GetFile() const { return m_file; }
+
+  //! Sets the contents of the file content.xml
+  void SetContent(const wxString &xml) { m_content = xml; }
+  const wxString &GetContent() const { return m_content; }
+
+  //! Adds a file, for example an image, to the archive
+  void AddFile(const wxString &name, const wxMemoryBuffer &data)
+    { m_files.push_back({name, data}); }
+
+  /*! Sets the file the archive is written to before it replaces the old file
+
+    By default this is the name of the file followed by a "~". Writes that can
+    run at the same time need different temp files. The temp file is deleted
+    if writing fails.
+   */
+  void SetTempFile(const wxString &tempFile) { m_tempFile = tempFile; }
+
+  //! Can the XML parser read content.xml again?
+  bool IsContentValid() const;
+
+  /*! Writes the archive and replaces the old file with it
+
+    Tests that the XML parser can read content.xml first.
+    \return false, if content.xml isn't valid XML or the archive could not be
+    written or read back, in which case the old file is left alone.
+   */
+  bool Write();
+
+  //! Has Write() failed because content.xml isn't valid XML?
+  bool HasInvalidContent() const { return m_invalidContent; }
+
+  //! The CRC32 checksum .zip files use
+  static uint32_t CRC32(const void *data, size_t length);
+
+private:
+  struct File
+  {
+    wxString name;
+    wxMemoryBuffer data;
+  };
+
+  //! Writes the archive to backupfile and replaces the old file with it
+  bool Write(const wxString &backupfile);
+  //! Writes the archive to backupfile
+  bool WriteArchive(const wxString &backupfile);
+  //! Tests if the XML part of the archive in backupfile can be opened
+  static bool CanBeOpened(const wxString &backupfile);
+
+  wxString m_file;
+  //! The file set by SetTempFile(), if any
+  wxString m_tempFile;
+  wxString m_content;
+  std::vector<File> m_files;
+  bool m_invalidContent = false;
+};
+
+#endif // WXMAXIMA_WXMXWRITER_H
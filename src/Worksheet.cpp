@@ -44,6 +44,7 @@
 #include <wx/dcbuffer.h>
 #include <wx/wupdlock.h>
 #include <wx/event.h>
+#include <wx/stopwatch.h>
 #include "wxMaximaFrame.h"
 #include "Worksheet.h"
 #include "BitmapOut.h"
@@ -71,6 +72,10 @@
 #include <stdlib.h>
 #include "memory"
 
+#ifdef HAVE_OMP_HEADER
+#include <omp.h>
+#endif
+
 //! This class represents the worksheet shown in the middle of the wxMaxima window.
 Worksheet::Worksheet(wxWindow *parent, int id, Worksheet* &observer, wxPoint pos, wxSize size) :
   wxScrolled<wxWindow>(
@@ -141,8 +146,6 @@ Worksheet::Worksheet(wxWindow *parent, int id, Worksheet* &observer, wxPoint pos
   m_hCaretBlinkVisible = true;
   m_hasFocus = true;
   m_windowActive = true;
-  m_lastTop = 0;
-  m_lastBottom = 0;
   m_followEvaluation = true;
   TreeUndo_ActiveCell = NULL;
   m_questionPrompt = false;
@@ -240,7 +243,7 @@ bool Worksheet::RedrawIfRequested()
 {
   bool redrawIssued = false;
 
-  RecalculateIfNeeded();
+  RecalculateIfNeeded(0);
 
   if(m_mouseMotionWas)
   {
@@ -252,16 +255,7 @@ bool Worksheet::RedrawIfRequested()
       GroupCell *oldGroupCellUnderPointer = m_cellPointers.m_groupCellUnderPointer;
 
       // find out which group cell lies under the pointer
-      GroupCell *tmp = GetTree();
-      wxRect rect;
-
-      while (tmp != NULL)
-      {
-        rect = tmp->GetRect();
-        if (m_pointer_y <= rect.GetBottom())
-          break;
-        tmp = tmp->GetNext();
-      }
+      GroupCell *tmp = GetGroupCellAtY(m_pointer_y);
       if (GetTree())
         GetTree()->CellUnderPointer(tmp);
 
@@ -355,6 +349,9 @@ bool Worksheet::RedrawIfRequested()
 
 void Worksheet::RequestRedraw(GroupCell *start)
 {
+  if (m_headless)
+    return;
+
   m_redrawRequested = true;
 
   if (start == 0)
@@ -491,9 +488,9 @@ void Worksheet::OnPaint(wxPaintEvent &WXUNUSED(event))
   m_configuration->SetContext(dc);
 
   // We might be triggered after someone changed the worksheet and before the idle
-  // loop caused it to be recalculated => Ensure all sizes and positions to be known
-  // before we proceed.
-  RecalculateIfNeeded();
+  // loop caused it to be recalculated => Ensure all sizes and positions of the cells
+  // we draw to be known before we proceed.
+  RecalculateIfNeeded(0);
 
   // Create a graphics context that supports antialiasing, but on MSW
   // only supports fonts that come in the Right Format.
@@ -631,8 +628,6 @@ void Worksheet::OnPaint(wxPaintEvent &WXUNUSED(event))
   
   for (GroupCell *tmp = GetTree(); tmp; )
   {
-    wxRect cellRect = tmp->GetRect();
-    
     int width;
     int height;
     GetClientSize(&width, &height);
@@ -643,19 +638,7 @@ void Worksheet::OnPaint(wxPaintEvent &WXUNUSED(event))
     m_configuration->SetVisibleRegion(wxRect(upperLeftScreenCorner,
                                              upperLeftScreenCorner + wxPoint(width,height)));
     m_configuration->SetWorksheetPosition(GetPosition());
-    // Clear the image cache of all cells above or below the viewport.
-    if (cellRect.GetTop() >= bottom || cellRect.GetBottom() <= top)
-    {
-      // Only actually clear the image cache if there is a screen's height between
-      // us and the image's position: Else the chance is too high that we will
-      // very soon have to generated a scaled image again.
-      if ((cellRect.GetBottom() <= m_lastBottom - 2 * height) || (cellRect.GetTop() >= m_lastTop + 2 * height))
-      {
-        if (tmp->GetOutput())
-          tmp->GetOutput()->ClearCacheList();
-      }
-    }
-    
+
     tmp->SetCurrentPoint(point);
     if (tmp->DrawThisCell(point))
     {
@@ -680,8 +663,6 @@ void Worksheet::OnPaint(wxPaintEvent &WXUNUSED(event))
   
   m_configuration->SetContext(m_dc);
   m_configuration->UnsetAntialiassingDC();
-  m_lastTop = top;
-  m_lastBottom = bottom;
 
   m_configuration->ReportMultipleRedraws();
 }
@@ -918,8 +899,14 @@ void Worksheet::SetZoomFactor(double newzoom, bool recalc)
   ScheduleScrollToCell(cellToScrollTo);
 }
 
-bool Worksheet::RecalculateIfNeeded()
+bool Worksheet::RecalculateIfNeeded(long timeBudget_ms)
 {
+  if (m_headless)
+  {
+    m_recalculateStart = {};
+    return false;
+  }
+
   UpdateConfigurationClientSize();
   if (!m_recalculateStart || !GetTree())
   {
@@ -946,14 +933,36 @@ bool Worksheet::RecalculateIfNeeded()
                                            upperLeftScreenCorner + wxPoint(width,height)));
   m_configuration->SetWorksheetPosition(GetPosition());
 
-  for (auto *tmp = m_recalculateStart ? m_recalculateStart : GetTree();
-       tmp; tmp = tmp->GetNext())
+  // Everything up to the bottom of the visible region has to be laid out
+  // exactly before we can draw it. The cells below only need to be laid out
+  // before they are scrolled into view => if we are in a hurry we leave them
+  // for later and use their old sizes as an estimate until then.
+  // The visible region's top left corner is minus the scroll position, whereas the
+  // cells' rectangles are in worksheet coordinates.
+  int visibleBottom;
+  CalcUnscrolledPosition(0, height, NULL, &visibleBottom);
+  wxASSERT(visibleBottom == height - m_configuration->GetVisibleRegion().GetTop());
+  wxStopWatch stopwatch;
+  GroupCell *tmp = m_recalculateStart ? m_recalculateStart : GetTree();
+  for (; tmp; tmp = tmp->GetNext())
   {
+    if ((timeBudget_ms >= 0) && (stopwatch.Time() >= timeBudget_ms) && tmp->GetPrevious() &&
+        (tmp->GetPrevious()->GetRect().GetBottom() > visibleBottom))
+      break;
     tmp->Recalculate();
   }
 
   if (m_configuration->AdjustWorksheetSize())
     AdjustSize();
+
+  if (tmp)
+  {
+    // Continue here next time. The flags that tell that all cells need to be
+    // recalculated stay set until we are done with the last cell.
+    m_recalculateStart = tmp;
+    return true;
+  }
+
   m_configuration->RecalculationForce(false);
   m_configuration->FontChanged(false);
 
@@ -965,6 +974,9 @@ bool Worksheet::RecalculateIfNeeded()
 
 void Worksheet::Recalculate(Cell *start, bool force)
 {
+  if (m_headless)
+    return;
+
   GroupCell *group = GetTree();
   if (start)
     group = start->GetGroup();
@@ -1971,23 +1983,15 @@ void Worksheet::OnMouseLeftDown(wxMouseEvent &event)
   m_hCaretActive = false;
   SetActiveCell(NULL, false);
 
-  GroupCell *tmp = GetTree();
-  wxRect rect;
+  GroupCell *tmp = GetGroupCellAtY(m_down.y);
   GroupCell *clickedBeforeGC = NULL;
   GroupCell *clickedInGC = NULL;
-  for (; tmp; tmp = tmp->GetNext())
-  { // go through all groupcells
-    rect = tmp->GetRect();
-    if (m_down.y < rect.GetTop())
-    {
+  if (tmp)
+  {
+    if (m_down.y < tmp->GetRect().GetTop())
       clickedBeforeGC = tmp;
-      break;
-    }
-    else if (m_down.y <= rect.GetBottom())
-    {
+    else
       clickedInGC = tmp;
-      break;
-    }
   }
 
   if (clickedBeforeGC)
@@ -2025,14 +2029,77 @@ GroupCell *Worksheet::FirstVisibleGC()
   wxPoint point;
   CalcUnscrolledPosition(0, 0, &point.x, &point.y);
 
+  return GetGroupCellAtY(point.y + 1);
+}
+
+void Worksheet::RebuildGroupIndex()
+{
+  m_groupIndex.clear();
   for (GroupCell *tmp = GetTree(); tmp; tmp = tmp->GetNext())
-  { // go through all groupcells
-    wxRect rect = tmp->GetRect();
+    m_groupIndex.emplace_back(tmp);
+}
 
-    if (point.y < rect.GetBottom())
-      return tmp;
+GroupCell *Worksheet::GetGroupCellAtY(int y)
+{
+  // The index is only rebuilt if it turns out to be out of date: Most lookups
+  // are caused by mouse motion, and the worksheet doesn't change between them.
+  for (int attempt = 0; attempt < 2; attempt++)
+  {
+    if (attempt > 0 || m_groupIndex.empty())
+      RebuildGroupIndex();
+
+    size_t low = 0;
+    size_t high = m_groupIndex.size();
+    bool stale = false;
+    while (low < high)
+    {
+      size_t mid = low + (high - low) / 2;
+      GroupCell *group = m_groupIndex[mid];
+      if (!group)
+      {
+        stale = true;
+        break;
+      }
+      if (group->GetRect().GetBottom() < y)
+        low = mid + 1;
+      else
+        high = mid;
+    }
+    if (stale)
+      continue;
+
+    if (low < m_groupIndex.size())
+    {
+      // If a cell has been inserted between the cell we found and the one
+      // before it the new cell might be the one we are searching for.
+      GroupCell *group = m_groupIndex[low];
+      GroupCell *previous = (low > 0) ? m_groupIndex[low - 1].get() : nullptr;
+      if (!group || group->GetPrevious() != previous || (low == 0 && group != GetTree()))
+        continue;
+      return group;
+    }
+
+    // y lies below the last cell we know of. Test if there are cells we don't know.
+    if (m_groupIndex.empty())
+    {
+      if (GetTree())
+        continue;
+    }
+    else
+    {
+      GroupCell *last = m_groupIndex.back();
+      if (!last || last->GetNext())
+        continue;
+    }
+    return NULL;
   }
-  return {};
+
+  // Even a freshly built index didn't help: The positions of the cells aren't
+  // sorted, for example since they haven't been calculated yet.
+  for (GroupCell *tmp = GetTree(); tmp; tmp = tmp->GetNext())
+    if (y <= tmp->GetRect().GetBottom())
+      return tmp;
+  return NULL;
 }
 
 void Worksheet::OnMouseLeftUp(wxMouseEvent &event)
@@ -2137,28 +2204,17 @@ void Worksheet::SelectGroupCells(wxPoint down, wxPoint up)
   int ybottom = wxMax(down.y, up.y);
   m_cellPointers.m_selectionStart = m_cellPointers.m_selectionEnd = nullptr;
 
-  wxRect rect;
-
   // find out the group cell the selection begins in
-  for (GroupCell *tmp = GetTree(); tmp; tmp = tmp->GetNext())
-  {
-    rect = tmp->GetRect();
-    if (ytop <= rect.GetBottom())
-    {
-      m_cellPointers.m_selectionStart = tmp;
-      break;
-    }
-  }
+  m_cellPointers.m_selectionStart = GetGroupCellAtY(ytop);
 
   // find out the group cell the selection ends in
-  for (GroupCell *tmp = GetTree(); tmp; tmp = tmp->GetNext())
+  GroupCell *endGroup = GetGroupCellAtY(ybottom);
+  if (endGroup)
   {
-    rect = tmp->GetRect();
-    if (ybottom < rect.GetTop())
-    {
-      m_cellPointers.m_selectionEnd = tmp->m_previous;
-      break;
-    }
+    if (ybottom < endGroup->GetRect().GetTop())
+      m_cellPointers.m_selectionEnd = endGroup->GetPrevious();
+    else
+      m_cellPointers.m_selectionEnd = endGroup;
   }
   if (!m_cellPointers.m_selectionEnd)
     m_cellPointers.m_selectionEnd = m_last;
@@ -2848,10 +2904,6 @@ void Worksheet::DeleteRegion(GroupCell *start, GroupCell *end, UndoActions *undo
     if (tmp->IsFoldable() || (tmp->GetGroupType() == GC_TYPE_IMAGE))
       renumber = true;
 
-    // Don't keep cached versions of scaled images around in the undo buffer.
-    if (tmp->GetOutput())
-      tmp->GetOutput()->ClearCacheList();
-
     if (tmp == end)
       break;
   }
@@ -4254,6 +4306,7 @@ void Worksheet::StepAnimation(int change)
       if (pos >= tmp->Length())
         pos = 0;
       tmp->SetDisplayedIndex(pos);
+      tmp->PrefetchImages();
 
       // Refresh the displayed bitmap
       wxRect rect = m_cellPointers.m_selectionStart->GetRect();
@@ -4346,6 +4399,8 @@ void Worksheet::OnTimer(wxTimerEvent &event)
         if (pos >= slideshow->Length())
           pos = 0;
         slideshow->SetDisplayedIndex(pos);
+        // Scale the next frames while the timer waits for the next step
+        slideshow->PrefetchImages();
 
         // Refresh the displayed bitmap
         if (!m_configuration->ClipToDrawRegion())
@@ -4387,6 +4442,7 @@ void Worksheet::DestroyTree()
   wxDELETE(m_tree);
   m_tree = NULL;
   m_last = NULL;
+  m_groupIndex.clear();
 }
 
 std::unique_ptr<GroupCell> Worksheet::CopyTree() const
@@ -5210,6 +5266,32 @@ bool Worksheet::ExportToHTML(const wxString &file)
   // Write the actual contents
   //////////////////////////////////////////////
 
+  // Everything that needs a DC or the GUI is done by the main thread. Encoding
+  // and writing the image files isn't and therefore is done by background tasks
+  // whilst we lay out the next chunks. The names of the image files only depend
+  // on the order of the chunks, so the HTML can be written before the images.
+  //
+  // The chunks and bitmaps the tasks work on are kept alive until they are
+  // finished. Only a few of them are held in memory at once.
+  #ifdef HAVE_OMP_HEADER
+  const size_t maxPendingImages = std::max(2 * omp_get_max_threads(), 2);
+  #else
+  const size_t maxPendingImages = 8;
+  #endif
+  std::vector<std::unique_ptr<Cell>> pendingChunks;
+  std::vector<std::unique_ptr<wxImage>> pendingImages;
+  auto waitForImages = [&]() {
+    #ifdef HAVE_OPENMP_TASKS
+    #pragma omp taskwait
+    #endif
+    pendingChunks.clear();
+    pendingImages.clear();
+  };
+  auto imageQueued = [&]() {
+    if (pendingChunks.size() + pendingImages.size() >= maxPendingImages)
+      waitForImages();
+  };
+
   for (; tmp; tmp = tmp->GetNext())
   {
     // Handle a code cell
@@ -5283,7 +5365,8 @@ bool Worksheet::ExportToHTML(const wxString &file)
           if (chunk->GetType() == MC_TYPE_SLIDE)
           {
             dynamic_cast<SlideShow *>(&(*chunk))->ToGif(
-                    imgDir + wxT("/") + filename + wxString::Format(wxT("_%d.gif"), count));
+                    imgDir + wxT("/") + filename + wxString::Format(wxT("_%d.gif"), count),
+                    GifAnimationWriter::sharedPalette);
             output << wxT("  <img src=\"") + filename_encoded + wxT("_htmlimg/") +
                       filename_encoded +
                       wxString::Format(_("_%d.gif\"  alt=\"Animated Diagram\" loading=\"lazy\" style=\"max-width:90%%;\" />\n"), count);
@@ -5333,17 +5416,25 @@ bool Worksheet::ExportToHTML(const wxString &file)
 
             case Configuration::bitmap:
             {
-              wxSize size;
               int bitmapScale = 3;
               ext = wxT(".png");
               wxConfig::Get()->Read(wxT("bitmapScale"), &bitmapScale);
-              size = CopyToFile(imgDir + wxT("/") + filename + wxString::Format(wxT("_%d.png"), count),
-                                &(*chunk),
-                                NULL, true, bitmapScale);
               int borderwidth = 0;
               wxString alttext = EditorCell::EscapeHTMLChars(chunk->ListToString());
               borderwidth = chunk->GetImageBorderWidth();
 
+              BitmapOut bitmap(&m_configuration, std::move(chunk), bitmapScale);
+              wxSize size = bitmap.GetScaledSize();
+              pendingImages.emplace_back(new wxImage(bitmap.GetImage()));
+              const wxImage *image = pendingImages.back().get();
+              const wxString imageFile =
+                imgDir + wxT("/") + filename + wxString::Format(wxT("_%d.png"), count);
+              #ifdef HAVE_OPENMP_TASKS
+              #pragma omp task firstprivate(image, imageFile)
+              #endif
+              BitmapOut::ToFile(*image, imageFile);
+              imageQueued();
+
               wxString line = wxT("  <img src=\"") +
                 filename_encoded + wxT("_htmlimg/") + filename_encoded +
                 wxString::Format(wxT("_%d%s\" width=\"%i\" style=\"max-width:90%%;\" loading=\"lazy\" alt=\" "),
@@ -5365,18 +5456,26 @@ bool Worksheet::ExportToHTML(const wxString &file)
           }
           else
           {
-            wxSize size;
-            ext = wxT(".") + dynamic_cast<ImgCell *>(&(*chunk))->GetExtension();
-            size = dynamic_cast<ImgCell *>(&(*chunk))->ToImageFile(
-              imgDir + wxT("/") + filename + wxString::Format(wxT("_%d"), count) + ext);
+            ImgCell *imgCell = dynamic_cast<ImgCell *>(&(*chunk));
+            ext = wxT(".") + imgCell->GetExtension();
+            // The image is written as it is, so we know its size in advance.
+            int width = imgCell->GetOriginalWidth();
             int borderwidth = 0;
             wxString alttext = EditorCell::EscapeHTMLChars(chunk->ListToString());
             borderwidth = chunk->GetImageBorderWidth();
+            const wxString imageFile =
+              imgDir + wxT("/") + filename + wxString::Format(wxT("_%d"), count) + ext;
+            #ifdef HAVE_OPENMP_TASKS
+            #pragma omp task firstprivate(imgCell, imageFile)
+            #endif
+            imgCell->ToImageFile(imageFile);
+            pendingChunks.emplace_back(std::move(chunk));
+            imageQueued();
 
             wxString line = wxT("  <img src=\"") +
               filename_encoded + wxT("_htmlimg/") + filename_encoded +
               wxString::Format(wxT("_%d%s\" width=\"%i\" style=\"max-width:90%%;\" loading=\"lazy\" alt=\""),
-                               count, ext.utf8_str(), size.x - 2 * borderwidth) +
+                               count, ext.utf8_str(), width - 2 * borderwidth) +
               alttext +
               wxT("\" /><br/>\n");
 
@@ -5466,7 +5565,8 @@ bool Worksheet::ExportToHTML(const wxString &file)
           if (tmp->GetLabel()->GetType() == MC_TYPE_SLIDE)
           {
             dynamic_cast<SlideShow *>(tmp->GetOutput())->ToGif(imgDir + wxT("/") + filename +
-                                                               wxString::Format(wxT("_%d.gif"), count));
+                                                               wxString::Format(wxT("_%d.gif"), count),
+                                                               GifAnimationWriter::sharedPalette);
             output << wxT("  <img src=\"") + filename_encoded + wxT("_htmlimg/") +
                       filename_encoded +
                       wxString::Format(_("_%d.gif\" alt=\"Animated Diagram\" style=\"max-width:90%%;\" loading=\"lazy\" />"), count)
@@ -5475,9 +5575,13 @@ bool Worksheet::ExportToHTML(const wxString &file)
           else
           {
             ImgCell *imgCell = dynamic_cast<ImgCell *>(out);
-            imgCell->ToImageFile(
-                    imgDir + wxT("/") + filename + wxString::Format(wxT("_%d."), count) +
-                    imgCell->GetExtension());
+            const wxString imageFile =
+              imgDir + wxT("/") + filename + wxString::Format(wxT("_%d."), count) +
+              imgCell->GetExtension();
+            #ifdef HAVE_OPENMP_TASKS
+            #pragma omp task firstprivate(imgCell, imageFile)
+            #endif
+            imgCell->ToImageFile(imageFile);
             output << wxT("  <img src=\"") + filename_encoded + wxT("_htmlimg/") +
                       filename_encoded +
                       wxString::Format(wxT("_%d.%s\" alt=\"Diagram\" style=\"max-width:90%%;\" loading=\"lazy\" />"), count,
@@ -5494,6 +5598,9 @@ bool Worksheet::ExportToHTML(const wxString &file)
     }
   }
 
+  // All image files need to exist before we claim the export to be finished.
+  waitForImages();
+
 //////////////////////////////////////////////
 // Footer
 //////////////////////////////////////////////
@@ -5909,360 +6016,173 @@ bool Worksheet::ExportToMAC(const wxString &file)
 */
 bool Worksheet::ExportToWXMX(const wxString &file, bool markAsSaved)
 {
-  #ifdef OPENMP
-  #if OPENMP_VER >= 201511
-  #pragma omp taskwait
-  #endif
-  #endif
   // Show a busy cursor as long as we export a file.
   wxBusyCursor crs;
-  // Don't update the worksheet whilst exporting
-  wxWindowUpdateLocker noUpdates(this);
-  wxLogMessage(_("Starting to save the worksheet as .wxmx"));
-  // delete temp file if it already exists
-  wxString backupfile = file + wxT("~");
-  if (wxFileExists(backupfile))
+  std::unique_ptr<WXMXWriter> writer;
   {
-    if (!wxRemoveFile(backupfile))
-      return false;
+    // Don't update the worksheet whilst exporting
+    wxWindowUpdateLocker noUpdates(this);
+    writer = SnapshotWXMX(file);
   }
+  if (!writer->Write())
   {
-    wxFFileOutputStream out(backupfile);
-    if (!out.IsOk())
-      return false;
-    {
-      wxZipOutputStream zip(out);
-      if (!zip.IsOk())
-        return false;
-      {
-        wxTextOutputStream output(zip);
+    if (writer->HasInvalidContent())
+      PutInvalidXMLOnClipboard(writer->GetContent());
+    return false;
+  }
 
-        /* The first zip entry is a file named "mimetype": This makes sure that the mimetype
-           is always stored at the same position in the file. This is common practice. One
-           example from an ePub file:
+  if (markAsSaved)
+    SetSaved(true);
+  return true;
+}
+
+void Worksheet::PutInvalidXMLOnClipboard(const wxString &xml)
+{
+  if (wxTheClipboard->Open())
+  {
+    wxDataObjectComposite *data = new wxDataObjectComposite;
+    data->Add(new wxTextDataObject(xml));
+    wxTheClipboard->SetData(data);
+    wxLogMessage(_("Produced invalid XML. The erroneous XML data has therefore not been saved but has been put on the clipboard in order to allow to debug it."));
+    wxTheClipboard->Close();
+  }
+}
 
-           00000000  50 4b 03 04 14 00 00 08  00 00 cd bd 0a 43 6f 61  |PK...........Coa|
-           00000010  ab 2c 14 00 00 00 14 00  00 00 08 00 00 00 6d 69  |.,............mi|
-           00000020  6d 65 74 79 70 65 61 70  70 6c 69 63 61 74 69 6f  |metypeapplicatio|
-           00000030  6e 2f 65 70 75 62 2b 7a  69 70 50 4b 03 04 14 00  |n/epub+zipPK....|
+std::unique_ptr<WXMXWriter> Worksheet::SnapshotWXMX(const wxString &file)
+{
+  std::unique_ptr<WXMXWriter> writer(new WXMXWriter(file));
+  wxString xmlText;
 
-        */
+  xmlText << wxT("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+  xmlText << wxT("\n<!--   Created using wxMaxima ") << wxT(GITVERSION) << wxT("   -->");
+  xmlText << wxT("\n<!--https://wxMaxima-developers.github.io/wxmaxima/-->\n");
 
-        // Make sure that the mime type is stored as plain text.
-        //
-        // We will keep that setting for the rest of the file for the following reasons:
-        //  - Compression of the .zip file won't improve compression of the embedded .png images
-        //  - The text part of the file is too small to justify compression
-        //  - not compressing the text part of the file allows version control systems to
-        //    determine which lines have changed and to track differences between file versions
-        //    efficiently (in a compressed text virtually every byte might change when one
-        //    byte at the start of the uncompressed original is)
-        //  - and if anything crashes in a bad way chances are high that the uncompressed
-        //    contents of the .wxmx file can be rescued using a text editor.
-        //  Who would - under these circumstances - care about a kilobyte?
-        zip.SetLevel(0);
-        zip.PutNextEntry(wxT("mimetype"));
-        output << wxT("text/x-wxmathml");
-        zip.CloseEntry();
-        zip.PutNextEntry(wxT("format.txt"));
-        output << wxT(
-          "\n\nThis file contains a wxMaxima session in the .wxmx format.\n"
-          ".wxmx files are .xml-based files contained in a .zip container like .odt\n"
-          "or .docx files. After changing their name to end in .zip the .xml and\n"
-          "eventual bitmap files inside them can be extracted using any .zip file\n"
-          "viewer.\n"
-          "The reason why part of a .wxmx file still might still seem to make sense in a\n"
-          "ordinary text viewer is that the text portion of .wxmx by default\n"
-          "isn't compressed: The text is typically small and compressing it would\n"
-          "mean that changing a single character would (with a high probability) change\n"
-          "big parts of the  whole contents of the compressed .zip archive.\n"
-          "Even if version control tools like git and svn that remember all changes\n"
-          "that were ever made to a file can handle binary files compression would\n"
-          "make the changed part of the file bigger and therefore seriously reduce\n"
-          "the efficiency of version control\n\n"
-          "wxMaxima can be downloaded from https://github.com/wxMaxima-developers/wxmaxima.\n"
-          "It also is part of the windows installer for maxima\n"
-          "(https://wxmaxima-developers.github.io/wxmaxima/).\n\n"
-          "If a .wxmx file is broken but the content.xml portion of the file can still be\n"
-          "viewed using a text editor just save the xml's text as \"content.xml\"\n"
-          "and try to open it using a recent version of wxMaxima.\n"
-          "If it is valid XML (the XML header is intact, all opened tags are closed again,\n"
-          "the text is saved with the text encoding \"UTF8 without BOM\" and the few\n"
-          "special characters XML requires this for are properly escaped)\n"
-          "chances are high that wxMaxima will be able to recover all code and text\n"
-          "from the XML file.\n\n"
-          );
-        zip.CloseEntry();
-
-        // next zip entry is "content.xml", xml of GetTree()
-
-        zip.PutNextEntry(wxT("content.xml"));
-        wxString xmlText;
-
-        xmlText << wxT("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
-        xmlText << wxT("\n<!--   Created using wxMaxima ") << wxT(GITVERSION) << wxT("   -->");
-        xmlText << wxT("\n<!--https://wxMaxima-developers.github.io/wxmaxima/-->\n");
-
-        // write document
-        xmlText << wxT("\n<wxMaximaDocument version=\"");
-        xmlText << DOCUMENT_VERSION_MAJOR << wxT(".");
-        xmlText << DOCUMENT_VERSION_MINOR << wxT("\" zoom=\"");
-        xmlText << int(100.0 * m_configuration->GetZoomFactor()) << wxT("\"");
-
-        // **************************************************************************
-        // Find out the number of the cell the cursor is at and save this information
-        // if we find it
-
-        // Determine which cell the cursor is at.
-        long ActiveCellNumber = 1;
-        GroupCell *cursorCell = NULL;
-        if (m_hCaretActive)
-        {
-          cursorCell = GetHCaret();
+  // write document
+  xmlText << wxT("\n<wxMaximaDocument version=\"");
+  xmlText << DOCUMENT_VERSION_MAJOR << wxT(".");
+  xmlText << DOCUMENT_VERSION_MINOR << wxT("\" zoom=\"");
+  xmlText << int(100.0 * m_configuration->GetZoomFactor()) << wxT("\"");
 
-          // If the cursor is before the 1st cell in the worksheet the cell number
-          // is 0.
-          if (!cursorCell)
-            ActiveCellNumber = 0;
-        }
-        else
-        {
-          if (GetActiveCell())
-            cursorCell = GetActiveCell()->GetGroup();
-        }
+  // **************************************************************************
+  // Find out the number of the cell the cursor is at and save this information
+  // if we find it
 
-        if (cursorCell == NULL)
-          ActiveCellNumber = 0;
-        // We want to save the information that the cursor is in the nth cell.
-        // Count the cells until then.
-        GroupCell *tmp = GetTree();
-        if (tmp == NULL)
-          ActiveCellNumber = -1;
-        if (ActiveCellNumber > 0)
-        {
-          while ((tmp) && (tmp != cursorCell))
-          {
-            tmp = tmp->GetNext();
-            ActiveCellNumber++;
-          }
-        }
-        // Paranoia: What happens if we didn't find the cursor?
-        if (tmp == NULL) ActiveCellNumber = -1;
+  // Determine which cell the cursor is at.
+  long ActiveCellNumber = 1;
+  GroupCell *cursorCell = NULL;
+  if (m_hCaretActive)
+  {
+    cursorCell = GetHCaret();
 
-        // If we know where the cursor was we save this piece of information.
-        // If not we omit it.
-        if (ActiveCellNumber >= 0)
-          xmlText << wxString::Format(wxT(" activecell=\"%li\""), ActiveCellNumber);
+    // If the cursor is before the 1st cell in the worksheet the cell number
+    // is 0.
+    if (!cursorCell)
+      ActiveCellNumber = 0;
+  }
+  else
+  {
+    if (GetActiveCell())
+      cursorCell = GetActiveCell()->GetGroup();
+  }
 
+  if (cursorCell == NULL)
+    ActiveCellNumber = 0;
+  // We want to save the information that the cursor is in the nth cell.
+  // Count the cells until then.
+  GroupCell *tmp = GetTree();
+  if (tmp == NULL)
+    ActiveCellNumber = -1;
+  if (ActiveCellNumber > 0)
+  {
+    while ((tmp) && (tmp != cursorCell))
+    {
+      tmp = tmp->GetNext();
+      ActiveCellNumber++;
+    }
+  }
+  // Paranoia: What happens if we didn't find the cursor?
+  if (tmp == NULL) ActiveCellNumber = -1;
 
-        // Save the variables list for the "variables" sidepane.
-        wxArrayString variables = m_variablesPane->GetVarnames();
-        if(variables.GetCount() > 1)
-        {
-          long varcount = variables.GetCount() - 1;
-          xmlText += wxString::Format(" variables_num=\"%li\"", varcount);
-          for(auto i = 0; i<variables.GetCount(); i++)
-            xmlText += wxString::Format(" variables_%li=\"%s\"", i, Cell::XMLescape(variables[i]).utf8_str());
-        }
-  
-        xmlText << ">\n";
+  // If we know where the cursor was we save this piece of information.
+  // If not we omit it.
+  if (ActiveCellNumber >= 0)
+    xmlText << wxString::Format(wxT(" activecell=\"%li\""), ActiveCellNumber);
 
-        // Reset image counter
-        m_cellPointers.WXMXResetCounter();
 
-        if (GetTree())
-          xmlText += GetTree()->ListToXML();
+  // Save the variables list for the "variables" sidepane.
+  wxArrayString variables = m_variablesPane->GetVarnames();
+  if(variables.GetCount() > 1)
+  {
+    long varcount = variables.GetCount() - 1;
+    xmlText += wxString::Format(" variables_num=\"%li\"", varcount);
+    for(auto i = 0; i<variables.GetCount(); i++)
+      xmlText += wxString::Format(" variables_%li=\"%s\"", i, Cell::XMLescape(variables[i]).utf8_str());
+  }
 
-        // Delete all but one control character from the string: there should be
-        // no way for them to enter this string, anyway. But sometimes they still
-        // do...
-        for (wxString::const_iterator it = xmlText.begin(); it != xmlText.end(); ++it)
-        {
-          wxChar c = *it;
-          if ((c < wxT('\t')) ||
-              ((c > wxT('\n')) && (c < wxT(' '))) ||
-              (c == wxChar((char) 0x7F))
-            )
-          {
-            // *it = wxT(' ');
-          }
-        }
+  xmlText << ">\n";
 
-        xmlText +=  wxT("\n</wxMaximaDocument>");
+  // Reset image counter
+  m_cellPointers.WXMXResetCounter();
 
-        {
-          // Prepare reading the files we have stored in memory
-          std::unique_ptr<wxFileSystem> fsystem(new wxFileSystem);
-          fsystem->AddHandler(new wxMemoryFSHandler);
-          fsystem->ChangePathTo(wxT("memory:"), true);
-
-          // In wxWidgets 3.1.1 fsystem->FindFirst crashes if we don't have a file
-          // in the memory filesystem => Let's create a file just to make sure
-          // one exists.
-          wxMemoryBuffer dummyBuf;
-          wxMemoryFSHandler::AddFile("dummyfile",
-                                     dummyBuf.GetData(),
-                                     dummyBuf.GetDataLen());
-
-          // Let wxWidgets test if the document can be read again by the XML parser before
-          // the user finds out the hard way.
-          {
-            wxXmlDocument doc;
-            {
-              wxMemoryOutputStream ostream;
-              wxTextOutputStream txtstrm(ostream);
-              txtstrm.WriteString(xmlText);
-              wxMemoryInputStream istream(ostream);
-              doc.Load(istream);
-            }
+  if (GetTree())
+    xmlText += GetTree()->ListToXML();
 
-            // If we fail to load the document we abort the safe process as it will
-            // only destroy data.
-            // But we can still put the erroneous data into the clipboard for debugging purposes.
-            if (!doc.IsOk())
-            {
-              if (wxTheClipboard->Open())
-              {
-                wxDataObjectComposite *data = new wxDataObjectComposite;
-                data->Add(new wxTextDataObject(xmlText));
-                wxTheClipboard->SetData(data);
-                wxLogMessage(_("Produced invalid XML. The erroneous XML data has therefore not been saved but has been put on the clipboard in order to allow to debug it."));
-                wxTheClipboard->Close();
-              }
+  xmlText +=  wxT("\n</wxMaximaDocument>");
 
-              // Remove all files from our internal filesystem
-              wxString memFsName = fsystem->FindFirst("*", wxFILE);
-              while(memFsName != wxEmptyString)
-              {
-                wxString name = memFsName.Right(memFsName.Length()-7);
-                wxMemoryFSHandler::RemoveFile(name);
-                memFsName = fsystem->FindNext();
-              }
-              return false;
-            }
-          }
+  // Prepare reading the files we have stored in memory
+  std::unique_ptr<wxFileSystem> fsystem(new wxFileSystem);
+  fsystem->AddHandler(new wxMemoryFSHandler);
+  fsystem->ChangePathTo(wxT("memory:"), true);
 
-          // wxWidgets could pretty-print the XML document now. But as no-one will
-          // look at it, anyway, there might be no good reason to do so.
-          if (GetTree() != NULL)output << xmlText;
+  // In wxWidgets 3.1.1 fsystem->FindFirst crashes if we don't have a file
+  // in the memory filesystem => Let's create a file just to make sure
+  // one exists.
+  wxMemoryBuffer dummyBuf;
+  wxMemoryFSHandler::AddFile("dummyfile",
+                             dummyBuf.GetData(),
+                             dummyBuf.GetDataLen());
 
-          // Move all files we have stored in memory during saving to zip file
-          wxString memFsName = fsystem->FindFirst("*", wxFILE);
-          while(memFsName != wxEmptyString)
-          {
-            wxString name = memFsName.Right(memFsName.Length()-7);
-            if(name != wxT("dummyfile"))
-            {
-              zip.CloseEntry();
+  // Testing that the XML parser can read the document again is left to
+  // WXMXWriter::Write(), which can run in a background task.
+  writer->SetContent(xmlText);
 
-              wxFSFile *fsfile;
+  // Move all files we have stored in memory during saving to the writer
+  wxString memFsName = fsystem->FindFirst("*", wxFILE);
+  while(memFsName != wxEmptyString)
+  {
+    wxString name = memFsName.Right(memFsName.Length()-7);
+    if(name != wxT("dummyfile"))
+    {
+      wxFSFile *fsfile;
 #ifdef HAVE_OPENMP_TASKS
 #pragma omp critical (OpenFSFile)
 #endif
-              fsfile = fsystem->OpenFile(memFsName);
-
-              if (fsfile)
-              {
-                // The data for gnuplot is likely to change in its entirety if it
-                // ever changes => We can store it in a compressed form.
-                if(name.EndsWith(wxT(".data")))
-                  zip.SetLevel(9);
-                else
-                  zip.SetLevel(0);
+      fsfile = fsystem->OpenFile(memFsName);
 
-                zip.PutNextEntry(name);
-                std::unique_ptr<wxInputStream> imagefile(fsfile->GetStream());
-
-                while (!(imagefile->Eof()))
-                  imagefile->Read(zip);
-              }
-            }
-            wxMemoryFSHandler::RemoveFile(name);
-            memFsName = fsystem->FindNext();
-          }
+      if (fsfile)
+      {
+        std::unique_ptr<wxFSFile> fileOwner(fsfile);
+        wxInputStream *imagefile = fsfile->GetStream();
+        wxMemoryBuffer data;
+        char buf[65536];
+        while (imagefile && !(imagefile->Eof()))
+        {
+          imagefile->Read(buf, sizeof(buf));
+          if(imagefile->LastRead() == 0)
+            break;
+          data.AppendData(buf, imagefile->LastRead());
         }
+        writer->AddFile(name, data);
       }
-      if(!zip.Close())
-        return false;
     }
-    if (!out.Close())
-      return false;
+    wxMemoryFSHandler::RemoveFile(name);
+    memFsName = fsystem->FindNext();
   }
-  // If all data is saved now we can overwrite the actual save file.
-  // We will try to do so a few times if we suspect a MSW virus scanner or similar
-  // temporarily hindering us from doing so.
-  
-  // The following line is paranoia as closing (and thus writing) the file has
-  // succeeded.
-  if(!wxFileExists(backupfile))
-    return false;
-  
-  // Now we try to open the file in order to see if saving hasn't failed
-  // without returning an error - which can apparently happen on MSW.
-  wxString wxmxURI = wxURI(wxT("file://") + backupfile).BuildURI();
-  wxmxURI.Replace("#", "%23");
-#ifdef  __WXMSW__
-  // Fixes a missing "///" after the "file:". This works because we always get absolute
-  // file names.
-  wxRegEx uriCorector1("^file:([a-zA-Z]):");
-  wxRegEx uriCorector2("^file:([a-zA-Z][a-zA-Z]):");
-  uriCorector1.ReplaceFirst(&wxmxURI,wxT("file:///\\1:"));
-  uriCorector2.ReplaceFirst(&wxmxURI,wxT("file:///\\1:"));
-#endif
-  // The URI of the wxm code contained within the .wxmx file
-  wxString filename = wxmxURI + wxT("#zip:content.xml");
 
-  // Open the file we have saved yet just in order to see if we
-  // actually managed to save it correctly.
-  {
-    wxFileSystem fs;
-    wxFSFile *fsfile;
-#ifdef HAVE_OPENMP_TASKS
-#pragma omp critical (OpenFSFile)
-#endif
-    fsfile = fs.OpenFile(filename);
-    
-    // Did we succeed in opening the file?
-    if (!fsfile)
-    {
-      wxLogMessage(_(wxT("Saving succeeded, but the file could not be read again \u21D2 Not replacing the old saved file.")));
-      return false;
-    }
-    wxDELETE(fsfile);
-  }
-  
-  {
-    bool done;
-    SuppressErrorDialogs suppressor;
-    done = wxRenameFile(backupfile, file, true);
-    if(!done)
-    {
-      // We might have failed to move the file because an over-eager virus scanner wants to
-      // scan it and a design decision of a filesystem driver might hinder us from moving
-      // it during this action => Wait for a second and retry.
-      wxSleep(1);
-      done = wxRenameFile(backupfile, file, true);
-    }
-    if(!done)
-    {
-      // We might have failed to move the file because an over-eager virus scanner wants to
-      // scan it and a design decision of a filesystem driver might hinder us from moving
-      // it during this action => Wait for a second and retry.
-      wxSleep(1);
-      done = wxRenameFile(backupfile, file, true);
-    }
-    if(!done)
-    {
-      wxSleep(1);
-      if (!wxRenameFile(backupfile, file, true))
-        return false;
-    }
-    if (markAsSaved)
-      SetSaved(true);
-    
-    wxLogMessage(_("wxmx file saved"));
-  }
-  return true;
+  // content.xml only contains anything if there is a worksheet
+  if (GetTree() == NULL)
+    writer->SetContent(wxEmptyString);
+  return writer;
 }
 
 bool Worksheet::CanEdit()
@@ -7738,6 +7658,30 @@ bool Worksheet::CaretVisibleIs()
   }
 }
 
+void Worksheet::PrefetchImages()
+{
+  if (!GetTree() || m_configuration->GetPrinting())
+    return;
+
+  // Images up to one screen height above and below the visible region. The
+  // cells' rectangles are in worksheet coordinates, not in window coordinates.
+  int width;
+  int height;
+  GetClientSize(&width, &height);
+  int top;
+  int bottom;
+  CalcUnscrolledPosition(0, -height, NULL, &top);
+  CalcUnscrolledPosition(0, 2 * height, NULL, &bottom);
+
+  for (GroupCell *group = GetGroupCellAtY(top);
+       group && (group->GetRect().GetTop() <= bottom);
+       group = group->GetNext())
+  {
+    for (Cell *cell = group->GetOutput(); cell; cell = cell->GetNext())
+      cell->PrefetchImages();
+  }
+}
+
 bool Worksheet::ScrollToCaretIfNeeded()
 {
   if(!m_scrollToCaret)
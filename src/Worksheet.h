@@ -38,6 +38,7 @@
 #include <wx/fdrepdlg.h>
 #include <wx/dc.h>
 #include <list>
+#include <memory>
 
 #include "CellPointers.h"
 #include "VariablesPane.h"
@@ -53,6 +54,7 @@
 #include "TableOfContents.h"
 #include "UnicodeSidebar.h"
 #include "ToolBar.h"
+#include "WXMXWriter.h"
 
 /*! The canvas that contains the spreadsheet the whole program is about.
 
@@ -127,6 +129,8 @@ private:
   GroupCell *m_redrawStart;
   //! Do we need to redraw the worksheet?
   bool m_redrawRequested;
+  //! true = nobody will ever see the worksheet => don't lay it out or draw it
+  bool m_headless = false;
   //! The clipboard format "mathML"
 
   //! A class that publishes wxm data to the clipboard
@@ -202,10 +206,6 @@ private:
 
 //! true, if we have the current focus.
   bool m_hasFocus;
-  //! The last beginning for the area being drawn
-  long m_lastTop;
-  //! The last ending for the area being drawn
-  long m_lastBottom;
   /*! \defgroup UndoBufferFill Undo methods for cell additions/deletions:
 
     Each EditorCell has its own private undo buffer Additionally wxMaxima
@@ -731,6 +731,15 @@ public:
     \return true, if we did redraw a workscreet portion.
    */
   void RequestRedraw(GroupCell *start = NULL);
+
+  /*! Tell the worksheet that it is never displayed
+
+    Headless worksheets are only evaluated and saved: They skip recalculating
+    the cells' sizes and redrawing.
+   */
+  void SetHeadless(bool headless){m_headless = headless;}
+  //! Is this worksheet never displayed?
+  bool IsHeadless() const {return m_headless;}
   /*! Request a part of the worksheet to be redrawn
 
     \param rect The rectangle that is to be requested to be redrawn. If this
@@ -927,8 +936,16 @@ public:
   */
   void InsertLine(std::unique_ptr<Cell> &&newCell, bool forceNewLine = false);
 
-  // Actually recalculate the worksheet.
-  bool RecalculateIfNeeded();
+  /*! Actually recalculate the worksheet.
+
+    \param timeBudget_ms How many milliseconds we may spend on cells below the visible
+           region before we leave the rest for the next call. -1 means: Recalculate
+           everything now. Cells that are visible are always recalculated as the
+           screen cannot be drawn without them. Until cells below the visible region
+           have been recalculated their old sizes serve as an estimate.
+    \return true, if the worksheet was recalculated.
+   */
+  bool RecalculateIfNeeded(long timeBudget_ms = -1);
 
   //! Schedule a recalculation of the worksheet starting with the cell start.
   void Recalculate(Cell *start, bool force = false);
@@ -1107,12 +1124,29 @@ public:
   bool ExportToMAC(const wxString &file);
 
   /*! export to xml compatible file
+
+    The caller has to make sure that no autosave is writing the same file.
     \param file The file name
     \param markAsSaved false means that this action doesn't clear the
                              worksheet's "modified" status.
   */
   bool ExportToWXMX(const wxString &file, bool markAsSaved = true);
 
+  /*! Collects everything ExportToWXMX writes to a .wxmx file
+
+    Needs to be called from the GUI thread. The returned writer doesn't access
+    the worksheet any more which means that it can write the file from a
+    background task.
+  */
+  std::unique_ptr<WXMXWriter> SnapshotWXMX(const wxString &file);
+
+  /*! Puts XML the XML parser cannot read on the clipboard so it can be debugged
+
+    For when WXMXWriter::Write() has failed as the worksheet's XML representation
+    is invalid. Needs to be called from the GUI thread.
+   */
+  static void PutInvalidXMLOnClipboard(const wxString &xml);
+
   //! The start of a RTF document
   wxString RTFStart() const;
 
@@ -1173,6 +1207,12 @@ public:
   //! Scrolls to the cursor, if requested.
   bool ScrollToCaretIfNeeded();
 
+  /*! Starts scaling the images near the visible region in the background
+
+    This way they can be drawn without delay once they are scrolled into view.
+   */
+  void PrefetchImages();
+
   //! Scrolls to the cell given by ScheduleScrollToCell; Is called once we have time to do so.
   void ScrollToCellIfNeeded();
   
@@ -1195,6 +1235,13 @@ public:
   //! The first groupCell that is currently visible.
   GroupCell *FirstVisibleGC();
 
+  /*! The first group cell whose bottom is at or below the y coordinate y
+
+    Returns NULL if y lies below the last group cell. Bisects m_groupIndex
+    instead of walking the whole list of group cells.
+  */
+  GroupCell *GetGroupCellAtY(int y);
+
   /*! Scrolls to a point on the worksheet
 
     \todo I have deactivated this assert for the release as it scares the users
@@ -1583,6 +1630,17 @@ protected:
   void UpdateConfigurationClientSize();
   //! Where to start recalculation. NULL = No recalculation needed.
   GroupCell *m_recalculateStart;
+  /*! All group cells of the worksheet, in the order they appear in
+
+    The y positions of the group cells grow monotonically along this list which
+    means that GetGroupCellAtY() can find a group cell by bisection. Entries of
+    deleted cells become NULL; GetGroupCellAtY() rebuilds the index as soon as
+    it encounters one of them or finds that new cells have been inserted next
+    to the cell it has found.
+  */
+  std::vector<CellPtr<GroupCell>> m_groupIndex;
+  //! Fill m_groupIndex with the current list of group cells
+  void RebuildGroupIndex();
   //! The x position of the mouse pointer
   int m_pointer_x;
   //! The y position of the mouse pointer
@@ -0,0 +1,92 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+#include "ZipArchiveIndex.h"
+#include <wx/log.h>
+#include <wx/wfstream.h>
+#include <vector>
+
+ZipArchiveIndex::ZipArchiveIndex(const wxString &file) :
+  m_file(file)
+{
+  wxFFileInputStream input(m_file);
+  if (!input.IsOk())
+    return;
+  wxZipInputStream zip(input);
+  wxZipEntry *entry;
+  while ((entry = zip.GetNextEntry()) != NULL)
+    m_entries[entry->GetInternalName()].reset(entry);
+}
+
+wxString ZipArchiveIndex::InternalName(const wxString &name)
+{
+  wxString internalName = wxZipEntry::GetInternalName(name, wxPATH_UNIX);
+  while (internalName.StartsWith(wxT("/")))
+    internalName = internalName.Mid(1);
+  return internalName;
+}
+
+bool ZipArchiveIndex::Contains(const wxString &name) const
+{
+  return m_entries.find(InternalName(name)) != m_entries.end();
+}
+
+bool ZipArchiveIndex::Read(const wxString &name, wxMemoryBuffer &data) const
+{
+  wxString internalName = InternalName(name);
+  auto indexEntry = m_entries.find(internalName);
+  if (indexEntry == m_entries.end())
+    return false;
+
+  // Every call uses its own streams so several tasks can read at once.
+  wxLogNull suppressor;
+  wxFFileInputStream input(m_file);
+  if (!input.IsOk())
+    return false;
+  wxZipInputStream zip(input);
+
+  // On a seekable stream the entry can be opened directly. If that fails we
+  // search the archive for it from the start.
+  wxZipEntry entry(*indexEntry->second);
+  bool opened = input.IsSeekable() && zip.OpenEntry(entry);
+  if (!opened)
+  {
+    wxZipEntry *candidate;
+    while ((!opened) && ((candidate = zip.GetNextEntry()) != NULL))
+    {
+      opened = (candidate->GetInternalName() == internalName);
+      delete candidate;
+    }
+  }
+  if (!opened)
+    return false;
+
+  data.Clear();
+  std::vector<char> buf(65536);
+  while (!zip.Eof())
+  {
+    zip.Read(buf.data(), buf.size());
+    if (zip.LastRead() == 0)
+      break;
+    data.AppendData(buf.data(), zip.LastRead());
+  }
+  return (zip.GetLastError() == wxSTREAM_NO_ERROR) || (zip.GetLastError() == wxSTREAM_EOF);
+}
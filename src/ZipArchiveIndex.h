@@ -0,0 +1,74 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+/*! \file
+  This file declares the class ZipArchiveIndex that reads files from .wxmx archives.
+ */
+
+#ifndef WXMAXIMA_ZIPARCHIVEINDEX_H
+#define WXMAXIMA_ZIPARCHIVEINDEX_H
+
+#include <wx/string.h>
+#include <wx/buffer.h>
+#include <wx/hashmap.h>
+#include <wx/zipstrm.h>
+#include <memory>
+#include <unordered_map>
+
+/*! The table of contents of a .zip archive, for example a .wxmx file
+
+  Reading a file from a .zip archive using wxFileSystem means that the
+  archive's table of contents has to be found and that the file system's handler
+  has to be locked against concurrent use. This class reads the table of
+  contents once. Afterwards Read() only uses objects it owns itself, which
+  means that any number of background tasks can read different files from the
+  same archive at the same time.
+ */
+class ZipArchiveIndex
+{
+public:
+  //! Reads the table of contents of the archive \p file
+  explicit ZipArchiveIndex(const wxString &file);
+
+  //! Could the table of contents be read?
+  bool IsOk() const { return !m_entries.empty(); }
+
+  //! Does the archive contain a file of this name?
+  bool Contains(const wxString &name) const;
+
+  /*! Reads and uncompresses a file from the archive
+
+    Is thread-safe.
+    \return false, if the file could not be read.
+   */
+  bool Read(const wxString &name, wxMemoryBuffer &data) const;
+
+private:
+  //! The name the archive uses for the file \p name
+  static wxString InternalName(const wxString &name);
+
+  //! The archive
+  wxString m_file;
+  //! The entries of the table of contents, by name
+  std::unordered_map<wxString, std::unique_ptr<wxZipEntry>, wxStringHash> m_entries;
+};
+
+#endif // WXMAXIMA_ZIPARCHIVEINDEX_H
@@ -34,6 +34,7 @@
 #include <wx/cmdline.h>
 #include <wx/fileconf.h>
 #include <wx/sysopt.h>
+#include <wx/thread.h>
 #include "Dirstructure.h"
 #include <iostream>
 
@@ -57,10 +58,11 @@ IMPLEMENT_WX_THEME_SUPPORT;
 
 int CommonMain()
 {
+  int exitCode = 0;
   wxTheApp->CallOnInit();
   #pragma omp parallel
   #pragma omp master
-  wxTheApp->OnRun();
+  exitCode = wxTheApp->OnRun();
   wxConfigBase *config = wxConfig::Get();
   config->Flush();
   delete config;
@@ -68,7 +70,7 @@ int CommonMain()
     wxLogDebug("CellPtr: %zu live instances leaked", CellPtrBase::GetLiveInstanceCount());
   if(Observed::GetLiveInstanceCount() != 0)
     wxLogDebug("Cell:    %zu live instances leaked", Observed::GetLiveInstanceCount());
-  return 0;
+  return exitCode;
 }
 
 #ifndef __WXMSW__
@@ -86,6 +88,7 @@ int WINAPI WinMain( HINSTANCE hI, HINSTANCE hPrevI, LPSTR lpCmdLine, int nCmdSho
 #endif
 
 std::vector<wxMaxima *> MyApp::m_topLevelWindows;
+std::unique_ptr<BatchRunner> MyApp::m_batchRunner;
 
 
 bool MyApp::OnInit()
@@ -193,6 +196,12 @@ bool MyApp::OnInit()
        "evaluate the file after opening it.", wxCMD_LINE_VAL_NONE , 0},
       {wxCMD_LINE_SWITCH, "b", "batch",
        "run the file and exit afterwards. Halts on questions and stops on errors.",  wxCMD_LINE_VAL_NONE, 0},
+      {wxCMD_LINE_SWITCH, "", "headless",
+       "like --batch, but without displaying anything. Saves the result as .wxmx file and exits on questions.",  wxCMD_LINE_VAL_NONE, 0},
+      {wxCMD_LINE_OPTION, "j", "jobs",
+       "with --headless: evaluate up to <num> files in parallel (default: the number of CPUs).",  wxCMD_LINE_VAL_NUMBER, 0},
+      {wxCMD_LINE_OPTION, "", "summary",
+       "with --headless: write the time each file needed and its errors to <str> in JSON format. Default if more than one file is given: stdout.",  wxCMD_LINE_VAL_STRING, 0},
                   {wxCMD_LINE_SWITCH, "", "logtostdout",
                    "Log all \"debug messages\" sidebar messages to stderr, too.",  wxCMD_LINE_VAL_NONE, 0},
                   {wxCMD_LINE_SWITCH, "", "pipe",
@@ -332,13 +341,50 @@ bool MyApp::OnInit()
     evalOnStartup = true;
     exitAfterEval = true;
   }
+
+  if (cmdLineParser.Found(wxT("headless")))
+  {
+    evalOnStartup = true;
+    exitAfterEval = true;
+    wxMaxima::Headless();
+  }
   
   if (cmdLineParser.Found(wxT("e")))
     evalOnStartup = true;
 
   bool windowOpened = false;
-  
-  if (cmdLineParser.Found(wxT("o"), &file))
+
+  wxString summaryFile;
+  bool const summaryWanted = cmdLineParser.Found(wxT("summary"), &summaryFile);
+  if (wxMaxima::IsHeadless() &&
+      (summaryWanted || (cmdLineParser.GetParamCount() + (cmdLineParser.Found(wxT("o")) ? 1 : 0) > 1)))
+  {
+    // Evaluate the files using a pool of wxMaxima windows with a maxima process each.
+    long jobs = wxThread::GetCPUCount();
+    cmdLineParser.Found(wxT("j"), &jobs);
+    if (jobs < 1)
+      jobs = 1;
+    m_batchRunner = std::make_unique<BatchRunner>(
+      [this](const wxString &file){return NewWindow(file, true, true);},
+      jobs, summaryFile);
+    wxArrayString files;
+    if (cmdLineParser.Found(wxT("o"), &file))
+      files.Add(file);
+    for (unsigned int i=0; i < cmdLineParser.GetParamCount(); i++)
+      files.Add(cmdLineParser.GetParam(i));
+    for (auto const &name : files)
+    {
+      wxFileName FileName = name;
+      FileName.MakeAbsolute();
+      m_batchRunner->AddFile(FileName.GetFullPath());
+    }
+    m_batchRunner->Start();
+    // Without any file to evaluate we are done already.
+    if (m_batchRunner->Done())
+      exit(wxMaxima::GetExitCode());
+    windowOpened = true;
+  }
+  else if (cmdLineParser.Found(wxT("o"), &file))
   {
     wxFileName FileName = file;
     FileName.MakeAbsolute();
@@ -347,7 +393,7 @@ bool MyApp::OnInit()
     windowOpened = true;
   }
 
-  if(cmdLineParser.GetParamCount() > 0)
+  if(!m_batchRunner && (cmdLineParser.GetParamCount() > 0))
   {
     for (unsigned int i=0; i < cmdLineParser.GetParamCount(); i++)
     {
@@ -379,10 +425,10 @@ int MyApp::OnExit()
 int MyApp::OnRun()
 {
   wxApp::OnRun();
-  return 0;
+  return wxMaxima::GetExitCode();
 }
 
-void MyApp::NewWindow(const wxString &file, bool evalOnStartup, bool exitAfterEval, unsigned char *wxmData, int wxmLen)
+wxMaxima *MyApp::NewWindow(const wxString &file, bool evalOnStartup, bool exitAfterEval, unsigned char *wxmData, int wxmLen)
 {
   int numberOfWindows = m_topLevelWindows.size();
 
@@ -424,8 +470,12 @@ void MyApp::NewWindow(const wxString &file, bool evalOnStartup, bool exitAfterEv
   m_topLevelWindows.push_back(frame);
 
   SetTopWindow(frame);
+  // A headless evaluation doesn't need a window anybody can see.
+  if (wxMaxima::IsHeadless())
+    return frame;
   frame->Show(true);
   frame->ShowTip(false);
+  return frame;
 }
 
 void MyApp::OnFileMenu(wxCommandEvent &ev)
@@ -63,6 +63,7 @@
 #include "Printout.h"
 #include "TipOfTheDay.h"
 #include "EditorCell.h"
+#include "TextExtentCache.h"
 #include "SlideShowCell.h"
 #include "PlotFormatWiz.h"
 #include "ActualValuesStorageWiz.h"
@@ -94,9 +95,13 @@
 #include <wx/sckstrm.h>
 #include <wx/fs_mem.h>
 #include <wx/persist/toplevel.h>
+#include <wx/progdlg.h>
 
 #include <wx/url.h>
 #include <wx/sstream.h>
+#include <wx/ffile.h>
+#include <algorithm>
+#include <cmath>
 #include <list>
 #include <memory>
 
@@ -110,11 +115,19 @@ void MyApp::DelistTopLevelWindow(wxMaxima *window)
 {
   auto pos = std::find(m_topLevelWindows.begin(), m_topLevelWindows.end(), window);
   if (pos != m_topLevelWindows.end())
+  {
     m_topLevelWindows.erase(pos);
+    // Opens the window for the next file, if there is one => the program only
+    // exits when the last file has been evaluated.
+    if (m_batchRunner)
+      m_batchRunner->WindowClosed(window, window->HeadlessError());
+  }
 }
 
 void wxMaxima::ConfigChanged()
 {
+  // The fonts might have changed, which invalidates all text sizes we know
+  TextExtentCache::Get().Clear();
   if(m_worksheet->GetTree())
     m_worksheet->GetTree()->FontsChangedList();
   
@@ -190,11 +203,14 @@ wxMaxima::wxMaxima(wxWindow *parent, int id, wxLocale *locale, const wxString ti
                 MyApp::m_topLevelWindows.empty()),
   m_openFile(filename),
   m_gnuplotcommand("gnuplot"),
-  m_parser(&m_worksheet->m_configuration)
+  m_parser(&m_worksheet->m_configuration),
+  m_backgroundParser(&m_worksheet->m_configuration)
 {
   #ifdef HAVE_OMP_HEADER
   omp_init_lock(&m_helpFileAnchorsLock);
   #endif
+  m_backgroundParser.CollectWarnings(true);
+  InitOutputScanner();
   // Needed for making wxSocket work for multiple threads. We currently don't
   // use this feature.
   // wxSocketBase::Initialize();
@@ -225,6 +241,7 @@ wxMaxima::wxMaxima(wxWindow *parent, int id, wxLocale *locale, const wxString ti
 
   m_commandIndex = -1;
   m_isActive = true;
+  m_worksheet->SetHeadless(m_headless);
   wxConfigBase *config = wxConfig::Get();
   // If maxima fails to come up directly on startup of wxMaxima there is no need to retry.
   m_unsuccessfulConnectionAttempts = 11;
@@ -622,6 +639,8 @@ wxMaxima::wxMaxima(wxWindow *parent, int id, wxLocale *locale, const wxString ti
           wxCommandEventHandler(wxMaxima::AlgebraMenu), NULL, this);
   Connect(menu_time, wxEVT_MENU,
           wxCommandEventHandler(wxMaxima::MaximaMenu), NULL, this);
+  Connect(menu_profileEvaluations, wxEVT_MENU,
+          wxCommandEventHandler(wxMaxima::MaximaMenu), NULL, this);
   Connect(menu_factsimp, wxEVT_MENU,
           wxCommandEventHandler(wxMaxima::SimplifyMenu), NULL, this);
   Connect(menu_factcomb, wxEVT_MENU,
@@ -1002,6 +1021,8 @@ wxMaxima::wxMaxima(wxWindow *parent, int id, wxLocale *locale, const wxString ti
           wxCommandEventHandler(wxMaxima::HistoryDClick), NULL, this);
   Connect(structure_ctrl_id, wxEVT_LIST_ITEM_ACTIVATED,
           wxListEventHandler(wxMaxima::TableOfContentsSelection), NULL, this);
+  Connect(profile_ctrl_id, wxEVT_LIST_ITEM_ACTIVATED,
+          wxListEventHandler(wxMaxima::ProfileSelection), NULL, this);
   Connect(menu_stats_histogram, wxEVT_BUTTON,
           wxCommandEventHandler( wxMaxima::StatsMenu), NULL, this);
   Connect(menu_stats_piechart, wxEVT_BUTTON,
@@ -1225,7 +1246,9 @@ TextCell *wxMaxima::ConsoleAppend(wxString s, CellType type, const wxString &use
     wxBusyCursor crs;
 
     if (s.StartsWith(m_mathPrefix1) || s.StartsWith(m_mathPrefix2))
-      DoConsoleAppend("<span>" + s + "</span>", type, AppendOpt(AppendOpt::NewLine | AppendOpt::BigSkip), userLabel);
+      DoConsoleAppend("<span>" + s + "</span>", type,
+                      AppendOpt(AppendOpt::NewLine | AppendOpt::BigSkip | AppendOpt::Background),
+                      userLabel);
     else
       lastLine = DoRawConsoleAppend(s, type);
   }
@@ -1282,9 +1305,35 @@ void wxMaxima::DoConsoleAppend(wxString s, CellType type, AppendOpt opts, const
 
   s.Replace(wxT("\n"), wxT(" "), true);
 
+#ifdef HAVE_OPENMP_TASKS
+  // Converting big outputs to cells can take long enough to make the GUI feel
+  // unresponsive. Images are loaded by the GUI thread as wxWidgets' image
+  // handling isn't guaranteed to be thread-safe.
+  if ((opts & AppendOpt::Background) && (!m_mathParseJob) &&
+      (s.Length() > 20000) && (!s.Contains(wxT("<img"))) && (!s.Contains(wxT("<slide"))))
+  {
+    m_mathParseJob = std::make_unique<MathParseJob>();
+    MathParseJob *job = m_mathParseJob.get();
+    job->m_xml = s;
+    job->m_type = type;
+    job->m_opts = opts;
+    job->m_group = m_worksheet->GetWorkingGroup();
+    m_backgroundParser.SetUserLabel(userLabel);
+    #pragma omp task firstprivate(job)
+    {
+      job->m_cell.reset(m_backgroundParser.ParseLine(job->m_xml, job->m_type));
+      CallAfter(&wxMaxima::OnMathParsedInBackground);
+    }
+    return;
+  }
+#endif
+
   m_parser.SetUserLabel(userLabel);
-  std::unique_ptr<Cell> cell(m_parser.ParseLine(s, type));
+  InsertParsedLine(std::unique_ptr<Cell>(m_parser.ParseLine(s, type)), opts);
+}
 
+void wxMaxima::InsertParsedLine(std::unique_ptr<Cell> &&cell, AppendOpt opts)
+{
   wxASSERT_MSG(cell, _("There was an error in generated XML!\n\n"
                        "Please report this as a bug."));
   if (!cell)
@@ -1343,7 +1392,8 @@ TextCell *wxMaxima::DoRawConsoleAppend(wxString s, CellType type, AppendOpt opts
       if(s.IsEmpty())
       {
         incompleteTextCell->GetGroup()->ResetSize();
-        incompleteTextCell->GetGroup()->Recalculate();
+        if (!m_headless)
+          incompleteTextCell->GetGroup()->Recalculate();
         return incompleteTextCell;
       }
     }
@@ -1433,7 +1483,8 @@ void wxMaxima::StripLispComments(wxString &s)
     m_blankStatementRegEx.Replace(&s, wxT(";"));
 }
 
-void wxMaxima::SendMaxima(wxString s, bool addToHistory)
+void wxMaxima::SendMaxima(wxString s, bool addToHistory,
+                          long commandId, long previousCommandId)
 {
   // Normally we catch parenthesis errors before adding cells to the
   // evaluation queue. But if the error is introduced only after the
@@ -1507,6 +1558,15 @@ void wxMaxima::SendMaxima(wxString s, bool addToHistory)
       else
         StatusMaximaBusy(waiting);
 
+      if (commandId >= 0)
+      {
+        // If maxima has to skip this command it reads everything up to the
+        // line with the wx-end-command.
+        s = wxString::Format(wxT(":lisp-quiet (wx-begin-command %li %li)\n"),
+                             commandId, previousCommandId) + s +
+          wxString::Format(wxT(":lisp-quiet (wx-end-command %li)\n"), commandId);
+      }
+
       wxScopedCharBuffer const data_raw = s.utf8_str();
 #ifdef __WXMSW__
       // On MS Windows we don't get a signal that tells us if a write has
@@ -1566,36 +1626,23 @@ void wxMaxima::TryToReadDataFromMaxima()
   // data and before we had been able to process it.
   if(m_client == NULL)
     return;
-  if(m_clientStream == NULL)
-    return;
   if(!m_client->IsConnected())
     return;
   if(!m_client->IsData())
     return;
-  if(m_clientTextStream == NULL)
-    return;
   m_statusBar->NetworkStatus(StatusBar::receive);
 
-  // Read all new lines of text we received.
-  wxChar chr;
-
-  int newBytes = 0;
-  while((m_client->IsConnected()) && (m_client->IsData()) && (m_clientStream != NULL) &&
-        (!m_clientStream->Eof()))
+  // Read everything maxima has sent us so far in big blocks and convert it to
+  // text in one go. Stop after a few megabytes so the GUI stays responsive
+  // during a big data transfer.
+  size_t const maxBytesPerCall = 4 * 1024 * 1024;
+  size_t newBytes = m_clientReadBuffer.ReadFrom(*m_client, maxBytesPerCall);
+  m_clientReadBuffer.DecodeTo(m_newCharsFromMaxima);
+  if(newBytes >= maxBytesPerCall)
   {
-    chr = m_clientTextStream->GetChar();
-    if(chr == wxEOT)
-      break;
-    if(chr != '\0')
-      m_newCharsFromMaxima += chr;
-    // Trigger the gui every few kilobytes so it stays responsible during
-    // a big data transfer
-    if(newBytes++>100000)
-    {
-      // Make sure that the idle loop is triggered that causes more data to be read
-      CallAfter(&wxWakeUpIdle);
-      return;
-    }
+    // Make sure that the idle loop is triggered that causes more data to be read
+    CallAfter(&wxWakeUpIdle);
+    return;
   }
 
   if(m_pipeToStdout)
@@ -1693,6 +1740,8 @@ void wxMaxima::OnMaximaConnect()
   m_statusBar->NetworkStatus(StatusBar::idle);
   m_worksheet->QuestionAnswered();
   m_currentOutput = wxEmptyString;
+  m_outputScanner.Reset();
+  CancelMathParseJob();
     
   m_client.reset(m_server->Accept(false));
   if(!m_client)
@@ -1710,8 +1759,7 @@ void wxMaxima::OnMaximaConnect()
   else
   {
     wxLogMessage(_("Connected."));
-    m_clientStream.reset(new wxSocketInputStream(*m_client));
-    m_clientTextStream.reset(new wxTextInputStream(*m_clientStream, wxT('\t'), wxConvUTF8));
+    m_clientReadBuffer.Clear();
     m_client->SetEventHandler(*GetEventHandler());
     m_client->SetNotify(wxSOCKET_INPUT_FLAG|wxSOCKET_OUTPUT_FLAG|wxSOCKET_LOST_FLAG|wxSOCKET_CONNECTION_FLAG);
     m_client->Notify(true);
@@ -2034,9 +2082,12 @@ void wxMaxima::KillMaxima(bool logMessage)
   m_configCommands = wxEmptyString;
   // The new maxima process will be in its initial condition => mark it as such.
   m_hasEvaluatedCells = false;
+  // Maxima still exists => we can still find out what the aborted cell has cost.
+  FinishProfiling();
 
   m_worksheet->SetWorkingGroup(nullptr);
   m_worksheet->m_evaluationQueue.Clear();
+  m_pipeline.clear();
   EvaluationQueueLength(0);
 
   // We start checking for maximas output again as soon as we send some data to the program.
@@ -2044,6 +2095,8 @@ void wxMaxima::KillMaxima(bool logMessage)
   m_CWD = wxEmptyString;
   m_worksheet->QuestionAnswered();
   m_currentOutput = wxEmptyString;
+  m_outputScanner.Reset();
+  CancelMathParseJob();
   // If we did close maxima by hand we already might have a new process
   // and therefore invalidate the wrong process in this step
   if (m_process)
@@ -2052,8 +2105,7 @@ void wxMaxima::KillMaxima(bool logMessage)
   m_maximaStdout = NULL;
   m_maximaStderr = NULL;
 
-  m_clientTextStream = NULL;
-  m_clientStream = NULL;
+  m_clientReadBuffer.Clear();
 
   if(m_client && (m_client->IsConnected()))
   {
@@ -2248,79 +2300,52 @@ void wxMaxima::ReadFirstPrompt(wxString &data)
         m_worksheet->OpenNextOrCreateCell();
     }
     if (m_exitAfterEval && m_worksheet->m_evaluationQueue.Empty())
+    {
+      if (m_headless)
+        SaveHeadless();
       Close();
+    }
   }
   else
     TriggerEvaluation();
 }
 
-int wxMaxima::GetMiscTextEnd(const wxString &data)
-{
-  // These tests are redundant with later tests. But they are faster.
-  if(data.StartsWith(m_mathPrefix1) || (data.StartsWith(m_mathPrefix2)))
-    return 0;
-//  if(data.StartsWith(m_outputPromptPrefix))
-//    return 0;
-  if(data.StartsWith(m_statusbarPrefix))
-    return 0;
-  if(data.StartsWith(m_promptPrefix))
-    return 0;
-  if(data.StartsWith(m_symbolsPrefix))
-    return 0;
-  if(data.StartsWith(m_variablesPrefix))
-    return 0;
-  if(data.StartsWith(m_addVariablesPrefix))
-    return 0;
-  if(data.StartsWith(m_suppressOutputPrefix))
-    return 0;
-
-  int mthpos = wxMax(data.Find(m_mathPrefix1), data.Find(m_mathPrefix2));
-//  int lblpos = data.Find(m_outputPromptPrefix);
-  int statpos = data.Find(m_statusbarPrefix);
-  int prmptpos = data.Find(m_promptPrefix);
-  int symbolspos = data.Find(m_symbolsPrefix);
-  int suppressOutputPos = data.Find(m_suppressOutputPrefix);
-  int variablespos = data.Find(m_variablesPrefix);
-  int addvariablespos = data.Find(m_addVariablesPrefix);
-
-  int tagPos = data.Length();
-  if ((mthpos != wxNOT_FOUND) && (mthpos < tagPos))
-    tagPos = mthpos;
-//  if ((tagPos == wxNOT_FOUND) || ((lblpos != wxNOT_FOUND) && (lblpos < tagPos)))
-//    tagPos = lblpos;
-  if ((tagPos == wxNOT_FOUND) || ((statpos != wxNOT_FOUND) && (statpos < tagPos)))
-    tagPos = statpos;
-  if ((tagPos == wxNOT_FOUND) || ((prmptpos != wxNOT_FOUND) && (prmptpos < tagPos)))
-    tagPos = prmptpos;
-  if ((tagPos == wxNOT_FOUND) || ((prmptpos != wxNOT_FOUND) && (prmptpos < tagPos)))
-    tagPos = prmptpos;
-  if ((tagPos == wxNOT_FOUND) || ((symbolspos != wxNOT_FOUND) && (symbolspos < tagPos)))
-    tagPos = symbolspos;
-  if ((tagPos == wxNOT_FOUND) || ((variablespos != wxNOT_FOUND) && (variablespos < tagPos)))
-    tagPos = variablespos;
-  if ((tagPos == wxNOT_FOUND) || ((addvariablespos != wxNOT_FOUND) && (addvariablespos < tagPos)))
-    tagPos = addvariablespos;
-  if ((tagPos == wxNOT_FOUND) || ((suppressOutputPos != wxNOT_FOUND) && (suppressOutputPos < tagPos)))
-    tagPos = suppressOutputPos;
-  return tagPos;
-}
-
-void wxMaxima::ReadMiscText(wxString &data)
+void wxMaxima::InitOutputScanner()
 {
-  if (data.IsEmpty())
-    return;
+  const struct
+  {
+    const wxString &prefix;
+    const wxString &suffix;
+    OutputReader reader;
+  } tags[] =
+    {
+      {m_mathPrefix1, m_mathSuffix1, &wxMaxima::ReadMath},
+      {m_promptPrefix, m_promptSuffix, &wxMaxima::ReadPrompt},
+      {m_mathPrefix2, m_mathSuffix2, &wxMaxima::ReadMath},
+      {m_symbolsPrefix, m_symbolsSuffix, &wxMaxima::ReadLoadSymbols},
+      {m_suppressOutputPrefix, m_suppressOutputSuffix, &wxMaxima::ReadSuppressedOutput},
+      {m_variablesPrefix, m_variablesSuffix, &wxMaxima::ReadVariables},
+      {m_addVariablesPrefix, m_addVariablesSuffix, &wxMaxima::ReadAddVariables},
+      {m_statusbarPrefix, m_statusbarSuffix, &wxMaxima::ReadStatusBar},
+      {m_commandStartPrefix, m_commandStartSuffix, &wxMaxima::ReadCommandStart},
+      {m_commandSkippedPrefix, m_commandSkippedSuffix, &wxMaxima::ReadCommandSkipped},
+      {MaximaIPC::Prefix(), MaximaIPC::Suffix(), &wxMaxima::ReadIPC}
+    };
+
+  for (const auto &tag : tags)
+  {
+    m_outputScanner.AddTag(tag.prefix, tag.suffix);
+    m_outputReaders.push_back(tag.reader);
+  }
+  m_ipcTag = m_outputReaders.size() - 1;
+}
 
-  // Extract all text that isn't a xml tag known to us.
-  int miscTextLen = GetMiscTextEnd(data);
-  if(miscTextLen <= 0)
-  {
-    if (!data.empty())
-      m_worksheet->SetCurrentTextCell(nullptr);
+void wxMaxima::ReadMiscText(const wxString &data)
+{
+  if (data.IsEmpty())
     return;
-  }
 
-  wxString miscText = data.Left(miscTextLen);
-  data = data.Right(data.Length() - miscTextLen);
+  wxString miscText = data;
 
   if(miscText == "\r")
     return;
@@ -2415,17 +2440,11 @@ void wxMaxima::ReadMiscText(wxString &data)
   }
   if (miscText.EndsWith("\n"))
     m_worksheet->SetCurrentTextCell(nullptr);
-
-  if (!data.empty())
-    m_worksheet->SetCurrentTextCell(nullptr);
 }
 
 int wxMaxima::FindTagEnd(const wxString &data, const wxString &tag)
 {
-  if((m_currentOutputEnd.IsEmpty()) || (m_currentOutputEnd.Find(tag) != wxNOT_FOUND))
-    return data.Find(tag);
-  else
-    return wxNOT_FOUND;
+  return data.Find(tag);
 }
 
 void wxMaxima::ReadStatusBar(wxString &data)
@@ -2506,6 +2525,83 @@ void wxMaxima::ReadSuppressedOutput(wxString &data)
   }
 }
 
+void wxMaxima::ReadCommandStart(wxString &data)
+{
+  if (!data.StartsWith(m_commandStartPrefix))
+    return;
+  int end = FindTagEnd(data, m_commandStartSuffix);
+  if (end == wxNOT_FOUND)
+    return;
+  long id = -1;
+  data.SubString(m_commandStartPrefix.Length(), end - 1).ToLong(&id);
+  data = data.Right(data.Length() - end - m_commandStartSuffix.Length());
+
+  // The command maxima has started might have been removed from the queue
+  // in the meantime. In this case it belongs to no cell.
+  if (m_pipeline.empty() || (m_pipeline.front().m_id != id) ||
+      m_pipeline.front().m_started)
+    return;
+  PipelinedCommand &cmd = m_pipeline.front();
+  cmd.m_started = true;
+
+  EvaluationQueue &queue = m_worksheet->m_evaluationQueue;
+  // If all commands from the last cell have been evaluated the queue has to
+  // switch to the next cell, first.
+  if (queue.GetCommand().IsEmpty())
+    queue.RemoveFirst();
+  GroupCell *const cell = queue.GetCell();
+  if ((!cell) || (cell != cmd.m_group.get()))
+  {
+    // Maxima evaluates this command anyway. Its output goes to its cell, if
+    // that still exists, and it must neither be sent again nor be removed from
+    // the evaluation queue once it is finished.
+    wxLogMessage(_("The evaluation queue has changed after sending commands to maxima in advance."));
+    cmd.m_orphaned = true;
+    m_worksheet->SetWorkingGroup(cmd.m_group.get());
+    return;
+  }
+
+  // PeekCommand() has already added the missing semicolon to the command we
+  // have sent. The cell gets it now that it is the current one, as in
+  // TriggerEvaluation().
+  if (queue.m_workingGroupChanged && cell->AddEnding())
+    queue.AddEnding();
+  if (queue.m_workingGroupChanged)
+    PrepareCellForEvaluation(cell);
+  // Determines the label the user has assigned to the command
+  queue.GetCommand();
+  m_commandIndex = queue.GetIndex();
+  SetEvaluatedCell(cell);
+  StatusMaximaBusy(calculating);
+  EvaluationQueueLength(queue.Size(), queue.CommandsLeftInCell());
+}
+
+void wxMaxima::ReadCommandSkipped(wxString &data)
+{
+  if (!data.StartsWith(m_commandSkippedPrefix))
+    return;
+  int end = FindTagEnd(data, m_commandSkippedSuffix);
+  if (end == wxNOT_FOUND)
+    return;
+  long id = -1;
+  data.SubString(m_commandSkippedPrefix.Length(), end - 1).ToLong(&id);
+  data = data.Right(data.Length() - end - m_commandSkippedSuffix.Length());
+
+  auto skipped = std::find_if(m_pipeline.begin(), m_pipeline.end(),
+                              [id](const PipelinedCommand &cmd){return cmd.m_id == id;});
+  if (skipped == m_pipeline.end())
+    return;
+
+  // Maxima skips this command and all commands we have sent after it. The
+  // ones that still are in the evaluation queue are sent again.
+  m_pipeline.erase(skipped, m_pipeline.end());
+  if (m_pipeline.empty())
+  {
+    m_maximaBusy = false;
+    TriggerEvaluation();
+  }
+}
+
 void wxMaxima::ReadLoadSymbols(wxString &data)
 {
   if (!data.StartsWith(m_symbolsPrefix))
@@ -2543,6 +2639,9 @@ void wxMaxima::ReadVariables(wxString &data)
     wxXmlNode *node = xmldoc.GetRoot();
     if(node != NULL)
     {
+      // A reply to a query for all watched variables might contain hundreds of
+      // them => repaint the variables pane only once.
+      m_worksheet->m_variablesPane->BeginBatch();
       wxXmlNode *vars = node->GetChildren();
       while (vars != NULL)
       {
@@ -2569,7 +2668,11 @@ void wxMaxima::ReadVariables(wxString &data)
               value = valnode->GetContent();
             }
           }
+          var = var->GetNext();
+        }
 
+        if(!name.IsEmpty())
+        {
           if(bound)
           {
             if(name == "maxima_userdir")
@@ -2640,15 +2743,14 @@ void wxMaxima::ReadVariables(wxString &data)
           }
           else
             m_worksheet->m_variablesPane->VariableUndefined(name);
-
-          var = var->GetNext();
         }
         vars = vars->GetNext();
       }
+      m_worksheet->m_variablesPane->EndBatch();
     }
 
     if(num>1)
-      wxLogMessage(_("Maxima sends a new set of auto-completable symbols."));
+      wxLogMessage(wxString::Format(_("Maxima has sent the values of %i variables."), num));
     else
       wxLogMessage(_("Maxima has sent a new variable value."));
 
@@ -2708,9 +2810,14 @@ bool wxMaxima::QueryVariableValue()
 
   if(m_varNamesToQuery.GetCount() > 0)
   {
-    SendMaxima(wxT(":lisp-quiet (wx-query-variable \"") +
-               m_varNamesToQuery.Last()+wxT("\")\n"));
-    m_varNamesToQuery.RemoveAt(m_varNamesToQuery.GetCount()-1);
+    // Ask for all variables at once: Maxima answers with a single <variables> tag.
+    wxString command = wxT(":lisp-quiet (wx-query-variables '(");
+    for (const auto &name : m_varNamesToQuery)
+      command += wxT("\"") + name + wxT("\" ");
+    command.Trim();
+    command += wxT("))\n");
+    SendMaxima(command);
+    m_varNamesToQuery.Clear();
     return true;
   }
   else
@@ -2726,7 +2833,6 @@ bool wxMaxima::QueryVariableValue()
  */
 void wxMaxima::ReadPrompt(wxString &data)
 {
-  m_evalOnStartup = false;
   if (!data.StartsWith(m_promptPrefix))
     return;
 
@@ -2746,8 +2852,6 @@ void wxMaxima::ReadPrompt(wxString &data)
   wxString o = data.SubString(m_promptPrefix.Length(), end - 1);
   // Remove the prompt we will process from the string.
   data = data.Right(data.Length()-end-m_promptSuffix.Length());
-  if(data == wxT(" "))
-    data = wxEmptyString;
 
   // If we got a prompt our connection to maxima was successful.
   if(m_unsuccessfulConnectionAttempts > 0)
@@ -2776,8 +2880,19 @@ void wxMaxima::ReadPrompt(wxString &data)
   {
     // Maxima displayed a new main prompt => We don't have a question
     m_worksheet->QuestionAnswered();
-    // And we can remove one command from the evaluation queue.
-    m_worksheet->m_evaluationQueue.RemoveFirst();
+    // And we can remove one command from the evaluation queue - unless the
+    // command maxima has finished had left the queue before.
+    if (m_pipeline.empty() ||
+        (!m_pipeline.front().m_orphaned &&
+         (m_pipeline.front().m_group.get() == m_worksheet->m_evaluationQueue.GetCell())))
+      m_worksheet->m_evaluationQueue.RemoveFirst();
+    if (!m_pipeline.empty())
+      m_pipeline.pop_front();
+    // If maxima already has got the next command we only can send more
+    // commands in advance. This is true even if the queue is empty now:
+    // Maxima still has to evaluate the commands that have left it.
+    if (!m_pipeline.empty())
+      m_maximaBusy = true;
 
     //m_lastPrompt = o.Mid(1,o.Length()-1);
     //m_lastPrompt.Replace(wxT(")"), wxT(":"), false);
@@ -2801,7 +2916,10 @@ void wxMaxima::ReadPrompt(wxString &data)
       m_worksheet->FollowEvaluation(false);
       if (m_exitAfterEval)
       {
-        SaveFile(false);
+        if (m_headless)
+          SaveHeadless();
+        else
+          SaveFile(false);
         Close();
       }
       // Inform the user that the evaluation queue is empty.
@@ -2832,7 +2950,28 @@ void wxMaxima::ReadPrompt(wxString &data)
   }
   else
   {  // We have a question
+    if (m_pipeline.size() > 1)
+    {
+      wxLogMessage(_("Maxima asks a question after we have sent it more commands: "
+                     "It might read one of them as the answer."));
+      m_pipeline.erase(m_pipeline.begin() + 1, m_pipeline.end());
+    }
     m_worksheet->SetLastQuestion(o);
+    if (m_headless)
+    {
+      // Nobody can answer the question => only continue if the cell knows the answer.
+      GroupCell *group = m_worksheet->GetWorkingGroup();
+      if ((!group) || (!group->AutoAnswer()) || group->GetAnswer(o).IsEmpty())
+      {
+        m_headlessError = wxString::Format(
+          _("Maxima has asked a question no answer is known for: %s"), o);
+        wxLogMessage(m_headlessError);
+        m_exitCode = -1;
+        SaveHeadless();
+        Close();
+        return;
+      }
+    }
     m_worksheet->QuestionAnswered();
     m_worksheet->QuestionPending(true);
     // If the user answers a question additional output might be required even
@@ -2853,7 +2992,7 @@ void wxMaxima::ReadPrompt(wxString &data)
       else
         DoRawConsoleAppend(o, MC_TYPE_PROMPT, AppendOpt(options));
   }
-    if (m_worksheet->ScrolledAwayFromEvaluation())
+    if (m_worksheet->ScrolledAwayFromEvaluation() && !m_headless)
     {
       if (m_worksheet->m_mainToolBar)
         m_worksheet->m_mainToolBar->EnableTool(ToolBar::tb_follow, true);
@@ -3946,119 +4085,20 @@ void wxMaxima::CompileHelpFileAnchors()
     m_worksheet->m_helpFileAnchors["with_slider_draw3d"] = "draw3d";
     m_worksheet->m_helpFileAnchorsUsable = true;
 
-    int foundAnchors = 0;
     wxLogMessage(_("Compiling the list of anchors the maxima manual provides"));
-    wxRegEx idExtractor(".*<span id=\\\"([a-zAZ0-9_-]*)\\\"");
-    wxRegEx idExtractor_oldManual(".*<a name=\\\"([a-zAZ0-9_-]*)\\\"");
-    wxString escapeChars = "<=>[]`%?;\\$%&+-*/.!\'@#:^_";
-    if(wxFileExists(MaximaHelpFile))
-    {
-      wxFileInputStream input(MaximaHelpFile);
-      if(input.IsOk())
-      {
-        wxTextInputStream text(input, wxT('\t'), wxConvAuto(wxFONTENCODING_UTF8));
-        while(input.IsOk() && !input.Eof())
-        {
-          wxString line = text.ReadLine();
-          wxStringTokenizer tokens(line, wxT(">"));
-          while(tokens.HasMoreTokens())
-          {
-            wxString token = tokens.GetNextToken();
-            wxString oldToken(token);
-            wxString id;
-            if(idExtractor.Replace(&token, "\\1")>0)
-              id = token;
-            else
-            {
-              if(idExtractor_oldManual.Replace(&token, "\\1")>0)
-                id = token;
-            }
-            if(!id.IsEmpty())
-            {
-              // In anchors a space is represented by a hyphen
-              token.Replace("-", " ");
-              // Some other chars including the minus are represented by "_00xx"
-              // where xx is being the ascii code of the char.
-              for(auto it = escapeChars.begin(); it != escapeChars.end(); ++it)
-                token.Replace(wxString::Format("_00%x",(char)*it), *it);
-              // What the g_t means I don't know. But we don't need it
-              if(token.StartsWith("g_t"))
-                token = token.Right(token.Length()-3);
-              //! Tokens that end with "-1" aren't too useful, normally.
-              if((!token.EndsWith("-1")) && (!token.Contains(" ")))
-              {
-                m_worksheet->m_helpFileAnchors[token] = id;
-                foundAnchors++;
-              }
-            }
-          }
-        }
-      }
-    }
+    if(!m_manualIndex.Scan(MaximaHelpFile))
+      wxLogMessage(wxString::Format(_("Cannot read the manual %s."), MaximaHelpFile.utf8_str()));
+    int foundAnchors = m_manualIndex.GetKeywords().size();
+    for (const auto &keyword : m_manualIndex.GetKeywords())
+      m_worksheet->m_helpFileAnchors[keyword.first] = keyword.second;
     if(m_worksheet->m_helpFileAnchors["%solve"].IsEmpty())
       m_worksheet->m_helpFileAnchors["%solve"] = m_worksheet->m_helpFileAnchors["to_poly_solve"];
     
     wxLogMessage(wxString::Format(_("Found %i anchors."), foundAnchors));
-    wxXmlAttribute *maximaVersion = new wxXmlAttribute(
-      wxT("maxima_version"),
-      m_maximaVersion);
-    wxXmlNode *topNode = new wxXmlNode(
-      NULL,
-      wxXML_DOCUMENT_NODE, wxEmptyString,
-      wxEmptyString
-      );
-    wxXmlNode *headNode = new wxXmlNode(
-      topNode,
-      wxXML_ELEMENT_NODE, wxT("maxima_toc"),
-      wxEmptyString,
-      maximaVersion
-      );
-    
-    wxLogMessage(wxString::Format(_("Found %i anchors."), foundAnchors));
-
-    Worksheet::HelpFileAnchors::const_iterator it;
-    for (it = m_worksheet->m_helpFileAnchors.begin(); it != m_worksheet->m_helpFileAnchors.end(); ++it)
-    {
-      wxXmlNode *manualEntry =
-        new wxXmlNode(
-          headNode,
-          wxXML_ELEMENT_NODE,
-          "entry");
-      wxXmlNode *anchorNode = new wxXmlNode(
-        manualEntry,
-        wxXML_ELEMENT_NODE,
-        "anchor");
-      new wxXmlNode(
-        anchorNode,
-        wxXML_TEXT_NODE,
-        wxEmptyString,
-        it->second);
-      wxXmlNode *keyNode = new wxXmlNode(
-        manualEntry,
-        wxXML_ELEMENT_NODE,
-        "key");
-      new wxXmlNode(
-        keyNode,
-        wxXML_TEXT_NODE,
-        wxEmptyString,
-        it->first);
-    }
-    wxXmlDocument xmlDoc;
-    xmlDoc.SetDocumentNode(topNode);
-    wxXmlNode *commentNode = new wxXmlNode(
-        NULL,
-        wxXML_COMMENT_NODE,
-        wxEmptyString,
-        _("This file is generated by wxMaxima\n"
-          "It caches the list of subjects maxima's manual offers and is automatically\n"
-          "overwritten if maxima's version changes or the file cannot be read"));
-
-    xmlDoc.AppendToProlog(commentNode);
-
-    wxString saveName = Dirstructure::AnchorsCacheFile();
-    wxLogMessage(wxString::Format(_("Trying to cache the list of subjects the manual contains in the file %s."),
-                                  saveName.utf8_str()));
-    xmlDoc.Save(saveName);
+    SaveManualAnchorsToCache();
+    if(!m_manualIndex.Save(Dirstructure::ManualIndexFile(), m_maximaVersion))
+      wxLogMessage(wxString::Format(_("Cannot write the full-text index of the manual to %s."),
+                                    Dirstructure::ManualIndexFile().utf8_str()));
   }
   #ifdef HAVE_OMP_HEADER
   omp_unset_lock(&m_helpFileAnchorsLock);
@@ -4066,6 +4106,43 @@ void wxMaxima::CompileHelpFileAnchors()
 }
 
 
+void wxMaxima::SaveManualAnchorsToCache()
+{
+  // Writing the file directly is much faster than building a wxXmlDocument first.
+  wxString xml = wxT("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+  xml += wxT("<!--") +
+    wxString(_("This file is generated by wxMaxima\n"
+               "It caches the list of subjects maxima's manual offers and is automatically\n"
+               "overwritten if maxima's version changes or the file cannot be read")) +
+    wxT("-->\n");
+  xml += wxT("<maxima_toc maxima_version=\"") + Cell::XMLescape(m_maximaVersion) + wxT("\">\n");
+  for (const auto &anchor : m_worksheet->m_helpFileAnchors)
+    if(!anchor.second.IsEmpty())
+      xml += wxT("  <entry><anchor>") + Cell::XMLescape(anchor.second) +
+        wxT("</anchor><key>") + Cell::XMLescape(anchor.first) + wxT("</key></entry>\n");
+  xml += wxT("</maxima_toc>\n");
+
+  wxString saveName = Dirstructure::AnchorsCacheFile();
+  wxLogMessage(wxString::Format(_("Trying to cache the list of subjects the manual contains in the file %s."),
+                                saveName.utf8_str()));
+  // Another wxMaxima process might read or write the cache at the same time
+  // => each process writes to a file of its own and renames it.
+  wxString tempFile = wxFileName::CreateTempFileName(saveName);
+  if (tempFile.IsEmpty())
+    return;
+  bool written;
+  {
+    wxFFile file(tempFile, wxT("wb"));
+    written = file.IsOpened() && file.Write(xml, wxConvUTF8) && file.Close();
+  }
+  if (!written || !wxRenameFile(tempFile, saveName, true))
+  {
+    wxRemoveFile(tempFile);
+    wxLogMessage(wxString::Format(_("Cannot write the list of subjects the manual contains to %s."),
+                                  saveName.utf8_str()));
+  }
+}
+
 bool wxMaxima::LoadManualAnchorsFromCache()
 {
   SuppressErrorDialogs suppressor;
@@ -4075,6 +4152,12 @@ bool wxMaxima::LoadManualAnchorsFromCache()
     wxLogMessage(_("No file with the subjects the manual contained in the last wxMaxima run."));
     return false;
   }
+  // Without the full-text index the manual has to be scanned again, anyway.
+  if(!wxFileExists(Dirstructure::ManualIndexFile()))
+  {
+    wxLogMessage(_("No full-text index of the manual from the last wxMaxima run."));
+    return false;
+  }
   wxXmlDocument xmlDocument(anchorsFile);
   if(!xmlDocument.IsOk())
   {
@@ -4136,6 +4219,26 @@ bool wxMaxima::LoadManualAnchorsFromCache()
   return done;
 }
 
+std::vector<ManualIndex::Section> wxMaxima::SearchManual(const wxString &query)
+{
+  #ifdef HAVE_OMP_HEADER
+  omp_set_lock(&m_helpFileAnchorsLock);
+  #endif
+  // If the anchors have been read from the cache the full-text index still
+  // needs to be read.
+  if(m_manualIndex.IsEmpty())
+  {
+    SuppressErrorDialogs suppressor;
+    if(!m_manualIndex.Load(Dirstructure::ManualIndexFile(), m_maximaVersion))
+      wxLogMessage(_("Cannot read the full-text index of the manual."));
+  }
+  std::vector<ManualIndex::Section> hits = m_manualIndex.Search(query);
+  #ifdef HAVE_OMP_HEADER
+  omp_unset_lock(&m_helpFileAnchorsLock);
+  #endif
+  return hits;
+}
+
 void wxMaxima::ShowMaximaHelp(wxString keyword)
 {
   if(keyword.StartsWith("(%i"))
@@ -4148,9 +4251,29 @@ void wxMaxima::ShowMaximaHelp(wxString keyword)
   MaximaHelpFile.Replace("\\", "/", true);
 #endif
   
-  wxBusyCursor crs;
-  CompileHelpFileAnchors();
-  keyword = m_worksheet->m_helpFileAnchors[keyword];
+  {
+    wxBusyCursor crs;
+    CompileHelpFileAnchors();
+  }
+  wxString anchor = m_worksheet->m_helpFileAnchors[keyword];
+  if(anchor.IsEmpty() && !keyword.IsEmpty())
+  {
+    // The manual has no entry for this keyword => offer the sections that mention it
+    std::vector<ManualIndex::Section> hits = SearchManual(keyword);
+    if(!hits.empty())
+    {
+      wxArrayString titles;
+      for (const auto &hit : hits)
+        titles.Add(hit.m_title);
+      int choice = wxGetSingleChoiceIndex(
+        wxString::Format(_("The manual has no entry for \"%s\". Sections that mention it:"), keyword),
+        _("Maxima help"), titles, this);
+      if(choice < 0)
+        return;
+      anchor = hits[choice].m_id;
+    }
+  }
+  keyword = anchor;
   if(keyword.IsEmpty())
     keyword = "Function-and-Variable-Index";
   if(!MaximaHelpFile.IsEmpty())
@@ -4185,15 +4308,12 @@ bool wxMaxima::InterpretDataFromMaxima()
 
   if ((m_xmlInspector) && (IsPaneDisplayed(menu_pane_xmlInspector)))
     m_xmlInspector->Add_FromMaxima(m_newCharsFromMaxima);
-  // This way we can avoid searching the whole string for a
-  // ending tag if we have received only a few bytes of the
-  // data between 2 tags
-  m_currentOutputEnd = m_currentOutput.Right(30) + m_newCharsFromMaxima;
+
+  if (m_profiler.IsRunning())
+    m_profiler.AddOutput(m_newCharsFromMaxima.utf8_str().length());
 
   m_currentOutput += m_newCharsFromMaxima;
   m_newCharsFromMaxima = wxEmptyString;
-  if ((m_xmlInspector) && (IsPaneDisplayed(menu_pane_xmlInspector)))
-    m_xmlInspector->Add_FromMaxima(m_newCharsFromMaxima);
 
   if (!m_dispReadOut &&
       (m_currentOutput != wxT("\n")) &&
@@ -4203,68 +4323,101 @@ bool wxMaxima::InterpretDataFromMaxima()
     m_dispReadOut = true;
   }
 
-  size_t length_old = 0;
+  InterpretCurrentOutput();
+  return true;
+}
 
-  while (length_old != m_currentOutput.Length())
-  {
-    if (m_currentOutput.StartsWith("\n<"))
-      m_currentOutput = m_currentOutput.Right(m_currentOutput.Length() - 1);
+void wxMaxima::InterpretCurrentOutput()
+{
+  // Output that arrives while a background task converts math to cells
+  // has to wait until these cells are in the worksheet
+  if (m_mathParseJob)
+    return;
 
-    length_old = m_currentOutput.Length();
+  if (m_first)
+  {
+    // This function determines the port maxima is running on from  the text
+    // maxima outputs at startup. This piece of text is afterwards discarded.
+    ReadFirstPrompt(m_currentOutput);
+    if (m_first)
+      return;
+  }
+  m_evalOnStartup = false;
 
-    GroupCell *oldActiveCell = NULL;
-    GroupCell *newActiveCell = NULL;
+  // Walk through the output with a read cursor and hand each complete tag and
+  // each piece of text between the tags to the function that interprets it.
+  // Only the part of the output we have interpreted is removed at the end which
+  // means that we don't need to copy the rest of the data after each tag.
+  m_outputScanner.EnableTag(m_ipcTag, MaximaIPC::IsEnabled());
+  size_t pos = 0;
+  while (pos < m_currentOutput.Length())
+  {
+    if ((m_currentOutput[pos] == wxT('\n')) && (pos + 1 < m_currentOutput.Length()) &&
+        (m_currentOutput[pos + 1] == wxT('<')))
+      pos++;
 
-    // Handle text that isn't wrapped in a known tag
-    if (!m_first)
+    std::size_t tag = m_outputScanner.TagAt(m_currentOutput, pos);
+    if (tag == MaximaOutputScanner::NoTag)
     {
-      // First read the prompt that tells us that maxima awaits the next command:
-      // If that is the case ReadPrompt() sends the next command to maxima and
-      // maxima can work while we interpret its output.
-      oldActiveCell = m_worksheet->GetWorkingGroup();
-      ReadPrompt(m_currentOutput);
-      newActiveCell = m_worksheet->GetWorkingGroup();
-
-      // Temporarily switch to the WorkingGroup the output we don't have interpreted yet
-      // was for
-      if (newActiveCell != oldActiveCell)
-        m_worksheet->SetWorkingGroup(oldActiveCell);
-      // Handle the <mth> tag that contains math output and sometimes text.
-      ReadMath(m_currentOutput);
-
-      // The following function calls each extract and remove one type of XML tag
-      // information from the beginning of the data string we got - but only do so
-      // after the closing tag has been transferred, as well.
-      ReadLoadSymbols(m_currentOutput);
+      // Handle text that isn't XML output: Mostly Error messages or warnings.
+      size_t miscTextEnd = m_outputScanner.MiscTextEnd(m_currentOutput, pos);
+      ReadMiscText(m_currentOutput.Mid(pos, miscTextEnd - pos));
+      pos = miscTextEnd;
+      if (pos < m_currentOutput.Length())
+        m_worksheet->SetCurrentTextCell(nullptr);
+      continue;
+    }
 
-      // Discard startup warnings
-      ReadSuppressedOutput(m_currentOutput);
+    m_worksheet->SetCurrentTextCell(nullptr);
 
-      // Let's see if maxima informs us about the values of variables
-      ReadVariables(m_currentOutput);
+    // Only interpret a tag after its closing tag has been transferred, as well.
+    size_t end = m_outputScanner.TagEnd(m_currentOutput, pos, tag);
+    if (end == wxString::npos)
+      break;
 
-      // Let's see if maxima tells us to add new symbols to the watchlist
-      ReadAddVariables(m_currentOutput);
+    wxString tagData = m_currentOutput.Mid(pos, end - pos);
+    pos = end;
+    OutputReader reader = m_outputReaders[tag];
+    (this->*reader)(tagData);
 
-      // Handle the XML tag that contains Status bar updates
-      ReadStatusBar(m_currentOutput);
+    // Maxima follows its prompt by a space we don't want to see in the worksheet
+    if ((reader == &wxMaxima::ReadPrompt) && (pos + 1 == m_currentOutput.Length()) &&
+        (m_currentOutput[pos] == wxT(' ')))
+      pos++;
 
-      // Handle the XML tag that contains the interprocess communication messages
-      m_ipc.ReadInputData(m_currentOutput);
+    // Math that is converted to cells in the background has to appear in the
+    // worksheet before anything that follows it.
+    if (m_mathParseJob)
+      break;
+  }
+  m_currentOutput.erase(0, wxMin(pos, m_currentOutput.Length()));
+}
 
-      // Handle text that isn't XML output: Mostly Error messages or warnings.
-      ReadMiscText(m_currentOutput);
-    }
-    else
-      // This function determines the port maxima is running on from  the text
-      // maxima outputs at startup. This piece of text is afterwards discarded.
-      ReadFirstPrompt(m_currentOutput);
+void wxMaxima::OnMathParsedInBackground()
+{
+  std::unique_ptr<MathParseJob> job = std::move(m_mathParseJob);
+  if (!job)
+    return;
 
-    // Switch to the WorkingGroup the next bunch of data is for.
-    if (newActiveCell != oldActiveCell)
-      m_worksheet->SetWorkingGroup(newActiveCell);
-  }
-  return true;
+  if (!job->m_cancelled)
+  {
+    // Put the output into the cell maxima was working on when it sent it.
+    GroupCell *workingGroup = m_worksheet->GetWorkingGroup();
+    bool const switchGroup = job->m_group && (job->m_group.get() != workingGroup);
+    if (switchGroup)
+      m_worksheet->SetWorkingGroup(job->m_group.get());
+    InsertParsedLine(std::move(job->m_cell), job->m_opts);
+    if (switchGroup)
+      m_worksheet->SetWorkingGroup(workingGroup);
+  }
+  job.reset();
+  // The background task isn't allowed to open message boxes => it leaves its
+  // warnings to us.
+  for (const auto &warning : m_backgroundParser.TakeWarnings())
+    LoggingMessageBox(warning, _("Warning"), wxOK | wxICON_WARNING);
+
+  // Interpret the output that has arrived in the meantime
+  InterpretCurrentOutput();
 }
 
 ///--------------------------------------------------------------------------------
@@ -4318,7 +4471,9 @@ void wxMaxima::OnIdle(wxIdleEvent &event)
 
   if(m_worksheet != NULL)
   {
-    bool requestMore = m_worksheet->RecalculateIfNeeded();
+    // Lay out the cells below the visible region bit by bit so we stay
+    // responsive even if the worksheet is long.
+    bool requestMore = m_worksheet->RecalculateIfNeeded(30);
     m_worksheet->ScrollToCellIfNeeded();
     m_worksheet->ScrollToCaretIfNeeded();
     if(requestMore)
@@ -4364,6 +4519,9 @@ void wxMaxima::OnIdle(wxIdleEvent &event)
     return;
   }
 
+  // Scale the images the user might scroll to next in the background.
+  m_worksheet->PrefetchImages();
+
   // If nothing which is visible has changed nothing that would cause us to need
   // update the menus and toolbars has.
   if (m_worksheet->UpdateControlsNeeded())
@@ -4932,11 +5090,50 @@ bool wxMaxima::OpenFile(const wxString &file, const wxString &command)
   return retval;
 }
 
+void wxMaxima::SaveHeadless()
+{
+  wxFileName file(m_worksheet->m_currentFile);
+  if (!file.IsOk() || file.GetName().IsEmpty())
+  {
+    m_headlessError = _("Headless evaluation: No file name to save the result to.");
+    wxLogMessage(m_headlessError);
+    m_exitCode = -1;
+    return;
+  }
+  file.SetExt(wxT("wxmx"));
+  WaitForAutoSave();
+  if (m_worksheet->ExportToWXMX(file.GetFullPath()))
+  {
+    m_headlessSaved = true;
+    wxLogMessage(_("Saved the evaluated worksheet to %s"), file.GetFullPath());
+  }
+  else
+  {
+    m_headlessError = wxString::Format(_("Cannot save the evaluated worksheet to %s"),
+                                       file.GetFullPath());
+    wxLogMessage(m_headlessError);
+    m_exitCode = -1;
+  }
+}
+
+wxString wxMaxima::HeadlessError() const
+{
+  if (!m_headlessError.IsEmpty())
+    return m_headlessError;
+  if (!m_headlessSaved)
+    return _("The window has been closed before the evaluation was finished");
+  return {};
+}
+
 bool wxMaxima::SaveFile(bool forceSave)
 {
   // Show a busy cursor as long as we export a file.
   wxBusyCursor crs;
 
+  // An autosave that finished after this save would replace the file with an
+  // older state of the worksheet.
+  WaitForAutoSave();
+
   wxString file = m_worksheet->m_currentFile;
   wxString fileExt = wxT("wxmx");
   int ext = 0;
@@ -5117,7 +5314,16 @@ bool wxMaxima::AbortOnError()
   // Maxima encountered an error.
   // The question is now if we want to try to send it something new to evaluate.
 
-  ExitAfterEval(false);
+  // A headless evaluation still has to save its result and to exit, but
+  // shouldn't report success.
+  if (m_headless)
+  {
+    m_exitCode = -1;
+    if (m_headlessError.IsEmpty())
+      m_headlessError = _("Maxima has issued an error");
+  }
+  else
+    ExitAfterEval(false);
   EvalOnStartup(false);
 
   if (m_worksheet->m_notificationMessage)
@@ -5128,7 +5334,8 @@ bool wxMaxima::AbortOnError()
     m_worksheet->m_notificationMessage->m_errorNotificationCell = m_worksheet->GetWorkingGroup(true);
   }
 
-  m_exitAfterEval = false;
+  if (!m_headless)
+    m_exitAfterEval = false;
   if(m_exitOnError)
   {
     wxMaxima::m_exitCode = -1;
@@ -5136,6 +5343,9 @@ bool wxMaxima::AbortOnError()
   }
   if (m_worksheet->m_configuration->GetAbortOnError())
   {
+    // Maxima will skip the commands we have sent in advance as the current one
+    // has failed.
+    m_pipeline.clear();
     m_worksheet->m_evaluationQueue.Clear();
     // Inform the user that the evaluation queue is empty.
     EvaluationQueueLength(0);
@@ -5154,36 +5364,11 @@ long long wxMaxima::GetTotalCpuTime()
   return (long long) systemtime.dwLowDateTime +
         ((long long) systemtime.dwHighDateTime << 32);
 #else
-  int CpuJiffies = 0;
-  if(wxFileExists("/proc/stat"))
-  {
-    wxFileInputStream input("/proc/stat");
-    if(input.IsOk())
-    {
-      wxTextInputStream text(input, wxT('\t'), wxConvAuto(wxFONTENCODING_UTF8));
-      wxString line;
-      while((!input.Eof()) && (!line.StartsWith("cpu ")))
-        line = text.ReadLine();
-
-      // Strip the "cpu" from the line
-      line = line.Right(line.Length() - 4);
-      line.Trim(false);
-      wxStringTokenizer tokens(line, wxT(" "));
-      for(auto i = 0; i < 3; i++)
-      {
-        if(tokens.HasMoreTokens())
-        {
-          long additionalJiffies;
-          if(!tokens.GetNextToken().ToLong(&additionalJiffies))
-            return -1;
-          CpuJiffies += additionalJiffies;
-        }
-        else
-          return -1;
-      }
-    }
-  }
-  return CpuJiffies;
+  // Milliseconds, which is the same unit GetMaximaCpuTime() uses
+  double cpuTime = ProcessStats::TotalCPUTime();
+  if(cpuTime < 0)
+    return -1;
+  return std::llround(cpuTime * 1000);
 #endif
 }
 
@@ -5205,49 +5390,16 @@ long long wxMaxima::GetMaximaCpuTime()
     }
   }
   #endif
-  int maximaJiffies = 0;
-  wxString statFileName = wxString::Format("/proc/%li/stat",m_pid);
-  if(wxFileExists(statFileName))
-  {
-    wxFileInputStream input(statFileName);
-    if(input.IsOk())
-    {
-      wxTextInputStream text(input, wxT('\t'), wxConvAuto(wxFONTENCODING_UTF8));
-      wxString line = text.ReadLine();
-
-      wxStringTokenizer tokens(line, wxT(" "));
-      for(auto i = 0; i < 13; i++)
-      {
-        if(tokens.HasMoreTokens())
-          tokens.GetNextToken();
-        else return -1;
-      }
-
-      for(auto i = 0; i < 4; i++)
-      {
-        {
-          if(tokens.HasMoreTokens())
-          {
-            long additionalJiffies;
-            if(!tokens.GetNextToken().ToLong(&additionalJiffies))
-            {
-              maximaJiffies = -1;
-              break;
-            }
-            maximaJiffies += additionalJiffies;
-          }
-          else return -1;
-        }
-      }
-    }
-  }
-  return maximaJiffies;
+  ProcessStats stats;
+  if(!stats.Read(m_pid) || (stats.m_userTime < 0) || (stats.m_systemTime < 0))
+    return -1;
+  return std::llround((stats.m_userTime + stats.m_systemTime + stats.m_childTime) * 1000);
 }
 
 double wxMaxima::GetMaximaCPUPercentage()
 {
 
-  int CpuJiffies = GetTotalCpuTime();
+  long long CpuJiffies = GetTotalCpuTime();
   if(CpuJiffies < 0)
     return -1;
 
@@ -5263,7 +5415,7 @@ double wxMaxima::GetMaximaCPUPercentage()
     return -1;
   }
 
-  int maximaJiffies = GetMaximaCpuTime();
+  long long maximaJiffies = GetMaximaCpuTime();
   if(maximaJiffies < 0)
     return -1;
 
@@ -5291,6 +5443,7 @@ void wxMaxima::OnTimerEvent(wxTimerEvent &event)
       break;
     case MAXIMA_STDOUT_POLL_ID:
       ReadStdErr();
+      m_profiler.Sample();
 
       if (m_process != NULL)
       {
@@ -5327,7 +5480,11 @@ bool wxMaxima::AutoSave()
 {
   if(!SaveNecessary())
     return true;
-  
+
+  // The last autosave is still writing its file => Try again next time.
+  if(m_autoSaveJob)
+    return true;
+
   bool savedWas = m_worksheet->IsSaved();
   wxString oldTempFile = m_tempfileName;
   wxString oldFilename = m_worksheet->m_currentFile;
@@ -5339,22 +5496,24 @@ bool wxMaxima::AutoSave()
   if (m_worksheet->m_configuration->AutoSaveAsTempFile() ||
       m_worksheet->m_currentFile.IsEmpty())
   {
-    bool saved = m_worksheet->ExportToWXMX(m_tempfileName);
-
     wxLogMessage(wxString::Format(_("Autosaving as temp file %s"), m_tempfileName.utf8_str()));
-    if((m_tempfileName != oldTempFile) && saved)
-    {
-      if(!oldTempFile.IsEmpty())
-      {
-        if(wxFileExists(oldTempFile))
-        {
-          SuppressErrorDialogs blocker;
-          wxLogMessage(wxString::Format(_("Trying to remove the old temp file %s"), oldTempFile.utf8_str()));
-          wxRemoveFile(oldTempFile);
-        }
-      }
-    }
-    RegisterAutoSaveFile();
+    std::shared_ptr<AutoSaveJob> job(new AutoSaveJob);
+    job->m_writer = m_worksheet->SnapshotWXMX(m_tempfileName);
+    job->m_tempFile = true;
+    job->m_oldTempFile = oldTempFile;
+    StartAutoSave(std::move(job));
+  }
+  else if (m_worksheet->m_currentFile.Lower().EndsWith(wxT(".wxmx")))
+  {
+    wxLogMessage(wxString::Format(_("Autosaving the .wxmx file as %s"),
+                                  m_worksheet->m_currentFile.utf8_str()));
+    StatusSaveStart();
+    std::shared_ptr<AutoSaveJob> job(new AutoSaveJob);
+    job->m_writer = m_worksheet->SnapshotWXMX(m_worksheet->m_currentFile);
+    // Changes that are made while the file is written will reset this flag.
+    // If writing the file fails OnAutoSaveDone() resets it, too.
+    savedWas = true;
+    StartAutoSave(std::move(job));
   }
   else
   {
@@ -5371,6 +5530,107 @@ bool wxMaxima::AutoSave()
   return savedWas;
 }
 
+bool wxMaxima::AutoSaveJob::Run()
+{
+  int expected = queued;
+  if (!m_state.compare_exchange_strong(expected, writing))
+    return false;
+  m_success = m_writer->Write();
+  m_state = done;
+  return true;
+}
+
+void wxMaxima::StartAutoSave(std::shared_ptr<AutoSaveJob> &&job)
+{
+  m_autoSaveJob = std::move(job);
+  // A save the user starts while we write the file mustn't use the same temp file.
+  wxString tempFile = wxFileName::CreateTempFileName(m_autoSaveJob->m_writer->GetFile() + wxT("~"));
+  if (!tempFile.IsEmpty())
+    m_autoSaveJob->m_writer->SetTempFile(tempFile);
+#ifdef HAVE_OPENMP_TASKS
+  std::shared_ptr<AutoSaveJob> runningJob = m_autoSaveJob;
+  // Compressing and writing the file doesn't need the GUI thread.
+  #pragma omp task firstprivate(runningJob)
+  {
+    if (runningJob->Run())
+      CallAfter(&wxMaxima::OnAutoSaveDone);
+  }
+#else
+  m_autoSaveJob->Run();
+  OnAutoSaveDone();
+#endif
+}
+
+void wxMaxima::WaitForAutoSave()
+{
+  if (!m_autoSaveJob)
+    return;
+  // If the background task hasn't started yet we write the file ourselves.
+  // Else we wait for the task to finish writing it.
+  if (!m_autoSaveJob->Run())
+    while (m_autoSaveJob->m_state != AutoSaveJob::done)
+      wxMilliSleep(10);
+  // The task might have asked for OnAutoSaveDone() to be called later. But the
+  // file it has written has to be taken care of before anything else is saved.
+  OnAutoSaveDone();
+}
+
+void wxMaxima::OnAutoSaveDone()
+{
+  // A call that was requested by an autosave WaitForAutoSave() has already
+  // taken care of mustn't touch the next autosave.
+  if (!m_autoSaveJob || (m_autoSaveJob->m_state != AutoSaveJob::done))
+    return;
+  std::shared_ptr<AutoSaveJob> job = std::move(m_autoSaveJob);
+
+  if (!job->m_success && job->m_writer->HasInvalidContent())
+    Worksheet::PutInvalidXMLOnClipboard(job->m_writer->GetContent());
+
+  wxString file = job->m_writer->GetFile();
+  if (job->m_tempFile)
+  {
+    if (file != m_tempfileName)
+    {
+      // The temp file has been discarded while we were writing it, for example
+      // since the user has saved or opened a file in the meantime.
+      if (job->m_success && wxFileExists(file))
+      {
+        SuppressErrorDialogs blocker;
+        wxRemoveFile(file);
+      }
+      return;
+    }
+    if ((job->m_oldTempFile != file) && job->m_success)
+    {
+      if(!job->m_oldTempFile.IsEmpty())
+      {
+        if(wxFileExists(job->m_oldTempFile))
+        {
+          SuppressErrorDialogs blocker;
+          wxLogMessage(wxString::Format(_("Trying to remove the old temp file %s"),
+                                        job->m_oldTempFile.utf8_str()));
+          wxRemoveFile(job->m_oldTempFile);
+        }
+      }
+    }
+    RegisterAutoSaveFile();
+  }
+  else
+  {
+    if (job->m_success)
+    {
+      RemoveTempAutosavefile();
+      StatusSaveFinished();
+    }
+    else
+    {
+      m_worksheet->SetSaved(false);
+      ResetTitle(false, true);
+      StatusSaveFailed();
+    }
+  }
+}
+
 void wxMaxima::FileMenu(wxCommandEvent &event)
 {
   if(m_worksheet != NULL)
@@ -6080,6 +6340,14 @@ void wxMaxima::MaximaMenu(wxCommandEvent &event)
       cmd = wxT("if showtime#false then showtime:false else showtime:all$");
       MenuCommand(cmd);
       break;
+    case menu_profileEvaluations:
+      m_worksheet->m_configuration->ProfileEvaluations(
+        !m_worksheet->m_configuration->ProfileEvaluations());
+      m_MaximaMenu->Check(menu_profileEvaluations,
+                          m_worksheet->m_configuration->ProfileEvaluations());
+      if (!m_worksheet->m_configuration->ProfileEvaluations())
+        FinishProfiling();
+      break;
     case menu_fun_def:
       cmd = GetTextFromUser(_("Show the definition of function:"),
                             _("Function"), m_worksheet->m_configuration, wxEmptyString, this);
@@ -8339,6 +8607,10 @@ void wxMaxima::StatsMenu(wxCommandEvent &event)
 
 bool wxMaxima::SaveOnClose()
 {
+  // Nobody could answer a dialog asking if to save the file.
+  if (m_headless)
+    return true;
+
   if (!SaveNecessary())
   {
     wxLogMessage(_("No saving on close necessary."));
@@ -8400,6 +8672,9 @@ void wxMaxima::OnClose(wxCloseEvent &event)
   #ifdef HAVE_OPENMP_TASKS
   #pragma omp taskwait
   #endif
+  // If an autosave has just written its file we have to know before deciding
+  // if the file needs to be saved.
+  OnAutoSaveDone();
   
   if(event.GetEventType() == wxEVT_END_SESSION)
     KillMaxima();
@@ -8860,7 +9135,17 @@ void wxMaxima::PopupMenu(wxCommandEvent &event)
     {
       Cell *selectedCell = m_worksheet->GetSelectionStart();
       if (selectedCell != NULL && selectedCell->GetType() == MC_TYPE_SLIDE)
-        dynamic_cast<SlideShow *>(selectedCell)->ToGif(file);
+      {
+        SlideShow *slideShow = dynamic_cast<SlideShow *>(selectedCell);
+        wxProgressDialog progressDialog(_("Save animation"), _("Writing the frames of the animation"),
+                                        slideShow->Length(), this,
+                                        wxPD_APP_MODAL | wxPD_AUTO_HIDE | wxPD_CAN_ABORT |
+                                        wxPD_ELAPSED_TIME | wxPD_REMAINING_TIME);
+        slideShow->ToGif(file, GifAnimationWriter::perFramePalette,
+                         [&progressDialog](size_t written, size_t WXUNUSED(total)){
+                           return progressDialog.Update(static_cast<int>(written));
+                         });
+      }
     }
   }
   break;
@@ -9180,14 +9465,154 @@ wxString wxMaxima::GetUnmatchedParenthesisState(wxString text,int &index)
     return wxEmptyString;
 }
 
+void wxMaxima::PrepareCellForEvaluation(GroupCell *cell)
+{
+  // Clear the monitor that shows the xml representation of the output of the
+  // current maxima command.
+  if ((m_xmlInspector) && (IsPaneDisplayed(menu_pane_xmlInspector)))
+    m_xmlInspector->Clear();
+
+  // If the cell's output that we are about to remove contains the currently
+  // selected cells we undo the selection.
+  if (m_worksheet->GetSelectionStart())
+  {
+    if (m_worksheet->GetSelectionStart()->GetGroup() == cell)
+      m_worksheet->ClearSelection();
+  }
+  if (m_worksheet->GetSelectionEnd())
+  {
+    if (m_worksheet->GetSelectionEnd()->GetGroup() == cell)
+      m_worksheet->ClearSelection();
+  }
+  cell->RemoveOutput();
+  m_worksheet->RequestRedraw();
+  StartProfiling(cell);
+}
+
+void wxMaxima::StartProfiling(GroupCell *cell)
+{
+  FinishProfiling();
+  if ((!m_worksheet->m_configuration->ProfileEvaluations()) || (m_pid <= 0))
+    return;
+  m_profiledCell = cell;
+  m_profiler.Start(m_pid);
+}
+
+void wxMaxima::FinishProfiling()
+{
+  if (!m_profiler.IsRunning())
+    return;
+  EvaluationProfile profile = m_profiler.Stop();
+  // The user might have deleted the cell in the meantime.
+  if (!m_profiledCell)
+    return;
+  m_profiledCell->SetProfile(profile);
+  m_profiledCell = nullptr;
+  if ((m_profilePane) && (IsPaneDisplayed(menu_pane_profile)))
+    m_profilePane->UpdateProfiles(m_worksheet->GetTree());
+}
+
+void wxMaxima::SetEvaluatedCell(GroupCell *cell)
+{
+  if (m_worksheet->FollowEvaluation())
+  {
+    m_worksheet->SetSelection(cell);
+    if (!m_worksheet->GetWorkingGroup())
+    {
+      m_worksheet->SetHCaret(cell);
+      m_worksheet->ScrollToCaret();
+    }
+  }
+
+  m_worksheet->SetWorkingGroup(cell);
+  cell->GetPrompt()->SetValue(m_lastPrompt);
+}
+
+bool wxMaxima::CanBePipelined(const EvaluationQueue::QueuedCommand &cmd)
+{
+  wxString text = cmd.m_command;
+  text.Trim(false);
+  if (text.IsEmpty() || (text == wxT(";")) || (text == wxT("$")))
+    return false;
+
+  // :lisp and the other break commands aren't terminated by a ";"
+  if (text.StartsWith(wxT(":")))
+    return false;
+
+  // If maxima asks a question it would read the next command as the answer
+  if (cmd.m_cell->AutoAnswer() || !cmd.m_cell->m_knownAnswers.empty())
+    return false;
+  if (m_mightAskQuestionRegEx.Matches(text))
+    return false;
+
+  // Cells with unmatched parenthesis are refused by TriggerEvaluation()
+  int index;
+  return GetUnmatchedParenthesisState(cmd.m_cell->GetEditable()->ToString(true), index).IsEmpty();
+}
+
+void wxMaxima::SendPipelined(const wxString &command, GroupCell *cell, bool started)
+{
+  long previousId = -1;
+  if (!m_pipeline.empty())
+    previousId = m_pipeline.back().m_id;
+  m_pipeline.emplace_back(++m_lastCommandId, cell, started);
+  SendMaxima(command, true, m_lastCommandId, previousId);
+}
+
+bool wxMaxima::PipelineMatchesQueue() const
+{
+  EvaluationQueue::QueuedCommand cmd;
+  for (size_t i = 0; i < m_pipeline.size(); i++)
+  {
+    if (m_pipeline[i].m_orphaned ||
+        !m_worksheet->m_evaluationQueue.PeekCommand(i, cmd) ||
+        (cmd.m_cell != m_pipeline[i].m_group.get()))
+      return false;
+  }
+  return true;
+}
+
+void wxMaxima::FillPipeline()
+{
+  // Only if maxima evaluates a command we have sent in advance it will skip
+  // the commands that follow it if it fails.
+  if (m_pipeline.empty())
+    return;
+
+  // Commands that have left the evaluation queue have to be drained, first.
+  // Once the pipeline is empty TriggerEvaluation() continues with the queue.
+  if (!PipelineMatchesQueue())
+    return;
+
+  if (m_worksheet->QuestionPending() || m_worksheet->m_configuration->InLispMode())
+    return;
+
+  if (!m_client || (!m_client->IsConnected()))
+    return;
+
+  size_t const maxLength = m_worksheet->m_configuration->PipelineDepth() + 1;
+  EvaluationQueue::QueuedCommand cmd;
+  while ((m_pipeline.size() < maxLength) &&
+         m_worksheet->m_evaluationQueue.PeekCommand(m_pipeline.size(), cmd) &&
+         CanBePipelined(cmd))
+  {
+    SendPipelined(cmd.m_command, cmd.m_cell, false);
+    // Now that we have sent a command we need to query all variable values anew
+    m_varNamesToQuery = m_worksheet->m_variablesPane->GetEscapedVarnames();
+  }
+}
+
 //! Tries to evaluate next group cell in queue
 //
 // Calling this function should not do anything dangerous
 void wxMaxima::TriggerEvaluation()
 {
-  // If evaluation is already running we don't have anything to do
+  // If evaluation is already running we at most can send more commands in advance
   if(m_maximaBusy)
+  {
+    FillPipeline();
     return;
+  }
 
   // While we wait for an answer we cannot send new commands.
   if (m_worksheet->QuestionPending())
@@ -9202,6 +9627,7 @@ void wxMaxima::TriggerEvaluation()
   GroupCell *const tmp = m_worksheet->m_evaluationQueue.GetCell();
   if (!tmp)
   {
+    FinishProfiling();
     // Maxima is no more busy.
     StatusMaximaBusy(waiting);
     // Inform the user that the evaluation queue length now is 0.
@@ -9242,27 +9668,7 @@ void wxMaxima::TriggerEvaluation()
   m_maximaStdoutPollTimer.StartOnce(MAXIMAPOLLMSECS);
 
   if (m_worksheet->m_evaluationQueue.m_workingGroupChanged)
-  {
-    // Clear the monitor that shows the xml representation of the output of the
-    // current maxima command.
-    if ((m_xmlInspector) && (IsPaneDisplayed(menu_pane_xmlInspector)))
-      m_xmlInspector->Clear();
-
-    // If the cell's output that we are about to remove contains the currently
-    // selected cells we undo the selection.
-    if (m_worksheet->GetSelectionStart())
-    {
-      if (m_worksheet->GetSelectionStart()->GetGroup() == tmp)
-        m_worksheet->ClearSelection();
-    }
-    if (m_worksheet->GetSelectionEnd())
-    {
-      if (m_worksheet->GetSelectionEnd()->GetGroup() == tmp)
-        m_worksheet->ClearSelection();
-    }
-    tmp->RemoveOutput();
-    m_worksheet->RequestRedraw();
-  }
+    PrepareCellForEvaluation(tmp);
   wxString text = m_worksheet->m_evaluationQueue.GetCommand();
   m_commandIndex = m_worksheet->m_evaluationQueue.GetIndex();
   if ((text != wxEmptyString) && (text != wxT(";")) && (text != wxT("$")))
@@ -9271,22 +9677,20 @@ void wxMaxima::TriggerEvaluation()
     wxString parenthesisError = GetUnmatchedParenthesisState(tmp->GetEditable()->ToString(true),index);
     if (parenthesisError.IsEmpty())
     {
-      if (m_worksheet->FollowEvaluation())
-      {
-        m_worksheet->SetSelection(tmp);
-        if (!m_worksheet->GetWorkingGroup())
-        {
-          m_worksheet->SetHCaret(tmp);
-          m_worksheet->ScrollToCaret();
-        }
-      }
-
-      m_worksheet->SetWorkingGroup(tmp);
-      tmp->GetPrompt()->SetValue(m_lastPrompt);
+      SetEvaluatedCell(tmp);
 
       SendMaxima(m_configCommands);
-      SendMaxima(text, true);
+      // Maxima is idle => it has no more commands we sent in advance.
+      m_pipeline.clear();
+      EvaluationQueue::QueuedCommand cmd;
+      if ((m_worksheet->m_configuration->PipelineDepth() > 0) &&
+          m_worksheet->m_evaluationQueue.PeekCommand(0, cmd) &&
+          CanBePipelined(cmd))
+        SendPipelined(text, tmp, true);
+      else
+        SendMaxima(text, true);
       m_maximaBusy = true;
+      FillPipeline();
       // Now that we have sent a command we need to query all variable values anew
       m_varNamesToQuery = m_worksheet->m_variablesPane->GetEscapedVarnames();
       m_configCommands = wxEmptyString;
@@ -9317,6 +9721,8 @@ void wxMaxima::TriggerEvaluation()
                                              parenthesisError + wxT("\n"));
       cell->SetType(MC_TYPE_ERROR);
       tmp->SetOutput(std::move(cell));
+      // The cell hasn't been evaluated => there is nothing to profile.
+      m_profiledCell = nullptr;
       m_worksheet->m_evaluationQueue.Clear();
       m_worksheet->SetWorkingGroup(nullptr);
       tmp->GetInput()->SetCaretPosition(index);
@@ -9751,6 +10157,19 @@ void wxMaxima::TableOfContentsSelection(wxListEvent &event)
   }
 }
 
+void wxMaxima::ProfileSelection(wxListEvent &event)
+{
+  GroupCell *selection = m_profilePane->GetCell(event.GetIndex());
+
+  // The list isn't updated when cells are deleted => make sure the cell still exists.
+  if ((selection) && (m_worksheet->GetTree()) && (m_worksheet->GetTree()->Contains(selection)))
+  {
+    m_worksheet->SetHCaret(selection);
+    m_worksheet->ScrollToCaret();
+    m_worksheet->SetFocus();
+  }
+}
+
 void wxMaxima::OnFollow(wxCommandEvent &WXUNUSED(event))
 {
   m_worksheet->CloseAutoCompletePopup();
@@ -9960,6 +10379,7 @@ void wxMaxima::ChangeCellStyle(wxCommandEvent& WXUNUSED(event))
 
 bool wxMaxima::m_pipeToStdout = false;
 bool wxMaxima::m_exitOnError = false;
+bool wxMaxima::m_headless = false;
 wxString wxMaxima::m_extraMaximaArgs;
 int wxMaxima::m_exitCode = 0;
 //wxRegEx  wxMaxima::m_outputPromptRegEx(wxT("<lbl>.*</lbl>"));
@@ -9969,6 +10389,11 @@ wxRegEx  wxMaxima::m_funRegEx(wxT("^ *([[:alnum:]%_]+) *\\(([[:alnum:]%_,[[.].]
 wxRegEx  wxMaxima::m_varRegEx(wxT("^ *([[:alnum:]%_]+) *:"));
 wxRegEx  wxMaxima::m_blankStatementRegEx(wxT("(^;)|((^|;)(((\\/\\*.*\\*\\/)?([[:space:]]*))+;)+)"));
 wxRegEx  wxMaxima::m_sbclCompilationRegEx(wxT("; compiling (.* \\.*)"));
+wxRegEx  wxMaxima::m_mightAskQuestionRegEx(
+  wxT("(^|[^[:alnum:]_%])(integrate|defint|risch|limit|tlimit|gruntz|asksign|sign|"
+      "laplace|ilt|specint|sum|product|nusum|simplify_sum|taylor|powerseries|"
+      "ode2|ic1|ic2|bc2|desolve|realpart|imagpart|rectform|polarform|carg|"
+      "read|readonly|demo|batch|load)[[:space:]]*\\("));
 wxRegEx  wxMaxima::m_gnuplotErrorRegex(wxT("\".*\\.gnuplot\", line [0-9][0-9]*: "));
 wxString wxMaxima::m_suppressOutputPrefix(wxT("<suppressOutput>"));
 wxString wxMaxima::m_suppressOutputSuffix(wxT("</suppressOutput>"));
@@ -9980,6 +10405,10 @@ wxString wxMaxima::m_addVariablesPrefix(wxT("<watch_variables_add>"));
 wxString wxMaxima::m_addVariablesSuffix(wxT("</watch_variables_add>"));
 wxString wxMaxima::m_statusbarPrefix(wxT("<statusbar>"));
 wxString wxMaxima::m_statusbarSuffix(wxT("</statusbar>\n"));
+wxString wxMaxima::m_commandStartPrefix(wxT("<command_start>"));
+wxString wxMaxima::m_commandStartSuffix(wxT("</command_start>"));
+wxString wxMaxima::m_commandSkippedPrefix(wxT("<command_skipped>"));
+wxString wxMaxima::m_commandSkippedSuffix(wxT("</command_skipped>"));
 wxString wxMaxima::m_firstPrompt(wxT("(%i1) "));
 wxString wxMaxima::m_mathPrefix1(wxT("<mth>"));
 wxString wxMaxima::m_mathPrefix2(wxT("<math>"));
@@ -34,7 +34,12 @@
 #include "wxMaximaFrame.h"
 #include "MathParser.h"
 #include "MaximaIPC.h"
+#include "MaximaReadBuffer.h"
+#include "MaximaOutputScanner.h"
 #include "Dirstructure.h"
+#include "BatchRunner.h"
+#include "ManualIndex.h"
+#include "EvaluationProfile.h"
 
 #include <wx/socket.h>
 #include <wx/config.h>
@@ -46,7 +51,9 @@
 #include <wx/txtstrm.h>
 #include <wx/sckstrm.h>
 #include <wx/buffer.h>
+#include <deque>
 #include <memory>
+#include <atomic>
 #ifdef __WXMSW__
 #include <windows.h>
 #endif
@@ -87,6 +94,16 @@ public:
   //! Pipe maxima's output to stdout
   static void PipeToStdout(){m_pipeToStdout = true;}
   static void ExitOnError(){m_exitOnError = true;}
+  /*! Evaluate the file without displaying anything
+
+    The result is saved as .wxmx file and the program exits afterwards.
+   */
+  static void Headless(){m_headless = true;}
+  static bool IsHeadless(){return m_headless;}
+  //! Why did the headless evaluation fail? Empty = it didn't.
+  wxString HeadlessError() const;
+  //! The exit code the program should return
+  static int GetExitCode(){return m_exitCode;}
   static void EnableIPC(){ MaximaIPC::EnableIPC(); }
   static void ExtraMaximaArgs(const wxString &args){m_extraMaximaArgs = args;}
 
@@ -155,7 +172,23 @@ public:
   //! Launches the help browser on the uri passed as an argument.
   void LaunchHelpBrowser(wxString uri);
   
-  void SendMaxima(wxString s, bool addToHistory = false);
+  /*! Saves the result of a headless evaluation
+
+    The result is saved as .wxmx file next to the file that has been evaluated.
+   */
+  void SaveHeadless();
+
+  /*! Sends a command to maxima
+
+    \param s The command
+    \param addToHistory true = add the command to the history pane
+    \param commandId If >= 0 the command is sent to maxima before it has
+                      answered the last one and this is its id, see m_pipeline.
+    \param previousCommandId The id of the command sent before, if that one
+                              has been sent in advance, as well; else -1.
+   */
+  void SendMaxima(wxString s, bool addToHistory = false,
+                  long commandId = -1, long previousCommandId = -1);
 
   //! Open a file
   bool OpenFile(const wxString &file, const wxString &command ={});
@@ -196,6 +229,11 @@ private:
   wxString m_initialWorkSheetContents;
   static bool m_pipeToStdout;
   static bool m_exitOnError;
+  static bool m_headless;
+  //! Why did the headless evaluation fail? Empty = it didn't.
+  wxString m_headlessError;
+  //! Has the result of the headless evaluation been saved?
+  bool m_headlessSaved = false;
   static wxString m_extraMaximaArgs;
   //! Search for the wxMaxima help file
   wxString SearchwxMaximaHelp();
@@ -266,6 +304,12 @@ protected:
   void CompileHelpFileAnchors();
   //! Load the result from the last CompileHelpFileAnchors from the disk cache
   bool LoadManualAnchorsFromCache();
+  //! Store the anchors CompileHelpFileAnchors has found in the disk cache
+  void SaveManualAnchorsToCache();
+  //! The sections of the manual that best match the words in query
+  std::vector<ManualIndex::Section> SearchManual(const wxString &query);
+  //! The anchors and the full-text index of the manual
+  ManualIndex m_manualIndex;
   //! The gnuplot process info
   wxProcess *m_gnuplotProcess;
   //! Is this window active?
@@ -413,9 +457,50 @@ protected:
    */
   TextCell *ConsoleAppend(wxString s, CellType type, const wxString &userLabel = {});        //!< append maxima output to console
 
-  enum AppendOpt { NewLine = 1, BigSkip = 2, PromptToolTip = 4, DefaultOpt = NewLine|BigSkip };
+  /*! Options for DoConsoleAppend
+
+    Background means: The XML may be converted to cells in a background task.
+    Output from maxima that arrives in the meantime is only interpreted after
+    the resulting cells have been added to the worksheet.
+   */
+  enum AppendOpt { NewLine = 1, BigSkip = 2, PromptToolTip = 4, Background = 8,
+                   DefaultOpt = NewLine|BigSkip };
   void DoConsoleAppend(wxString s, CellType type, AppendOpt opts = AppendOpt::DefaultOpt,
                        const wxString &userLabel = {});
+  //! Adds a cell DoConsoleAppend has created to the worksheet
+  void InsertParsedLine(std::unique_ptr<Cell> &&cell, AppendOpt opts);
+
+  /*! A chunk of maxima's math output that is converted to cells in a background task
+
+    While the task runs only the task accesses this object, m_backgroundParser and the cells
+    the task creates.
+   */
+  struct MathParseJob
+  {
+    //! The XML code to convert
+    wxString m_xml;
+    CellType m_type;
+    AppendOpt m_opts;
+    //! The working group at the time maxima sent us the output
+    CellPtr<GroupCell> m_group;
+    //! The cells the background task has created
+    std::unique_ptr<Cell> m_cell;
+    //! true = the result isn't wanted any more, for example since maxima was restarted
+    bool m_cancelled = false;
+  };
+  //! The math output that is currently converted to cells in the background, if any
+  std::unique_ptr<MathParseJob> m_mathParseJob;
+  //! The parser the background task uses. Only ever used by one task at a time.
+  MathParser m_backgroundParser;
+  /*! Adds the cells the background task has created to the worksheet
+
+    Afterwards interprets the rest of maxima's output that has arrived in the meantime.
+   */
+  void OnMathParsedInBackground();
+  //! Don't add the cells the background task currently creates to the worksheet
+  void CancelMathParseJob(){if(m_mathParseJob) m_mathParseJob->m_cancelled = true;}
+  //! Interprets the data in m_currentOutput
+  void InterpretCurrentOutput();
 
   /*!Append one or more lines of ordinary unicode text to the console
 
@@ -446,6 +531,8 @@ protected:
 
   //! Issued on double click on a table of contents item
   void TableOfContentsSelection(wxListEvent &event);
+  //! Issued on double click on an item of the list of the slowest cells
+  void ProfileSelection(wxListEvent &event);
 
   void OnInspectorEvent(wxCommandEvent &ev);
 
@@ -454,6 +541,26 @@ protected:
   //! Try to evaluate the next command for maxima that is in the evaluation queue
   void TriggerEvaluation();
 
+  //! Removes the old output of a cell maxima is about to evaluate
+  void PrepareCellForEvaluation(GroupCell *cell);
+  //! Starts measuring the evaluation of cell, if the user wants cells to be profiled
+  void StartProfiling(GroupCell *cell);
+  //! Attaches what the evaluation of the profiled cell has cost to that cell
+  void FinishProfiling();
+  //! Marks cell as the one maxima currently evaluates
+  void SetEvaluatedCell(GroupCell *cell);
+
+  /*! Sends commands from the evaluation queue to maxima before it has answered the current one
+
+    Does nothing if the command maxima currently evaluates hasn't been sent
+    this way, as well, or if Configuration::PipelineDepth() is 0.
+   */
+  void FillPipeline();
+  //! Sends a command in a way that allows maxima to skip it if the command before it fails
+  void SendPipelined(const wxString &command, GroupCell *cell, bool started);
+  //! Is it safe to send this command to maxima before it has answered the one before?
+  bool CanBePipelined(const EvaluationQueue::QueuedCommand &cmd);
+
   void TryUpdateInspector();
 
   bool UpdateDrawPane();
@@ -493,13 +600,11 @@ protected:
    */
   void ReadFirstPrompt(wxString &data);
 
-  /*! Determine where the text for ReadMiscText ends
+  //! A function that interprets a tag in maxima's output
+  typedef void (wxMaxima::*OutputReader)(wxString &data);
 
-    Every error message or other line maxima outputs should end in a newline character. 
-    But sometimes it doesn't and a <code>\<mth\></code> tag comes first \f$ =>\f$ This 
-    function determines where the miscellaneous text ends.
-   */
-  int GetMiscTextEnd(const wxString &data);
+  //! Tells m_outputScanner about all tags in maxima's output we know about
+  void InitOutputScanner();
 
   //! Find the end of a tag in wxMaxima's output.
   int FindTagEnd(const wxString &data, const wxString &tag);
@@ -509,9 +614,25 @@ protected:
      Some commands provide status messages before the math output or the command has finished.
      This function makes wxMaxima output them directly as they arrive.
 
-     After processing the lines not enclosed in xml tags they are removed from data.
+     \param data The text up to the next xml tag.
    */
-  void ReadMiscText(wxString &data);
+  void ReadMiscText(const wxString &data);
+
+  /*! Reads the tag maxima sends when it starts evaluating a command we have sent in advance
+
+    Makes the cell the command belongs to the working group.
+   */
+  void ReadCommandStart(wxString &data);
+
+  /*! Reads the tag maxima sends if it has skipped a command we have sent in advance
+
+    This happens if the command before it has failed: The commands that still
+    are in the evaluation queue are sent again.
+   */
+  void ReadCommandSkipped(wxString &data);
+
+  //! Hands the interprocess communication tag to m_ipc
+  void ReadIPC(wxString &data){m_ipc.ReadInputData(data);}
 
   /*! Reads the input prompt from Maxima.
 
@@ -639,9 +760,52 @@ protected:
   bool SaveOnClose();
   /*! Save the project in a temp file.
 
-    Returns false if a save was necessary, but not possible.
+    If the worksheet is saved as a .wxmx file the file is written by a
+    background task. Returns false if a save was necessary, but not possible.
    */
   bool AutoSave();
+
+  //! A .wxmx file an autosave writes in the background
+  struct AutoSaveJob
+  {
+    enum State
+    {
+      queued,  //!< Nobody has started writing the file yet
+      writing, //!< The background task or WaitForAutoSave() writes the file
+      done     //!< The file has been written, or writing it has failed
+    };
+    //! The snapshot of the worksheet that is to be written
+    std::unique_ptr<WXMXWriter> m_writer;
+    //! true = we save to a temp file, not to the file the user has chosen
+    bool m_tempFile = false;
+    //! The temp file of the last autosave, which can be deleted after success
+    wxString m_oldTempFile;
+    //! Set by whoever has written the file before m_state changes to done
+    bool m_success = false;
+    std::atomic<int> m_state{queued};
+    /*! Writes the file, unless somebody else already has started to do so
+
+      \return false, if somebody else has started writing the file
+     */
+    bool Run();
+  };
+  /*! The autosave that is currently writing its file, if any
+
+    Shared with the background task that writes the file: If WaitForAutoSave()
+    has written the file before that task was started the task still needs to
+    be able to find out that there is nothing left to do.
+   */
+  std::shared_ptr<AutoSaveJob> m_autoSaveJob;
+  //! Writes the file for an autosave, in the background if possible
+  void StartAutoSave(std::shared_ptr<AutoSaveJob> &&job);
+  //! Called by the GUI thread when the file for an autosave has been written
+  void OnAutoSaveDone();
+  /*! Waits until a running autosave has written its file
+
+    Only waits for this autosave, not for any other background task. If the
+    background task hasn't started yet the file is written right away instead.
+   */
+  void WaitForAutoSave();
   
   int SaveDocumentP();
 
@@ -655,8 +819,8 @@ protected:
   }
 
   std::unique_ptr<wxSocketBase> m_client;
-  std::unique_ptr<wxSocketInputStream> m_clientStream;
-  std::unique_ptr<wxTextInputStream> m_clientTextStream;
+  //! The raw bytes from maxima that haven't been converted to text yet
+  MaximaReadBuffer m_clientReadBuffer;
   wxSocketServer *m_server;
   wxProcess *m_process;
   //! The stdout of the maxima process
@@ -666,15 +830,12 @@ protected:
   int m_port;
   //! All chars from maxima that still aren't part of m_currentOutput
   wxString m_newCharsFromMaxima;
-  /*! The end of maxima's current uninterpreted output, see m_currentOutput.
-   
-    If we just want to look if maxima's current output contains an ending tag
-    this is the place we can search in fast.
-
-    wxEmptyString means that the current output isn't long enought to make 
-    creating this string worthwile.
-   */
-  wxString m_currentOutputEnd;
+  //! Finds the tags in m_currentOutput
+  MaximaOutputScanner m_outputScanner;
+  //! The function that interprets each tag m_outputScanner knows about
+  std::vector<OutputReader> m_outputReaders;
+  //! The tag m_outputScanner knows the IPC messages by
+  std::size_t m_ipcTag = MaximaOutputScanner::NoTag;
   //! Caches the name of wxMaxima's help file.
   wxString m_wxMaximaHelpFile;
   //! All from maxima's current output we still haven't interpreted
@@ -715,6 +876,14 @@ protected:
   static wxString m_suppressOutputPrefix;
   //! The marker that tells to stop to suppress any output from maxima
   static wxString m_suppressOutputSuffix;
+  //! The marker maxima sends when it starts evaluating a command we have sent in advance
+  static wxString m_commandStartPrefix;
+  //! The end of m_commandStartPrefix's tag
+  static wxString m_commandStartSuffix;
+  //! The marker maxima sends if it skipped a command we have sent in advance
+  static wxString m_commandSkippedPrefix;
+  //! The end of m_commandSkippedPrefix's tag
+  static wxString m_commandSkippedSuffix;
   //! The first prompt maxima will output
   static wxString m_firstPrompt;
   //! An empty wxxml symbols section
@@ -743,13 +912,48 @@ protected:
   wxString m_gnuplotcommand;
   //! The Char the current command starts at in the current WorkingGroup
   int m_commandIndex;
+  //! Measures what the evaluation of the current cell costs
+  EvaluationProfiler m_profiler;
+  //! The cell m_profiler measures the evaluation of
+  CellPtr<GroupCell> m_profiledCell;
   wxFindReplaceData m_findData;
   static wxRegEx m_funRegEx;
   static wxRegEx m_varRegEx;
   static wxRegEx m_blankStatementRegEx;
   static wxRegEx m_sbclCompilationRegEx;
+  //! Matches commands that might cause maxima to ask a question
+  static wxRegEx m_mightAskQuestionRegEx;
   MathParser m_parser;
   bool m_maximaBusy;
+  //! A command we have sent to maxima before it has finished the one before
+  struct PipelinedCommand
+  {
+    PipelinedCommand(long id, GroupCell *group, bool started) :
+      m_id(id), m_group(group), m_started(started) {}
+    long m_id;
+    //! The cell the command belongs to
+    CellPtr<GroupCell> m_group;
+    //! Has maxima told us it evaluates this command?
+    bool m_started;
+    //! Has the command's cell left the evaluation queue while maxima still had the command?
+    bool m_orphaned = false;
+  };
+  /*! The commands maxima evaluates or still has to evaluate, if they were sent in advance
+
+    The first entry is the command maxima currently evaluates and, unless its
+    cell has left the evaluation queue, the one the first entry of the queue
+    belongs to.
+   */
+  std::deque<PipelinedCommand> m_pipeline;
+  //! The id of the last command we have sent in advance
+  long m_lastCommandId = 0;
+  /*! Are the commands in m_pipeline still the first ones in the evaluation queue?
+
+    If cells have been removed from the queue maxima still evaluates the
+    commands we have sent for them. We have to wait until it has done so
+    before we know which command from the queue to send next.
+   */
+  bool PipelineMatchesQueue() const;
   wxMemoryBuffer m_rawDataToSend;
   unsigned long int m_rawBytesSent;
 private:
@@ -800,10 +1004,12 @@ public:
     \param wxmData A gnuzipped version of the .wxm file containing the initial worksheet contents
     \param wxmLen  The length of wxmData
    */
-  void NewWindow(const wxString &file = {}, bool evalOnStartup = false, bool exitAfterEval = false, unsigned char *wxmData = NULL, int wxmLen = 0);
+  wxMaxima *NewWindow(const wxString &file = {}, bool evalOnStartup = false, bool exitAfterEval = false, unsigned char *wxmData = NULL, int wxmLen = 0);
 
   static std::vector<wxMaxima *> m_topLevelWindows;
   static void DelistTopLevelWindow(wxMaxima *);
+  //! Distributes the files of a headless evaluation of many files among windows
+  static std::unique_ptr<BatchRunner> m_batchRunner;
 
   void OnFileMenu(wxCommandEvent &ev);
 
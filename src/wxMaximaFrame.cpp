@@ -174,6 +174,7 @@ wxMaximaFrame::wxMaximaFrame(wxWindow *parent, int id, const wxString &title,
 
   m_xmlInspector = new XmlInspector(this, -1);
   wxWindowUpdateLocker xmlInspectorBlocker(m_xmlInspector);
+  m_profilePane = new ProfilePane(this, -1);
   m_statusBar = new StatusBar(this, -1);
   wxWindowUpdateLocker statusbarBlocker(m_statusBar);
   SetStatusBar(m_statusBar);
@@ -231,6 +232,16 @@ wxMaximaFrame::wxMaximaFrame(wxWindow *parent, int id, const wxString &title,
                             PaneBorder(true).
                             Right());
 
+  m_manager.AddPane(m_profilePane,
+                    wxAuiPaneInfo().Name("profile").
+                            CloseButton(true).PinButton(true).
+                            TopDockable(true).
+                            BottomDockable(true).
+                            LeftDockable(true).
+                            RightDockable(true).
+                            PaneBorder(true).
+                            Bottom());
+
   wxPanel *statPane;
   m_manager.AddPane(statPane = CreateStatPane(),
                     wxAuiPaneInfo().Name(wxT("stats")).
@@ -383,6 +394,7 @@ wxMaximaFrame::wxMaximaFrame(wxWindow *parent, int id, const wxString &title,
   }
   
   m_manager.GetPane("XmlInspector") = m_manager.GetPane("XmlInspector").Show(false).Movable(true);
+  m_manager.GetPane("profile") = m_manager.GetPane("profile").Show(false).Movable(true);
   m_manager.GetPane("stats") = m_manager.GetPane("stats").Show(false).Movable(true);
   m_manager.GetPane("greek") = m_manager.GetPane("greek").Show(false).Movable(true);
   m_manager.GetPane("variables") = m_manager.GetPane("variables").Show(false).Movable(true);
@@ -466,6 +478,8 @@ wxMaximaFrame::wxMaximaFrame(wxWindow *parent, int id, const wxString &title,
   // The XML inspector scares many users and displaying long XML responses there slows
   // down wxMaxima => disable the XML inspector on startup.
   m_manager.GetPane(wxT("XmlInspector")).Show(false).PaneBorder(true).Movable(true);
+  m_manager.GetPane(wxT("profile")) =
+    m_manager.GetPane(wxT("profile")).Caption(_("Slowest cells")).CloseButton(true).Resizable().PaneBorder(true).Movable(true);
   m_manager.GetPane(wxT("unicode")) = m_manager.GetPane(wxT("unicode")).Caption(_("Unicode characters")).Show(false).PaneBorder(true).Movable(true);
 
   m_manager.GetPane(wxT("structure")) =
@@ -765,6 +779,7 @@ void wxMaximaFrame::SetupMenu()
   m_Maxima_Panes_Sub->AppendCheckItem(menu_pane_log,   _("Debug messages"));
   m_Maxima_Panes_Sub->AppendCheckItem(menu_pane_variables,   _("Variables"));
   m_Maxima_Panes_Sub->AppendCheckItem(menu_pane_xmlInspector, _("Raw XML Monitor"));
+  m_Maxima_Panes_Sub->AppendCheckItem(menu_pane_profile, _("Slowest cells"));
   m_Maxima_Panes_Sub->AppendSeparator();
   m_Maxima_Panes_Sub->Append(menu_pane_dockAll, _("Dock all Sidebars"));
   m_Maxima_Panes_Sub->AppendSeparator();
@@ -942,6 +957,10 @@ void wxMaximaFrame::SetupMenu()
   m_MaximaMenu->Append(menu_time, _("Toggle &Time Display"),
                        _("Display time used for evaluation"),
                        wxITEM_NORMAL);
+  m_MaximaMenu->AppendCheckItem(menu_profileEvaluations, _("Profile Cell Evaluations"),
+                                _("Measure the time and memory the evaluation of each cell needs"));
+  m_MaximaMenu->Check(menu_profileEvaluations,
+                      m_worksheet->m_configuration->ProfileEvaluations());
   m_MaximaMenu->Append(menu_display, _("Change &2d Display"),
                        _("Change the 2d display algorithm used to display math output"),
                        wxITEM_NORMAL);
@@ -1558,6 +1577,9 @@ bool wxMaximaFrame::IsPaneDisplayed(Event id)
     case menu_pane_xmlInspector:
       displayed = m_manager.GetPane(wxT("XmlInspector")).IsShown();
       break;
+    case menu_pane_profile:
+      displayed = m_manager.GetPane(wxT("profile")).IsShown();
+      break;
     case menu_pane_stats:
       displayed = m_manager.GetPane(wxT("stats")).IsShown();
       break;
@@ -1596,6 +1618,7 @@ void wxMaximaFrame::DockAllSidebars(wxCommandEvent & WXUNUSED(ev))
   m_manager.GetPane(wxT("history")).Dock();
   m_manager.GetPane(wxT("structure")).Dock();
   m_manager.GetPane(wxT("XmlInspector")).Dock();
+  m_manager.GetPane(wxT("profile")).Dock();
   m_manager.GetPane(wxT("stats")).Dock();
   m_manager.GetPane(wxT("greek")).Dock();
   m_manager.GetPane(wxT("log")).Dock();
@@ -1624,6 +1647,11 @@ void wxMaximaFrame::ShowPane(Event id, bool show)
     case menu_pane_xmlInspector:
       m_manager.GetPane(wxT("XmlInspector")).Show(show);
       break;
+    case menu_pane_profile:
+      m_manager.GetPane(wxT("profile")).Show(show);
+      if(show)
+        m_profilePane->UpdateProfiles(m_worksheet->GetTree());
+      break;
     case menu_pane_stats:
       m_manager.GetPane(wxT("stats")).Show(show);
       break;
@@ -1653,6 +1681,7 @@ void wxMaximaFrame::ShowPane(Event id, bool show)
       m_manager.GetPane(wxT("history")).Show(false);
       m_manager.GetPane(wxT("structure")).Show(false);
       m_manager.GetPane(wxT("XmlInspector")).Show(false);
+      m_manager.GetPane(wxT("profile")).Show(false);
       m_manager.GetPane(wxT("stats")).Show(false);
       m_manager.GetPane(wxT("greek")).Show(false);
       m_manager.GetPane(wxT("log")).Show(false);
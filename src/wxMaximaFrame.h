@@ -47,6 +47,7 @@ surrounding the worksheet.
 #include "MainMenuBar.h"
 #include "History.h"
 #include "XmlInspector.h"
+#include "ProfilePane.h"
 #include "StatusBar.h"
 #include "LogPane.h"
 #include <list>
@@ -108,6 +109,7 @@ public:
     menu_pane_variables, //!< Both the "toggle the variables pane" command and the "variables" pane
     menu_pane_draw,      //!< Both the "toggle the draw pane" command for the "draw" pane
     menu_pane_symbols,   //!< Both the "toggle the symbols pane" command for the "symbols" pane
+    menu_pane_profile,   //!< Both the "toggle the profile pane" command for the "profile" pane
     /*! Both used as the "toggle the stats pane" command and as the ID of the stats pane
 
       Since this enum is also used for iterating over the panes it is vital 
@@ -492,7 +494,8 @@ public:
     enable_unicodePane,
     menu_showLatinGreekLookalikes,
     menu_showGreekMu,
-    menu_invertWorksheetBackground
+    menu_invertWorksheetBackground,
+    menu_profileEvaluations
   };
 
   /*! Update the recent documents list
@@ -757,6 +760,8 @@ protected:
   wxAuiManager m_manager;
   //! A XmlInspector-like xml monitor
   XmlInspector *m_xmlInspector;
+  //! The list of the cells whose evaluation took longest
+  ProfilePane *m_profilePane;
   //! true=force an update of the status bar at the next call of StatusMaximaBusy()
   bool m_forceStatusbarUpdate;
   //! The panel the log and debug messages will appear on
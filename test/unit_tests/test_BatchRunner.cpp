@@ -0,0 +1,81 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+#include "BatchRunner.h"
+#include <catch2/catch.hpp>
+#include <wx/filefn.h>
+#include <wx/filename.h>
+#include <wx/textfile.h>
+#include <algorithm>
+
+SCENARIO("BatchRunner never runs more than maxJobs files at once") {
+  GIVEN("Five files and a pool of two processes") {
+    // The runner only compares the window pointers => any distinct addresses will do.
+    char windows[5];
+    std::vector<wxString> started;
+    size_t running = 0;
+    size_t maxRunning = 0;
+    wxString summaryFile = wxFileName::CreateTempFileName(wxT("batchrunner"));
+    BatchRunner runner([&](const wxString &file) {
+        running++;
+        maxRunning = std::max(maxRunning, running);
+        started.push_back(file);
+        return reinterpret_cast<wxMaxima *>(&windows[started.size() - 1]);
+      }, 2, summaryFile);
+    for (int i = 0; i < 5; i++)
+      runner.AddFile(wxString::Format(wxT("file%i.wxmx"), i));
+    WHEN("the runner is started") {
+      runner.Start();
+      THEN("only two files are started") {
+        REQUIRE(started.size() == 2);
+        REQUIRE(!runner.Done());
+      }
+    }
+    WHEN("every window closes as soon as it has been started") {
+      runner.Start();
+      size_t closed = 0;
+      while (closed < started.size())
+      {
+        running--;
+        runner.WindowClosed(reinterpret_cast<wxMaxima *>(&windows[closed]),
+                            (closed == 3) ? wxT("Maxima has issued an error") : wxT(""));
+        closed++;
+      }
+      THEN("all files have been evaluated with at most two at a time") {
+        REQUIRE(started.size() == 5);
+        REQUIRE(maxRunning == 2);
+        REQUIRE(runner.Done());
+      }
+      THEN("the summary lists all files and the failure") {
+        wxTextFile summary(summaryFile);
+        REQUIRE(summary.Open());
+        wxString text;
+        for (size_t i = 0; i < summary.GetLineCount(); i++)
+          text += summary[i] + wxT("\n");
+        REQUIRE(text.Contains(wxT("\"files\": 5")));
+        REQUIRE(text.Contains(wxT("\"failed\": 1")));
+        REQUIRE(text.Contains(wxT("\"error\": \"Maxima has issued an error\"")));
+        REQUIRE(text.Contains(wxT("\"file\": \"file4.wxmx\"")));
+      }
+    }
+    wxRemoveFile(summaryFile);
+  }
+}
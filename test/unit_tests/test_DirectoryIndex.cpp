@@ -0,0 +1,93 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+#include "DirectoryIndex.h"
+#include <catch2/catch.hpp>
+#include <wx/ffile.h>
+#include <wx/filefn.h>
+#include <wx/filename.h>
+#include <wx/utils.h>
+#include <set>
+
+//! Collects the names of all files in a directory and its subdirectories
+class FileCollector : public wxDirTraverser
+{
+public:
+  wxDirTraverseResult OnFile(const wxString &filename) override
+    {
+      m_files.insert(wxFileName(filename).GetFullName());
+      return wxDIR_CONTINUE;
+    }
+  wxDirTraverseResult OnDir(const wxString &WXUNUSED(dirname)) override
+    { return wxDIR_CONTINUE; }
+  std::set<wxString> m_files;
+};
+
+static void CreateEmptyFile(const wxString &name)
+{
+  wxFFile file(name, wxT("w"));
+  file.Write(wxT("\n"));
+}
+
+SCENARIO("DirectoryIndex remembers directory listings") {
+  wxString dir = wxFileName::GetTempDir() + wxFILE_SEP_PATH +
+    wxString::Format(wxT("test_DirectoryIndex_%lu"), wxGetProcessId());
+  wxString indexFile = dir + wxT(".txt");
+  wxFileName::Mkdir(dir + wxFILE_SEP_PATH + wxT("sub"), wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL);
+  CreateEmptyFile(dir + wxFILE_SEP_PATH + wxT("a.mac"));
+  CreateEmptyFile(dir + wxFILE_SEP_PATH + wxT("sub") + wxFILE_SEP_PATH + wxT("b.dem"));
+
+  GIVEN("An index that has traversed a directory tree and has been saved") {
+    DirectoryIndex index(indexFile);
+    FileCollector scanned;
+    REQUIRE(index.Traverse(dir, scanned));
+    REQUIRE(scanned.m_files == std::set<wxString>({wxT("a.mac"), wxT("b.dem")}));
+    REQUIRE(index.Save());
+
+    WHEN("the index is loaded again") {
+      DirectoryIndex loaded(indexFile);
+      REQUIRE(loaded.Load());
+      THEN("it knows the same files without validating its listings") {
+        FileCollector cached;
+        REQUIRE(loaded.Traverse(dir, cached, false));
+        REQUIRE(cached.m_files == scanned.m_files);
+      }
+    }
+    WHEN("a file is added after the directory has been read") {
+      CreateEmptyFile(dir + wxFILE_SEP_PATH + wxT("sub") + wxFILE_SEP_PATH + wxT("c.mac"));
+      THEN("validating the index finds it") {
+        FileCollector validated;
+        REQUIRE(index.Traverse(dir, validated));
+        REQUIRE(validated.m_files.count(wxT("c.mac")) == 1);
+      }
+    }
+  }
+  GIVEN("A directory that doesn't exist") {
+    DirectoryIndex index;
+    FileCollector files;
+    THEN("Traverse() fails") {
+      REQUIRE(!index.Traverse(dir + wxFILE_SEP_PATH + wxT("nonexistent"), files));
+    }
+  }
+
+  wxFileName::Rmdir(dir, wxPATH_RMDIR_RECURSIVE);
+  wxRemoveFile(indexFile);
+}
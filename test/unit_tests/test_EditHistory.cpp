@@ -0,0 +1,91 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+#include "EditHistory.h"
+#include <catch2/catch.hpp>
+
+SCENARIO("EditHistory restores every state it was given") {
+  GIVEN("A history of a few edits") {
+    EditHistory history;
+    history.Push(wxT("f(x):=x^2;"), 10, -1, -1);
+    history.Push(wxT("f(x):=x^3;"), 9, -1, -1);
+    history.Push(wxT("g(x):=x^3;"), 1, 0, 1);
+    history.Push(wxT("g(x):=sin(x)^3;"), 13, -1, -1);
+    REQUIRE(history.size() == 4);
+    REQUIRE(history.LastText() == wxT("g(x):=sin(x)^3;"));
+    WHEN("the states are read back in any order") {
+      THEN("texts and selections are restored") {
+        REQUIRE(history.Get(0).text == wxT("f(x):=x^2;"));
+        REQUIRE(history.Get(0).caretPosition == 10);
+        REQUIRE(history.Get(3).text == wxT("g(x):=sin(x)^3;"));
+        REQUIRE(history.Get(1).text == wxT("f(x):=x^3;"));
+        REQUIRE(history.Get(2).text == wxT("g(x):=x^3;"));
+        REQUIRE(history.Get(2).selStart == 0);
+        REQUIRE(history.Get(2).selEnd == 1);
+      }
+    }
+    WHEN("the history is truncated") {
+      history.Get(0);
+      history.Truncate(2);
+      THEN("the newest remaining state is the last one") {
+        REQUIRE(history.size() == 2);
+        REQUIRE(history.LastText() == wxT("f(x):=x^3;"));
+        history.Push(wxT("h(x):=x^3;"), 1, -1, -1);
+        REQUIRE(history.Get(0).text == wxT("f(x):=x^2;"));
+        REQUIRE(history.Get(2).text == wxT("h(x):=x^3;"));
+      }
+    }
+  }
+}
+
+SCENARIO("EditHistory stores only the differences between states") {
+  GIVEN("A long text that is edited many times") {
+    EditHistory history;
+    wxString text(10000, wxT('a'));
+    for (int i = 0; i < 100; i++)
+    {
+      text.insert(5000, wxT("b"));
+      history.Push(text, i, -1, -1);
+    }
+    THEN("the memory usage is far below that of 100 copies") {
+      REQUIRE(history.GetMemoryUsage() < 100 * 1000);
+      REQUIRE(history.Get(0).text.Length() == 10001);
+    }
+    WHEN("the memory is limited") {
+      size_t limit = history.GetMemoryUsage() / 2;
+      history.Limit(limit);
+      THEN("the oldest states are dropped") {
+        REQUIRE(history.GetMemoryUsage() <= limit);
+        REQUIRE(history.size() < 100);
+        REQUIRE(history.Get(history.size() - 1).text == text);
+        REQUIRE(history.Get(0).text.Length() == 10000 + 100 - history.size() + 1);
+      }
+    }
+    WHEN("the memory limit is 0") {
+      size_t memoryUsage = history.GetMemoryUsage();
+      history.Limit(0);
+      THEN("nothing is dropped") {
+        REQUIRE(history.GetMemoryUsage() == memoryUsage);
+        REQUIRE(history.size() == 100);
+      }
+    }
+  }
+}
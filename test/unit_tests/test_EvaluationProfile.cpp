@@ -0,0 +1,70 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+#include "EvaluationProfile.h"
+#include <catch2/catch.hpp>
+
+SCENARIO("ProcessStats understands the files in /proc") {
+  GIVEN("The stat file of a process whose name contains spaces and parenthesis") {
+    ProcessStats stats;
+    const char stat[] =
+      "1234 (sbcl (maxima) x) R 1 1234 1234 0 -1 4194560 5000 0 0 0 250 50 30 20 20 0 1\n";
+    THEN("the CPU times are found") {
+      REQUIRE(stats.ParseStat(stat, 100));
+      REQUIRE(stats.m_userTime == Approx(2.5));
+      REQUIRE(stats.m_systemTime == Approx(0.5));
+      REQUIRE(stats.m_childTime == Approx(0.5));
+    }
+  }
+  GIVEN("A status file") {
+    ProcessStats stats;
+    const char status[] =
+      "Name:\tsbcl\nVmPeak:\t  900000 kB\nVmHWM:\t   20480 kB\nVmRSS:\t   10240 kB\n";
+    THEN("the memory usage is found") {
+      REQUIRE(stats.ParseStatus(status));
+      REQUIRE(stats.m_memory == 10240LL * 1024);
+      REQUIRE(stats.m_peakMemory == 20480LL * 1024);
+    }
+  }
+  GIVEN("The system-wide stat file") {
+    const char stat[] = "cpu  100 20 30 4000 0 0 0 0 0 0\ncpu0 50 10 15 2000 0 0 0 0 0 0\n";
+    THEN("user, nice and system time are summed up") {
+      REQUIRE(ProcessStats::ParseTotalCPUTime(stat, 100) == Approx(1.5));
+    }
+  }
+}
+
+SCENARIO("EvaluationProfile is exported") {
+  GIVEN("A profile whose CPU times are unknown") {
+    EvaluationProfile profile;
+    profile.m_wallTime = 1.25;
+    profile.m_peakMemory = 2048;
+    profile.m_outputBytes = 17;
+    THEN("CSV leaves them empty") {
+      REQUIRE(profile.ToCSV(wxT("(%i1) \"a\"")) == wxT("\"(%i1) \"\"a\"\"\",1.250,,,2048,17"));
+    }
+    THEN("JSON makes them null") {
+      REQUIRE(profile.ToJSON(wxT("x")) ==
+              wxT("{\"cell\": \"x\", \"wall_time_s\": 1.250, \"user_cpu_s\": null, "
+                  "\"system_cpu_s\": null, \"peak_memory_bytes\": 2048, \"output_bytes\": 17}"));
+    }
+  }
+}
@@ -0,0 +1,72 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+#include "EvaluationQueue.h"
+#include <catch2/catch.hpp>
+
+using Token = MaximaTokenizer::Token;
+
+SCENARIO("SplitCommands splits a cell at the end of each command") {
+  GIVEN("Two commands, a comment and a :lisp command") {
+    MaximaTokenizer::TokenList tokens = {
+      Token(wxT("a"), TS_CODE_VARIABLE), Token(wxT(":"), TS_CODE_OPERATOR),
+      Token(wxT("1"), TS_CODE_NUMBER), Token(wxT(";"), TS_CODE_ENDOFLINE),
+      Token(wxT("\n"), TS_DEFAULT), Token(wxT("/* b */"), TS_CODE_COMMENT),
+      Token(wxT("b"), TS_CODE_VARIABLE), Token(wxT("$"), TS_CODE_ENDOFLINE),
+      Token(wxT("\n"), TS_DEFAULT), Token(wxT(":lisp (print 1)"), TS_CODE_LISP)};
+    WHEN("the cell is split") {
+      auto commands = EvaluationQueue::SplitCommands(tokens);
+      THEN("each command ends at its terminator and comments are dropped") {
+        REQUIRE(commands.size() == 3);
+        REQUIRE(commands[0].GetString() == wxT("a:1;"));
+        REQUIRE(commands[0].GetIndex() == 4);
+        REQUIRE(commands[1].GetString() == wxT("b$"));
+        REQUIRE(commands[1].GetIndex() == 14);
+        REQUIRE(commands[2].GetString() == wxT(":lisp (print 1)"));
+        REQUIRE(commands[2].GetIndex() == 30);
+      }
+    }
+  }
+  GIVEN("A last command without a terminator, followed by whitespace") {
+    MaximaTokenizer::TokenList tokens = {
+      Token(wxT("a"), TS_CODE_VARIABLE), Token(wxT(";"), TS_CODE_ENDOFLINE),
+      Token(wxT("sin"), TS_CODE_FUNCTION), Token(wxT("("), TS_CODE_OPERATOR),
+      Token(wxT("x"), TS_CODE_VARIABLE), Token(wxT(")"), TS_CODE_OPERATOR),
+      Token(wxT(" \n"), TS_DEFAULT)};
+    THEN("it is returned as it is unless an ending is asked for") {
+      auto commands = EvaluationQueue::SplitCommands(tokens);
+      REQUIRE(commands.size() == 2);
+      REQUIRE(commands[1].GetString() == wxT("sin(x)"));
+      REQUIRE(commands[1].GetIndex() == 10);
+      commands = EvaluationQueue::SplitCommands(tokens, true);
+      REQUIRE(commands.size() == 2);
+      REQUIRE(commands[0].GetString() == wxT("a;"));
+      REQUIRE(commands[1].GetString() == wxT("sin(x);"));
+    }
+  }
+  GIVEN("A cell that contains only a comment") {
+    MaximaTokenizer::TokenList tokens = {Token(wxT("/* nothing */"), TS_CODE_COMMENT)};
+    THEN("it contains no commands, even if an ending is asked for") {
+      REQUIRE(EvaluationQueue::SplitCommands(tokens).empty());
+      REQUIRE(EvaluationQueue::SplitCommands(tokens, true).empty());
+    }
+  }
+}
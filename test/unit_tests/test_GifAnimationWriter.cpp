@@ -0,0 +1,192 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+#include "GifAnimationWriter.h"
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <random>
+
+/*! Decodes the data sub-blocks LZWCompress() returns
+
+  Follows the gif specification, not the encoder: The code size grows as soon
+  as the dictionary holds 2^codeSize entries and a clear code restarts with
+  9-bit codes and an empty dictionary.
+  \return false if the data is malformed
+ */
+static bool LZWDecompress(const std::vector<unsigned char> &blocks,
+                          std::vector<unsigned char> &pixels,
+                          int &clearCodes, int &maxCodeSize)
+{
+  const int clearCode = 256;
+  const int endCode = 257;
+  std::vector<unsigned char> bytes;
+  size_t pos = 0;
+  while (true)
+  {
+    if (pos >= blocks.size())
+      return false;
+    size_t length = blocks[pos++];
+    if (length == 0)
+      break;
+    if (pos + length > blocks.size())
+      return false;
+    bytes.insert(bytes.end(), blocks.begin() + pos, blocks.begin() + pos + length);
+    pos += length;
+  }
+  if (pos != blocks.size())
+    return false;
+
+  // Each dictionary entry is a known entry followed by one pixel
+  std::vector<int> prefixes(4096, -1);
+  std::vector<unsigned char> suffixes(4096);
+  for (int i = 0; i < 256; i++)
+    suffixes[i] = i;
+  auto expand = [&](int code){
+    std::vector<unsigned char> string;
+    for (; code >= 0; code = prefixes[code])
+      string.push_back(suffixes[code]);
+    std::reverse(string.begin(), string.end());
+    return string;
+  };
+
+  int codeSize = 9;
+  int nextCode = endCode + 1;
+  int previous = -1;
+  size_t bit = 0;
+  pixels.clear();
+  clearCodes = 0;
+  maxCodeSize = codeSize;
+  while (true)
+  {
+    if (bit + codeSize > 8 * bytes.size())
+      return false;
+    int code = 0;
+    for (int i = 0; i < codeSize; i++, bit++)
+      code |= ((bytes[bit / 8] >> (bit % 8)) & 1) << i;
+
+    if (code == endCode)
+      return true;
+    if (code == clearCode)
+    {
+      clearCodes++;
+      codeSize = 9;
+      nextCode = endCode + 1;
+      previous = -1;
+      continue;
+    }
+    std::vector<unsigned char> string;
+    if (previous < 0)
+    {
+      if (code > 255)
+        return false;
+      string = expand(code);
+    }
+    else
+    {
+      if (code < nextCode)
+        string = expand(code);
+      else if (code == nextCode)
+      {
+        string = expand(previous);
+        string.push_back(string.front());
+      }
+      else
+        return false;
+      if (nextCode < 4096)
+      {
+        prefixes[nextCode] = previous;
+        suffixes[nextCode] = string.front();
+        nextCode++;
+      }
+    }
+    pixels.insert(pixels.end(), string.begin(), string.end());
+    previous = code;
+    if ((nextCode == (1 << codeSize)) && (codeSize < 12))
+      maxCodeSize = ++codeSize;
+  }
+}
+
+//! Compresses pixels and checks that decompressing them yields the same pixels
+static void RequireRoundTrip(const std::vector<unsigned char> &pixels,
+                             int &clearCodes, int &maxCodeSize)
+{
+  std::vector<unsigned char> compressed =
+    GifAnimationWriter::LZWCompress(pixels.data(), pixels.size());
+  std::vector<unsigned char> decompressed;
+  REQUIRE(LZWDecompress(compressed, decompressed, clearCodes, maxCodeSize));
+  REQUIRE(decompressed == pixels);
+}
+
+SCENARIO("LZWCompress output can be decompressed") {
+  int clearCodes = 0;
+  int maxCodeSize = 0;
+  GIVEN("No pixels at all") {
+    THEN("only the clear code and the end code are written") {
+      RequireRoundTrip({}, clearCodes, maxCodeSize);
+      REQUIRE(clearCodes == 1);
+    }
+  }
+  GIVEN("A single pixel") {
+    THEN("it survives the round trip") {
+      RequireRoundTrip({42}, clearCodes, maxCodeSize);
+    }
+  }
+  GIVEN("A long run of one color") {
+    std::vector<unsigned char> pixels(100000, 3);
+    THEN("it is compressed well and survives the round trip") {
+      REQUIRE(GifAnimationWriter::LZWCompress(pixels.data(), pixels.size()).size() < 1000);
+      RequireRoundTrip(pixels, clearCodes, maxCodeSize);
+      REQUIRE(maxCodeSize == 10);
+    }
+  }
+  GIVEN("A color gradient") {
+    std::vector<unsigned char> pixels(100000);
+    for (size_t i = 0; i < pixels.size(); i++)
+      pixels[i] = (i / 7) % 256;
+    THEN("the code size grows past 9 bits") {
+      RequireRoundTrip(pixels, clearCodes, maxCodeSize);
+      REQUIRE(maxCodeSize > 9);
+    }
+  }
+  GIVEN("Random noise that fills the dictionary many times") {
+    std::mt19937 random(1);
+    std::vector<unsigned char> pixels(200000);
+    for (auto &pixel : pixels)
+      pixel = random() & 0xff;
+    THEN("the code size reaches 12 bits and the dictionary is cleared") {
+      RequireRoundTrip(pixels, clearCodes, maxCodeSize);
+      REQUIRE(maxCodeSize == 12);
+      REQUIRE(clearCodes > 1);
+    }
+  }
+  GIVEN("Random data with few colors and lengths") {
+    std::mt19937 random(2);
+    THEN("every one of them survives the round trip") {
+      for (int run = 0; run < 100; run++)
+      {
+        std::vector<unsigned char> pixels(random() % 20000);
+        for (auto &pixel : pixels)
+          pixel = random() % (1 + run * 5 % 256);
+        RequireRoundTrip(pixels, clearCodes, maxCodeSize);
+      }
+    }
+  }
+}
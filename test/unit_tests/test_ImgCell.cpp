@@ -28,10 +28,13 @@
 #include "FontCache.cpp"
 #include "Image.cpp"
 #include "ImgCell.cpp"
+#include "ScaledBitmapCache.cpp"
 #include "StringUtils.cpp"
 #include "TextCell.cpp"
+#include "TextExtentCache.cpp"
 #include "TextStyle.cpp"
 #include "VisiblyInvalidCell.cpp"
+#include "ZipArchiveIndex.cpp"
 #include <catch2/catch.hpp>
 
 CellPointers pointers(nullptr);
@@ -0,0 +1,71 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+#include "ManualIndex.h"
+#include <catch2/catch.hpp>
+#include <wx/filefn.h>
+#include <wx/filename.h>
+
+static const char manual[] =
+  "<html><head><style>p.expand { color: red }</style></head><body>\n"
+  "<p>Text that belongs to no section</p>\n"
+  "<span id=\"index-expand\"></span><dt>Function: expand (expr)</dt>\n"
+  "<dd>Expands products &amp; powers. Expand also expands sums.</dd>\n"
+  "<a name=\"g_t_0025pi\"></a><dt>Constant: %pi</dt>\n"
+  "<dd>The ratio of a circle's circumference to its diameter. Not expanded.</dd>\n"
+  "<span id=\"Introduction-to-Lists\"></span><h3>Introduction to Lists</h3>\n";
+
+SCENARIO("ManualIndex finds the anchors of the manual") {
+  GIVEN("A scanned manual") {
+    ManualIndex index;
+    index.Scan(manual, sizeof(manual) - 1);
+    THEN("Only keywords without spaces are found") {
+      ManualIndex::Keywords keywords = index.GetKeywords();
+      REQUIRE(keywords.size() == 1);
+      REQUIRE(keywords[0].first == wxT("%pi"));
+      REQUIRE(keywords[0].second == wxT("g_t_0025pi"));
+    }
+    THEN("The full-text search ranks the sections") {
+      std::vector<ManualIndex::Section> hits = index.Search(wxT("Expand"));
+      REQUIRE(hits.size() == 1);
+      REQUIRE(hits[0].m_id == wxT("index-expand"));
+      REQUIRE(hits[0].m_title == wxT("expand"));
+      REQUIRE(index.Search(wxT("ratio circle")).front().m_id == wxT("g_t_0025pi"));
+    }
+    THEN("Style sheets and text before the first anchor aren't indexed") {
+      REQUIRE(index.Search(wxT("color")).empty());
+      REQUIRE(index.Search(wxT("belongs")).empty());
+    }
+    WHEN("the index is saved and loaded again") {
+      wxString file = wxFileName::CreateTempFileName(wxT("test_ManualIndex"));
+      REQUIRE(index.Save(file, wxT("5.46.0")));
+      ManualIndex loaded;
+      THEN("it finds the same sections") {
+        REQUIRE(loaded.Load(file, wxT("5.46.0")));
+        REQUIRE(loaded.Search(wxT("sums")).front().m_id == wxT("index-expand"));
+      }
+      THEN("it isn't used for a different maxima") {
+        REQUIRE(!loaded.Load(file, wxT("5.47.0")));
+      }
+      wxRemoveFile(file);
+    }
+  }
+}
@@ -0,0 +1,172 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+#include "MaximaOutputScanner.h"
+#include <catch2/catch.hpp>
+
+namespace {
+//! A scanner that knows about a few of the tags wxMaxima uses
+struct TestScanner : public MaximaOutputScanner
+{
+  TestScanner()
+    {
+      math = AddTag(wxT("<mth>"), wxT("</mth>"));
+      prompt = AddTag(wxT("<PROMPT>"), wxT("</PROMPT>"));
+      ipc = AddTag(wxT("<ipc>"), wxT("</ipc>"));
+    }
+  std::size_t math;
+  std::size_t prompt;
+  std::size_t ipc;
+};
+
+/*! Interprets data the way wxMaxima::InterpretCurrentOutput() does
+
+  \return The number of tags found
+ */
+std::size_t Interpret(TestScanner &scanner, wxString &data)
+{
+  std::size_t tags = 0;
+  std::size_t pos = 0;
+  while (pos < data.Length())
+  {
+    std::size_t tag = scanner.TagAt(data, pos);
+    if (tag == MaximaOutputScanner::NoTag)
+    {
+      pos = scanner.MiscTextEnd(data, pos);
+      continue;
+    }
+    std::size_t end = scanner.TagEnd(data, pos, tag);
+    if (end == wxString::npos)
+      break;
+    tags++;
+    pos = end;
+  }
+  data.erase(0, pos);
+  return tags;
+}
+
+/*! Feeds output to the scanner in packets of at least packetSize characters
+
+  Like wxMaxima does we only interpret the data we have received if it ends in a
+  newline: Packets are therefore extended up to the next newline.
+  \param resetBetweenPackets Forget how far the last packet has been searched
+  \return The number of tags found
+ */
+std::size_t Receive(const wxString &output, std::size_t packetSize,
+                    bool resetBetweenPackets = false)
+{
+  TestScanner scanner;
+  wxString data;
+  std::size_t tags = 0;
+  std::size_t pos = 0;
+  while (pos < output.Length())
+  {
+    std::size_t end = output.find(wxT('\n'), pos + packetSize - 1);
+    if (end == wxString::npos)
+      end = output.Length();
+    else
+      end++;
+    data += output.Mid(pos, end - pos);
+    pos = end;
+    if (resetBetweenPackets)
+      scanner.Reset();
+    tags += Interpret(scanner, data);
+  }
+  return tags;
+}
+}
+
+SCENARIO("MaximaOutputScanner recognizes tags") {
+  TestScanner scanner;
+  const wxString data = wxT("x<y<mth>1</mth><PROMPT>(%i2) </PROMPT>");
+  REQUIRE(scanner.TagAt(data, 0) == MaximaOutputScanner::NoTag);
+  REQUIRE(scanner.TagAt(data, 1) == MaximaOutputScanner::NoTag);
+  REQUIRE(scanner.TagAt(data, 3) == scanner.math);
+  REQUIRE(scanner.TagAt(data, 15) == scanner.prompt);
+  REQUIRE(scanner.TagAt(data, data.Length()) == MaximaOutputScanner::NoTag);
+  GIVEN("A tag that has been disabled") {
+    scanner.EnableTag(scanner.math, false);
+    REQUIRE(scanner.TagAt(data, 3) == MaximaOutputScanner::NoTag);
+    scanner.EnableTag(scanner.math, true);
+    REQUIRE(scanner.TagAt(data, 3) == scanner.math);
+  }
+}
+
+SCENARIO("MaximaOutputScanner finds the end of text between tags") {
+  TestScanner scanner;
+  const wxString data = wxT("a<b error<mth>1</mth>");
+  REQUIRE(scanner.MiscTextEnd(data, 0) == 9);
+  REQUIRE(scanner.MiscTextEnd(wxT("no tags <here>"), 0) == 14);
+}
+
+SCENARIO("MaximaOutputScanner finds the end of tags") {
+  TestScanner scanner;
+  const wxString data = wxT("<mth>1</mth><mth>2</mth>");
+  REQUIRE(scanner.TagEnd(data, 0, scanner.math) == 12);
+  REQUIRE(scanner.TagEnd(data, 12, scanner.math) == data.Length());
+}
+
+SCENARIO("MaximaOutputScanner copes with tags that arrive in many packets") {
+  wxString output = wxT("warning\n<mth>");
+  for (int i = 0; i < 300; i++)
+    output += wxT("<n>1</n>\n");
+  output += wxT("</mth>\n<PROMPT>(%i2) </PROMPT>\n");
+  for (std::size_t packetSize : {1, 2, 3, 5, 64})
+  {
+    GIVEN("Packets of " + std::to_string(packetSize) + " characters") {
+      THEN("All tags are found exactly once") {
+        REQUIRE(Receive(output, packetSize) == 2);
+      }
+    }
+  }
+}
+
+/* Scans 50 MB of maxima output that arrives in 64 kB packets.
+
+   Hidden from the normal test run: Use "test_MaximaOutputScanner [benchmark]"
+   to run it.
+ */
+TEST_CASE("MaximaOutputScanner benchmark", "[.][benchmark]") {
+  const std::size_t outputSize = 50 * 1024 * 1024;
+  const std::size_t packetSize = 65536;
+
+  wxString manyTags;
+  while (manyTags.Length() < outputSize)
+    manyTags += wxT("<mth><lbl>(%o1) </lbl><n>12345</n></mth>\n<PROMPT>(%i2) </PROMPT>\n");
+
+  // A matrix with a million entries is one single huge tag.
+  wxString oneTag = wxT("<mth>");
+  while (oneTag.Length() < outputSize)
+    oneTag += wxT("<mtd><n>12345</n></mtd>\n");
+  oneTag += wxT("</mth>\n");
+
+  BENCHMARK("Many small tags") {
+    return Receive(manyTags, packetSize);
+  };
+
+  BENCHMARK("One big tag") {
+    return Receive(oneTag, packetSize);
+  };
+
+  BENCHMARK("One big tag, searched from its start for every packet") {
+    return Receive(oneTag, packetSize, true);
+  };
+}
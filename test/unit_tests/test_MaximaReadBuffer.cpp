@@ -0,0 +1,128 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+#include "MaximaReadBuffer.h"
+#include <wx/mstream.h>
+#include <wx/txtstrm.h>
+#include <algorithm>
+#include <catch2/catch.hpp>
+
+SCENARIO("MaximaReadBuffer decodes plain ASCII") {
+  GIVEN("A buffer with some ASCII text") {
+    MaximaReadBuffer buffer;
+    buffer.Append("<mth>x</mth>\n", 13);
+    WHEN("it is decoded") {
+      wxString text;
+      buffer.DecodeTo(text);
+      THEN("all of the text is returned") {
+        REQUIRE(text == wxT("<mth>x</mth>\n"));
+        REQUIRE(buffer.GetPendingBytes() == 0);
+      }
+    }
+  }
+}
+
+SCENARIO("MaximaReadBuffer drops NUL bytes") {
+  GIVEN("A buffer with NUL bytes in between") {
+    MaximaReadBuffer buffer;
+    buffer.Append("a\0b\0", 4);
+    wxString text;
+    buffer.DecodeTo(text);
+    REQUIRE(text == wxT("ab"));
+  }
+}
+
+SCENARIO("MaximaReadBuffer handles characters split between two reads") {
+  // U+03C0 GREEK SMALL LETTER PI and U+1D70B MATHEMATICAL ITALIC SMALL PI
+  static const char utf8[] = "%\xCF\x80=\xF0\x9D\x9C\x8B";
+  static const std::size_t utf8Len = sizeof(utf8) - 1;
+  const wxString expected = wxString::FromUTF8(utf8, utf8Len);
+  for (std::size_t split = 0; split <= utf8Len; split++)
+  {
+    GIVEN("The data split at byte " + std::to_string(split)) {
+      MaximaReadBuffer buffer;
+      wxString text;
+      buffer.Append(utf8, split);
+      buffer.DecodeTo(text);
+      THEN("Only complete characters are decoded") {
+        REQUIRE(expected.StartsWith(text));
+      }
+      buffer.Append(utf8 + split, utf8Len - split);
+      buffer.DecodeTo(text);
+      THEN("The complete text arrives after the second read") {
+        REQUIRE(text == expected);
+        REQUIRE(buffer.GetPendingBytes() == 0);
+      }
+    }
+  }
+}
+
+SCENARIO("MaximaReadBuffer copes with large amounts of data") {
+  GIVEN("More data than fits into a single block") {
+    MaximaReadBuffer buffer;
+    const std::string line = "<mth><n>12345</n></mth>\n";
+    std::size_t const repetitions = 3 * MaximaReadBuffer::BlockSize / line.size();
+    for (std::size_t i = 0; i < repetitions; i++)
+      buffer.Append(line.data(), line.size());
+    wxString text;
+    buffer.DecodeTo(text);
+    REQUIRE(text.Length() == repetitions * line.size());
+    REQUIRE(text.EndsWith(wxT("</mth>\n")));
+  }
+}
+
+/* Replays 16 MB of maxima output in socket-sized packets.
+
+   Hidden from the normal test run: Use "test_MaximaReadBuffer [benchmark]" to
+   compare the block-wise decoding with the per-character wxTextInputStream
+   the socket used to be read with.
+ */
+TEST_CASE("MaximaReadBuffer replay benchmark", "[.][benchmark]") {
+  std::string transcript;
+  const std::string line = "<mth><lbl>(%o1) </lbl><n>12345</n><h>*</h><v>\xCF\x80</v></mth>\n";
+  while (transcript.size() < 16 * 1024 * 1024)
+    transcript += line;
+
+  BENCHMARK("MaximaReadBuffer, one DecodeTo() per packet") {
+    MaximaReadBuffer buffer;
+    wxString text;
+    for (std::size_t pos = 0; pos < transcript.size(); pos += MaximaReadBuffer::BlockSize)
+    {
+      buffer.Append(transcript.data() + pos,
+                    std::min(MaximaReadBuffer::BlockSize, transcript.size() - pos));
+      buffer.DecodeTo(text);
+    }
+    return text.Length();
+  };
+
+  BENCHMARK("wxTextInputStream::GetChar()") {
+    wxMemoryInputStream stream(transcript.data(), transcript.size());
+    wxTextInputStream textStream(stream, wxT('\t'), wxConvUTF8);
+    wxString text;
+    while (!stream.Eof())
+    {
+      wxChar chr = textStream.GetChar();
+      if (chr != wxT('\0'))
+        text += chr;
+    }
+    return text.Length();
+  };
+}
@@ -0,0 +1,136 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+#include "MaximaTokenizer.h"
+#include <catch2/catch.hpp>
+
+using TokenList = MaximaTokenizer::TokenList;
+
+// The tokenizer only asks the configuration if we are in lisp mode and if
+// asterisks are to be changed to dots.
+Configuration::Configuration(wxDC *dc, InitOpt) : m_dc(dc)
+{
+  m_inLispMode = false;
+  m_changeAsterisk = false;
+}
+Configuration::~Configuration() {}
+
+namespace {
+Configuration configuration;
+
+TokenList Tokenize(const wxString &text)
+{
+  return MaximaTokenizer(text, &configuration).PopTokens();
+}
+
+//! Re-tokenizes text after it has been changed from oldText
+TokenList Retokenize(const wxString &text, const wxString &oldText, TokenList &&oldTokens)
+{
+  return MaximaTokenizer(text, &configuration, oldText, std::move(oldTokens)).PopTokens();
+}
+
+//! The tokens as a string that Catch can show if two token lists differ
+wxString Dump(const TokenList &tokens)
+{
+  wxString dump;
+  for (auto const &token : tokens)
+    dump += wxString::Format(wxT("[%s|%i]"), token.GetText(), int(token.GetStyle()));
+  return dump;
+}
+
+const wxString program =
+  wxT("f(x):=x^2;\n")
+  wxT("/* a comment\n")
+  wxT("   that spans two lines */\n")
+  wxT("s:\"a string\n")
+  wxT("over two lines\";\n")
+  wxT("g(y):=block([a],a:y+1,\n")
+  wxT("  a*2);\n")
+  wxT("h(z);\n")
+  wxT("k:h;\n");
+}
+
+SCENARIO("Re-tokenizing after an edit gives the same tokens as tokenizing everything") {
+  const struct
+  {
+    const char *what;
+    wxString from;
+    wxString to;
+  } edits[] = {
+    {"An edit in the middle of a line", wxT("x^2"), wxT("x^3+sin(x)")},
+    {"An edit in the first line", wxT("f(x)"), wxT("ff(x,y)")},
+    {"An edit in the last line", wxT("k:h;"), wxT("k:h(1);")},
+    {"An inserted newline", wxT("a:y+1,"), wxT("a:\ny+1,")},
+    {"A deleted newline", wxT("a:y+1,\n"), wxT("a:y+1,")},
+    {"Two deleted lines", wxT("g(y):=block([a],a:y+1,\n  a*2);\n"), wxT("")},
+    {"An edit inside a multi-line comment", wxT("that spans"), wxT("that still spans")},
+    {"A newline inside a comment", wxT("a comment"), wxT("a\ncomment")},
+    {"A comment that is closed early", wxT("a comment"), wxT("a */ comment")},
+    {"A comment that is opened", wxT("x^2;"), wxT("x^2; /*")},
+    {"A comment that is no more closed", wxT("two lines */"), wxT("two lines")},
+    {"An edit inside a multi-line string", wxT("over two"), wxT("over 2")},
+    {"A string that is no more closed", wxT("lines\";"), wxT("lines;")},
+    {"A string that is opened", wxT("h(z);"), wxT("h(\"z);")},
+    {"A function name that is split from its argument", wxT("h(z);"), wxT("h\n(z);")},
+    {"A function that becomes a variable", wxT("h(z);"), wxT("h;")},
+  };
+
+  for (auto const &edit : edits)
+  {
+    GIVEN(edit.what) {
+      wxString changed = program;
+      REQUIRE(changed.Replace(edit.from, edit.to, false) == 1);
+      TokenList tokens = Retokenize(changed, program, Tokenize(program));
+      THEN("The tokens are the same as if the whole text was tokenized") {
+        REQUIRE(Dump(tokens) == Dump(Tokenize(changed)));
+      }
+      WHEN("The edit is undone") {
+        TokenList undone = Retokenize(program, changed, std::move(tokens));
+        THEN("The tokens are the same as the original ones") {
+          REQUIRE(Dump(undone) == Dump(Tokenize(program)));
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("Re-tokenizing while a program is typed") {
+  GIVEN("A program that is typed in one character at a time") {
+    wxString text;
+    TokenList tokens;
+    for (auto const &ch : program)
+    {
+      wxString const oldText = text;
+      text += ch;
+      tokens = Retokenize(text, oldText, std::move(tokens));
+      REQUIRE(Dump(tokens) == Dump(Tokenize(text)));
+    }
+    WHEN("It is deleted again from the front") {
+      while (!text.IsEmpty())
+      {
+        wxString const oldText = text;
+        text.erase(0, 1);
+        tokens = Retokenize(text, oldText, std::move(tokens));
+        REQUIRE(Dump(tokens) == Dump(Tokenize(text)));
+      }
+    }
+  }
+}
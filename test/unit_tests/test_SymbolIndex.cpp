@@ -0,0 +1,90 @@
+// -*- mode: c++; c-file-style: "linux"; c-basic-offset: 2; indent-tabs-mode: nil -*-
+//
+//  Copyright (C) 2026 wxMaxima Team (https://wxMaxima-developers.github.io/wxmaxima/)
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; if not, write to the Free Software
+//  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+//
+//  SPDX-License-Identifier: GPL-2.0+
+
+#include "SymbolIndex.h"
+#include <catch2/catch.hpp>
+
+SCENARIO("SymbolIndex finds all symbols with a given prefix") {
+  GIVEN("An index with a few symbols, one of them added twice") {
+    SymbolIndex index;
+    index.Add(wxT("sin"));
+    index.Add(wxT("sinh"));
+    index.Add(wxT("asin"));
+    index.Add(wxT("sinc"));
+    index.Add(wxT("sqrt"));
+    index.Add(wxT("sin"));
+    THEN("the duplicate is stored only once") {
+      REQUIRE(index.GetCount() == 5);
+      REQUIRE(index.Contains(wxT("sinh")));
+      REQUIRE(!index.Contains(wxT("cos")));
+    }
+    WHEN("the symbols starting with \"sin\" are requested") {
+      auto range = index.PrefixRange(wxT("sin"));
+      THEN("exactly these are returned, in sorted order") {
+        auto it = range.first;
+        REQUIRE(it != range.second);
+        REQUIRE(*it++ == wxT("sin"));
+        REQUIRE(*it++ == wxT("sinc"));
+        REQUIRE(*it++ == wxT("sinh"));
+        REQUIRE(it == range.second);
+      }
+    }
+    WHEN("a prefix without matches is requested") {
+      auto range = index.PrefixRange(wxT("cos"));
+      THEN("the range is empty") {
+        REQUIRE(range.first == range.second);
+      }
+    }
+    WHEN("the empty prefix is requested") {
+      auto range = index.PrefixRange(wxEmptyString);
+      THEN("all symbols are returned") {
+        REQUIRE(std::distance(range.first, range.second) == 5);
+      }
+    }
+  }
+}
+
+SCENARIO("StaticSymbolTable finds all symbols with a given prefix") {
+  GIVEN("A sorted table like the generated ones") {
+    static const char *const symbols[] = {"asin", "sin", "sinc", "sinh", "sqrt"};
+    StaticSymbolTable table(symbols);
+    THEN("it knows exactly its symbols") {
+      REQUIRE(table.GetCount() == 5);
+      REQUIRE(table.Contains(wxT("sinh")));
+      REQUIRE(!table.Contains(wxT("si")));
+      REQUIRE(!table.Contains(wxT("cos")));
+    }
+    WHEN("the symbols starting with \"sin\" are requested") {
+      auto range = table.PrefixRange(wxT("sin"));
+      THEN("exactly these are returned, in sorted order") {
+        REQUIRE(std::distance(range.first, range.second) == 3);
+        REQUIRE(wxString(*range.first) == wxT("sin"));
+        REQUIRE(wxString(*(range.second - 1)) == wxT("sinh"));
+      }
+    }
+    WHEN("a prefix without matches is requested") {
+      auto range = table.PrefixRange(wxT("zeta"));
+      THEN("the range is empty") {
+        REQUIRE(range.first == range.second);
+      }
+    }
+  }
+}